@@ -0,0 +1,365 @@
+//
+//  AssetMappingStore.cpp
+//  assignment-client/src/assets
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AssetMappingStore.h"
+
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QSaveFile>
+
+#include "AssetServerLogging.h"
+
+static const QString MAP_FILE_NAME = "map.json";
+static const QString JOURNAL_FILE_NAME = "map.journal";
+
+// number of journaled transactions after which the full map file is rewritten
+static const int JOURNAL_CHECKPOINT_TRANSACTIONS = 256;
+
+// number of changed paths remembered for clients asking for the changes since their last sync
+static const size_t MAX_CHANGE_LOG_SIZE = 100000;
+
+AssetMappingStore::~AssetMappingStore() {
+    if (_journalTransactions > 0) {
+        checkpoint();
+    }
+}
+
+bool AssetMappingStore::load(const QDir& resourcesDirectory) {
+    _mapFilePath = resourcesDirectory.absoluteFilePath(MAP_FILE_NAME);
+    _journal.setFileName(resourcesDirectory.absoluteFilePath(JOURNAL_FILE_NAME));
+    // versions and the change log only live in memory, so the clients of a previous run need a full snapshot
+    _historyID = QUuid::createUuid();
+
+    QFile mapFile { _mapFilePath };
+    if (mapFile.exists()) {
+        if (!mapFile.open(QIODevice::ReadOnly)) {
+            qCCritical(asset_server) << "Failed to read mapping file at" << _mapFilePath;
+            return false;
+        }
+
+        QJsonParseError error;
+        auto jsonDocument = QJsonDocument::fromJson(mapFile.readAll(), &error);
+
+        if (error.error != QJsonParseError::NoError) {
+            qCCritical(asset_server) << "Failed to read mapping file at" << _mapFilePath;
+            return false;
+        }
+
+        if (!jsonDocument.isObject()) {
+            qCWarning(asset_server) << "Failed to read mapping file, root value in" << _mapFilePath << "is not an object";
+            return false;
+        }
+
+        auto root = jsonDocument.object();
+        for (auto it = root.begin(); it != root.end(); ++it) {
+            auto key = it.key();
+            auto value = it.value();
+
+            if (!value.isString()) {
+                qCWarning(asset_server) << "Skipping" << key << ":" << value << "because it is not a string";
+                continue;
+            }
+
+            if (!AssetUtils::isValidFilePath(key)) {
+                qCWarning(asset_server) << "Will not keep mapping for" << key << "since it is not a valid path.";
+                continue;
+            }
+
+            if (!AssetUtils::isValidHash(value.toString())) {
+                qCWarning(asset_server) << "Will not keep mapping for" << key << "since it does not have a valid hash.";
+                continue;
+            }
+
+            apply(key, value.toString());
+        }
+
+        qCInfo(asset_server) << "Loaded" << _mappings.size() << "mappings from map file at" << _mapFilePath;
+    } else {
+        qCInfo(asset_server) << "No existing mappings loaded from file since no file was found at" << _mapFilePath;
+    }
+
+    if (!replayJournal()) {
+        return false;
+    }
+
+    if (!_journal.open(QIODevice::WriteOnly | QIODevice::Append)) {
+        qCCritical(asset_server) << "Failed to open mapping journal at" << _journal.fileName();
+        return false;
+    }
+
+    return true;
+}
+
+bool AssetMappingStore::replayJournal() {
+    if (!_journal.exists()) {
+        return true;
+    }
+
+    if (!_journal.open(QIODevice::ReadOnly)) {
+        qCCritical(asset_server) << "Failed to read mapping journal at" << _journal.fileName();
+        return false;
+    }
+
+    int numReplayed = 0;
+    // the end of the last complete line, every entry is written with its line break
+    qint64 completeSize = 0;
+    while (!_journal.atEnd()) {
+        auto rawLine = _journal.readLine();
+        bool isComplete = rawLine.endsWith('\n');
+        auto line = rawLine.trimmed();
+        if (line.isEmpty()) {
+            if (isComplete) {
+                completeSize = _journal.pos();
+            }
+            continue;
+        }
+
+        if (!isComplete) {
+            // only the last line can miss its line break: the server stopped while writing this entry, so the
+            // transaction was never acknowledged
+            qCWarning(asset_server) << "Ignoring incomplete entry at the end of mapping journal" << _journal.fileName();
+            break;
+        }
+        completeSize = _journal.pos();
+
+        QJsonParseError error;
+        auto jsonDocument = QJsonDocument::fromJson(line, &error);
+        if (error.error != QJsonParseError::NoError || !jsonDocument.isObject()) {
+            // the transactions after this one were acknowledged, so keep replaying them
+            qCWarning(asset_server) << "Skipping corrupt entry ending at" << completeSize << "in mapping journal"
+                                    << _journal.fileName();
+            continue;
+        }
+
+        auto changes = jsonDocument.object();
+        for (auto it = changes.begin(); it != changes.end(); ++it) {
+            auto value = it.value();
+            if (value.isNull()) {
+                apply(it.key(), AssetUtils::AssetHash());
+            } else if (AssetUtils::isValidFilePath(it.key()) && AssetUtils::isValidHash(value.toString())) {
+                apply(it.key(), value.toString());
+            }
+        }
+        ++numReplayed;
+    }
+    bool isTorn = completeSize < _journal.size();
+    _journal.close();
+
+    // drop the incomplete entry, or the entries appended from now on would follow it on the same line and be lost
+    // with it on the next replay
+    if (isTorn && !_journal.resize(completeSize)) {
+        qCCritical(asset_server) << "Failed to truncate the incomplete entry of mapping journal at" << _journal.fileName();
+        return false;
+    }
+
+    if (numReplayed > 0) {
+        qCInfo(asset_server) << "Replayed" << numReplayed << "transactions from mapping journal at" << _journal.fileName();
+
+        // fold the journal into the map file so we start from an empty journal
+        if (!checkpoint()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool AssetMappingStore::checkpoint() {
+    QSaveFile mapFile { _mapFilePath };
+    if (!mapFile.open(QIODevice::WriteOnly)) {
+        qCWarning(asset_server) << "Failed to open map file at" << _mapFilePath;
+        return false;
+    }
+
+    QJsonObject root;
+    for (const auto& mapping : _mappings) {
+        root[mapping.first] = mapping.second;
+    }
+
+    QJsonDocument jsonDocument { root };
+
+    if (mapFile.write(jsonDocument.toJson()) == -1) {
+        qCWarning(asset_server) << "Failed to write JSON mappings to file at" << _mapFilePath;
+        return false;
+    }
+
+    if (!mapFile.commit()) {
+        qCWarning(asset_server) << "Failed to commit JSON mappings to file at" << _mapFilePath;
+        return false;
+    }
+
+    // everything in the journal is now in the map file, replaying it again would be harmless
+    // but there is no reason to keep it around
+    if (!_journal.resize(0)) {
+        qCWarning(asset_server) << "Failed to clear mapping journal at" << _journal.fileName();
+    }
+    _journalTransactions = 0;
+
+    qCDebug(asset_server) << "Wrote" << _mappings.size() << "JSON mappings to file at" << _mapFilePath;
+    return true;
+}
+
+AssetUtils::AssetHash AssetMappingStore::getHash(const AssetUtils::AssetPath& path) const {
+    auto it = _mappings.find(path);
+    return it != _mappings.end() ? it->second : AssetUtils::AssetHash();
+}
+
+AssetUtils::AssetPathList AssetMappingStore::getPathsInFolder(const AssetUtils::AssetPath& folderPath) const {
+    AssetUtils::AssetPathList paths;
+    for (auto it = _mappings.lower_bound(folderPath); it != _mappings.end() && it->first.startsWith(folderPath); ++it) {
+        paths << it->first;
+    }
+    return paths;
+}
+
+void AssetMappingStore::apply(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& hash) {
+    auto it = _mappings.find(path);
+    if (it != _mappings.end()) {
+        auto indexIt = _pathsByHash.find(it->second);
+        if (indexIt != _pathsByHash.end()) {
+            indexIt->remove(path);
+            if (indexIt->isEmpty()) {
+                _pathsByHash.erase(indexIt);
+            }
+        }
+
+        if (hash.isEmpty()) {
+            _mappings.erase(it);
+            return;
+        }
+        it->second = hash;
+    } else if (hash.isEmpty()) {
+        return;
+    } else {
+        _mappings[path] = hash;
+    }
+
+    _pathsByHash[hash].insert(path);
+}
+
+void AssetMappingStore::beginTransaction() {
+    Q_ASSERT(!_inTransaction);
+    _inTransaction = true;
+    _transactionUndo.clear();
+}
+
+void AssetMappingStore::set(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& hash) {
+    Q_ASSERT(_inTransaction);
+    Q_ASSERT(!hash.isEmpty());
+
+    if (!_transactionUndo.contains(path)) {
+        _transactionUndo[path] = getHash(path);
+    }
+    apply(path, hash);
+}
+
+bool AssetMappingStore::remove(const AssetUtils::AssetPath& path) {
+    Q_ASSERT(_inTransaction);
+
+    auto oldHash = getHash(path);
+    if (oldHash.isEmpty()) {
+        return false;
+    }
+
+    if (!_transactionUndo.contains(path)) {
+        _transactionUndo[path] = oldHash;
+    }
+    apply(path, AssetUtils::AssetHash());
+    return true;
+}
+
+bool AssetMappingStore::commitTransaction() {
+    Q_ASSERT(_inTransaction);
+
+    // only keep what actually changed, a path set then removed in the same transaction is not a change
+    QHash<AssetUtils::AssetPath, AssetUtils::AssetHash> changes;
+    for (auto it = _transactionUndo.cbegin(); it != _transactionUndo.cend(); ++it) {
+        auto newHash = getHash(it.key());
+        if (newHash != it.value()) {
+            changes[it.key()] = newHash;
+        }
+    }
+
+    if (changes.isEmpty()) {
+        _transactionUndo.clear();
+        _inTransaction = false;
+        return true;
+    }
+
+    if (!appendToJournal(changes)) {
+        qCWarning(asset_server) << "Failed to persist" << changes.size() << "mapping changes, rolling back";
+        rollbackTransaction();
+        return false;
+    }
+
+    ++_version;
+    for (auto it = changes.cbegin(); it != changes.cend(); ++it) {
+        _changeLog.push_back({ _version, it.key() });
+    }
+    while (_changeLog.size() > MAX_CHANGE_LOG_SIZE) {
+        _trimmedVersion = _changeLog.front().version;
+        _changeLog.pop_front();
+    }
+
+    _transactionUndo.clear();
+    _inTransaction = false;
+
+    if (++_journalTransactions >= JOURNAL_CHECKPOINT_TRANSACTIONS) {
+        // a failed checkpoint is not fatal, the changes are still in the journal
+        checkpoint();
+    }
+
+    return true;
+}
+
+void AssetMappingStore::rollbackTransaction() {
+    Q_ASSERT(_inTransaction);
+
+    for (auto it = _transactionUndo.cbegin(); it != _transactionUndo.cend(); ++it) {
+        apply(it.key(), it.value());
+    }
+
+    _transactionUndo.clear();
+    _inTransaction = false;
+}
+
+bool AssetMappingStore::appendToJournal(const QHash<AssetUtils::AssetPath, AssetUtils::AssetHash>& changes) {
+    QJsonObject entry;
+    for (auto it = changes.cbegin(); it != changes.cend(); ++it) {
+        entry[it.key()] = it.value().isEmpty() ? QJsonValue() : QJsonValue(it.value());
+    }
+
+    auto line = QJsonDocument(entry).toJson(QJsonDocument::Compact);
+    line.append('\n');
+
+    auto previousSize = _journal.size();
+    if (_journal.write(line) != line.size() || !_journal.flush()) {
+        qCWarning(asset_server) << "Failed to write to mapping journal at" << _journal.fileName();
+
+        // don't leave a partial entry behind, it would hide every entry written after it
+        _journal.resize(previousSize);
+        return false;
+    }
+
+    return true;
+}
+
+bool AssetMappingStore::getChangesSince(const QUuid& historyID, Version sinceVersion,
+                                        QSet<AssetUtils::AssetPath>& changedPaths) const {
+    if (historyID != _historyID || sinceVersion > _version || sinceVersion < _trimmedVersion) {
+        return false;
+    }
+
+    for (auto it = _changeLog.crbegin(); it != _changeLog.crend() && it->version > sinceVersion; ++it) {
+        changedPaths.insert(it->path);
+    }
+
+    return true;
+}
@@ -0,0 +1,105 @@
+//
+//  AssetMappingStore.h
+//  assignment-client/src/assets
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AssetMappingStore_h
+#define hifi_AssetMappingStore_h
+
+#include <deque>
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QHash>
+#include <QtCore/QSet>
+#include <QtCore/QUuid>
+
+#include "AssetUtils.h"
+
+// Path => hash mappings of the asset server.
+//
+// The mappings are kept sorted by path, so the mappings below a folder are a contiguous range that
+// is found with a single lookup. A reverse index answers "which paths use this hash" without a scan.
+//
+// Changes are made in transactions. Each committed transaction is appended to a journal next to the
+// map file and gets a new version number; the full map file is only rewritten once the journal grows
+// past a threshold, or when the store is closed. A transaction that fails to reach the journal is
+// rolled back in memory.
+//
+// The versions of recent changes are remembered so that clients can ask for what changed since the
+// version they last saw instead of downloading every mapping again.
+class AssetMappingStore {
+public:
+    using Version = uint64_t;
+
+    ~AssetMappingStore();
+
+    // Loads the map file and replays the journal found in the directory. Must be called before any other method.
+    bool load(const QDir& resourcesDirectory);
+
+    // Writes the full map file and clears the journal
+    bool checkpoint();
+
+    const AssetUtils::Mappings& getMappings() const { return _mappings; }
+    size_t size() const { return _mappings.size(); }
+
+    // Returns an empty hash if there is no mapping for this path
+    AssetUtils::AssetHash getHash(const AssetUtils::AssetPath& path) const;
+    bool contains(const AssetUtils::AssetPath& path) const { return _mappings.find(path) != _mappings.end(); }
+
+    QSet<AssetUtils::AssetPath> getPathsForHash(const AssetUtils::AssetHash& hash) const { return _pathsByHash.value(hash); }
+    bool isHashMapped(const AssetUtils::AssetHash& hash) const { return _pathsByHash.contains(hash); }
+    QList<AssetUtils::AssetHash> getMappedHashes() const { return _pathsByHash.keys(); }
+
+    // All the mappings whose path starts with folderPath, which must end with a slash
+    AssetUtils::AssetPathList getPathsInFolder(const AssetUtils::AssetPath& folderPath) const;
+
+    void beginTransaction();
+    void set(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& hash);
+    bool remove(const AssetUtils::AssetPath& path);
+    // Persists the changes made since beginTransaction, or rolls them back if that fails
+    bool commitTransaction();
+    void rollbackTransaction();
+
+    // Identifies this run of the store, versions from a different history can't be compared with ours
+    QUuid getHistoryID() const { return _historyID; }
+    Version getVersion() const { return _version; }
+
+    // Fills the paths changed after sinceVersion (set or removed) and returns true,
+    // or returns false if the changes are too old to be known and a full snapshot is needed.
+    bool getChangesSince(const QUuid& historyID, Version sinceVersion, QSet<AssetUtils::AssetPath>& changedPaths) const;
+
+private:
+    void apply(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& hash);
+    bool replayJournal();
+    bool appendToJournal(const QHash<AssetUtils::AssetPath, AssetUtils::AssetHash>& changes);
+
+    struct Change {
+        Version version;
+        AssetUtils::AssetPath path;
+    };
+
+    AssetUtils::Mappings _mappings;
+    QHash<AssetUtils::AssetHash, QSet<AssetUtils::AssetPath>> _pathsByHash;
+
+    QString _mapFilePath;
+    QFile _journal;
+    int _journalTransactions { 0 };
+
+    bool _inTransaction { false };
+    // the value each path had before the current transaction, empty if it wasn't mapped
+    QHash<AssetUtils::AssetPath, AssetUtils::AssetHash> _transactionUndo;
+
+    QUuid _historyID;
+    Version _version { 0 };
+    // changes up to this version may have been dropped from the change log
+    Version _trimmedVersion { 0 };
+    std::deque<Change> _changeLog;
+};
+
+#endif // hifi_AssetMappingStore_h
@@ -23,8 +23,8 @@
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
 #include <QtCore/QJsonDocument>
-#include <QtCore/QSaveFile>
 #include <QtCore/QString>
+#include <QtCore/QTimer>
 #include <QtGui/QImageReader>
 #include <QtCore/QVector>
 #include <QtCore/QUrlQuery>
@@ -33,6 +33,7 @@
 #include <NodeType.h>
 #include <SharedUtil.h>
 #include <PathUtils.h>
+#include <UUID.h>
 #include <image/TextureProcessing.h>
 
 #include "AssetServerLogging.h"
@@ -166,9 +167,9 @@ std::pair<AssetUtils::BakingStatus, QString> AssetServer::getAssetStatus(const A
         bakedPath = meta.redirectTarget;
     }
 
-    auto jt = _fileMappings.find(bakedPath);
-    if (jt != _fileMappings.end()) {
-        if (jt->second == hash) {
+    auto bakedHash = _mappingStore.getHash(bakedPath);
+    if (!bakedHash.isEmpty()) {
+        if (bakedHash == hash) {
             return { AssetUtils::NotBaked, "" };
         } else {
             return { AssetUtils::Baked, "" };
@@ -181,11 +182,10 @@ std::pair<AssetUtils::BakingStatus, QString> AssetServer::getAssetStatus(const A
 }
 
 void AssetServer::bakeAssets() {
-    auto it = _fileMappings.cbegin();
-    for (; it != _fileMappings.cend(); ++it) {
-        auto path = it->first;
-        auto hash = it->second;
-        maybeBake(path, hash);
+    // maybeBake can add mappings, iterate over a copy
+    auto mappings = _mappingStore.getMappings();
+    for (const auto& mapping : mappings) {
+        maybeBake(mapping.first, mapping.second);
     }
 }
 
@@ -212,7 +212,7 @@ void AssetServer::createEmptyMetaFile(const AssetUtils::AssetHash& hash) {
 bool AssetServer::hasMetaFile(const AssetUtils::AssetHash& hash) {
     QString metaFilePath = AssetUtils::HIDDEN_BAKED_CONTENT_FOLDER + hash + "/meta.json";
 
-    return _fileMappings.find(metaFilePath) != _fileMappings.end();
+    return _mappingStore.contains(metaFilePath);
 }
 
 bool AssetServer::needsToBeBaked(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& assetHash) {
@@ -236,12 +236,12 @@ bool AssetServer::needsToBeBaked(const AssetUtils::AssetPath& path, const AssetU
         bakedPath = meta.redirectTarget;
     }
 
-    auto mappingIt = _fileMappings.find(bakedPath);
-    bool bakedMappingExists = mappingIt != _fileMappings.end();
+    auto bakedHash = _mappingStore.getHash(bakedPath);
+    bool bakedMappingExists = !bakedHash.isEmpty();
 
     // If the path is mapped to the original file's hash, baking has been disabled for this
     // asset
-    if (bakedMappingExists && mappingIt->second == assetHash) {
+    if (bakedMappingExists && bakedHash == assetHash) {
         return false;
     }
 
@@ -364,6 +364,10 @@ void AssetServer::run() {
 }
 
 static const QString ASSET_FILES_SUBDIR = "files";
+static const QString PARTIAL_UPLOADS_SUBDIR = "uploads";
+static const qint64 PARTIAL_UPLOAD_MAX_AGE_SECS = 7 * 24 * 60 * 60;
+static const int PARTIAL_UPLOAD_PRUNE_INTERVAL_MS = 60 * 60 * 1000;
+static const uint64_t MAX_PARTIAL_UPLOADS_SIZE = 4 * AssetUtils::MAX_UPLOAD_SIZE;
 
 void AssetServer::completeSetup() {
     auto nodeList = DependencyManager::get<NodeList>();
@@ -425,8 +429,25 @@ void AssetServer::completeSetup() {
         return;
     }
 
+    QDir partialUploadsDirectory = _resourcesDirectory;
+    if (!_resourcesDirectory.mkpath(PARTIAL_UPLOADS_SUBDIR) || !partialUploadsDirectory.cd(PARTIAL_UPLOADS_SUBDIR)) {
+        qCCritical(asset_server) << "Unable to create upload directory for asset-server files. Stopping assignment.";
+        setFinished(true);
+        return;
+    }
+
+    // uploads that weren't resumed in a while most likely never will be
+    _partialUploads = std::make_shared<PartialUploads>(_filesDirectory, partialUploadsDirectory, MAX_PARTIAL_UPLOADS_SIZE);
+    _partialUploads->removeStale(PARTIAL_UPLOAD_MAX_AGE_SECS);
+    QTimer* pruneTimer = new QTimer(this);
+    connect(pruneTimer, &QTimer::timeout, this, [this] {
+        _partialUploads->removeStale(PARTIAL_UPLOAD_MAX_AGE_SECS);
+    });
+    pruneTimer->setTimerType(Qt::CoarseTimer);
+    pruneTimer->start(PARTIAL_UPLOAD_PRUNE_INTERVAL_MS);
+
     // load whatever mappings we currently have from the local file
-    if (loadMappingsFromFile()) {
+    if (_mappingStore.load(_resourcesDirectory)) {
         qCInfo(asset_server) << "Serving files from: " << _filesDirectory.path();
 
         // Check the asset directory to output some information about what we have
@@ -437,7 +458,7 @@ void AssetServer::completeSetup() {
 
         qCInfo(asset_server) << "There are" << hashedFiles.size() << "asset files in the asset directory.";
 
-        if (_fileMappings.size() > 0) {
+        if (_mappingStore.size() > 0) {
             cleanupUnmappedFiles();
             cleanupBakedFilesForDeletedAssets();
         }
@@ -532,14 +553,7 @@ void AssetServer::cleanupUnmappedFiles() {
     for (const auto& fileInfo : files) {
         auto filename = fileInfo.fileName();
         if (hashFileRegex.exactMatch(filename)) {
-            bool matched { false };
-            for (auto& pair : _fileMappings) {
-                if (pair.second == filename) {
-                    matched = true;
-                    break;
-                }
-            }
-            if (!matched) {
+            if (!_mappingStore.isHashMapped(filename)) {
                 // remove the unmapped file
                 QFile removeableFile { fileInfo.absoluteFilePath() };
 
@@ -560,27 +574,20 @@ void AssetServer::cleanupBakedFilesForDeletedAssets() {
 
     std::set<AssetUtils::AssetHash> bakedHashes;
 
-    for (const auto& it : _fileMappings) {
-        // check if this is a mapping to baked content
-        if (it.first.startsWith(AssetUtils::HIDDEN_BAKED_CONTENT_FOLDER)) {
-            // extract the hash from the baked mapping
-            AssetUtils::AssetHash hash = it.first.mid(AssetUtils::HIDDEN_BAKED_CONTENT_FOLDER.length(),
-                                                      AssetUtils::SHA256_HASH_HEX_LENGTH);
+    // the baked mappings are all below the hidden baked folder
+    for (const auto& bakedPath : _mappingStore.getPathsInFolder(AssetUtils::HIDDEN_BAKED_CONTENT_FOLDER)) {
+        // extract the hash from the baked mapping
+        AssetUtils::AssetHash hash = bakedPath.mid(AssetUtils::HIDDEN_BAKED_CONTENT_FOLDER.length(),
+                                                   AssetUtils::SHA256_HASH_HEX_LENGTH);
 
-            // add the hash to our set of hashes for which we have baked content
-            bakedHashes.insert(hash);
-        }
+        // add the hash to our set of hashes for which we have baked content
+        bakedHashes.insert(hash);
     }
 
     // enumerate the hashes for which we have baked content
     for (const auto& hash : bakedHashes) {
         // check if we have a mapping that points to this hash
-        auto matchingMapping = std::find_if(std::begin(_fileMappings), std::end(_fileMappings),
-                                            [&hash](const std::pair<AssetUtils::AssetPath, AssetUtils::AssetHash> mappingPair) {
-            return mappingPair.second == hash;
-        });
-
-        if (matchingMapping == std::end(_fileMappings)) {
+        if (!_mappingStore.isHashMapped(hash)) {
             // we didn't find a mapping for this hash, remove any baked content we still have for it
             removeBakedPathsForDeletedAsset(hash);
         }
@@ -611,6 +618,9 @@ void AssetServer::handleAssetMappingOperation(QSharedPointer<ReceivedMessage> me
         case AssetMappingOperationType::GetAll:
             handleGetAllMappingOperation(*replyPacket);
             break;
+        case AssetMappingOperationType::GetChanges:
+            handleGetMappingChangesOperation(*message, *replyPacket);
+            break;
         case AssetMappingOperationType::Set:
             handleSetMappingOperation(*message, canWriteToAssetServer, *replyPacket);
             break;
@@ -639,11 +649,10 @@ void AssetServer::handleGetMappingOperation(ReceivedMessage& message, NLPacketLi
     QUrl url { assetPath };
     assetPath = url.path();
 
-    auto it = _fileMappings.find(assetPath);
-    if (it != _fileMappings.end()) {
+    auto originalAssetHash = _mappingStore.getHash(assetPath);
+    if (!originalAssetHash.isEmpty()) {
 
         // check if we should re-direct to a baked asset
-        auto originalAssetHash = it->second;
         QString redirectedAssetHash;
         quint8 wasRedirected = false;
         bool bakingDisabled = false;
@@ -660,12 +669,12 @@ void AssetServer::handleGetMappingOperation(ReceivedMessage& message, NLPacketLi
             bakedAssetPath = meta.redirectTarget;
         }
 
-        auto bakedIt = _fileMappings.find(bakedAssetPath);
-        if (bakedIt != _fileMappings.end()) {
-            if (bakedIt->second != originalAssetHash) {
+        auto bakedAssetHash = _mappingStore.getHash(bakedAssetPath);
+        if (!bakedAssetHash.isEmpty()) {
+            if (bakedAssetHash != originalAssetHash) {
                 qDebug() << "Did find baked version for: " << originalAssetHash << assetPath;
                 // we found a baked version of the requested asset to serve, redirect to that
-                redirectedAssetHash = bakedIt->second;
+                redirectedAssetHash = bakedAssetHash;
                 wasRedirected = true;
             } else {
                 qDebug() << "Did not find baked version for: " << originalAssetHash << assetPath << " (disabled)";
@@ -706,26 +715,88 @@ void AssetServer::handleGetMappingOperation(ReceivedMessage& message, NLPacketLi
     }
 }
 
+void AssetServer::writeMappingWithStatus(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& hash,
+                                         NLPacketList& replyPacket) {
+    replyPacket.writeString(path);
+    replyPacket.write(QByteArray::fromHex(hash.toUtf8()));
+
+    AssetUtils::BakingStatus status;
+    QString lastBakeErrors;
+    std::tie(status, lastBakeErrors) = getAssetStatus(path, hash);
+    replyPacket.writePrimitive(status);
+    if (status == AssetUtils::Error) {
+        replyPacket.writeString(lastBakeErrors);
+    }
+}
+
 void AssetServer::handleGetAllMappingOperation(NLPacketList& replyPacket) {
     replyPacket.writePrimitive(AssetUtils::AssetServerError::NoError);
 
-    uint32_t count = (uint32_t)_fileMappings.size();
+    uint32_t count = (uint32_t)_mappingStore.size();
 
     replyPacket.writePrimitive(count);
 
-    for (auto it = _fileMappings.cbegin(); it != _fileMappings.cend(); ++ it) {
-        auto mapping = it->first;
-        auto hash = it->second;
-        replyPacket.writeString(mapping);
-        replyPacket.write(QByteArray::fromHex(hash.toUtf8()));
-
-        AssetUtils::BakingStatus status;
-        QString lastBakeErrors;
-        std::tie(status, lastBakeErrors) = getAssetStatus(mapping, hash);
-        replyPacket.writePrimitive(status);
-        if (status == AssetUtils::Error) {
-            replyPacket.writeString(lastBakeErrors);
+    for (const auto& mapping : _mappingStore.getMappings()) {
+        writeMappingWithStatus(mapping.first, mapping.second, replyPacket);
+    }
+}
+
+void AssetServer::handleGetMappingChangesOperation(ReceivedMessage& message, NLPacketList& replyPacket) {
+    QUuid historyID = QUuid::fromRfc4122(message.read(NUM_BYTES_RFC4122_UUID));
+    AssetMappingStore::Version sinceVersion;
+    message.readPrimitive(&sinceVersion);
+
+    replyPacket.writePrimitive(AssetUtils::AssetServerError::NoError);
+    replyPacket.write(_mappingStore.getHistoryID().toRfc4122());
+    replyPacket.writePrimitive(_mappingStore.getVersion());
+
+    QSet<AssetUtils::AssetPath> changedPaths;
+    quint8 isFullSnapshot = !_mappingStore.getChangesSince(historyID, sinceVersion, changedPaths);
+    replyPacket.writePrimitive(isFullSnapshot);
+
+    if (isFullSnapshot) {
+        replyPacket.writePrimitive((uint32_t)_mappingStore.size());
+        for (const auto& mapping : _mappingStore.getMappings()) {
+            writeMappingWithStatus(mapping.first, mapping.second, replyPacket);
+        }
+        return;
+    }
+
+    // The baking status of an asset is derived from mappings in the hidden baked folder and from the pending bakes,
+    // so also send the assets whose baked content changed, and those currently waiting on a bake.
+    QSet<AssetUtils::AssetPath> pathsToSend;
+    for (const auto& path : changedPaths) {
+        if (path.startsWith(AssetUtils::HIDDEN_BAKED_CONTENT_FOLDER)) {
+            auto hash = path.mid(AssetUtils::HIDDEN_BAKED_CONTENT_FOLDER.length(), AssetUtils::SHA256_HASH_HEX_LENGTH);
+            pathsToSend.unite(_mappingStore.getPathsForHash(hash));
         }
+        pathsToSend.insert(path);
+    }
+    for (auto it = _pendingBakes.cbegin(); it != _pendingBakes.cend(); ++it) {
+        pathsToSend.unite(_mappingStore.getPathsForHash(it.key()));
+    }
+
+    AssetUtils::AssetPathList removedPaths;
+    uint32_t numChangedMappings = 0;
+    for (const auto& path : pathsToSend) {
+        if (_mappingStore.contains(path)) {
+            ++numChangedMappings;
+        } else {
+            removedPaths << path;
+        }
+    }
+
+    replyPacket.writePrimitive(numChangedMappings);
+    for (const auto& path : pathsToSend) {
+        auto hash = _mappingStore.getHash(path);
+        if (!hash.isEmpty()) {
+            writeMappingWithStatus(path, hash, replyPacket);
+        }
+    }
+
+    replyPacket.writePrimitive((uint32_t)removedPaths.size());
+    for (const auto& path : removedPaths) {
+        replyPacket.writeString(path);
     }
 }
 
@@ -886,7 +957,7 @@ void AssetServer::handleAssetUpload(QSharedPointer<ReceivedMessage> message, Sha
     if (canWriteToAssetServer) {
         qCDebug(asset_server) << "Starting an UploadAssetTask for upload from" << message->getSourceID();
 
-        auto task = new UploadAssetTask(message, senderNode, _filesDirectory, _filesizeLimit);
+        auto task = new UploadAssetTask(message, senderNode, _partialUploads, _filesizeLimit);
         _transferTaskPool.start(task);
     } else {
         // this is a node the domain told us is not allowed to rez entities
@@ -969,95 +1040,6 @@ void AssetServer::sendStatsPacket() {
     ThreadedAssignment::addPacketStatsAndSendStatsPacket(serverStats);
 }
 
-static const QString MAP_FILE_NAME = "map.json";
-
-bool AssetServer::loadMappingsFromFile() {
-
-    auto mapFilePath = _resourcesDirectory.absoluteFilePath(MAP_FILE_NAME);
-
-    QFile mapFile { mapFilePath };
-    if (mapFile.exists()) {
-        if (mapFile.open(QIODevice::ReadOnly)) {
-            QJsonParseError error;
-
-            auto jsonDocument = QJsonDocument::fromJson(mapFile.readAll(), &error);
-
-            if (error.error == QJsonParseError::NoError) {
-                if (!jsonDocument.isObject()) {
-                    qCWarning(asset_server) << "Failed to read mapping file, root value in" << mapFilePath << "is not an object";
-                    return false;
-                }
-
-                //_fileMappings = jsonDocument.object().toVariantHash();
-                auto root = jsonDocument.object();
-                for (auto it = root.begin(); it != root.end(); ++it) {
-                    auto key = it.key();
-                    auto value = it.value();
-
-                    if (!value.isString()) {
-                        qCWarning(asset_server) << "Skipping" << key << ":" << value << "because it is not a string";
-                        continue;
-                    }
-
-                    if (!AssetUtils::isValidFilePath(key)) {
-                        qCWarning(asset_server) << "Will not keep mapping for" << key << "since it is not a valid path.";
-                        continue;
-                    }
-
-                    if (!AssetUtils::isValidHash(value.toString())) {
-                        qCWarning(asset_server) << "Will not keep mapping for" << key << "since it does not have a valid hash.";
-                        continue;
-                    }
-
-
-                    qDebug() << "Added " << key << value.toString();
-                    _fileMappings[key] = value.toString();
-                }
-
-                qCInfo(asset_server) << "Loaded" << _fileMappings.size() << "mappings from map file at" << mapFilePath;
-                return true;
-            }
-        }
-
-        qCCritical(asset_server) << "Failed to read mapping file at" << mapFilePath;
-        return false;
-    } else {
-        qCInfo(asset_server) << "No existing mappings loaded from file since no file was found at" << mapFilePath;
-    }
-
-    return true;
-}
-
-bool AssetServer::writeMappingsToFile() {
-    auto mapFilePath = _resourcesDirectory.absoluteFilePath(MAP_FILE_NAME);
-
-    QSaveFile mapFile { mapFilePath };
-    if (mapFile.open(QIODevice::WriteOnly)) {
-        QJsonObject root;
-
-        for (auto it : _fileMappings) {
-            root[it.first] = it.second;
-        }
-
-        QJsonDocument jsonDocument { root };
-
-        if (mapFile.write(jsonDocument.toJson()) != -1) {
-            if (mapFile.commit()) {
-                qCDebug(asset_server) << "Wrote JSON mappings to file at" << mapFilePath;
-                return true;
-            } else {
-                qCWarning(asset_server) << "Failed to commit JSON mappings to file at" << mapFilePath;
-            }
-        } else {
-            qCWarning(asset_server) << "Failed to write JSON mappings to file at" << mapFilePath;
-        }
-    } else {
-        qCWarning(asset_server) << "Failed to open map file at" << mapFilePath;
-    }
-
-    return false;
-}
-
 bool AssetServer::setMapping(AssetUtils::AssetPath path, AssetUtils::AssetHash hash) {
     path = path.trimmed();
 
@@ -1071,27 +1053,16 @@ bool AssetServer::setMapping(AssetUtils::AssetPath path, AssetUtils::AssetHash h
         return false;
     }
 
-    // remember what the old mapping was in case persistence fails
-    auto it = _fileMappings.find(path);
-    auto oldMapping = it != _fileMappings.end() ? it->second : "";
-
-    // update the in memory QHash
-    _fileMappings[path] = hash;
+    _mappingStore.beginTransaction();
+    _mappingStore.set(path, hash);
 
-    // attempt to write to file
-    if (writeMappingsToFile()) {
+    // attempt to persist, the store puts back the old mapping if that fails
+    if (_mappingStore.commitTransaction()) {
         // persistence succeeded, we are good to go
         qCDebug(asset_server) << "Set mapping:" << path << "=>" << hash;
         maybeBake(path, hash);
         return true;
     } else {
-        // failed to persist this mapping to file - put back the old one in our in-memory representation
-        if (oldMapping.isEmpty()) {
-            _fileMappings.erase(_fileMappings.find(path));
-        } else {
-            _fileMappings[path] = oldMapping;
-        }
-
         qCWarning(asset_server) << "Failed to persist mapping:" << path << "=>" << hash;
 
         return false;
@@ -1115,68 +1086,56 @@ void AssetServer::removeBakedPathsForDeletedAsset(AssetUtils::AssetHash hash) {
 }
 
 bool AssetServer::deleteMappings(const AssetUtils::AssetPathList& paths) {
-    // take a copy of the current mappings in case persistence of these deletes fails
-    auto oldMappings = _fileMappings;
-
     QSet<QString> hashesToCheckForDeletion;
 
+    _mappingStore.beginTransaction();
+
     // enumerate the paths to delete and remove them all
     for (const auto& rawPath : paths) {
         auto path = rawPath.trimmed();
 
         // figure out if this path will delete a file or folder
         if (pathIsFolder(path)) {
-            // enumerate the in memory file mappings and remove anything that matches
-            auto it = _fileMappings.begin();
-            auto sizeBefore = _fileMappings.size();
+            auto folderPaths = _mappingStore.getPathsInFolder(path);
 
-            while (it != _fileMappings.end()) {
-                if (it->first.startsWith(path)) {
-                    // add this hash to the list we need to check for asset removal from the server
-                    hashesToCheckForDeletion << it->second;
+            for (const auto& folderPath : folderPaths) {
+                // add this hash to the list we need to check for asset removal from the server
+                hashesToCheckForDeletion << _mappingStore.getHash(folderPath);
 
-                    it = _fileMappings.erase(it);
-                } else {
-                    ++it;
-                }
+                _mappingStore.remove(folderPath);
             }
 
-            auto sizeNow = _fileMappings.size();
-            if (sizeBefore != sizeNow) {
-                qCDebug(asset_server) << "Deleted" << sizeBefore - sizeNow << "mappings in folder: " << path;
+            if (!folderPaths.isEmpty()) {
+                qCDebug(asset_server) << "Deleted" << folderPaths.size() << "mappings in folder: " << path;
             } else {
                 qCDebug(asset_server) << "Did not find any mappings to delete in folder:" << path;
             }
 
         } else {
-            auto it = _fileMappings.find(path);
-            if (it != _fileMappings.end()) {
+            auto hash = _mappingStore.getHash(path);
+            if (!hash.isEmpty()) {
                 // add this hash to the list we need to check for asset removal from server
-                hashesToCheckForDeletion << it->second;
+                hashesToCheckForDeletion << hash;
 
-                qCDebug(asset_server) << "Deleted a mapping:" << path << "=>" << it->second;
+                qCDebug(asset_server) << "Deleted a mapping:" << path << "=>" << hash;
 
-                _fileMappings.erase(it);
+                _mappingStore.remove(path);
             } else {
                 qCDebug(asset_server) << "Unable to delete a mapping that was not found:" << path;
             }
         }
     }
 
-    // deleted the old mappings, attempt to persist to file
-    if (writeMappingsToFile()) {
+    // deleted the old mappings, attempt to persist them
+    if (_mappingStore.commitTransaction()) {
         // persistence succeeded we are good to go
 
-        // TODO iterate through hashesToCheckForDeletion instead
-        for (auto& pair : _fileMappings) {
-            auto it = hashesToCheckForDeletion.find(pair.second);
-            if (it != hashesToCheckForDeletion.end()) {
-                hashesToCheckForDeletion.erase(it);
+        // we now have a set of hashes that may be unmapped - we will delete the asset files nothing maps to anymore
+        for (auto& hash : hashesToCheckForDeletion) {
+            if (_mappingStore.isHashMapped(hash)) {
+                continue;
             }
-        }
 
-        // we now have a set of hashes that are unmapped - we will delete those asset files
-        for (auto& hash : hashesToCheckForDeletion) {
             // remove the unmapped file
             QFile removeableFile { _filesDirectory.absoluteFilePath(hash) };
 
@@ -1191,11 +1150,9 @@ bool AssetServer::deleteMappings(const AssetUtils::AssetPathList& paths) {
 
         return true;
     } else {
+        // the store put back the deleted mappings
         qCWarning(asset_server) << "Failed to persist deleted mappings, rolling back";
 
-        // we didn't delete the previous mapping, put it back in our in-memory representation
-        _fileMappings = oldMappings;
-
         return false;
     }
 }
@@ -1220,35 +1177,30 @@ bool AssetServer::renameMapping(AssetUtils::AssetPath oldPath, AssetUtils::Asset
             return false;
         }
 
-        // take a copy of the old mappings
-        auto oldMappings = _fileMappings;
-
-        // iterate the current mappings and adjust any that matches the renamed folder
-        auto it = oldMappings.begin();
-
-        while (it != oldMappings.end()) {
-            auto& oldKey = it->first;
-            if (oldKey.startsWith(oldPath)) {
-                auto newKey = oldKey;
-                newKey.replace(0, oldPath.size(), newPath);
+        // take the mappings below the renamed folder before changing any of them
+        std::vector<std::pair<AssetUtils::AssetPath, AssetUtils::AssetHash>> renamedMappings;
+        for (const auto& oldKey : _mappingStore.getPathsInFolder(oldPath)) {
+            renamedMappings.emplace_back(oldKey, _mappingStore.getHash(oldKey));
+        }
 
-                // remove the old version from the in memory file mappings
-                _fileMappings.erase(_fileMappings.find(oldKey));
-                _fileMappings[newKey] = it->second;
-            }
+        _mappingStore.beginTransaction();
 
-            ++it;
+        for (const auto& mapping : renamedMappings) {
+            _mappingStore.remove(mapping.first);
+        }
+        for (const auto& mapping : renamedMappings) {
+            auto newKey = mapping.first;
+            newKey.replace(0, oldPath.size(), newPath);
+            _mappingStore.set(newKey, mapping.second);
         }
 
-        if (writeMappingsToFile()) {
+        if (_mappingStore.commitTransaction()) {
             // persisted the changed mappings, return success
             qCDebug(asset_server) << "Renamed folder mapping:" << oldPath << "=>" << newPath;
 
             return true;
         } else {
-            // couldn't persist the renamed paths, rollback and return failure
-            _fileMappings = oldMappings;
-
+            // couldn't persist the renamed paths, the store rolled them back
             qCWarning(asset_server) << "Failed to persist renamed folder mapping:" << oldPath << "=>" << newPath;
 
             return false;
@@ -1262,33 +1214,21 @@ bool AssetServer::renameMapping(AssetUtils::AssetPath oldPath, AssetUtils::Asset
         }
 
         // take the old hash to remove the old mapping
-        auto it = _fileMappings.find(oldPath);
-        auto oldSourceMapping = it->second;
-        _fileMappings.erase(it);
-
-        // in case we're overwriting, keep the current destination mapping for potential rollback
-        auto oldDestinationIt = _fileMappings.find(newPath);
+        auto oldSourceMapping = _mappingStore.getHash(oldPath);
 
         if (!oldSourceMapping.isEmpty()) {
-            _fileMappings[newPath] = oldSourceMapping;
+            // this overwrites the current destination mapping, if any
+            _mappingStore.beginTransaction();
+            _mappingStore.remove(oldPath);
+            _mappingStore.set(newPath, oldSourceMapping);
 
-            if (writeMappingsToFile()) {
+            if (_mappingStore.commitTransaction()) {
                 // persisted the renamed mapping, return success
                 qCDebug(asset_server) << "Renamed mapping:" << oldPath << "=>" << newPath;
 
                 return true;
             } else {
-                // we couldn't persist the renamed mapping, rollback and return failure
-                _fileMappings[oldPath] = oldSourceMapping;
-
-                if (oldDestinationIt != _fileMappings.end()) {
-                    // put back the overwritten mapping for the destination path
-                    _fileMappings[newPath] = oldDestinationIt->second;
-                } else {
-                    // clear the new mapping
-                    _fileMappings.erase(_fileMappings.find(newPath));
-                }
-
+                // we couldn't persist the renamed mapping, the store rolled it back
                 qCDebug(asset_server) << "Failed to persist renamed mapping:" << oldPath << "=>" << newPath;
 
                 return false;
@@ -1484,13 +1424,11 @@ static const QString REDIRECT_TARGET_KEY = "redirect_target";
 std::pair<bool, AssetMeta> AssetServer::readMetaFile(AssetUtils::AssetHash hash) {
     auto metaFilePath = AssetUtils::HIDDEN_BAKED_CONTENT_FOLDER + hash + "/" + "meta.json";
 
-    auto it = _fileMappings.find(metaFilePath);
-    if (it == _fileMappings.end()) {
+    auto metaFileHash = _mappingStore.getHash(metaFilePath);
+    if (metaFileHash.isEmpty()) {
         return { false, {} };
     }
 
-    auto metaFileHash = it->second;
-
     QFile metaFile(_filesDirectory.absoluteFilePath(metaFileHash));
 
     if (metaFile.open(QIODevice::ReadOnly)) {
@@ -1563,15 +1501,13 @@ bool AssetServer::writeMetaFile(AssetUtils::AssetHash originalAssetHash, const A
 
 bool AssetServer::setBakingEnabled(const AssetUtils::AssetPathList& paths, bool enabled) {
     for (const auto& path : paths) {
-        auto it = _fileMappings.find(path);
-        if (it != _fileMappings.end()) {
+        auto hash = _mappingStore.getHash(path);
+        if (!hash.isEmpty()) {
             auto type = assetTypeForFilename(path);
             if (type == BakedAssetType::Undefined) {
                 continue;
             }
 
-            auto hash = it->second;
-
             bool loaded;
             AssetMeta meta;
             std::tie(loaded, meta) = readMetaFile(hash);
@@ -1582,8 +1518,7 @@ bool AssetServer::setBakingEnabled(const AssetUtils::AssetPathList& paths, bool
                 bakedMapping = meta.redirectTarget;
             }
 
-            auto it = _fileMappings.find(bakedMapping);
-            bool currentlyDisabled = (it != _fileMappings.end() && it->second == hash);
+            bool currentlyDisabled = _mappingStore.getHash(bakedMapping) == hash;
 
             if (enabled && currentlyDisabled) {
                 QStringList bakedMappings{ bakedMapping };
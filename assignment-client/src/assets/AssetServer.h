@@ -18,7 +18,9 @@
 
 #include <ThreadedAssignment.h>
 
+#include "AssetMappingStore.h"
 #include "AssetUtils.h"
+#include "PartialUploads.h"
 #include "ReceivedMessage.h"
 
 #include "RegisteredMetaTypes.h"
@@ -96,6 +98,7 @@ private:
 
     void handleGetMappingOperation(ReceivedMessage& message, NLPacketList& replyPacket);
     void handleGetAllMappingOperation(NLPacketList& replyPacket);
+    void handleGetMappingChangesOperation(ReceivedMessage& message, NLPacketList& replyPacket);
     void handleSetMappingOperation(ReceivedMessage& message, bool hasWriteAccess, NLPacketList& replyPacket);
     void handleDeleteMappingsOperation(ReceivedMessage& message, bool hasWriteAccess, NLPacketList& replyPacket);
     void handleRenameMappingOperation(ReceivedMessage& message, bool hasWriteAccess, NLPacketList& replyPacket);
@@ -104,9 +107,8 @@ private:
     void handleAssetServerBackup(ReceivedMessage& message, NLPacketList& replyPacket);
     void handleAssetServerRestore(ReceivedMessage& message, NLPacketList& replyPacket);
 
-    // Mapping file operations must be called from main assignment thread only
-    bool loadMappingsFromFile();
-    bool writeMappingsToFile();
+    /// Write a mapping and its baking status, as expected by GetAllMappingsRequest
+    void writeMappingWithStatus(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& hash, NLPacketList& replyPacket);
 
     /// Set the mapping for path to hash
     bool setMapping(AssetUtils::AssetPath path, AssetUtils::AssetHash hash);
@@ -148,10 +150,12 @@ private:
     /// Remove baked paths when the original asset is deleteds
     void removeBakedPathsForDeletedAsset(AssetUtils::AssetHash originalAssetHash);
 
-    AssetUtils::Mappings _fileMappings;
+    // Mapping operations must be called from main assignment thread only
+    AssetMappingStore _mappingStore;
 
     QDir _resourcesDirectory;
     QDir _filesDirectory;
+    std::shared_ptr<PartialUploads> _partialUploads;
 
     /// Task pool for handling uploads and downloads of assets
     QThreadPool _transferTaskPool;
@@ -0,0 +1,269 @@
+//
+//  PartialUploads.cpp
+//  assignment-client/src/assets
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PartialUploads.h"
+
+#include <algorithm>
+
+#include <QtCore/QDateTime>
+#include <QtCore/QFile>
+
+#include "AssetServerLogging.h"
+
+using namespace AssetUtils;
+
+// partial files that weren't written to for that long can be removed to make room for other uploads
+static const qint64 PARTIAL_UPLOAD_IDLE_SECS = 10 * 60;
+
+PartialUploads::PartialUploads(const QDir& filesDirectory, const QDir& partialDirectory, uint64_t maxTotalSize) :
+    _filesDirectory(filesDirectory),
+    _partialDirectory(partialDirectory),
+    _maxTotalSize(maxTotalSize)
+{
+    for (const auto& fileInfo : _partialDirectory.entryInfoList(QDir::Files)) {
+        _totalSize += fileInfo.size();
+    }
+}
+
+AssetServerError PartialUploads::begin(const QByteArray& hash, uint64_t fileSize, uint64_t& offset) {
+    offset = 0;
+
+    QFileInfo assetFile { getAssetFilePath(hash) };
+    if (assetFile.exists()) {
+        if ((uint64_t)assetFile.size() == fileSize) {
+            // asset files are named after the hash of their contents, which was verified when they were written
+            qCDebug(asset_server) << "Not uploading existing file:" << hash.toHex();
+            offset = fileSize;
+            return NoError;
+        }
+        qCDebug(asset_server) << "Replacing an existing file whose size did not match the upload:" << hash.toHex();
+    }
+
+    auto upload = getUpload(hash);
+    QMutexLocker locker { &upload->mutex };
+
+    QFile partialFile { getPartialFilePath(hash) };
+    if (partialFile.exists()) {
+        uint64_t partialSize = partialFile.size();
+        if (partialSize <= fileSize) {
+            offset = partialSize;
+            qCDebug(asset_server) << "Resuming upload of" << hash.toHex() << "at" << offset << "of" << fileSize << "bytes";
+        } else if (partialFile.remove()) {
+            release(partialSize);
+        } else {
+            return FileOperationFailed;
+        }
+    }
+
+    if (offset == fileSize) {
+        // an empty file, or an upload that was interrupted right before we moved it
+        return complete(*upload, hash);
+    }
+
+    if (!makeRoom(fileSize - offset, hash)) {
+        qCWarning(asset_server) << "Not enough room left for partial uploads to upload" << hash.toHex();
+        offset = 0;
+        return FileOperationFailed;
+    }
+    return NoError;
+}
+
+AssetServerError PartialUploads::write(const QByteArray& hash, uint64_t fileSize, uint64_t offset,
+                                       const QByteArray& chunk, uint64_t& nextOffset) {
+    nextOffset = offset;
+
+    uint64_t chunkSize = chunk.size();
+    if (chunkSize == 0 || chunkSize > UPLOAD_CHUNK_SIZE || offset + chunkSize > fileSize) {
+        return InvalidByteRange;
+    }
+
+    auto upload = getUpload(hash);
+    QMutexLocker locker { &upload->mutex };
+
+    QFileInfo assetFile { getAssetFilePath(hash) };
+    if (assetFile.exists() && (uint64_t)assetFile.size() == fileSize) {
+        // completed by another upload of the same file
+        nextOffset = fileSize;
+        return NoError;
+    }
+
+    QFile partialFile { getPartialFilePath(hash) };
+    if (!partialFile.open(QIODevice::ReadWrite)) {
+        qCWarning(asset_server) << "Failed to open partial upload file" << partialFile.fileName();
+        return FileOperationFailed;
+    }
+
+    uint64_t partialSize = partialFile.size();
+    if (offset != partialSize) {
+        nextOffset = partialSize;
+        return NoError;
+    }
+
+    if (!reserve(chunkSize)) {
+        qCWarning(asset_server) << "Partial uploads are full, not writing to" << partialFile.fileName();
+        return FileOperationFailed;
+    }
+    if (!partialFile.seek(offset) || partialFile.write(chunk) != (qint64)chunkSize || !partialFile.flush()) {
+        qCWarning(asset_server) << "Failed to write to partial upload file" << partialFile.fileName();
+        partialFile.resize(offset);
+        release(chunkSize);
+        return FileOperationFailed;
+    }
+    partialFile.close();
+
+    // after a restart the partial file is hashed again from disk once complete
+    if (upload->hashedSize == offset) {
+        upload->hasher.addData(chunk);
+        upload->hashedSize += chunkSize;
+    }
+
+    nextOffset = offset + chunkSize;
+    if (nextOffset == fileSize) {
+        return complete(*upload, hash);
+    }
+    return NoError;
+}
+
+void PartialUploads::removeStale(qint64 maxAgeSecs) {
+    QMutexLocker locker { &_uploadsMutex };
+
+    auto now = QDateTime::currentDateTime();
+    auto partialFiles = _partialDirectory.entryInfoList(QDir::Files);
+    for (const auto& fileInfo : partialFiles) {
+        if (fileInfo.lastModified().secsTo(now) > maxAgeSecs && removePartialFile(fileInfo)) {
+            qCDebug(asset_server) << "Removed stale partial upload" << fileInfo.fileName();
+        }
+    }
+}
+
+uint64_t PartialUploads::getTotalSize() const {
+    QMutexLocker locker { &_uploadsMutex };
+    return _totalSize;
+}
+
+bool PartialUploads::reserve(uint64_t size) {
+    QMutexLocker locker { &_uploadsMutex };
+    if (_totalSize + size > _maxTotalSize) {
+        return false;
+    }
+    _totalSize += size;
+    return true;
+}
+
+void PartialUploads::release(uint64_t size) {
+    QMutexLocker locker { &_uploadsMutex };
+    _totalSize -= std::min(size, _totalSize);
+}
+
+bool PartialUploads::makeRoom(uint64_t size, const QByteArray& keepHash) {
+    QMutexLocker locker { &_uploadsMutex };
+    if (_totalSize + size <= _maxTotalSize) {
+        return true;
+    }
+
+    auto now = QDateTime::currentDateTime();
+    auto partialFiles = _partialDirectory.entryInfoList(QDir::Files, QDir::Time | QDir::Reversed);
+    QString keepFileName = keepHash.toHex();
+    for (const auto& fileInfo : partialFiles) {
+        if (fileInfo.lastModified().secsTo(now) <= PARTIAL_UPLOAD_IDLE_SECS) {
+            // this one and the rest of them were written to recently
+            break;
+        }
+        if (fileInfo.fileName() != keepFileName && removePartialFile(fileInfo)) {
+            qCDebug(asset_server) << "Removed idle partial upload" << fileInfo.fileName() << "to make room for" << keepFileName;
+            if (_totalSize + size <= _maxTotalSize) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool PartialUploads::removePartialFile(const QFileInfo& fileInfo) {
+    auto hash = QByteArray::fromHex(fileInfo.fileName().toLatin1());
+    auto upload = _uploads.find(hash);
+    if (upload != _uploads.end()) {
+        if (!upload.value()->mutex.tryLock()) {
+            // being written to right now
+            return false;
+        }
+        upload.value()->mutex.unlock();
+    }
+
+    if (!QFile::remove(fileInfo.absoluteFilePath())) {
+        return false;
+    }
+    _totalSize -= std::min((uint64_t)fileInfo.size(), _totalSize);
+    if (upload != _uploads.end()) {
+        _uploads.erase(upload);
+    }
+    return true;
+}
+
+PartialUploads::UploadPointer PartialUploads::getUpload(const QByteArray& hash) {
+    QMutexLocker locker { &_uploadsMutex };
+
+    auto& upload = _uploads[hash];
+    if (!upload) {
+        upload = std::make_shared<Upload>();
+    }
+    return upload;
+}
+
+void PartialUploads::removeUpload(const QByteArray& hash) {
+    QMutexLocker locker { &_uploadsMutex };
+    _uploads.remove(hash);
+}
+
+QString PartialUploads::getAssetFilePath(const QByteArray& hash) const {
+    return _filesDirectory.filePath(QString(hash.toHex()));
+}
+
+QString PartialUploads::getPartialFilePath(const QByteArray& hash) const {
+    return _partialDirectory.filePath(QString(hash.toHex()));
+}
+
+AssetServerError PartialUploads::complete(Upload& upload, const QByteArray& hash) {
+    QFile partialFile { getPartialFilePath(hash) };
+
+    if (upload.hashedSize != (uint64_t)partialFile.size()) {
+        if (!partialFile.open(QIODevice::ReadOnly)) {
+            return FileOperationFailed;
+        }
+        upload.hasher.reset();
+        upload.hasher.addData(&partialFile);
+        upload.hashedSize = partialFile.size();
+        partialFile.close();
+    }
+
+    uint64_t partialSize = partialFile.size();
+    AssetServerError error = NoError;
+    if (upload.hasher.result() != hash) {
+        qCWarning(asset_server) << "Discarding upload whose contents did not match the expected hash:" << hash.toHex();
+        if (partialFile.remove()) {
+            release(partialSize);
+        }
+        error = FileOperationFailed;
+    } else {
+        // at this point an existing asset file with that name can only be a damaged copy
+        auto assetFilePath = getAssetFilePath(hash);
+        QFile::remove(assetFilePath);
+        if (partialFile.rename(assetFilePath)) {
+            release(partialSize);
+            qCDebug(asset_server) << "Wrote file" << hash.toHex() << "to disk. Upload complete";
+        } else {
+            qCWarning(asset_server) << "Failed to move upload" << hash.toHex() << "with the asset files";
+            error = FileOperationFailed;
+        }
+    }
+
+    removeUpload(hash);
+    return error;
+}
@@ -0,0 +1,85 @@
+//
+//  PartialUploads.h
+//  assignment-client/src/assets
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_PartialUploads_h
+#define hifi_PartialUploads_h
+
+#include <memory>
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+
+#include "AssetUtils.h"
+
+// Uploads to the asset server that are in progress.
+//
+// The data received for an upload is appended to a partial file named after the expected hash, in a separate
+// directory, so an upload that was interrupted resumes from what was already written. The file is
+// hashed as it is written and only moved next to the asset files once the hash matches, so memory use doesn't
+// depend on the size of the upload. The partial files are capped in total size, and an upload that doesn't fit
+// makes room by removing the ones that weren't written to in a while. Safe to use from several upload tasks at once.
+class PartialUploads {
+public:
+    PartialUploads(const QDir& filesDirectory, const QDir& partialDirectory, uint64_t maxTotalSize);
+
+    // Sets offset to where the upload of this file should start from: the file size if the asset server
+    // already has it, or the size of what was kept from a previous attempt.
+    AssetUtils::AssetServerError begin(const QByteArray& hash, uint64_t fileSize, uint64_t& offset);
+
+    // Writes a chunk of the file at offset and sets nextOffset to where the upload should continue from.
+    // A chunk that isn't at the end of the partial file is ignored and nextOffset tells the client where that is.
+    AssetUtils::AssetServerError write(const QByteArray& hash, uint64_t fileSize, uint64_t offset,
+                                       const QByteArray& chunk, uint64_t& nextOffset);
+
+    // Removes the partial files that weren't written to in that many seconds
+    void removeStale(qint64 maxAgeSecs);
+
+    // The size of all the partial files
+    uint64_t getTotalSize() const;
+
+private:
+    struct Upload {
+        QMutex mutex;
+        QCryptographicHash hasher { QCryptographicHash::Sha256 };
+        uint64_t hashedSize { 0 };
+    };
+    using UploadPointer = std::shared_ptr<Upload>;
+
+    UploadPointer getUpload(const QByteArray& hash);
+    void removeUpload(const QByteArray& hash);
+
+    QString getAssetFilePath(const QByteArray& hash) const;
+    QString getPartialFilePath(const QByteArray& hash) const;
+
+    // Accounts for bytes written to or removed from the partial files. Reserving fails past the maximum total size.
+    bool reserve(uint64_t size);
+    void release(uint64_t size);
+
+    // Removes the least recently written of the partial files that are idle until size more bytes fit
+    bool makeRoom(uint64_t size, const QByteArray& keepHash);
+    // Removes a partial file unless it is being written to. _uploadsMutex must be held.
+    bool removePartialFile(const QFileInfo& fileInfo);
+
+    // Verifies the hash of a complete partial file and moves it with the asset files
+    AssetUtils::AssetServerError complete(Upload& upload, const QByteArray& hash);
+
+    QDir _filesDirectory;
+    QDir _partialDirectory;
+    const uint64_t _maxTotalSize;
+
+    mutable QMutex _uploadsMutex;
+    QHash<QByteArray, UploadPointer> _uploads;
+    uint64_t _totalSize { 0 };
+};
+
+#endif // hifi_PartialUploads_h
@@ -11,9 +11,6 @@
 
 #include "UploadAssetTask.h"
 
-#include <QtCore/QBuffer>
-#include <QtCore/QFile>
-
 #include <AssetUtils.h>
 #include <NodeList.h>
 #include <NLPacketList.h>
@@ -21,93 +18,63 @@
 #include "ClientServerUtils.h"
 
 UploadAssetTask::UploadAssetTask(QSharedPointer<ReceivedMessage> receivedMessage, SharedNodePointer senderNode,
-                                 const QDir& resourcesDir, uint64_t filesizeLimit) :
+                                 std::shared_ptr<PartialUploads> partialUploads, uint64_t filesizeLimit) :
     _receivedMessage(receivedMessage),
     _senderNode(senderNode),
-    _resourcesDir(resourcesDir),
+    _partialUploads(partialUploads),
     _filesizeLimit(filesizeLimit)
 {
     
 }
 
 void UploadAssetTask::run() {
-    auto data = _receivedMessage->getMessage();
-    
-    QBuffer buffer { &data };
-    buffer.open(QIODevice::ReadOnly);
-    
     MessageID messageID;
-    buffer.read(reinterpret_cast<char*>(&messageID), sizeof(messageID));
-    
+    _receivedMessage->readPrimitive(&messageID);
+
+    AssetUtils::AssetUploadOperation operation;
+    _receivedMessage->readPrimitive(&operation);
+
+    QByteArray hash = _receivedMessage->read(AssetUtils::SHA256_HASH_LENGTH);
+
     uint64_t fileSize;
-    buffer.read(reinterpret_cast<char*>(&fileSize), sizeof(fileSize));
+    _receivedMessage->readPrimitive(&fileSize);
 
-    if (_senderNode) {
-        qDebug() << "UploadAssetTask reading a file of " << fileSize << "bytes from" << uuidStringWithoutCurlyBraces(_senderNode->getUUID());
-    } else {
-        qDebug() << "UploadAssetTask reading a file of " << fileSize << "bytes from" << _receivedMessage->getSenderSockAddr();
-    }
-    
     auto replyPacket = NLPacket::create(PacketType::AssetUploadReply, -1, true);
     replyPacket->writePrimitive(messageID);
-    
-    if (fileSize > _filesizeLimit) {
-        replyPacket->writePrimitive(AssetUtils::AssetServerError::AssetTooLarge);
-    } else {
-        QByteArray fileData = buffer.read(fileSize);
-        
-        auto hash = AssetUtils::hashData(fileData);
-        auto hexHash = hash.toHex();
 
+    AssetUtils::AssetServerError error = AssetUtils::AssetServerError::NoError;
+    uint64_t offset = 0;
+
+    if (hash.size() != (int)AssetUtils::SHA256_HASH_LENGTH) {
+        error = AssetUtils::AssetServerError::InvalidByteRange;
+    } else if (fileSize > _filesizeLimit) {
+        error = AssetUtils::AssetServerError::AssetTooLarge;
+    } else if (operation == AssetUtils::UploadBegin) {
         if (_senderNode) {
-            qDebug() << "Hash for uploaded file from" << uuidStringWithoutCurlyBraces(_senderNode->getUUID()) << "is: (" << hexHash << ")";
+            qDebug() << "UploadAssetTask starting upload of a file of" << fileSize << "bytes (" << hash.toHex() << ") from"
+                << uuidStringWithoutCurlyBraces(_senderNode->getUUID());
         } else {
-            qDebug() << "Hash for uploaded file from" << _receivedMessage->getSenderSockAddr() << "is: (" << hexHash << ")";
+            qDebug() << "UploadAssetTask starting upload of a file of" << fileSize << "bytes (" << hash.toHex() << ") from"
+                << _receivedMessage->getSenderSockAddr();
         }
-        
-        QFile file { _resourcesDir.filePath(QString(hexHash)) };
-
-        bool existingCorrectFile = false;
-        
-        if (file.exists()) {
-            // check if the local file has the correct contents, otherwise we overwrite
-            if (file.open(QIODevice::ReadOnly) && AssetUtils::hashData(file.readAll()) == hash) {
-                qDebug() << "Not overwriting existing verified file: " << hexHash;
-
-                existingCorrectFile = true;
-
-                replyPacket->writePrimitive(AssetUtils::AssetServerError::NoError);
-                replyPacket->write(hash);
-            } else {
-                qDebug() << "Overwriting an existing file whose contents did not match the expected hash: " << hexHash;
-                file.close();
-            }
-        }
-
-        if (!existingCorrectFile) {
-            if (file.open(QIODevice::WriteOnly) && file.write(fileData) == qint64(fileSize)) {
-                qDebug() << "Wrote file" << hexHash << "to disk. Upload complete";
-                file.close();
-
-                replyPacket->writePrimitive(AssetUtils::AssetServerError::NoError);
-                replyPacket->write(hash);
-            } else {
-                qWarning() << "Failed to upload or write to file" << hexHash << " - upload failed.";
 
-                // upload has failed - remove the file and return an error
-                auto removed = file.remove();
-
-                if (!removed) {
-                    qWarning() << "Removal of failed upload file" << hexHash << "failed.";
-                }
-                
-                replyPacket->writePrimitive(AssetUtils::AssetServerError::FileOperationFailed);
-            }
-        }
+        error = _partialUploads->begin(hash, fileSize, offset);
+    } else if (operation == AssetUtils::UploadChunk) {
+        uint64_t chunkOffset;
+        _receivedMessage->readPrimitive(&chunkOffset);
 
+        error = _partialUploads->write(hash, fileSize, chunkOffset, _receivedMessage->readAll(), offset);
+    } else {
+        qWarning() << "UploadAssetTask received an unknown upload operation" << operation;
+        error = AssetUtils::AssetServerError::FileOperationFailed;
+    }
 
+    replyPacket->writePrimitive(error);
+    if (error == AssetUtils::AssetServerError::NoError) {
+        replyPacket->write(hash);
+        replyPacket->writePrimitive(offset);
     }
-    
+
     auto nodeList = DependencyManager::get<NodeList>();
     if (_senderNode) {
         nodeList->sendPacket(std::move(replyPacket), *_senderNode);
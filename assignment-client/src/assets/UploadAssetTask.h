@@ -14,27 +14,30 @@
 #ifndef hifi_UploadAssetTask_h
 #define hifi_UploadAssetTask_h
 
-#include <QtCore/QDir>
+#include <memory>
+
 #include <QtCore/QObject>
 #include <QtCore/QRunnable>
 #include <QtCore/QSharedPointer>
 
 #include "ReceivedMessage.h"
 
+#include "PartialUploads.h"
+
 class NLPacketList;
 class Node;
 
 class UploadAssetTask : public QRunnable {
 public:
-    UploadAssetTask(QSharedPointer<ReceivedMessage> message, QSharedPointer<Node> senderNode, 
-                    const QDir& resourcesDir, uint64_t filesizeLimit);
+    UploadAssetTask(QSharedPointer<ReceivedMessage> message, QSharedPointer<Node> senderNode,
+                    std::shared_ptr<PartialUploads> partialUploads, uint64_t filesizeLimit);
 
     void run() override;
 
 private:
     QSharedPointer<ReceivedMessage> _receivedMessage;
     QSharedPointer<Node> _senderNode;
-    QDir _resourcesDir;
+    std::shared_ptr<PartialUploads> _partialUploads;
     uint64_t _filesizeLimit;
 };
 
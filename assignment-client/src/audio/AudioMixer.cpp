@@ -54,6 +54,8 @@ float AudioMixer::_noiseMutingThreshold{ DEFAULT_NOISE_MUTING_THRESHOLD };
 float AudioMixer::_attenuationPerDoublingInDistance{ DEFAULT_ATTENUATION_PER_DOUBLING_IN_DISTANCE };
 map<QString, shared_ptr<CodecPlugin>> AudioMixer::_availableCodecs{ };
 QStringList AudioMixer::_codecPreferenceOrder{};
+int AudioMixer::_minDownstreamBitrate{ AudioCodecAdapter::DEFAULT_MIN_BITRATE };
+int AudioMixer::_maxDownstreamBitrate{ AudioCodecAdapter::DEFAULT_MAX_BITRATE };
 vector<AudioMixer::ZoneDescription> AudioMixer::_audioZones;
 vector<AudioMixer::ZoneSettings> AudioMixer::_zoneSettings;
 vector<AudioMixer::ReverbSettings> AudioMixer::_zoneReverbSettings;
@@ -328,7 +330,8 @@ void AudioMixer::sendStatsPacket() {
 
     mixStats["1_hrtf_renders"] = (int)(_stats.hrtfRenders / (float)_numStatFrames);
     mixStats["1_hrtf_resets"] = (int)(_stats.hrtfResets / (float)_numStatFrames);
-    mixStats["1_hrtf_updates"] = (int)(_stats.hrtfUpdates / (float)_numStatFrames);
+    mixStats["1_hrtf_in_use"] = (int)(_stats.hrtfInUse / (float)_numStatFrames);
+    mixStats["1_hrtf_allocated"] = (int)(_stats.hrtfAllocated / (float)_numStatFrames);
 
     mixStats["2_skipped_streams"] = (int)(_stats.skipped / (float)_numStatFrames);
     mixStats["2_inactive_streams"] = (int)(_stats.inactive / (float)_numStatFrames);
@@ -553,6 +556,8 @@ void AudioMixer::clearDomainSettings() {
     _attenuationPerDoublingInDistance = DEFAULT_ATTENUATION_PER_DOUBLING_IN_DISTANCE;
     _noiseMutingThreshold = DEFAULT_NOISE_MUTING_THRESHOLD;
     _codecPreferenceOrder.clear();
+    _minDownstreamBitrate = AudioCodecAdapter::DEFAULT_MIN_BITRATE;
+    _maxDownstreamBitrate = AudioCodecAdapter::DEFAULT_MAX_BITRATE;
     _audioZones.clear();
     _zoneSettings.clear();
     _zoneReverbSettings.clear();
@@ -667,6 +672,25 @@ void AudioMixer::parseSettingsObject(const QJsonObject& settingsObject) {
             qCDebug(audio) << "Codec preference order changed to" << _codecPreferenceOrder;
         }
 
+        // in kbps, setting both to the same value disables the bitrate adaptation but not FEC
+        const QString MIN_DOWNSTREAM_BITRATE = "min_downstream_bitrate";
+        const QString MAX_DOWNSTREAM_BITRATE = "max_downstream_bitrate";
+        if (audioEnvGroupObject[MIN_DOWNSTREAM_BITRATE].isString() || audioEnvGroupObject[MAX_DOWNSTREAM_BITRATE].isString()) {
+            const int BITS_PER_KILOBIT = 1000;
+            bool minOK = false;
+            bool maxOK = false;
+            int minBitrate = audioEnvGroupObject[MIN_DOWNSTREAM_BITRATE].toString().toInt(&minOK) * BITS_PER_KILOBIT;
+            int maxBitrate = audioEnvGroupObject[MAX_DOWNSTREAM_BITRATE].toString().toInt(&maxOK) * BITS_PER_KILOBIT;
+            _minDownstreamBitrate = minOK && minBitrate > 0 ? minBitrate : AudioCodecAdapter::DEFAULT_MIN_BITRATE;
+            _maxDownstreamBitrate = maxOK && maxBitrate > 0 ? maxBitrate : AudioCodecAdapter::DEFAULT_MAX_BITRATE;
+            if (_minDownstreamBitrate > _maxDownstreamBitrate) {
+                qCWarning(audio) << "Minimum downstream bitrate cannot be higher than the maximum. Using default values.";
+                _minDownstreamBitrate = AudioCodecAdapter::DEFAULT_MIN_BITRATE;
+                _maxDownstreamBitrate = AudioCodecAdapter::DEFAULT_MAX_BITRATE;
+            }
+            qCDebug(audio) << "Downstream bitrate range changed to" << _minDownstreamBitrate << "-" << _maxDownstreamBitrate;
+        }
+
         const QString ATTENATION_PER_DOULING_IN_DISTANCE = "attenuation_per_doubling_in_distance";
         if (audioEnvGroupObject[ATTENATION_PER_DOULING_IN_DISTANCE].isString()) {
             bool ok = false;
@@ -56,6 +56,9 @@ public:
     static const std::vector<ZoneDescription>& getAudioZones() { return _audioZones; }
     static const std::vector<ZoneSettings>& getZoneSettings() { return _zoneSettings; }
     static const std::vector<ReverbSettings>& getReverbSettings() { return _zoneReverbSettings; }
+    // the range each listener's downstream bitrate adapts within, in bits per second
+    static int getMinDownstreamBitrate() { return _minDownstreamBitrate; }
+    static int getMaxDownstreamBitrate() { return _maxDownstreamBitrate; }
     static const std::pair<QString, CodecPluginPointer> negotiateCodec(std::vector<QString> codecs);
 
     static bool shouldReplicateTo(const Node& from, const Node& to) {
@@ -143,6 +146,8 @@ private:
     static float _attenuationPerDoublingInDistance;
     static std::map<QString, CodecPluginPointer> _availableCodecs;
     static QStringList _codecPreferenceOrder;
+    static int _minDownstreamBitrate;
+    static int _maxDownstreamBitrate;
 
     static std::vector<ZoneDescription> _audioZones;
     static std::vector<ZoneSettings> _zoneSettings;
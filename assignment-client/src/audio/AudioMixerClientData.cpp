@@ -81,6 +81,7 @@ int AudioMixerClientData::processPackets(ConcurrentAddedStreams& addedStreams) {
             }
             case PacketType::AudioStreamStats: {
                 parseData(*packet);
+                adaptDownstreamCodec(*node);
                 break;
             }
             case PacketType::NegotiateAudioFormat:
@@ -223,12 +224,15 @@ void AudioMixerClientData::parseInjectorGainSet(ReceivedMessage& message, const
 }
 
 void AudioMixerClientData::setGainForAvatar(QUuid nodeID, float gain) {
-    auto it = std::find_if(_streams.active.cbegin(), _streams.active.cend(), [nodeID](const MixableStream& mixableStream){
+    auto it = std::find_if(_streams.active.begin(), _streams.active.end(), [nodeID](const MixableStream& mixableStream){
         return mixableStream.nodeStreamID.nodeID == nodeID && mixableStream.nodeStreamID.streamID.isNull();
     });
 
-    if (it != _streams.active.cend()) {
-        it->hrtf->setGainAdjustment(gain);
+    if (it != _streams.active.end()) {
+        it->gainAdjustment = gain;
+        if (it->hrtf) {
+            it->hrtf->setGainAdjustment(gain);
+        }
     }
 }
 
@@ -648,6 +652,37 @@ void AudioMixerClientData::sendAudioStreamStatsPackets(const SharedNodePointer&
     }
 }
 
+void AudioMixerClientData::adaptDownstreamCodec(const Node& node) {
+    const auto& packetStats = _downstreamAudioStreamStats._packetStreamStats;
+    PacketStreamStats newPacketStats = packetStats;
+    quint32 newStarves = _downstreamAudioStreamStats._starveCount;
+
+    // the listener starts its counts over when it resets its stream
+    if (packetStats._expectedReceived >= _lastDownstreamPacketStats._expectedReceived &&
+        packetStats._lost >= _lastDownstreamPacketStats._lost) {
+        newPacketStats = packetStats - _lastDownstreamPacketStats;
+    }
+    if (_downstreamAudioStreamStats._starveCount >= _lastDownstreamStarveCount) {
+        newStarves -= _lastDownstreamStarveCount;
+    }
+    _lastDownstreamPacketStats = packetStats;
+    _lastDownstreamStarveCount = _downstreamAudioStreamStats._starveCount;
+
+    AudioCodecAdapter::LinkStats linkStats;
+    linkStats.lossRate = newPacketStats.getLostRate();
+    linkStats.starves = (int)newStarves;
+    quint64 maxGap = _downstreamAudioStreamStats._timeGapWindowMax;
+    linkStats.jitterMsecs = maxGap > (quint64)AudioConstants::NETWORK_FRAME_USECS ?
+        (int)((maxGap - AudioConstants::NETWORK_FRAME_USECS) / USECS_PER_MSEC) : 0;
+    // mixed audio is unreliable, so the connection stats have no RTT samples for it, pings do
+    linkStats.rttMsecs = std::max(0, node.getPingMs());
+
+    _downstreamCodecAdapter.setBitrateRange(AudioMixer::getMinDownstreamBitrate(), AudioMixer::getMaxDownstreamBitrate());
+    if (_downstreamCodecAdapter.update(linkStats) && _encoder) {
+        _downstreamCodecAdapter.applyTo(*_encoder);
+    }
+}
+
 QJsonObject AudioMixerClientData::getAudioStreamStats() {
     QJsonObject result;
 
@@ -675,6 +710,12 @@ QJsonObject AudioMixerClientData::getAudioStreamStats() {
     downstreamStats["max_gap_30s_usecs"] = static_cast<double>(streamStats._timeGapWindowMax);
     downstreamStats["avg_gap_30s_usecs"] = static_cast<double>(streamStats._timeGapWindowAverage);
 
+    const auto& codecSettings = _downstreamCodecAdapter.getSettings();
+    downstreamStats["codec_bitrate"] = codecSettings.bitrate;
+    downstreamStats["codec_complexity"] = codecSettings.complexity;
+    downstreamStats["codec_fec"] = codecSettings.inbandFEC;
+    downstreamStats["codec_expected_loss%"] = codecSettings.expectedLossPercentage;
+
     result["downstream"] = downstreamStats;
 
     AvatarAudioStream* avatarAudioStream = getAvatarAudioStream();
@@ -782,6 +823,9 @@ void AudioMixerClientData::setupCodec(CodecPluginPointer codec, const QString& c
     _selectedCodecName = codecName;
     if (codec) {
         _encoder = codec->createEncoder(AudioConstants::SAMPLE_RATE, AudioConstants::STEREO);
+        if (_encoder) {
+            _downstreamCodecAdapter.applyTo(*_encoder);
+        }
         _decoder = codec->createDecoder(AudioConstants::SAMPLE_RATE, AudioConstants::MONO);
     }
 
@@ -22,7 +22,9 @@
 #include <QtCore/QJsonObject>
 
 #include <AABox.h>
+#include <AudioCodecAdapter.h>
 #include <AudioHRTF.h>
+#include <AudioHRTFPool.h>
 #include <AudioLimiter.h>
 #include <UUIDHasher.h>
 
@@ -79,6 +81,9 @@ public:
 
     void sendAudioStreamStatsPackets(const SharedNodePointer& destinationNode);
 
+    // adapts the encoder of our mix to what the listener reported receiving since its last stats
+    void adaptDownstreamCodec(const Node& node);
+
     void incrementOutgoingMixedAudioSequenceNumber() { _outgoingMixedAudioSequenceNumber++; }
     quint16 getOutgoingSequenceNumber() const { return _outgoingMixedAudioSequenceNumber; }
 
@@ -119,15 +124,17 @@ public:
     struct MixableStream {
         float approximateVolume { 0.0f };
         NodeIDStreamID nodeStreamID;
-        std::unique_ptr<AudioHRTF> hrtf;
+        // only held while the stream is being rendered for this listener, see AudioMixerSlave::addStream
+        AudioHRTFPool::Pointer hrtf;
+        float gainAdjustment { 1.0f };
         PositionalAudioStream* positionalStream;
         bool ignoredByListener { false };
         bool ignoringListener { false };
 
         MixableStream(NodeIDStreamID nodeIDStreamID, PositionalAudioStream* positionalStream) :
-            nodeStreamID(nodeIDStreamID), hrtf(new AudioHRTF), positionalStream(positionalStream) {};
+            nodeStreamID(nodeIDStreamID), positionalStream(positionalStream) {};
         MixableStream(QUuid nodeID, Node::LocalID localNodeID, StreamID streamID, PositionalAudioStream* positionalStream) :
-            nodeStreamID(nodeID, localNodeID, streamID), hrtf(new AudioHRTF), positionalStream(positionalStream) {};
+            nodeStreamID(nodeID, localNodeID, streamID), positionalStream(positionalStream) {};
     };
 
     using MixableStreamsVector = std::vector<MixableStream>;
@@ -138,6 +145,7 @@ public:
     };
 
     Streams& getStreams() { return _streams; }
+    AudioHRTFPool& getHRTFPool() { return _hrtfPool; }
 
     // thread-safe, called from AudioMixerSlave(s) while processing ignore packets for other nodes
     void ignoredByNode(QUuid nodeID);
@@ -185,11 +193,16 @@ private:
 
     bool containsValidPosition(ReceivedMessage& message) const;
 
+    // must outlive _streams, which hand their HRTF state back to it when destroyed
+    AudioHRTFPool _hrtfPool;
     Streams _streams;
 
     quint16 _outgoingMixedAudioSequenceNumber;
 
     AudioStreamStats _downstreamAudioStreamStats;
+    PacketStreamStats _lastDownstreamPacketStats;
+    quint32 _lastDownstreamStarveCount { 0 };
+    AudioCodecAdapter _downstreamCodecAdapter;
 
     int _frameToSendStats { 0 };
 
@@ -24,6 +24,7 @@
 #include <OctreeConstants.h>
 #include <plugins/PluginManager.h>
 #include <plugins/CodecPlugin.h>
+#include <Profile.h>
 #include <udt/PacketHeaders.h>
 #include <SharedUtil.h>
 #include <StDev.h>
@@ -56,6 +57,7 @@ inline float computeAzimuth(const AvatarAudioStream& listeningNodeStream, const
         const glm::vec3& relativePosition);
 
 void AudioMixerSlave::processPackets(const SharedNodePointer& node) {
+    TRACE_SCOPE(network, "AudioMixerSlave::processPackets")
     AudioMixerClientData* data = (AudioMixerClientData*)node->getLinkedData();
     if (data) {
         // process packets and collect the number of streams available for this frame
@@ -71,6 +73,7 @@ void AudioMixerSlave::configureMix(ConstIter begin, ConstIter end, unsigned int
 }
 
 void AudioMixerSlave::mix(const SharedNodePointer& node) {
+    TRACE_SCOPE(app, "AudioMixerSlave::mix")
     // check that the node is valid
     AudioMixerClientData* data = (AudioMixerClientData*)node->getLinkedData();
     if (data == nullptr) {
@@ -298,9 +301,9 @@ float approximateVolume(const MixableStream& stream, const AvatarAudioStream* li
     // approximate the gain
     float gain = approximateGain(*listenerAudioStream, *(stream.positionalStream));
 
-    // for avatar streams, modify by the set gain adjustment
+    // for avatar streams, modify by the set gain adjustment, scaled the way the HRTF applies it
     if (stream.nodeStreamID.streamID.isNull()) {
-        gain *= stream.hrtf->getGainAdjustment();
+        gain *= HRTF_GAIN * stream.gainAdjustment;
     }
 
     return stream.positionalStream->getLastPopOutputTrailingLoudness() * gain;
@@ -317,6 +320,7 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
     bool isSoloing = !listenerData->getSoloedNodes().empty();
 
     auto& streams = listenerData->getStreams();
+    auto& hrtfPool = listenerData->getHRTFPool();
 
     addStreams(*listener, *listenerData);
 
@@ -337,10 +341,6 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
             return true;
         }
 
-        if (!isThrottling) {
-            updateHRTFParameters(stream, *listenerAudioStream, listenerData->getMasterAvatarGain(),
-                                 listenerData->getMasterInjectorGain());
-        }
         return false;
     });
 
@@ -362,10 +362,6 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
             return true;
         }
 
-        if (!isThrottling) {
-            updateHRTFParameters(stream, *listenerAudioStream, listenerData->getMasterAvatarGain(),
-                                 listenerData->getMasterInjectorGain());
-        }
         return false;
     });
 
@@ -381,19 +377,24 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
             stream.approximateVolume = approximateVolume(stream, listenerAudioStream);
         } else {
             if (shouldBeSkipped(stream, *listener, *listenerAudioStream, *listenerData)) {
-                addStream(stream, *listenerAudioStream, 0.0f, 0.0f, isSoloing);
+                if (stream.hrtf) {
+                    // flush the tail of the last rendered block
+                    addStream(stream, *listenerAudioStream, hrtfPool, 0.0f, 0.0f, isSoloing);
+                    releaseHRTF(stream);
+                }
                 streams.skipped.push_back(move(stream));
                 ++stats.activeToSkipped;
                 return true;
             }
 
-            addStream(stream, *listenerAudioStream, listenerData->getMasterAvatarGain(), listenerData->getMasterInjectorGain(),
-                      isSoloing);
+            addStream(stream, *listenerAudioStream, hrtfPool, listenerData->getMasterAvatarGain(),
+                      listenerData->getMasterInjectorGain(), isSoloing);
 
             if (shouldBeInactive(stream)) {
                 // To reduce artifacts we still call render to flush the HRTF for every silent
                 // sources on the first frame where the source becomes silent
                 // this ensures the correct tail from last mixed block
+                releaseHRTF(stream);
                 streams.inactive.push_back(move(stream));
                 ++stats.activeToInactive;
                 return true;
@@ -417,19 +418,20 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
         SegmentedEraseIf<MixableStreamsVector> erase(streams.active);
         erase.iterateTo(throttlePoint, [&](MixableStream& stream) {
             if (shouldBeSkipped(stream, *listener, *listenerAudioStream, *listenerData)) {
-                resetHRTFState(stream);
+                releaseHRTF(stream);
                 streams.skipped.push_back(move(stream));
                 ++stats.activeToSkipped;
                 return true;
             }
 
-            addStream(stream, *listenerAudioStream, listenerData->getMasterAvatarGain(), listenerData->getMasterInjectorGain(),
-                      isSoloing);
+            addStream(stream, *listenerAudioStream, hrtfPool, listenerData->getMasterAvatarGain(),
+                      listenerData->getMasterInjectorGain(), isSoloing);
 
             if (shouldBeInactive(stream)) {
                 // To reduce artifacts we still call render to flush the HRTF for every silent
                 // sources on the first frame where the source becomes silent
                 // this ensures the correct tail from last mixed block
+                releaseHRTF(stream);
                 streams.inactive.push_back(move(stream));
                 ++stats.activeToInactive;
                 return true;
@@ -438,11 +440,10 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
             return false;
         });
         erase.iterateTo(end(streams.active), [&](MixableStream& stream) {
-            // To reduce artifacts we reset the HRTF state for every throttled
-            // sources on the first frame where the source becomes throttled
-            // this ensures at least remove the tail from last mixed block
-            // preventing excessive artifacts on the next first block
-            resetHRTFState(stream);
+            // To reduce artifacts we drop the HRTF state of every throttled source,
+            // the next block rendered for it fades in from silence instead of
+            // continuing from a stale tail
+            releaseHRTF(stream);
 
             if (shouldBeSkipped(stream, *listener, *listenerAudioStream, *listenerData)) {
                 streams.skipped.push_back(move(stream));
@@ -464,6 +465,14 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
     stats.inactive += (int)streams.inactive.size();
     stats.active += (int)streams.active.size();
 
+    // about every second, give back the memory of the audible sources that weren't needed during the last one
+    const unsigned int NUM_FRAMES_PER_SEC = (int)ceil(AudioConstants::NETWORK_FRAMES_PER_SEC);
+    if (_frame % NUM_FRAMES_PER_SEC == 0) {
+        hrtfPool.trim();
+    }
+    stats.hrtfInUse += (int)hrtfPool.getNumInUse();
+    stats.hrtfAllocated += (int)hrtfPool.getNumAllocated();
+
     // clear the newly ignored, un-ignored, ignoring, and un-ignoring streams now that we've processed them
     listenerData->clearStagedIgnoreChanges();
 
@@ -491,11 +500,18 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
 
 void AudioMixerSlave::addStream(AudioMixerClientData::MixableStream& mixableStream,
                                 AvatarAudioStream& listeningNodeStream,
+                                AudioHRTFPool& hrtfPool,
                                 float masterAvatarGain,
                                 float masterInjectorGain,
                                 bool isSoloing) {
     ++stats.totalMixes;
 
+    if (!mixableStream.hrtf) {
+        // the stream just became audible for this listener, it fades in from silence
+        mixableStream.hrtf = hrtfPool.acquire();
+        mixableStream.hrtf->setGainAdjustment(mixableStream.gainAdjustment);
+    }
+
     auto streamToAdd = mixableStream.positionalStream;
 
     // check if this is a server echo of a source back to itself
@@ -575,30 +591,11 @@ void AudioMixerSlave::addStream(AudioMixerClientData::MixableStream& mixableStre
     }
 }
 
-void AudioMixerSlave::updateHRTFParameters(AudioMixerClientData::MixableStream& mixableStream,
-                                           AvatarAudioStream& listeningNodeStream,
-                                           float masterAvatarGain,
-                                           float masterInjectorGain) {
-    auto streamToAdd = mixableStream.positionalStream;
-
-    // check if this is a server echo of a source back to itself
-    bool isEcho = (streamToAdd == &listeningNodeStream);
-
-    glm::vec3 relativePosition = streamToAdd->getPosition() - listeningNodeStream.getPosition();
-
-    float distance = glm::max(glm::length(relativePosition), EPSILON);
-    float gain = isEcho ? 1.0f : computeGain(masterAvatarGain, masterInjectorGain, listeningNodeStream, *streamToAdd, 
-                                             relativePosition, distance);
-    float azimuth = isEcho ? 0.0f : computeAzimuth(listeningNodeStream, listeningNodeStream, relativePosition);
-
-    mixableStream.hrtf->setParameterHistory(azimuth, distance, gain);
-
-    ++stats.hrtfUpdates;
-}
-
-void AudioMixerSlave::resetHRTFState(AudioMixerClientData::MixableStream& mixableStream) {
-     mixableStream.hrtf->reset();
-    ++stats.hrtfResets;
+void AudioMixerSlave::releaseHRTF(AudioMixerClientData::MixableStream& mixableStream) {
+    if (mixableStream.hrtf) {
+        mixableStream.hrtf.reset();
+        ++stats.hrtfResets;
+    }
 }
 
 std::unique_ptr<NLPacket> createAudioPacket(PacketType type, int size, quint16 sequence, QString codec) {
@@ -60,14 +60,11 @@ private:
     bool prepareMix(const SharedNodePointer& listener);
     void addStream(AudioMixerClientData::MixableStream& mixableStream,
                    AvatarAudioStream& listeningNodeStream,
+                   AudioHRTFPool& hrtfPool,
                    float masterAvatarGain,
                    float masterInjectorGain,
                    bool isSoloing);
-    void updateHRTFParameters(AudioMixerClientData::MixableStream& mixableStream,
-                              AvatarAudioStream& listeningNodeStream,
-                              float masterAvatarGain,
-                              float masterInjectorGain);
-    void resetHRTFState(AudioMixerClientData::MixableStream& mixableStream);
+    void releaseHRTF(AudioMixerClientData::MixableStream& mixableStream);
 
     void addStreams(Node& listener, AudioMixerClientData& listenerData);
 
@@ -20,7 +20,8 @@ void AudioMixerStats::reset() {
 
     hrtfRenders = 0;
     hrtfResets = 0;
-    hrtfUpdates = 0;
+    hrtfInUse = 0;
+    hrtfAllocated = 0;
 
     manualStereoMixes = 0;
     manualEchoMixes = 0;
@@ -50,7 +51,8 @@ void AudioMixerStats::accumulate(const AudioMixerStats& otherStats) {
 
     hrtfRenders += otherStats.hrtfRenders;
     hrtfResets += otherStats.hrtfResets;
-    hrtfUpdates += otherStats.hrtfUpdates;
+    hrtfInUse += otherStats.hrtfInUse;
+    hrtfAllocated += otherStats.hrtfAllocated;
 
     manualStereoMixes += otherStats.manualStereoMixes;
     manualEchoMixes += otherStats.manualEchoMixes;
@@ -25,7 +25,8 @@ struct AudioMixerStats {
 
     int hrtfRenders { 0 };
     int hrtfResets { 0 };
-    int hrtfUpdates { 0 };
+    int hrtfInUse { 0 };      // HRTF instances held by audible streams, summed over listeners
+    int hrtfAllocated { 0 };  // HRTF instances allocated by the per-listener pools
 
     int manualStereoMixes { 0 };
     int manualEchoMixes { 0 };
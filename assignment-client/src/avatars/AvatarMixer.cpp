@@ -640,8 +640,11 @@ void AvatarMixer::handleRequestsDomainListDataPacket(QSharedPointer<ReceivedMess
                     // ...For those nodes, reset the lastBroadcastTime to 0
                     // so that the AvatarMixer will send Identity data to us
                     [&](const SharedNodePointer& node) {
-                        nodeData->setLastBroadcastTime(node->getLocalID(), 0);
-                        nodeData->resetSentTraitData(node->getLocalID());
+                        auto otherNodeData = reinterpret_cast<AvatarMixerClientData*>(node->getLinkedData());
+                        if (otherNodeData) {
+                            nodeData->setLastBroadcastTime(*otherNodeData, 0);
+                            nodeData->resetSentTraitData(*otherNodeData);
+                        }
                 }
                 );
             }
@@ -703,22 +706,19 @@ void AvatarMixer::handleNodeIgnoreRequestPacket(QSharedPointer<ReceivedMessage>
         QUuid ignoredUUID = QUuid::fromRfc4122(message->readWithoutCopy(NUM_BYTES_RFC4122_UUID));
         auto ignoredNode = nodeList->nodeWithUUID(ignoredUUID);
         if (ignoredNode) {
-            if (nodeData) {
+            AvatarMixerClientData* ignoredNodeData = reinterpret_cast<AvatarMixerClientData*>(ignoredNode->getLinkedData());
+            if (nodeData && ignoredNodeData) {
                 // Reset the lastBroadcastTime for the ignored avatar to 0
                 // so the AvatarMixer knows it'll have to send identity data about the ignored avatar
                 // to the ignorer if the ignorer unignores.
-                nodeData->setLastBroadcastTime(ignoredNode->getLocalID(), 0);
-                nodeData->resetSentTraitData(ignoredNode->getLocalID());
-            }
-
-
-            // Reset the lastBroadcastTime for the ignorer (FROM THE PERSPECTIVE OF THE IGNORED) to 0
-            // so the AvatarMixer knows it'll have to send identity data about the ignorer
-            // to the ignored if the ignorer unignores.
-            AvatarMixerClientData* ignoredNodeData = reinterpret_cast<AvatarMixerClientData*>(ignoredNode->getLinkedData());
-            if (ignoredNodeData) {
-                ignoredNodeData->setLastBroadcastTime(senderNode->getLocalID(), 0);
-                ignoredNodeData->resetSentTraitData(senderNode->getLocalID());
+                nodeData->setLastBroadcastTime(*ignoredNodeData, 0);
+                nodeData->resetSentTraitData(*ignoredNodeData);
+
+                // Reset the lastBroadcastTime for the ignorer (FROM THE PERSPECTIVE OF THE IGNORED) to 0
+                // so the AvatarMixer knows it'll have to send identity data about the ignorer
+                // to the ignored if the ignorer unignores.
+                ignoredNodeData->setLastBroadcastTime(*nodeData, 0);
+                ignoredNodeData->resetSentTraitData(*nodeData);
             }
         }
 
@@ -767,6 +767,7 @@ void AvatarMixer::sendStatsPacket() {
     statsObject["threads"] = _slavePool.numThreads();
     statsObject["trailing_mix_ratio"] = _trailingMixRatio;
     statsObject["throttling_ratio"] = _throttlingRatio;
+    statsObject["resource_memory"] = QJsonObject::fromVariantMap(ResourceCache::getMemoryStats());
 
 #ifdef DEBUG_EVENT_QUEUE
     QJsonObject qtStats;
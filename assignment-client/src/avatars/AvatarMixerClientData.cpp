@@ -12,6 +12,8 @@
 #include "AvatarMixerClientData.h"
 
 #include <algorithm>
+#include <functional>
+#include <mutex>
 #include <udt/PacketHeaders.h>
 
 #include <DependencyManager.h>
@@ -23,26 +25,45 @@
 
 #include "AvatarMixerSlave.h"
 
-AvatarMixerClientData::AvatarMixerClientData(const QUuid& nodeID, Node::LocalID nodeLocalID) : NodeData(nodeID, nodeLocalID) {
+namespace {
+// pair indices are handed out lowest first, so the pair states stay as small as the number of connected avatars
+std::mutex pairIndicesMutex;
+std::vector<int> freePairIndices;
+int numPairIndices { 0 };
+}  // namespace
+
+AvatarMixerClientData::AvatarMixerClientData(const QUuid& nodeID, Node::LocalID nodeLocalID) :
+    NodeData(nodeID, nodeLocalID),
+    _pairIndex(acquirePairIndex())
+{
     // in case somebody calls getSessionUUID on the AvatarData instance, make sure it has the right ID
     _avatar->setID(nodeID);
 }
 
-uint64_t AvatarMixerClientData::getLastOtherAvatarEncodeTime(NLPacket::LocalID otherAvatar) const {
-    const auto itr = _lastOtherAvatarEncodeTime.find(otherAvatar);
-    if (itr != _lastOtherAvatarEncodeTime.end()) {
-        return itr->second;
-    }
-    return 0;
+AvatarMixerClientData::~AvatarMixerClientData() {
+    releasePairIndex(_pairIndex);
 }
 
-void AvatarMixerClientData::setLastOtherAvatarEncodeTime(NLPacket::LocalID otherAvatar, uint64_t time) {
-    auto itr = _lastOtherAvatarEncodeTime.find(otherAvatar);
-    if (itr != _lastOtherAvatarEncodeTime.end()) {
-        itr->second = time;
-    } else {
-        _lastOtherAvatarEncodeTime.emplace(std::pair<NLPacket::LocalID, uint64_t>(otherAvatar, time));
+int AvatarMixerClientData::acquirePairIndex() {
+    std::lock_guard<std::mutex> lock(pairIndicesMutex);
+    if (freePairIndices.empty()) {
+        return numPairIndices++;
     }
+    std::pop_heap(freePairIndices.begin(), freePairIndices.end(), std::greater<int>());
+    int index = freePairIndices.back();
+    freePairIndices.pop_back();
+    return index;
+}
+
+void AvatarMixerClientData::releasePairIndex(int index) {
+    std::lock_guard<std::mutex> lock(pairIndicesMutex);
+    freePairIndices.push_back(index);
+    std::push_heap(freePairIndices.begin(), freePairIndices.end(), std::greater<int>());
+}
+
+uint64_t AvatarMixerClientData::getLastOtherAvatarEncodeTime(const AvatarMixerClientData& otherAvatar) const {
+    auto state = findPairState(otherAvatar);
+    return state ? state->lastEncodeTime : 0;
 }
 
 void AvatarMixerClientData::queuePacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer node) {
@@ -419,22 +440,16 @@ void AvatarMixerClientData::checkSkeletonURLAgainstWhitelist(const SlaveSharedDa
     }
 }
 
-uint64_t AvatarMixerClientData::getLastBroadcastTime(NLPacket::LocalID nodeUUID) const {
-    // return the matching PacketSequenceNumber, or the default if we don't have it
-    auto nodeMatch = _lastBroadcastTimes.find(nodeUUID);
-    if (nodeMatch != _lastBroadcastTimes.end()) {
-        return nodeMatch->second;
-    }
-    return 0;
+uint64_t AvatarMixerClientData::getLastBroadcastTime(const AvatarMixerClientData& other) const {
+    // return the matching broadcast time, or the default if we don't have it
+    auto state = findPairState(other);
+    return state ? state->lastBroadcastTime : 0;
 }
 
-uint16_t AvatarMixerClientData::getLastBroadcastSequenceNumber(NLPacket::LocalID nodeID) const {
+uint16_t AvatarMixerClientData::getLastBroadcastSequenceNumber(const AvatarMixerClientData& other) const {
     // return the matching PacketSequenceNumber, or the default if we don't have it
-    auto nodeMatch = _lastBroadcastSequenceNumbers.find(nodeID);
-    if (nodeMatch != _lastBroadcastSequenceNumbers.end()) {
-        return nodeMatch->second;
-    }
-    return 0;
+    auto state = findPairState(other);
+    return state ? state->lastBroadcastSequenceNumber : 0;
 }
 
 void AvatarMixerClientData::ignoreOther(SharedNodePointer self, SharedNodePointer other) {
@@ -451,9 +466,11 @@ void AvatarMixerClientData::ignoreOther(const Node* self, const Node* other) {
         } else {
             killPacket->writePrimitive(KillAvatarReason::YourAvatarEnteredTheirBubble);
         }
-        setLastBroadcastTime(other->getLocalID(), 0);
-
-        resetSentTraitData(other->getLocalID());
+        auto otherData = reinterpret_cast<const AvatarMixerClientData*>(other->getLinkedData());
+        if (otherData) {
+            setLastBroadcastTime(*otherData, 0);
+            resetSentTraitData(*otherData);
+        }
 
         DependencyManager::get<NodeList>()->sendPacket(std::move(killPacket), *self);
     }
@@ -476,8 +493,9 @@ void AvatarMixerClientData::removeFromRadiusIgnoringSet(const QUuid& other) {
     }
 }
 
-void AvatarMixerClientData::resetSentTraitData(Node::LocalID nodeLocalID) {
-    _lastSentTraitsTimestamps[nodeLocalID] = TraitsCheckTimestamp();
+void AvatarMixerClientData::resetSentTraitData(const AvatarMixerClientData& other) {
+    auto nodeLocalID = other.getNodeLocalID();
+    getPairState(other).lastSentTraitsTimestamp = TraitsCheckTimestamp();
     _perNodeSentTraitVersions[nodeLocalID].reset();
     _perNodeAckedTraitVersions[nodeLocalID].reset();
     for (auto&& pendingTraitVersions : _perNodePendingTraitVersions) {
@@ -521,23 +539,17 @@ void AvatarMixerClientData::loadJSONStats(QJsonObject& jsonObject) const {
     jsonObject["av_data_receive_rate"] = _avatar->getReceiveRate();
     jsonObject["recent_other_av_in_view"] = _recentOtherAvatarsInView;
     jsonObject["recent_other_av_out_of_view"] = _recentOtherAvatarsOutOfView;
+    jsonObject["pair_states_kb"] = (double)_pairStates.getMemoryUsage() / BYTES_PER_KILOBYTE;
 }
 
 AvatarMixerClientData::TraitsCheckTimestamp AvatarMixerClientData::getLastOtherAvatarTraitsSendPoint(
-    Node::LocalID otherAvatar) const {
-    auto it = _lastSentTraitsTimestamps.find(otherAvatar);
-
-    if (it != _lastSentTraitsTimestamps.end()) {
-        return it->second;
-    } else {
-        return TraitsCheckTimestamp();
-    }
+    const AvatarMixerClientData& otherAvatar) const {
+    auto state = findPairState(otherAvatar);
+    return state ? state->lastSentTraitsTimestamp : TraitsCheckTimestamp();
 }
 
 void AvatarMixerClientData::cleanupKilledNode(const QUuid&, Node::LocalID nodeLocalID) {
-    removeLastBroadcastSequenceNumber(nodeLocalID);
-    removeLastBroadcastTime(nodeLocalID);
-    _lastSentTraitsTimestamps.erase(nodeLocalID);
+    _pairStates.remove(nodeLocalID);
     _perNodeSentTraitVersions.erase(nodeLocalID);
     _perNodeAckedTraitVersions.erase(nodeLocalID);
     for (auto&& pendingTraitVersions : _perNodePendingTraitVersions) {
@@ -23,6 +23,7 @@
 
 #include "MixerAvatar.h"
 #include <AssociatedTraitValues.h>
+#include <AvatarPairStates.h>
 #include <NodeData.h>
 #include <NumericalConstants.h>
 #include <udt/PacketHeaders.h>
@@ -41,7 +42,7 @@ class AvatarMixerClientData : public NodeData {
     Q_OBJECT
 public:
     AvatarMixerClientData(const QUuid& nodeID, Node::LocalID nodeLocalID);
-    virtual ~AvatarMixerClientData() {}
+    virtual ~AvatarMixerClientData();
     using HRCTime = p_high_resolution_clock::time_point;
     using PerNodeTraitVersions = std::unordered_map<Node::LocalID, AvatarTraits::TraitVersions>;
 
@@ -52,16 +53,18 @@ public:
     const MixerAvatar* getConstAvatarData() const { return _avatar.get(); }
     MixerAvatarSharedPointer getAvatarSharedPointer() const { return _avatar; }
 
-    uint16_t getLastBroadcastSequenceNumber(NLPacket::LocalID nodeID) const;
-    void setLastBroadcastSequenceNumber(NLPacket::LocalID nodeID, uint16_t sequenceNumber)
-        { _lastBroadcastSequenceNumbers[nodeID] = sequenceNumber; }
-    Q_INVOKABLE void removeLastBroadcastSequenceNumber(NLPacket::LocalID nodeID) { _lastBroadcastSequenceNumbers.erase(nodeID); }
+    // Index of this avatar in the pair states of the other avatars, reused once this avatar is gone
+    int getPairIndex() const { return _pairIndex; }
+
+    uint16_t getLastBroadcastSequenceNumber(const AvatarMixerClientData& other) const;
+    void setLastBroadcastSequenceNumber(const AvatarMixerClientData& other, uint16_t sequenceNumber)
+        { getPairState(other).lastBroadcastSequenceNumber = sequenceNumber; }
     bool isIgnoreRadiusEnabled() const { return _isIgnoreRadiusEnabled; }
     void setIsIgnoreRadiusEnabled(bool enabled) { _isIgnoreRadiusEnabled = enabled; }
 
-    uint64_t getLastBroadcastTime(NLPacket::LocalID nodeUUID) const;
-    void setLastBroadcastTime(NLPacket::LocalID nodeUUID, uint64_t broadcastTime) { _lastBroadcastTimes[nodeUUID] = broadcastTime; }
-    Q_INVOKABLE void removeLastBroadcastTime(NLPacket::LocalID nodeUUID) { _lastBroadcastTimes.erase(nodeUUID); }
+    uint64_t getLastBroadcastTime(const AvatarMixerClientData& other) const;
+    void setLastBroadcastTime(const AvatarMixerClientData& other, uint64_t broadcastTime)
+        { getPairState(other).lastBroadcastTime = broadcastTime; }
 
     Q_INVOKABLE void cleanupKilledNode(const QUuid& nodeUUID, Node::LocalID nodeLocalID);
 
@@ -123,10 +126,12 @@ public:
 
     const ConicalViewFrustums& getViewFrustums() const { return _currentViewFrustums; }
 
-    uint64_t getLastOtherAvatarEncodeTime(NLPacket::LocalID otherAvatar) const;
-    void setLastOtherAvatarEncodeTime(NLPacket::LocalID otherAvatar, uint64_t time);
+    uint64_t getLastOtherAvatarEncodeTime(const AvatarMixerClientData& otherAvatar) const;
+    void setLastOtherAvatarEncodeTime(const AvatarMixerClientData& otherAvatar, uint64_t time)
+        { getPairState(otherAvatar).lastEncodeTime = time; }
 
-    QVector<JointData>& getLastOtherAvatarSentJoints(NLPacket::LocalID otherAvatar) { return _lastOtherAvatarSentJoints[otherAvatar]; }
+    PackedJointData& getLastOtherAvatarSentJoints(const AvatarMixerClientData& otherAvatar)
+        { return _pairStates.getSentJoints(otherAvatar.getPairIndex(), otherAvatar.getNodeLocalID()); }
 
     void queuePacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer node);
     int processPackets(const SlaveSharedData& slaveSharedData); // returns number of packets processed
@@ -144,9 +149,9 @@ public:
     AvatarTraits::TraitVersions& getLastReceivedTraitVersions() { return _lastReceivedTraitVersions; }
     const AvatarTraits::TraitVersions& getLastReceivedTraitVersions() const { return _lastReceivedTraitVersions; }
 
-    TraitsCheckTimestamp getLastOtherAvatarTraitsSendPoint(Node::LocalID otherAvatar) const;
-    void setLastOtherAvatarTraitsSendPoint(Node::LocalID otherAvatar, TraitsCheckTimestamp sendPoint)
-        { _lastSentTraitsTimestamps[otherAvatar] = sendPoint; }
+    TraitsCheckTimestamp getLastOtherAvatarTraitsSendPoint(const AvatarMixerClientData& otherAvatar) const;
+    void setLastOtherAvatarTraitsSendPoint(const AvatarMixerClientData& otherAvatar, TraitsCheckTimestamp sendPoint)
+        { getPairState(otherAvatar).lastSentTraitsTimestamp = sendPoint; }
 
     AvatarTraits::TraitMessageSequence getTraitsMessageSequence() const { return _currentTraitsMessageSequence; }
     AvatarTraits::TraitMessageSequence nextTraitsMessageSequence() { return ++_currentTraitsMessageSequence; }
@@ -157,9 +162,17 @@ public:
     AvatarTraits::TraitVersions& getLastSentTraitVersions(Node::LocalID otherAvatar) { return _perNodeSentTraitVersions[otherAvatar]; }
     AvatarTraits::TraitVersions& getLastAckedTraitVersions(Node::LocalID otherAvatar) { return _perNodeAckedTraitVersions[otherAvatar]; }
 
-    void resetSentTraitData(Node::LocalID nodeID);
+    void resetSentTraitData(const AvatarMixerClientData& other);
 
 private:
+    AvatarPairStates::State& getPairState(const AvatarMixerClientData& other)
+        { return _pairStates.get(other.getPairIndex(), other.getNodeLocalID()); }
+    const AvatarPairStates::State* findPairState(const AvatarMixerClientData& other) const
+        { return _pairStates.find(other.getPairIndex(), other.getNodeLocalID()); }
+
+    static int acquirePairIndex();
+    static void releasePairIndex(int index);
+
     struct PacketQueue : public std::queue<QSharedPointer<ReceivedMessage>> {
         QWeakPointer<Node> node;
     };
@@ -168,13 +181,10 @@ private:
     MixerAvatarSharedPointer _avatar { new MixerAvatar() };
 
     uint16_t _lastReceivedSequenceNumber { 0 };
-    std::unordered_map<NLPacket::LocalID, uint16_t> _lastBroadcastSequenceNumbers;
-    std::unordered_map<NLPacket::LocalID, uint64_t> _lastBroadcastTimes;
 
-    // this is a map of the last time we encoded an "other" avatar for
-    // sending to "this" node
-    std::unordered_map<NLPacket::LocalID, uint64_t> _lastOtherAvatarEncodeTime;
-    std::unordered_map<NLPacket::LocalID, QVector<JointData>> _lastOtherAvatarSentJoints;
+    int _pairIndex;
+    // what was last sent to "this" node about each "other" avatar
+    AvatarPairStates _pairStates;
 
     uint64_t _identityChangeTimestamp;
     bool _avatarSessionDisplayNameMustChange{ true };
@@ -217,8 +227,6 @@ private:
     // received.
     PerNodeTraitVersions _perNodeAckedTraitVersions;
 
-    std::unordered_map<Node::LocalID, TraitsCheckTimestamp> _lastSentTraitsTimestamps;
-
     // cache of traits sent to a node which are compared to incoming traits to 
     // prevent sending traits that have already been sent.
     PerNodeTraitVersions _perNodeSentTraitVersions;
@@ -26,6 +26,7 @@
 #include <Node.h>
 #include <OctreeConstants.h>
 #include <PrioritySortUtil.h>
+#include <Profile.h>
 #include <udt/PacketHeaders.h>
 #include <SharedUtil.h>
 #include <StDev.h>
@@ -60,6 +61,7 @@ void AvatarMixerSlave::harvestStats(AvatarMixerSlaveStats& stats) {
 
 
 void AvatarMixerSlave::processIncomingPackets(const SharedNodePointer& node) {
+    TRACE_SCOPE(network, "AvatarMixerSlave::processIncomingPackets")
     auto start = usecTimestampNow();
     auto nodeData = dynamic_cast<AvatarMixerClientData*>(node->getLinkedData());
     if (nodeData) {
@@ -112,7 +114,7 @@ qint64 AvatarMixerSlave::addChangedTraitsToBulkPacket(AvatarMixerClientData* lis
 
     // Perform a simple check with two server clock time points
     // to see if there is any new traits data for this avatar that we need to send
-    auto timeOfLastTraitsSent = listeningNodeData->getLastOtherAvatarTraitsSendPoint(sendingNodeLocalID);
+    auto timeOfLastTraitsSent = listeningNodeData->getLastOtherAvatarTraitsSendPoint(*sendingNodeData);
     auto timeOfLastTraitsChange = sendingNodeData->getLastReceivedTraitsChange();
     bool allTraitsUpdated = true;
 
@@ -236,7 +238,7 @@ qint64 AvatarMixerSlave::addChangedTraitsToBulkPacket(AvatarMixerClientData* lis
             // since we send all traits for this other avatar, update the time of last traits sent
             // to match the time of last traits change
             if (allTraitsUpdated) {
-                listeningNodeData->setLastOtherAvatarTraitsSendPoint(sendingNodeLocalID, timeOfLastTraitsChange);
+                listeningNodeData->setLastOtherAvatarTraitsSendPoint(*sendingNodeData, timeOfLastTraitsChange);
             }
         }
     }
@@ -263,6 +265,7 @@ int AvatarMixerSlave::sendReplicatedIdentityPacket(const Node& agentNode, const
 static const int AVATAR_MIXER_BROADCAST_FRAMES_PER_SECOND = 45;
 
 void AvatarMixerSlave::broadcastAvatarData(const SharedNodePointer& node) {
+    TRACE_SCOPE(app, "AvatarMixerSlave::broadcastAvatarData")
     quint64 start = usecTimestampNow();
 
     if ((node->getType() == NodeType::Agent || node->getType() == NodeType::EntityScriptServer) && node->getLinkedData() && node->getActiveSocket() && !node->isUpstream()) {
@@ -444,7 +447,7 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
         }
 
         if (sendAvatar) {
-            AvatarDataSequenceNumber lastSeqToReceiver = destinationNodeData->getLastBroadcastSequenceNumber(sourceAvatarNode->getLocalID());
+            AvatarDataSequenceNumber lastSeqToReceiver = destinationNodeData->getLastBroadcastSequenceNumber(*sourceAvatarNodeData);
             AvatarDataSequenceNumber lastSeqFromSender = sourceAvatarNodeData->getLastReceivedSequenceNumber();
 
             // FIXME - This code does appear to be working. But it seems brittle.
@@ -477,7 +480,7 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
         if (sendAvatar) {
             // sort this one for later
             const MixerAvatar* avatarNodeData = sourceAvatarNodeData->getConstAvatarData();
-            auto lastEncodeTime = destinationNodeData->getLastOtherAvatarEncodeTime(sourceAvatarNode->getLocalID());
+            auto lastEncodeTime = destinationNodeData->getLastOtherAvatarEncodeTime(*sourceAvatarNodeData);
 
             avatarPriorityQueues[avatarNodeData->getHasPriority() ? kHero : kNonhero].push(
                 SortableAvatar(avatarNodeData, sourceAvatarNode, lastEncodeTime));
@@ -565,15 +568,15 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
                 // If the time that the mixer sent AVATAR DATA about Avatar B to Node A is BEFORE OR EQUAL TO
                 // the time that Avatar B flagged an IDENTITY DATA change, send IDENTITY DATA about Avatar B to Node A.
                 if (sourceAvatar->hasProcessedFirstIdentity()
-                    && destinationNodeData->getLastBroadcastTime(sourceNode->getLocalID()) <= sourceNodeData->getIdentityChangeTimestamp()) {
+                    && destinationNodeData->getLastBroadcastTime(*sourceNodeData) <= sourceNodeData->getIdentityChangeTimestamp()) {
                     identityBytesSent += sendIdentityPacket(*identityPacketList, sourceNodeData, *destinationNode);
 
                     // remember the last time we sent identity details about this other node to the receiver
-                    destinationNodeData->setLastBroadcastTime(sourceNode->getLocalID(), usecTimestampNow());
+                    destinationNodeData->setLastBroadcastTime(*sourceNodeData, usecTimestampNow());
                 }
             }
 
-            QVector<JointData>& lastSentJointsForOther = destinationNodeData->getLastOtherAvatarSentJoints(sourceNode->getLocalID());
+            PackedJointData& lastSentJointsForOther = destinationNodeData->getLastOtherAvatarSentJoints(*sourceNodeData);
 
             const bool distanceAdjust = true;
             const bool dropFaceTracking = false;
@@ -583,8 +586,7 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
             do {
                 auto startSerialize = chrono::high_resolution_clock::now();
                 QByteArray bytes = sourceAvatar->toByteArray(detail, lastEncodeForOther, lastSentJointsForOther,
-                    sendStatus, dropFaceTracking, distanceAdjust, destinationPosition,
-                    &lastSentJointsForOther, avatarSpaceAvailable);
+                    sendStatus, dropFaceTracking, distanceAdjust, destinationPosition, avatarSpaceAvailable);
                 auto endSerialize = chrono::high_resolution_clock::now();
                 _stats.toByteArrayElapsedTime +=
                     (quint64)chrono::duration_cast<chrono::microseconds>(endSerialize - startSerialize).count();
@@ -611,9 +613,9 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
                 destinationNodeData->incrementNumAvatarsSentLastFrame();
 
                 // set the last sent sequence number for this sender on the receiver
-                destinationNodeData->setLastBroadcastSequenceNumber(sourceNode->getLocalID(),
+                destinationNodeData->setLastBroadcastSequenceNumber(*sourceNodeData,
                     sourceNodeData->getLastReceivedSequenceNumber());
-                destinationNodeData->setLastOtherAvatarEncodeTime(sourceNode->getLocalID(), usecTimestampNow());
+                destinationNodeData->setLastOtherAvatarEncodeTime(*sourceNodeData, usecTimestampNow());
             }
 
             auto endAvatarDataPacking = chrono::high_resolution_clock::now();
@@ -724,11 +726,11 @@ void AvatarMixerSlave::broadcastAvatarDataToDownstreamMixer(const SharedNodePoin
             quint64 end = usecTimestampNow();
             _stats.toByteArrayElapsedTime += (end - start);
 
-            auto lastBroadcastTime = nodeData->getLastBroadcastTime(agentNode->getLocalID());
+            auto lastBroadcastTime = nodeData->getLastBroadcastTime(*agentNodeData);
             if (lastBroadcastTime <= agentNodeData->getIdentityChangeTimestamp()
                 || (start - lastBroadcastTime) >= REBROADCAST_IDENTITY_TO_DOWNSTREAM_EVERY_US) {
                 sendReplicatedIdentityPacket(*agentNode, agentNodeData, *node);
-                nodeData->setLastBroadcastTime(agentNode->getLocalID(), start);
+                nodeData->setLastBroadcastTime(*agentNodeData, start);
             }
 
             // figure out how large our avatar byte array can be to fit in the packet list
@@ -762,7 +764,7 @@ void AvatarMixerSlave::broadcastAvatarDataToDownstreamMixer(const SharedNodePoin
                 nodeData->incrementNumAvatarsSentLastFrame();
 
                 // set the last sent sequence number for this sender on the receiver
-                nodeData->setLastBroadcastSequenceNumber(agentNode->getLocalID(),
+                nodeData->setLastBroadcastSequenceNumber(*agentNodeData,
                                                          agentNodeData->getLastReceivedSequenceNumber());
 
                 // increment the number of avatars sent to this reciever
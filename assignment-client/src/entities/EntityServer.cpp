@@ -17,6 +17,7 @@
 #include <QJsonDocument>
 
 #include <EntityTree.h>
+#include <EntityTreeCache.h>
 #include <ResourceCache.h>
 #include <ScriptCache.h>
 #include <plugins/PluginManager.h>
@@ -60,6 +61,8 @@ EntityServer::EntityServer(ReceivedMessage& message) :
         PacketType::ChallengeOwnershipRequest,
         PacketType::ChallengeOwnershipReply },
         PacketReceiver::makeSourcedListenerReference<EntityServer>(this, &EntityServer::handleEntityPacket));
+    packetReceiver.registerListener(PacketType::EntityCacheManifest,
+        PacketReceiver::makeSourcedListenerReference<EntityServer>(this, &EntityServer::handleEntityCacheManifest));
 
     connect(&_dynamicDomainVerificationTimer, &QTimer::timeout, this, &EntityServer::startDynamicDomainVerification);
     _dynamicDomainVerificationTimer.setSingleShot(true);
@@ -89,8 +92,23 @@ void EntityServer::handleEntityPacket(QSharedPointer<ReceivedMessage> message, S
     }
 }
 
+void EntityServer::handleEntityCacheManifest(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
+    EntityTreeCache::Manifest manifest;
+    if (!EntityTreeCache::decodeManifest(message->getMessage(), manifest)) {
+        qDebug() << "Ignoring malformed entity cache manifest from" << senderNode->getUUID();
+        return;
+    }
+
+    // the send thread for this node reconciles the manifest against the tree when it starts its next traversal
+    auto nodeData = static_cast<EntityNodeData*>(DependencyManager::get<NodeList>()->getOrCreateLinkedData(senderNode));
+    if (nodeData) {
+        nodeData->setEntityCacheManifest(std::move(manifest));
+    }
+}
+
 std::unique_ptr<OctreeQueryNode> EntityServer::createOctreeQueryNode() {
-    return std::unique_ptr<OctreeQueryNode> { new EntityNodeData() };
+    EntityTreePointer tree = std::static_pointer_cast<EntityTree>(_tree);
+    return std::unique_ptr<OctreeQueryNode> { new EntityNodeData(tree ? tree->getDeletionLog() : nullptr) };
 }
 
 OctreePointer EntityServer::createTree() {
@@ -135,14 +153,14 @@ bool EntityServer::hasSpecialPacketsToSend(const SharedNodePointer& node) {
     // check to see if any new entities have been added since we last sent to this node...
     EntityNodeData* nodeData = static_cast<EntityNodeData*>(node->getLinkedData());
     if (nodeData) {
-        quint64 deletedEntitiesSentAt = nodeData->getLastDeletedEntitiesSentAt();
-        EntityTreePointer tree = std::static_pointer_cast<EntityTree>(_tree);
-        shouldSendDeletedEntities = tree->hasEntitiesDeletedSince(deletedEntitiesSentAt);
+        const auto& deletionLog = nodeData->getDeletionLog();
+        auto deletedEntitiesCursor = nodeData->getDeletedEntitiesCursor();
+        shouldSendDeletedEntities = (deletionLog && deletionLog->getEnd() > deletedEntitiesCursor) ||
+            nodeData->hasStaleCachedEntities();
 
         #ifdef EXTRA_ERASE_DEBUGGING
             if (shouldSendDeletedEntities) {
-                int elapsed = usecTimestampNow() - deletedEntitiesSentAt;
-                qDebug() << "shouldSendDeletedEntities to node:" << node->getUUID() << "deletedEntitiesSentAt:" << deletedEntitiesSentAt << "elapsed:" << elapsed;
+                qDebug() << "shouldSendDeletedEntities to node:" << node->getUUID() << "deletedEntitiesCursor:" << deletedEntitiesCursor;
             }
         #endif
     }
@@ -150,22 +168,20 @@ bool EntityServer::hasSpecialPacketsToSend(const SharedNodePointer& node) {
     return shouldSendDeletedEntities;
 }
 
-// FIXME - most of the old code for this was encapsulated in EntityTree, I liked that design from a data
-// hiding and object oriented perspective. But that didn't really allow us to handle the case of lots
-// of entities being deleted at the same time. I'd like to look to move this back into EntityTree but
-// for now this works and addresses the bug.
+// The deleted entity IDs are encoded once in the deletion log of the tree, in runs that each fill an erase packet,
+// which are copied as they are into the packets of every node from where its cursor is.
 int EntityServer::sendSpecialPackets(const SharedNodePointer& node, OctreeQueryNode* queryNode, int& packetsSent) {
     int totalBytes = 0;
 
     EntityNodeData* nodeData = static_cast<EntityNodeData*>(node->getLinkedData());
     if (nodeData) {
 
-        quint64 deletedEntitiesSentAt = nodeData->getLastDeletedEntitiesSentAt();
-        quint64 considerEntitiesSince = EntityTree::getAdjustedConsiderSince(deletedEntitiesSentAt);
-
-        quint64 deletePacketSentAt = usecTimestampNow();
-        EntityTreePointer tree = std::static_pointer_cast<EntityTree>(_tree);
-        auto recentlyDeleted = tree->getRecentlyDeletedEntityIDs();
+        std::vector<EntityDeletionLog::Run> deletedRuns;
+        auto deletedEntitiesCursor = nodeData->getDeletedEntitiesCursor();
+        const auto& deletionLog = nodeData->getDeletionLog();
+        if (deletionLog) {
+            deletedEntitiesCursor = deletionLog->getDeletedSince(deletedEntitiesCursor, deletedRuns);
+        }
 
         packetsSent = 0;
 
@@ -189,76 +205,65 @@ int EntityServer::sendSpecialPackets(const SharedNodePointer& node, OctreeQueryN
         qint64 numberOfIDsPos = deletesPacket->pos();
         deletesPacket->writePrimitive(numberOfIDs);
 
-        // we keep a multi map of entity IDs to timestamps, we only want to include the entity IDs that have been
-        // deleted since we last sent to this node
-        auto it = recentlyDeleted.constBegin();
-        while (it != recentlyDeleted.constEnd()) {
-
-            // if the timestamp is more recent then out last sent time, include it
-            if (it.key() > considerEntitiesSince) {
-
-                // get all the IDs for this timestamp
-                const auto& entityIDsFromTime = recentlyDeleted.values(it.key());
-
-                for (const auto& entityID : entityIDsFromTime) {
-
-                    // check to make sure we have room for one more ID, if we don't have more
-                    // room, then send out this packet and create another one
-                    if (NUM_BYTES_RFC4122_UUID > deletesPacket->bytesAvailableForWrite()) {
-
-                        // replace the count for the number of included IDs
-                        deletesPacket->seek(numberOfIDsPos);
-                        deletesPacket->writePrimitive(numberOfIDs);
-
-                        // Send the current packet
-                        queryNode->packetSent(*deletesPacket);
-                        auto thisPacketSize = deletesPacket->getDataSize();
-                        totalBytes += thisPacketSize;
-                        packetsSent++;
-                        DependencyManager::get<NodeList>()->sendPacket(std::move(deletesPacket), *node);
+        auto appendEncodedIDs = [&](const char* encodedIDs, int numIDs) {
+            while (numIDs > 0) {
+                // check to make sure we have room for one more ID, if we don't have more
+                // room, then send out this packet and create another one
+                if (NUM_BYTES_RFC4122_UUID > deletesPacket->bytesAvailableForWrite()) {
 
-                        #ifdef EXTRA_ERASE_DEBUGGING
-                            qDebug() << "EntityServer::sendSpecialPackets() sending packet packetsSent[" << packetsSent << "] size:" << thisPacketSize;
-                        #endif
+                    // replace the count for the number of included IDs
+                    deletesPacket->seek(numberOfIDsPos);
+                    deletesPacket->writePrimitive(numberOfIDs);
 
+                    // Send the current packet
+                    queryNode->packetSent(*deletesPacket);
+                    auto thisPacketSize = deletesPacket->getDataSize();
+                    totalBytes += thisPacketSize;
+                    packetsSent++;
+                    DependencyManager::get<NodeList>()->sendPacket(std::move(deletesPacket), *node);
 
-                        // create another packet
-                        deletesPacket = NLPacket::create(PacketType::EntityErase);
+                    #ifdef EXTRA_ERASE_DEBUGGING
+                        qDebug() << "EntityServer::sendSpecialPackets() sending packet packetsSent[" << packetsSent << "] size:" << thisPacketSize;
+                    #endif
 
-                        // pack in flags
-                        deletesPacket->writePrimitive(flags);
 
-                        // pack in sequence number
-                        sequenceNumber = queryNode->getSequenceNumber();
-                        deletesPacket->writePrimitive(sequenceNumber);
+                    // create another packet
+                    deletesPacket = NLPacket::create(PacketType::EntityErase);
 
-                        // pack in timestamp
-                        deletesPacket->writePrimitive(now);
+                    // pack in flags
+                    deletesPacket->writePrimitive(flags);
 
-                        // figure out where we are now and pack a temporary number of IDs
-                        numberOfIDs = 0;
-                        numberOfIDsPos = deletesPacket->pos();
-                        deletesPacket->writePrimitive(numberOfIDs);
-                    }
+                    // pack in sequence number
+                    sequenceNumber = queryNode->getSequenceNumber();
+                    deletesPacket->writePrimitive(sequenceNumber);
 
-                    // FIXME - we still seem to see cases where incorrect EntityIDs get sent from the server
-                    // to the client. These were causing "lost" entities like flashlights and laser pointers
-                    // now that we keep around some additional history of the erased entities and resend that
-                    // history for a longer time window, these entities are not "lost". But we haven't yet
-                    // found/fixed the underlying issue that caused bad UUIDs to be sent to some users.
-                    deletesPacket->write(entityID.toRfc4122());
-                    ++numberOfIDs;
+                    // pack in timestamp
+                    deletesPacket->writePrimitive(now);
 
-                    #ifdef EXTRA_ERASE_DEBUGGING
-                        qDebug() << "EntityTree::encodeEntitiesDeletedSince() including:" << entityID;
-                    #endif
-                } // end for (ids)
+                    // figure out where we are now and pack a temporary number of IDs
+                    numberOfIDs = 0;
+                    numberOfIDsPos = deletesPacket->pos();
+                    deletesPacket->writePrimitive(numberOfIDs);
+                }
 
-            } // end if (it.val > sinceLast)
+                // as many of the IDs as there is room for
+                int numIDsToWrite = std::min(numIDs, (int)(deletesPacket->bytesAvailableForWrite() / NUM_BYTES_RFC4122_UUID));
+                deletesPacket->write(encodedIDs, numIDsToWrite * NUM_BYTES_RFC4122_UUID);
+                numberOfIDs += numIDsToWrite;
+                encodedIDs += numIDsToWrite * NUM_BYTES_RFC4122_UUID;
+                numIDs -= numIDsToWrite;
+            }
+        };
 
+        // the IDs deleted since the cursor of this node, each run fills a packet when the node is at its start
+        for (const auto& run : deletedRuns) {
+            appendEncodedIDs(run.data(), run.numIDs);
+        }
 
-            ++it;
-        } // end while
+        // entities from the node's local cache that were deleted before it connected
+        for (const auto& entityID : nodeData->takeStaleCachedEntities()) {
+            appendEncodedIDs(entityID.toRfc4122().constData(), 1);
+        }
 
         // replace the count for the number of included IDs
         deletesPacket->seek(numberOfIDsPos);
@@ -274,7 +279,7 @@ int EntityServer::sendSpecialPackets(const SharedNodePointer& node, OctreeQueryN
             qDebug() << "EntityServer::sendSpecialPackets() sending packet packetsSent[" << packetsSent << "] size:" << thisPacketSize;
         #endif
 
-        nodeData->setLastDeletedEntitiesSentAt(deletePacketSentAt);
+        nodeData->setDeletedEntitiesCursor(deletedEntitiesCursor);
     }
 
     #ifdef EXTRA_ERASE_DEBUGGING
@@ -289,20 +294,10 @@ int EntityServer::sendSpecialPackets(const SharedNodePointer& node, OctreeQueryN
 }
 
 void EntityServer::pruneDeletedEntities() {
+    // the deletion log knows the lowest cursor of the nodes
     EntityTreePointer tree = std::static_pointer_cast<EntityTree>(_tree);
     if (tree->hasAnyDeletedEntities()) {
-
-        quint64 earliestLastDeletedEntitiesSent = usecTimestampNow() + 1; // in the future
-        DependencyManager::get<NodeList>()->eachNode([&earliestLastDeletedEntitiesSent](const SharedNodePointer& node) {
-            if (node->getLinkedData()) {
-                EntityNodeData* nodeData = static_cast<EntityNodeData*>(node->getLinkedData());
-                quint64 nodeLastDeletedEntitiesSentAt = nodeData->getLastDeletedEntitiesSentAt();
-                if (nodeLastDeletedEntitiesSentAt < earliestLastDeletedEntitiesSent) {
-                    earliestLastDeletedEntitiesSent = nodeLastDeletedEntitiesSentAt;
-                }
-            }
-        });
-        tree->forgetEntitiesDeletedBefore(earliestLastDeletedEntitiesSent);
+        tree->getDeletionLog()->prune();
     }
 }
 
@@ -315,6 +310,13 @@ void EntityServer::readAdditionalConfiguration(const QJsonObject& settingsSectio
     readOptionBool(QString("wantTerseEditLogging"), settingsSectionObject, wantTerseEditLogging);
     qDebug("wantTerseEditLogging=%s", debug::valueOf(wantTerseEditLogging));
 
+    bool throttleDistantEntityUpdates;
+    if (!readOptionBool(QString("throttleDistantEntityUpdates"), settingsSectionObject, throttleDistantEntityUpdates)) {
+        throttleDistantEntityUpdates = true;
+    }
+    qDebug("throttleDistantEntityUpdates=%s", debug::valueOf(throttleDistantEntityUpdates));
+    EntityTreeSendThread::setThrottleDistantEntityUpdates(throttleDistantEntityUpdates);
+
     EntityTreePointer tree = std::static_pointer_cast<EntityTree>(_tree);
 
     int maxTmpEntityLifetime;
@@ -10,6 +10,10 @@
 //
 
 #include "EntityTreeHeadlessViewer.h"
+
+#include <EntityTreeCache.h>
+#include <NodeList.h>
+
 #include "SimpleEntitySimulation.h"
 
 EntityTreeHeadlessViewer::EntityTreeHeadlessViewer()
@@ -46,3 +50,19 @@ void EntityTreeHeadlessViewer::update() {
 void EntityTreeHeadlessViewer::processEraseMessage(ReceivedMessage& message, const SharedNodePointer& sourceNode) {
     std::static_pointer_cast<EntityTree>(_tree)->processEraseMessage(message, sourceNode);
 }
+
+int EntityTreeHeadlessViewer::loadCache() {
+    auto domainID = DependencyManager::get<NodeList>()->getDomainHandler().getUUID();
+
+    EntityTreeCache::Manifest manifest;
+    int numLoaded = EntityTreeCache::load(getTree(), domainID, manifest);
+    if (numLoaded > 0) {
+        EntityTreeCache::sendManifest(manifest);
+    }
+    return numLoaded;
+}
+
+int EntityTreeHeadlessViewer::saveCache() {
+    auto domainID = DependencyManager::get<NodeList>()->getDomainHandler().getUUID();
+    return EntityTreeCache::save(getTree(), domainID);
+}
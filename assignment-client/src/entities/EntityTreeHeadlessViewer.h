@@ -52,6 +52,23 @@ public:
 
     virtual void init() override;
 
+public slots:
+    /*@jsdoc
+     * Loads the entities cached for the current domain by {@link EntityViewer.saveCache|saveCache} and tells the entity 
+     * server which versions of them are held, so that it only sends the entities that changed since they were cached.
+     * @function EntityViewer.loadCache
+     * @returns {number} The number of entities loaded from the cache.
+     */
+    int loadCache();
+
+    /*@jsdoc
+     * Caches the entities received from the entity server, for a later {@link EntityViewer.loadCache|loadCache} in the 
+     * same domain.
+     * @function EntityViewer.saveCache
+     * @returns {number} The number of entities cached, or <code>-1</code> if the cache couldn't be written.
+     */
+    int saveCache();
+
 protected:
     virtual OctreePointer createTree() override {
         EntityTreePointer newTree = EntityTreePointer(new EntityTree(true));
@@ -14,9 +14,27 @@
 #include <EntityNodeData.h>
 #include <EntityTypes.h>
 #include <OctreeUtils.h>
+#include <Profile.h>
 
 #include "EntityServer.h"
 
+std::atomic<bool> EntityTreeSendThread::_throttleDistantEntityUpdates { true };
+
+// Update tiers for known moving entities that changed, picked from their angular size in the current view (radians).
+// Clients extrapolate the motion of an entity from its velocities between two updates.
+struct EntityUpdateTier {
+    float minAngularSize;
+    uint64_t interval; // usec
+};
+static const EntityUpdateTier ENTITY_UPDATE_TIERS[] = {
+    { 0.1f, 0 },
+    { 0.03f, 100 * USECS_PER_MSEC },
+    { 0.01f, 250 * USECS_PER_MSEC },
+    { 0.0f, USECS_PER_SECOND }
+};
+// entities this close to one of the views are always in the first tier
+static const float IMMEDIATE_ENTITY_UPDATE_DISTANCE = 10.0f; // meters
+
 EntityTreeSendThread::EntityTreeSendThread(OctreeServer* myServer, const SharedNodePointer& node) :
     OctreeSendThread(myServer, node)
 {
@@ -32,6 +50,7 @@ void EntityTreeSendThread::resetState() {
     qCDebug(entities) << "Clearing known EntityTreeSendThread state for" << _nodeUuid;
 
     _knownState.clear();
+    _deferredUpdates.clear();
     _traversal.reset();
 }
 
@@ -101,7 +120,13 @@ void EntityTreeSendThread::preDistributionProcessing() {
 
 bool EntityTreeSendThread::traverseTreeAndSendContents(SharedNodePointer node, OctreeQueryNode* nodeData,
             bool viewFrustumChanged, bool isFullScene) {
-    if (viewFrustumChanged || _traversal.finished()) {
+    TRACE_SCOPE(app, "EntityTreeSendThread::traverseTreeAndSendContents")
+    // a client that kept entities from a previous visit tells us which versions it has, so that
+    // we start over from what it actually holds instead of from nothing
+    EntityTreeCache::Manifest cacheManifest;
+    bool hasCacheManifest = static_cast<EntityNodeData*>(nodeData)->takeEntityCacheManifest(cacheManifest);
+
+    if (viewFrustumChanged || _traversal.finished() || hasCacheManifest) {
         EntityTreeElementPointer root = std::dynamic_pointer_cast<EntityTreeElement>(_myServer->getOctree()->getRoot());
 
 
@@ -111,7 +136,10 @@ bool EntityTreeSendThread::traverseTreeAndSendContents(SharedNodePointer node, O
         int32_t lodLevelOffset = nodeData->getBoundaryLevelAdjust() + (viewFrustumChanged ? LOW_RES_MOVING_ADJUST : NO_BOUNDARY_ADJUST);
         newView.lodScaleFactor = powf(2.0f, lodLevelOffset);
         
-        startNewTraversal(newView, root, isFullScene);
+        startNewTraversal(newView, root, isFullScene || hasCacheManifest);
+        if (hasCacheManifest) {
+            reconcileEntityCache(cacheManifest, *static_cast<EntityNodeData*>(nodeData));
+        }
 
         // When the viewFrustum changed the sort order may be incorrect, so we re-sort
         // and also use the opportunity to cull anything no longer in view
@@ -155,6 +183,8 @@ bool EntityTreeSendThread::traverseTreeAndSendContents(SharedNodePointer node, O
         OctreeServer::trackTreeTraverseTime((float)(usecTimestampNow() - startTime));
     }
 
+    queueDueDeferredUpdates();
+
     bool sendComplete = OctreeSendThread::traverseTreeAndSendContents(node, nodeData, viewFrustumChanged, isFullScene);
 
     if (sendComplete && nodeData->wantReportInitialCompletion() && _traversal.finished()) {
@@ -241,12 +271,23 @@ void EntityTreeSendThread::startNewTraversal(const DiffTraversal::View& view, En
         case DiffTraversal::First:
             // When we get to a First traversal, clear the _knownState
             _knownState.clear();
+            _deferredUpdates.clear();
             _traversal.setScanCallback([this](DiffTraversal::VisibleElement& next) {
+                next.allKnown = true;
                 next.element->forEachEntity([&](EntityItemPointer entity) {
                     // Bail early if we've already checked this entity this frame
                     if (_sendQueue.contains(entity.get())) {
+                        next.allKnown = false;
                         return;
                     }
+                    // Or if the client has it from its entity cache and it hasn't changed since
+                    uint64_t knownTimestamp = _knownState.get(entity->getDenseIndex());
+                    if (knownTimestamp != 0 &&
+                        entity->getLastEdited() <= knownTimestamp &&
+                        entity->getLastChangedOnServer() <= knownTimestamp) {
+                        return;
+                    }
+                    next.allKnown = false;
                     const auto& view = _traversal.getCurrentView();
                     float priority = view.computePriority(entity);
 
@@ -260,23 +301,26 @@ void EntityTreeSendThread::startNewTraversal(const DiffTraversal::View& view, En
             _traversal.setScanCallback([this](DiffTraversal::VisibleElement& next) {
                 uint64_t startOfCompletedTraversal = _traversal.getStartOfCompletedTraversal();
                 if (next.element->getLastChangedContent() > startOfCompletedTraversal) {
+                    next.allKnown = true;
                     next.element->forEachEntity([&](EntityItemPointer entity) {
                         // Bail early if we've already checked this entity this frame
                         if (_sendQueue.contains(entity.get())) {
+                            next.allKnown = false;
                             return;
                         }
                         float priority = PrioritizedEntity::DO_NOT_SEND;
 
-                        auto knownTimestamp = _knownState.find(entity.get());
-                        if (knownTimestamp == _knownState.end()) {
+                        uint64_t knownTimestamp = _knownState.get(entity->getDenseIndex());
+                        if (knownTimestamp == 0) {
+                            next.allKnown = false;
                             const auto& view = _traversal.getCurrentView();
                             priority = view.computePriority(entity);
 
-                        } else if (entity->getLastEdited() > knownTimestamp->second ||
-                                   entity->getLastChangedOnServer() > knownTimestamp->second) {
-                            // it is known and it changed --> put it on the queue with any priority
-                            // TODO: sort these correctly
-                            priority = PrioritizedEntity::WHEN_IN_DOUBT_PRIORITY;
+                        } else if (entity->getLastEdited() > knownTimestamp ||
+                                   entity->getLastChangedOnServer() > knownTimestamp) {
+                            // it is known and it changed --> put it on the queue unless it isn't due for an update yet
+                            next.allKnown = false;
+                            priority = prioritizeChangedEntity(entity, knownTimestamp);
                         }
 
                         if (priority != PrioritizedEntity::DO_NOT_SEND) {
@@ -289,23 +333,26 @@ void EntityTreeSendThread::startNewTraversal(const DiffTraversal::View& view, En
         case DiffTraversal::Differential:
             assert(view.usesViewFrustums());
             _traversal.setScanCallback([this] (DiffTraversal::VisibleElement& next) {
+                next.allKnown = true;
                 next.element->forEachEntity([&](EntityItemPointer entity) {
                     // Bail early if we've already checked this entity this frame
                     if (_sendQueue.contains(entity.get())) {
+                        next.allKnown = false;
                         return;
                     }
                     float priority = PrioritizedEntity::DO_NOT_SEND;
 
-                    auto knownTimestamp = _knownState.find(entity.get());
-                    if (knownTimestamp == _knownState.end()) {
+                    uint64_t knownTimestamp = _knownState.get(entity->getDenseIndex());
+                    if (knownTimestamp == 0) {
+                        next.allKnown = false;
                         const auto& view = _traversal.getCurrentView();
                         priority = view.computePriority(entity);
 
-                    } else if (entity->getLastEdited() > knownTimestamp->second ||
-                               entity->getLastChangedOnServer() > knownTimestamp->second) {
-                        // it is known and it changed --> put it on the queue with any priority
-                        // TODO: sort these correctly
-                        priority = PrioritizedEntity::WHEN_IN_DOUBT_PRIORITY;
+                    } else if (entity->getLastEdited() > knownTimestamp ||
+                               entity->getLastChangedOnServer() > knownTimestamp) {
+                        // it is known and it changed --> put it on the queue unless it isn't due for an update yet
+                        next.allKnown = false;
+                        priority = prioritizeChangedEntity(entity, knownTimestamp);
                     }
 
                     if (priority != PrioritizedEntity::DO_NOT_SEND) {
@@ -317,6 +364,106 @@ void EntityTreeSendThread::startNewTraversal(const DiffTraversal::View& view, En
     }
 }
 
+void EntityTreeSendThread::reconcileEntityCache(const EntityTreeCache::Manifest& manifest, EntityNodeData& nodeData) {
+    // must follow a First traversal start, which cleared our _knownState
+    auto entityTree = std::static_pointer_cast<EntityTree>(_myServer->getOctree());
+
+    QVector<QUuid> staleEntities;
+    int numCurrent = 0;
+    for (auto it = manifest.cbegin(); it != manifest.cend(); ++it) {
+        EntityItemPointer entity = entityTree->findEntityByID(it.key());
+        if (!entity) {
+            // deleted while the client was away
+            staleEntities.push_back(it.key());
+        } else if (entity->getLastEdited() == it.value().lastEdited) {
+            // the client holds the version we sent at that time, anything that changed on the server
+            // since will be found by our traversals like for an entity we just sent
+            _knownState.set(entity->getDenseIndex(), it.value().sentAt);
+            ++numCurrent;
+        } else if (!_sendQueue.contains(entity.get())) {
+            // the client holds an outdated copy, replace it even if it isn't in view
+            _sendQueue.emplace(entity, PrioritizedEntity::WHEN_IN_DOUBT_PRIORITY);
+        }
+    }
+    nodeData.addStaleCachedEntities(staleEntities);
+
+    qCDebug(entities) << "Entity cache of" << _nodeUuid << "has" << manifest.size() << "entities:" << numCurrent << "current,"
+        << staleEntities.size() << "deleted," << (manifest.size() - numCurrent - staleEntities.size()) << "outdated";
+}
+
+uint64_t EntityTreeSendThread::getUpdateInterval(const EntityItemPointer& entity) const {
+    const auto& view = _traversal.getCurrentView();
+    if (!_throttleDistantEntityUpdates || !view.usesViewFrustums() || !entity->isMoving()) {
+        return 0;
+    }
+
+    // whatever this client is simulating, editing or has attached to itself is always up to date
+    if (entity->getSimulatorID() == _nodeUuid || entity->getLastEditedBy() == _nodeUuid ||
+        entity->getParentID() == _nodeUuid) {
+        return 0;
+    }
+
+    bool success = false;
+    auto cube = entity->getQueryAACube(success);
+    if (!success) {
+        return 0;
+    }
+    auto center = cube.calcCenter();
+    auto radius = 0.5f * SQRT_THREE * cube.getScale();
+    for (const auto& frustum : view.viewFrustums) {
+        if (glm::distance(center, frustum.getPosition()) - radius < IMMEDIATE_ENTITY_UPDATE_DISTANCE) {
+            return 0;
+        }
+    }
+
+    // out of view entities get the last tier, the same way a bigger LOD makes entities smaller
+    float angularSize = view.computePriority(entity);
+    if (angularSize == PrioritizedEntity::DO_NOT_SEND) {
+        angularSize = 0.0f;
+    }
+    angularSize /= view.lodScaleFactor;
+    for (const auto& tier : ENTITY_UPDATE_TIERS) {
+        if (angularSize >= tier.minAngularSize) {
+            return tier.interval;
+        }
+    }
+    return 0;
+}
+
+float EntityTreeSendThread::prioritizeChangedEntity(const EntityItemPointer& entity, uint64_t lastSentTime) {
+    uint64_t dueTime = lastSentTime + getUpdateInterval(entity);
+    if (dueTime <= usecTimestampNow()) {
+        return PrioritizedEntity::WHEN_IN_DOUBT_PRIORITY;
+    }
+
+    auto& deferred = _deferredUpdates[entity.get()];
+    deferred.entity = entity;
+    deferred.dueTime = dueTime;
+    return PrioritizedEntity::DO_NOT_SEND;
+}
+
+void EntityTreeSendThread::queueDueDeferredUpdates() {
+    uint64_t now = usecTimestampNow();
+    for (auto it = _deferredUpdates.begin(); it != _deferredUpdates.end();) {
+        EntityItemPointer entity = it->second.entity.lock();
+        uint64_t knownTimestamp = entity ? _knownState.get(entity->getDenseIndex()) : 0;
+        if (knownTimestamp == 0 || _sendQueue.contains(it->first)) {
+            it = _deferredUpdates.erase(it);
+            continue;
+        }
+
+        // the interval is checked again each time, so that an entity that came close or that the client
+        // started interacting with is sent right away
+        it->second.dueTime = knownTimestamp + getUpdateInterval(entity);
+        if (it->second.dueTime <= now) {
+            _sendQueue.emplace(entity, PrioritizedEntity::WHEN_IN_DOUBT_PRIORITY);
+            it = _deferredUpdates.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
 bool EntityTreeSendThread::traverseTreeAndBuildNextPacketPayload(EncodeBitstreamParams& params, const QJsonObject& jsonFilters) {
     if (_sendQueue.empty()) {
         params.stopReason = EncodeBitstreamParams::FINISHED;
@@ -393,10 +540,11 @@ bool EntityTreeSendThread::traverseTreeAndBuildNextPacketPayload(EncodeBitstream
                 ++_numEntities;
             }
             if (queuedItem.shouldForceRemove()) {
-                _knownState.erase(entity.get());
+                _knownState.reset(entity->getDenseIndex());
             } else {
-                _knownState[entity.get()] = sendTime;
+                _knownState.set(entity->getDenseIndex(), sendTime);
             }
+            _deferredUpdates.erase(entity.get());
         }
         _sendQueue.pop();
     }
@@ -420,7 +568,7 @@ bool EntityTreeSendThread::traverseTreeAndBuildNextPacketPayload(EncodeBitstream
 
 void EntityTreeSendThread::editingEntityPointer(const EntityItemPointer& entity) {
     if (entity) {
-        if (!_sendQueue.contains(entity.get()) && _knownState.find(entity.get()) != _knownState.end()) {
+        if (!_sendQueue.contains(entity.get()) && _knownState.get(entity->getDenseIndex()) != 0) {
             const auto& view = _traversal.getCurrentView();
             float priority = view.computePriority(entity);
 
@@ -434,6 +582,8 @@ void EntityTreeSendThread::editingEntityPointer(const EntityItemPointer& entity)
     }
 }
 
-void EntityTreeSendThread::deletingEntityPointer(EntityItem* entity) {
-    _knownState.erase(entity);
+void EntityTreeSendThread::deletingEntityPointer(EntityItem* entity, DenseIndex denseIndex) {
+    // the index may have been given to a new entity already, whose state the generation keeps apart
+    _knownState.reset(denseIndex);
+    _deferredUpdates.erase(entity);
 }
@@ -12,12 +12,15 @@
 #ifndef hifi_EntityTreeSendThread_h
 #define hifi_EntityTreeSendThread_h
 
+#include <atomic>
 #include <unordered_set>
 
 #include "../octree/OctreeSendThread.h"
 
+#include <DenseTimestamps.h>
 #include <DiffTraversal.h>
 #include <EntityPriorityQueue.h>
+#include <EntityTreeCache.h>
 #include <shared/ConicalViewFrustum.h>
 
 
@@ -30,6 +33,9 @@ class EntityTreeSendThread : public OctreeSendThread {
 public:
     EntityTreeSendThread(OctreeServer* myServer, const SharedNodePointer& node);
 
+    // when enabled, changes to moving entities that are far away or small on screen are sent less often
+    static void setThrottleDistantEntityUpdates(bool throttle) { _throttleDistantEntityUpdates = throttle; }
+
 protected:
     bool traverseTreeAndSendContents(SharedNodePointer node, OctreeQueryNode* nodeData,
             bool viewFrustumChanged, bool isFullScene) override;
@@ -43,15 +49,33 @@ private:
     bool addDescendantsToExtraFlaggedEntities(const QUuid& filteredEntityID, EntityItem& entityItem, EntityNodeData& nodeData);
 
     void startNewTraversal(const DiffTraversal::View& viewFrustum, EntityTreeElementPointer root, bool forceFirstPass = false);
+    void reconcileEntityCache(const EntityTreeCache::Manifest& manifest, EntityNodeData& nodeData);
     bool traverseTreeAndBuildNextPacketPayload(EncodeBitstreamParams& params, const QJsonObject& jsonFilters) override;
 
+    // minimum time between two updates of a known entity that changed, based on how it looks from the current view
+    uint64_t getUpdateInterval(const EntityItemPointer& entity) const;
+    // priority of a known entity that changed, DO_NOT_SEND if it was deferred until its update interval is over
+    float prioritizeChangedEntity(const EntityItemPointer& entity, uint64_t lastSentTime);
+    void queueDueDeferredUpdates();
+
     void preDistributionProcessing() override;
     bool hasSomethingToSend(OctreeQueryNode* nodeData) override { return !_sendQueue.empty(); }
     bool shouldStartNewTraversal(OctreeQueryNode* nodeData, bool viewFrustumChanged) override { return viewFrustumChanged || _traversal.finished(); }
 
     DiffTraversal _traversal;
     EntityPriorityQueue _sendQueue;
-    std::unordered_map<EntityItem*, uint64_t> _knownState;
+    // when each entity was last sent, by its dense index
+    DenseTimestamps _knownState;
+
+    // changes we didn't send yet because of the entity's update interval, we keep track of them since
+    // a Repeat traversal won't visit the entity again unless it changes some more
+    struct DeferredUpdate {
+        EntityItemWeakPointer entity;
+        uint64_t dueTime;
+    };
+    std::unordered_map<EntityItem*, DeferredUpdate> _deferredUpdates;
+
+    static std::atomic<bool> _throttleDistantEntityUpdates;
 
     // packet construction stuff
     EntityTreeElementExtraEncodeDataPointer _extraEncodeData { new EntityTreeElementExtraEncodeData() };
@@ -60,7 +84,7 @@ private:
 
 private slots:
     void editingEntityPointer(const EntityItemPointer& entity);
-    void deletingEntityPointer(EntityItem* entity);
+    void deletingEntityPointer(EntityItem* entity, DenseIndex denseIndex);
 };
 
 #endif // hifi_EntityTreeSendThread_h
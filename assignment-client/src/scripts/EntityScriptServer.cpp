@@ -579,7 +579,8 @@ void EntityScriptServer::sendStatsPacket() {
     }
     scriptEngineStats["number_running_scripts"] = numberRunningScripts;
     statsObject["script_engine_stats"] = scriptEngineStats;
-    
+
+    statsObject["resource_memory"] = QJsonObject::fromVariantMap(ResourceCache::getMemoryStats());
 
     auto nodeList = DependencyManager::get<NodeList>();
     QJsonObject nodesObject;
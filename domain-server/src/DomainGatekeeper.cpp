@@ -123,8 +123,14 @@ void DomainGatekeeper::processConnectRequestPacket(QSharedPointer<ReceivedMessag
             }
         }
 
-        node = processAgentConnectRequest(nodeConnection, username, usernameSignature, 
-                                          domainUsername, domainTokens.value(0), domainTokens.value(1));
+        if (!nodeConnection.sessionTicket.isNull()) {
+            node = resumeAgentSession(nodeConnection, username);
+        }
+
+        if (!node) {
+            node = processAgentConnectRequest(nodeConnection, username, usernameSignature,
+                                              domainUsername, domainTokens.value(0), domainTokens.value(1));
+        }
     }
 
     if (node) {
@@ -621,11 +627,84 @@ SharedNodePointer DomainGatekeeper::processAgentConnectRequest(const NodeConnect
     // add the connecting node
     SharedNodePointer newNode = addVerifiedNodeFromConnectRequest(nodeConnection);
 
+    setupVerifiedAgent(newNode, nodeConnection, username, userPerms, verifiedUsername, verifiedDomainUsername);
+
+#ifdef WANT_DEBUG
+    qDebug() << "accepting login:" << username;
+#endif
+
+    return newNode;
+}
+
+// how long the session of a removed agent can still be resumed with its ticket
+const quint64 SESSION_TICKET_RESUME_WINDOW_USECS = 2 * 60 * USECS_PER_SECOND;
+
+SharedNodePointer DomainGatekeeper::resumeAgentSession(const NodeConnectionData& nodeConnection, const QString& username) {
+    auto ticketIt = _sessionTickets.find(nodeConnection.sessionTicket);
+    if (ticketIt == _sessionTickets.end()) {
+        return SharedNodePointer();
+    }
+
+    // tickets are single use, whatever happens next this one is gone
+    SessionTicket ticket = ticketIt.value();
+    _sessionTickets.erase(ticketIt);
+    _sessionTicketForNode.remove(ticket.nodeID);
+
+    if (ticket.expiry != 0 && usecTimestampNow() > ticket.expiry) {
+        return SharedNodePointer();
+    }
+
+    // the ticket only stands in for the identity it was issued to, on the machine it was issued to. The fingerprint
+    // and username come unverified with the request, so the ticket also has to come from the address it was sent to.
+    QHostAddress senderHostAddress = nodeConnection.senderSockAddr.getAddress();
+    if (ticket.senderAddress != senderHostAddress || ticket.machineFingerprint != nodeConnection.machineFingerprint ||
+        ticket.verifiedUsername != username.toLower()) {
+        return SharedNodePointer();
+    }
+
+    auto limitedNodeList = DependencyManager::get<LimitedNodeList>();
+
+    bool isLocalUser =
+        (senderHostAddress == limitedNodeList->getLocalSockAddr().getAddress() || senderHostAddress == QHostAddress::LocalHost);
+
+    // permissions are recomputed from the verified identity, so that changes to the domain settings or bans still apply
+    NodePermissions userPerms = setPermissionsForUser(isLocalUser, ticket.verifiedUsername, ticket.verifiedDomainUsername,
+                                                      senderHostAddress, nodeConnection.hardwareAddress,
+                                                      nodeConnection.machineFingerprint);
+    if (!userPerms.can(NodePermissions::Permission::canConnectToDomain)) {
+        // let the regular path refuse the connection with the right reason
+        return SharedNodePointer();
+    }
+
+    // a node that is still in the list doesn't take a new seat, but it is only handed over to the socket it talks from
+    SharedNodePointer connectedNode = limitedNodeList->nodeWithUUID(ticket.nodeID);
+    bool isStillConnected = (bool)connectedNode;
+    if (isStillConnected && connectedNode->getPublicSocket() != nodeConnection.senderSockAddr) {
+        return SharedNodePointer();
+    }
+    if (!isStillConnected && !userPerms.can(NodePermissions::Permission::canConnectPastMaxCapacity) && !isWithinMaxCapacity()) {
+        return SharedNodePointer();
+    }
+
+    // keeping the node ID and local ID lets the assignments keep their state for this node
+    SharedNodePointer node = addVerifiedNodeFromConnectRequest(nodeConnection, ticket.nodeID);
+
+    setupVerifiedAgent(node, nodeConnection, username, userPerms, ticket.verifiedUsername, ticket.verifiedDomainUsername);
+
+    qDebug() << "Resumed session of node" << uuidStringWithoutCurlyBraces(ticket.nodeID)
+        << (isStillConnected ? "that was still connected" : "that had been removed");
+
+    return node;
+}
+
+void DomainGatekeeper::setupVerifiedAgent(const SharedNodePointer& node, const NodeConnectionData& nodeConnection,
+                                          const QString& username, const NodePermissions& userPerms,
+                                          const QString& verifiedUsername, const QString& verifiedDomainUsername) {
     // set the edit rights for this user
-    newNode->setPermissions(userPerms);
+    node->setPermissions(userPerms);
 
     // grab the linked data for our new node so we can set the username
-    DomainServerNodeData* nodeData = static_cast<DomainServerNodeData*>(newNode->getLinkedData());
+    DomainServerNodeData* nodeData = static_cast<DomainServerNodeData*>(node->getLinkedData());
 
     // if we have a username from the connect request, set it on the DomainServerNodeData
     nodeData->setUsername(username);
@@ -641,16 +720,40 @@ SharedNodePointer DomainGatekeeper::processAgentConnectRequest(const NodeConnect
 
     // also add an interpolation to DomainServerNodeData so that servers can get username in stats
     nodeData->addOverrideForKey(USERNAME_UUID_REPLACEMENT_STATS_KEY,
-                                uuidStringWithoutCurlyBraces(newNode->getUUID()), username);
+                                uuidStringWithoutCurlyBraces(node->getUUID()), username);
 
-#ifdef WANT_DEBUG
-    qDebug() << "accepting login:" << username;
-#endif
+    // issue the ticket this node can use to resume its session, it is sent with the domain list
+    _sessionTickets.remove(_sessionTicketForNode.take(node->getUUID()));
 
-    return newNode;
+    QUuid sessionTicket = QUuid::createUuid();
+    _sessionTickets.insert(sessionTicket, { node->getUUID(), verifiedUsername, verifiedDomainUsername,
+                                            nodeConnection.machineFingerprint, nodeConnection.senderSockAddr.getAddress(),
+                                            0 });
+    _sessionTicketForNode.insert(node->getUUID(), sessionTicket);
+    nodeData->setSessionTicket(sessionTicket);
+}
+
+void DomainGatekeeper::startSessionTicketExpiry(const QUuid& nodeID) {
+    auto now = usecTimestampNow();
+
+    // this is also where we forget the tickets that were never used
+    for (auto it = _sessionTickets.begin(); it != _sessionTickets.end();) {
+        if (it->expiry != 0 && now > it->expiry) {
+            _sessionTicketForNode.remove(it->nodeID);
+            it = _sessionTickets.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    auto ticketIt = _sessionTickets.find(_sessionTicketForNode.value(nodeID));
+    if (ticketIt != _sessionTickets.end()) {
+        ticketIt->expiry = now + SESSION_TICKET_RESUME_WINDOW_USECS;
+    }
 }
 
-SharedNodePointer DomainGatekeeper::addVerifiedNodeFromConnectRequest(const NodeConnectionData& nodeConnection) {
+SharedNodePointer DomainGatekeeper::addVerifiedNodeFromConnectRequest(const NodeConnectionData& nodeConnection,
+                                                                      const QUuid& nodeID) {
     HifiSockAddr discoveredSocket = nodeConnection.senderSockAddr;
     SharedNetworkPeer connectedPeer = _icePeers.value(nodeConnection.connectUUID);
 
@@ -659,17 +762,17 @@ SharedNodePointer DomainGatekeeper::addVerifiedNodeFromConnectRequest(const Node
         discoveredSocket = *connectedPeer->getActiveSocket();
     }
 
-    // create a new node ID for the verified connecting node
-    auto nodeID = QUuid::createUuid();
+    // create a new node ID for the verified connecting node, unless it is resuming a session
+    auto newNodeID = nodeID.isNull() ? QUuid::createUuid() : nodeID;
 
     // add a mapping from connection node ID to ICE peer ID
     // so that we can remove the ICE peer once we see this node connect
-    _nodeToICEPeerIDs.insert(nodeID, nodeConnection.connectUUID);
+    _nodeToICEPeerIDs.insert(newNodeID, nodeConnection.connectUUID);
 
     auto limitedNodeList = DependencyManager::get<LimitedNodeList>();
 
-    Node::LocalID newLocalID = findOrCreateLocalID(nodeID);
-    SharedNodePointer newNode = limitedNodeList->addOrUpdateNode(nodeID, nodeConnection.nodeType,
+    Node::LocalID newLocalID = findOrCreateLocalID(newNodeID);
+    SharedNodePointer newNode = limitedNodeList->addOrUpdateNode(newNodeID, nodeConnection.nodeType,
                                                                  nodeConnection.publicSockAddr, nodeConnection.localSockAddr,
                                                                  newLocalID);
 
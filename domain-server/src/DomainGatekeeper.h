@@ -45,6 +45,9 @@ public:
 
     void cleanupICEPeerForNode(const QUuid& nodeID);
 
+    // starts the window during which the session of a removed node can still be resumed with its ticket
+    void startSessionTicketExpiry(const QUuid& nodeID);
+
     Node::LocalID findOrCreateLocalID(const QUuid& uuid);
 
     static void sendProtocolMismatchConnectionDenial(const HifiSockAddr& senderSockAddr);
@@ -87,7 +90,12 @@ private:
                                                  const QString& domainUsername,
                                                  const QString& domainAccessToken,
                                                  const QString& domainRefreshToken);
-    SharedNodePointer addVerifiedNodeFromConnectRequest(const NodeConnectionData& nodeConnection);
+    SharedNodePointer resumeAgentSession(const NodeConnectionData& nodeConnection, const QString& username);
+    SharedNodePointer addVerifiedNodeFromConnectRequest(const NodeConnectionData& nodeConnection,
+                                                        const QUuid& nodeID = QUuid());
+    void setupVerifiedAgent(const SharedNodePointer& node, const NodeConnectionData& nodeConnection,
+                            const QString& username, const NodePermissions& userPerms,
+                            const QString& verifiedUsername, const QString& verifiedDomainUsername);
     
     bool verifyUserSignature(const QString& username, const QByteArray& usernameSignature,
                              const HifiSockAddr& senderSockAddr);
@@ -122,6 +130,21 @@ private:
     
     QHash<QString, QUuid> _connectionTokenHash;
 
+    // Session tickets let an agent that reconnects get back its node ID, local ID and verified identity
+    // in a single connect request, without going through username signature verification again.
+    // A ticket is single use, a new one is issued with every accepted agent connection. It is a bearer token, so it is
+    // only accepted from the address it was sent to.
+    struct SessionTicket {
+        QUuid nodeID;
+        QString verifiedUsername;
+        QString verifiedDomainUsername;
+        QUuid machineFingerprint;
+        QHostAddress senderAddress;
+        quint64 expiry { 0 }; // 0 while the node is connected
+    };
+    QHash<QUuid, SessionTicket> _sessionTickets;
+    QHash<QUuid, QUuid> _sessionTicketForNode;
+
     // the word "optimistic" below is used for keys that we request during user connection before the user has
     // had a chance to upload a new public key
 
@@ -117,9 +117,10 @@ static const QMap<QString, DomainServerExporter::MetricType> TYPE_MAP {
     { "audio_mixer_mix_stats_active_to_inactive"                                                  , DomainServerExporter::MetricType::Counter },
     { "audio_mixer_mix_stats_active_to_skippped"                                                  , DomainServerExporter::MetricType::Counter },
     { "audio_mixer_mix_stats_avg_mixes_per_block"                                                 , DomainServerExporter::MetricType::Gauge },
+    { "audio_mixer_mix_stats_hrtf_allocated"                                                      , DomainServerExporter::MetricType::Gauge },
+    { "audio_mixer_mix_stats_hrtf_in_use"                                                         , DomainServerExporter::MetricType::Gauge },
     { "audio_mixer_mix_stats_hrtf_renders"                                                        , DomainServerExporter::MetricType::Counter },
     { "audio_mixer_mix_stats_hrtf_resets"                                                         , DomainServerExporter::MetricType::Counter },
-    { "audio_mixer_mix_stats_hrtf_updates"                                                        , DomainServerExporter::MetricType::Counter },
     { "audio_mixer_mix_stats_inactive_streams"                                                    , DomainServerExporter::MetricType::Gauge },
     { "audio_mixer_mix_stats_inactive_to_active"                                                  , DomainServerExporter::MetricType::Counter },
     { "audio_mixer_mix_stats_inactive_to_skippped"                                                , DomainServerExporter::MetricType::Counter },
@@ -75,6 +75,9 @@ public:
 
     bool hasCheckedIn() const { return _hasCheckedIn; }
     void setHasCheckedIn(bool hasCheckedIn) { _hasCheckedIn = hasCheckedIn; }
+
+    const QUuid& getSessionTicket() const { return _sessionTicket; }
+    void setSessionTicket(const QUuid& sessionTicket) { _sessionTicket = sessionTicket; }
     
 private:
     QJsonObject overrideValuesIfNeeded(const QJsonObject& newStats);
@@ -102,6 +105,8 @@ private:
     bool _wasAssigned { false };
 
     bool _hasCheckedIn { false };
+
+    QUuid _sessionTicket;
 };
 
 #endif // hifi_DomainServerNodeData_h
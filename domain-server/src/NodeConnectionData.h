@@ -34,6 +34,7 @@ public:
     QString SystemInfo;
     quint32 connectReason;
     quint64 previousConnectionUpTime;
+    QUuid sessionTicket; // presented by agents resuming a previous session
     QByteArray protocolVersion;
 };
 
@@ -85,6 +85,7 @@
 #include <EntityScriptClient.h>
 #include <EntityScriptServerLogClient.h>
 #include <EntityScriptingInterface.h>
+#include <EntityTreeCache.h>
 #include "ui/overlays/ContextOverlayInterface.h"
 #include <ErrorDialog.h>
 #include <FileScriptingInterface.h>
@@ -341,6 +342,9 @@ static const QString DESKTOP_LOCATION = QStandardPaths::writableLocation(QStanda
 
 Setting::Handle<int> maxOctreePacketsPerSecond{"maxOctreePPS", DEFAULT_MAX_OCTREE_PPS};
 
+// the memory budget shared by the resource caches, 0 for none
+Setting::Handle<int> resourceMemoryBudgetMB{"resourceMemoryBudgetMB", (int)BYTES_TO_MB(DEFAULT_RESOURCE_MEMORY_BUDGET)};
+
 Setting::Handle<bool> loginDialogPoppedUp{"loginDialogPoppedUp", false};
 
 static const QUrl AVATAR_INPUTS_BAR_QML = PathUtils::qmlUrl("AvatarInputsBar.qml");
@@ -1490,6 +1494,7 @@ Application::Application(int& argc, char** argv, QElapsedTimer& startupTimer, bo
         concurrentDownloads = MAX_CONCURRENT_RESOURCE_DOWNLOADS;
     }
     ResourceCache::setRequestLimit(concurrentDownloads);
+    ResourceCache::setMemoryBudget((qint64)MB_TO_BYTES(resourceMemoryBudgetMB.get()));
 
     // perhaps override the avatar url.  Since we will test later for validity
     // we don't need to do so here.
@@ -2460,6 +2465,8 @@ Application::Application(int& argc, char** argv, QElapsedTimer& startupTimer, bo
         DependencyManager::get<PickManager>()->setPrecisionPicking(rayPickID, value);
     });
 
+    setupFrameBudgetGovernor();
+
     BillboardModeHelpers::setBillboardRotationOperator([](const glm::vec3& position, const glm::quat& rotation,
                                                           BillboardMode billboardMode, const glm::vec3& frustumPos, bool rotate90x) {
         const glm::quat ROTATE_90X = glm::angleAxis(-(float)M_PI_2, Vectors::RIGHT);
@@ -2812,6 +2819,8 @@ void Application::cleanupBeforeQuit() {
         }
     }
 
+    saveEntityCache();
+
     {
         auto nodeList = DependencyManager::get<NodeList>();
 
@@ -5343,7 +5352,9 @@ void Application::idle() {
         PerformanceTimer perfTimer("update");
         PerformanceWarning warn(showWarnings, "Application::idle()... update()");
         static const float BIGGEST_DELTA_TIME_SECS = 0.25f;
+        quint64 updateStart = usecTimestampNow();
         update(glm::clamp(secondsSinceLastUpdate, 0.0f, BIGGEST_DELTA_TIME_SECS));
+        updateFrameBudget((float)(usecTimestampNow() - updateStart) / USECS_PER_MSEC);
     }
 
     { // Update keyboard focus highlight
@@ -5907,6 +5918,31 @@ void Application::updateLOD(float deltaTime) const {
     }
 }
 
+void Application::setupFrameBudgetGovernor() {
+    // each level halves the time budget the subsystem already has, the picks being the last to go as they drive input
+    const int NUM_BUDGET_LEVELS = 3;
+
+    // the picks level applies on top of whatever budget scripts set
+    _picksBudgetSubsystem = _frameBudgetGovernor.addSubsystem("picks", NUM_BUDGET_LEVELS, 4.0f, [](int level) {
+        DependencyManager::get<PickManager>()->setPerFrameTimeBudgetLevel(level);
+    });
+    _entitiesBudgetSubsystem = _frameBudgetGovernor.addSubsystem("entities", NUM_BUDGET_LEVELS, 1.0f, [](int level) {
+        DependencyManager::get<EntityTreeRenderer>()->setUpdateRenderablesTimeBudget(MAX_UPDATE_RENDERABLES_TIME_BUDGET >> level);
+    });
+    _avatarsBudgetSubsystem = _frameBudgetGovernor.addSubsystem("avatars", NUM_BUDGET_LEVELS, 2.0f, [](int level) {
+        DependencyManager::get<AvatarManager>()->setUpdateOtherAvatarsTimeBudget(MAX_UPDATE_AVATARS_TIME_BUDGET >> level);
+    });
+}
+
+void Application::updateFrameBudget(float updateTime) {
+    PerformanceTimer perfTimer("frameBudget");
+    // it goes with the automatic LOD, which takes care of the rendering side of the frame
+    auto lodManager = DependencyManager::get<LODManager>();
+    _frameBudgetGovernor.setEnabled(lodManager->getAutomaticLODAdjust());
+    float budget = isThrottleRendering() ? 0.0f : (float)MSECS_PER_SECOND / lodManager->getLODTargetFPS();
+    _frameBudgetGovernor.endFrame(updateTime, budget);
+}
+
 void Application::pushPostUpdateLambda(void* key, const std::function<void()>& func) {
     std::unique_lock<std::mutex> guard(_postUpdateLambdasLock);
     _postUpdateLambdas[key] = func;
@@ -6552,6 +6588,7 @@ void Application::update(float deltaTime) {
     {
         PROFILE_RANGE(app, "PickManager");
         PerformanceTimer perfTimer("pickManager");
+        FrameBudgetGovernor::Scope budgetScope(_frameBudgetGovernor, _picksBudgetSubsystem);
         DependencyManager::get<PickManager>()->update();
     }
 
@@ -6662,7 +6699,10 @@ void Application::update(float deltaTime) {
 
                     // NOTE: the getEntities()->update() call below will wait for lock
                     // and will provide non-physical entity motion
-                    getEntities()->update(true); // update the models...
+                    {
+                        FrameBudgetGovernor::Scope budgetScope(_frameBudgetGovernor, _entitiesBudgetSubsystem);
+                        getEntities()->update(true); // update the models...
+                    }
 
                     auto t5 = std::chrono::high_resolution_clock::now();
 
@@ -6678,6 +6718,7 @@ void Application::update(float deltaTime) {
             }
         } else {
             // update the rendering without any simulation
+            FrameBudgetGovernor::Scope budgetScope(_frameBudgetGovernor, _entitiesBudgetSubsystem);
             getEntities()->update(false);
         }
         // remove recently dead avatarEntities
@@ -6691,6 +6732,7 @@ void Application::update(float deltaTime) {
         {
             PROFILE_RANGE(simulation, "OtherAvatars");
             PerformanceTimer perfTimer("otherAvatars");
+            FrameBudgetGovernor::Scope budgetScope(_frameBudgetGovernor, _avatarsBudgetSubsystem);
             avatarManager->updateOtherAvatars(deltaTime);
         }
 
@@ -7271,6 +7313,8 @@ void Application::clearDomainOctreeDetails(bool clearAll) {
         _octreeServerSceneStats.clear();
     });
 
+    saveEntityCache();
+
     // reset the model renderer
     clearAll ? getEntities()->clear() : getEntities()->clearDomainAndNonOwnedEntities();
 
@@ -7350,6 +7394,8 @@ void Application::nodeActivated(SharedNodePointer node) {
         _queryExpiry = SteadyClock::now();
         _octreeQuery.incrementConnectionID();
 
+        loadEntityCache();
+
         if  (!_failedToConnectToEntityServer) {
             _entityServerConnectionTimer.stop();
         }
@@ -7382,6 +7428,28 @@ void Application::nodeActivated(SharedNodePointer node) {
     }
 }
 
+void Application::loadEntityCache() {
+    auto domainID = DependencyManager::get<NodeList>()->getDomainHandler().getUUID();
+    if (domainID.isNull() || isServerlessMode()) {
+        return;
+    }
+    _entityCacheDomainID = domainID;
+
+    // start from the entities we had when we last left this domain, the entity server then only sends what changed
+    EntityTreeCache::Manifest manifest;
+    if (EntityTreeCache::load(getEntities()->getTree(), domainID, manifest) > 0) {
+        EntityTreeCache::sendManifest(manifest);
+    }
+}
+
+void Application::saveEntityCache() {
+    if (_entityCacheDomainID.isNull()) {
+        return;
+    }
+    EntityTreeCache::save(getEntities()->getTree(), _entityCacheDomainID);
+    _entityCacheDomainID = QUuid();
+}
+
 void Application::nodeKilled(SharedNodePointer node) {
     // These are here because connecting NodeList::nodeKilled to OctreePacketProcessor::nodeKilled doesn't work:
     // OctreePacketProcessor::nodeKilled is not being called when NodeList::nodeKilled is emitted.
@@ -8931,6 +8999,15 @@ int Application::getMaxOctreePacketsPerSecond() const {
     return _maxOctreePPS;
 }
 
+void Application::setResourceMemoryBudgetMB(int budgetMB) {
+    ResourceCache::setMemoryBudget((qint64)MB_TO_BYTES(std::max(budgetMB, 0)));
+    resourceMemoryBudgetMB.set(getResourceMemoryBudgetMB());
+}
+
+int Application::getResourceMemoryBudgetMB() const {
+    return (int)BYTES_TO_MB(ResourceCache::getMemoryBudget());
+}
+
 qreal Application::getDevicePixelRatio() {
     return (_window && _window->windowHandle()) ? _window->windowHandle()->devicePixelRatio() : 1.0;
 }
@@ -31,6 +31,7 @@
 #include <EntityEditPacketSender.h>
 #include <EntityTreeRenderer.h>
 #include <FileScriptingInterface.h>
+#include <FrameBudgetGovernor.h>
 #include <input-plugins/KeyboardMouseDevice.h>
 #include <input-plugins/TouchscreenDevice.h>
 #include <input-plugins/TouchscreenVirtualPadDevice.h>
@@ -281,6 +282,9 @@ public:
     void setMaxOctreePacketsPerSecond(int maxOctreePPS);
     int getMaxOctreePacketsPerSecond() const;
 
+    void setResourceMemoryBudgetMB(int budgetMB);
+    int getResourceMemoryBudgetMB() const;
+
     render::ScenePointer getMain3DScene() override { return _graphicsEngine.getRenderScene(); }
     render::EnginePointer getRenderEngine() override { return  _graphicsEngine.getRenderEngine(); }
     gpu::ContextPointer getGPUContext() const { return _graphicsEngine.getGPUContext(); }
@@ -563,11 +567,15 @@ private:
 
     // Various helper functions called during update()
     void updateLOD(float deltaTime) const;
+    void setupFrameBudgetGovernor();
+    void updateFrameBudget(float updateTime);
     void updateThreads(float deltaTime);
     void updateDialogs(float deltaTime) const;
 
     void queryOctree(NodeType_t serverType, PacketType packetType);
     void queryAvatars();
+    void loadEntityCache();
+    void saveEntityCache();
 
     int sendNackPackets();
 
@@ -659,6 +667,7 @@ private:
     TimePoint _queryExpiry;
 
     OctreeQuery _octreeQuery { true }; // NodeData derived class for querying octee cells from octree servers
+    QUuid _entityCacheDomainID; // domain whose entities we'll cache when leaving it
 
     std::shared_ptr<controller::StateController> _applicationStateDevice; // Default ApplicationDevice reflecting the state of different properties of the session
     std::shared_ptr<KeyboardMouseDevice> _keyboardMouseDevice;   // Default input device, the good old keyboard mouse and maybe touchpad
@@ -741,6 +750,12 @@ private:
 
     GameWorkload _gameWorkload;
 
+    // lowers the quality of the subsystems updated every frame, when the update takes longer than a frame
+    FrameBudgetGovernor _frameBudgetGovernor;
+    int _picksBudgetSubsystem { FrameBudgetGovernor::INVALID_SUBSYSTEM };
+    int _entitiesBudgetSubsystem { FrameBudgetGovernor::INVALID_SUBSYSTEM };
+    int _avatarsBudgetSubsystem { FrameBudgetGovernor::INVALID_SUBSYSTEM };
+
     GraphicsEngine _graphicsEngine;
     void updateRenderArgs(float deltaTime);
 
@@ -12,6 +12,7 @@
 
 #include "LODManager.h"
 
+#include <MeshPartPayload.h>
 #include <SettingHandle.h>
 #include <Util.h>
 #include <shared/GlobalAppProperties.h>
@@ -203,6 +204,14 @@ void LODManager::setLODAngleDeg(float lodAngle) {
     saveSettings();
 }
 
+float LODManager::getMeshLODPixelError() const {
+    return ModelMeshPartPayload::meshLODPixelError;
+}
+
+void LODManager::setMeshLODPixelError(float pixelError) {
+    ModelMeshPartPayload::meshLODPixelError = std::max(0.0f, pixelError);
+}
+
 void LODManager::setSmoothScale(float t) {
     _smoothScale = glm::max(1.0f, t);
 }
@@ -116,6 +116,8 @@ class AABox;
  * @property {number} lodAngleDeg - The minimum angular dimension (relative to the camera position) of an entity in order for 
  *     it to be rendered, in degrees. The angular dimension is calculated as a sphere of radius half the diagonal of the 
  *     entity's AA box.
+ * @property {number} meshLODPixelError - The largest error, in pixels on screen, of the simplified levels of detail that
+ *     baked model meshes are drawn with. <code>0</code> to always draw the full detail meshes.
  *
  * @property {number} pidKp - <em>Not used.</em>
  * @property {number} pidKi - <em>Not used.</em>
@@ -153,6 +155,8 @@ class LODManager : public QObject, public Dependency {
 
         Q_PROPERTY(float lodAngleDeg READ getLODAngleDeg WRITE setLODAngleDeg)
 
+        Q_PROPERTY(float meshLODPixelError READ getMeshLODPixelError WRITE setMeshLODPixelError)
+
         Q_PROPERTY(float pidKp READ getPidKp WRITE setPidKp)
         Q_PROPERTY(float pidKi READ getPidKi WRITE setPidKi)
         Q_PROPERTY(float pidKd READ getPidKd WRITE setPidKd)
@@ -293,6 +297,9 @@ public:
     float getVisibilityDistance() const;
     void setVisibilityDistance(float distance);
 
+    float getMeshLODPixelError() const;
+    void setMeshLODPixelError(float pixelError);
+
     float getPidKp() const;
     float getPidKi() const;
     float getPidKd() const;
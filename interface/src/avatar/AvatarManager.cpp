@@ -22,6 +22,7 @@
 #pragma GCC diagnostic ignored "-Wdouble-promotion"
 #endif
 
+#include <glm/gtx/norm.hpp>
 #include <glm/gtx/string_cast.hpp>
 
 #if defined(__GNUC__) && !defined(__clang__)
@@ -30,6 +31,7 @@
 
 #include <shared/QtHelpers.h>
 #include <AvatarData.h>
+#include <BulletUtil.h>
 #include <PerfStat.h>
 #include <PrioritySortUtil.h>
 #include <RegisteredMetaTypes.h>
@@ -55,6 +57,15 @@
 // We add _myAvatar into the hash with all the other AvatarData, and we use the default NULL QUid as the key.
 const QUuid MY_AVATAR_KEY;  // NULL key
 
+// distance from its position within which an unscaled avatar can touch things
+const float AVATAR_REACH = 1.0f;
+// other avatars get detailed collision bodies once they are this close to a physical interest,
+// and go back to a single proxy body once they are further than the demote distance
+const float DETAILED_BODIES_PROMOTE_DISTANCE = 1.0f;
+const float DETAILED_BODIES_DEMOTE_DISTANCE = 2.0f;
+const uint32_t PHYSICAL_INTEREST_CHECK_PERIOD = 4; // frames
+const int MAX_DETAILED_REBUILDS_PER_FRAME = 4;
+
 AvatarManager::AvatarManager(QObject* parent) :
     _myAvatar(new MyAvatar(qApp->thread()), [](MyAvatar* ptr) { ptr->deleteLater(); })
 {
@@ -97,6 +108,13 @@ AvatarSharedPointer AvatarManager::addAvatar(const QUuid& sessionUUID, const QWe
         transaction.reset(spaceIndex, sphere, workload::Owner(nestable));
         _space->enqueueTransaction(transaction);
     }
+
+    // entities which arrived before this avatar can now be hooked up to it
+    auto treeRenderer = DependencyManager::get<EntityTreeRenderer>();
+    EntityTreePointer entityTree = treeRenderer ? treeRenderer->getTree() : nullptr;
+    if (entityTree) {
+        entityTree->notifyParentAdded(sessionUUID);
+    }
     return avatar;
 }
 
@@ -283,12 +301,14 @@ void AvatarManager::updateOtherAvatars(float deltaTime) {
 
     _numHeroAvatars = (int)avatarPriorityQueues[kHero].size();
 
+    updatePhysicalInterests();
+
     // process in sorted order
     uint64_t startTime = usecTimestampNow();
 
-    const uint64_t MAX_UPDATE_HEROS_TIME_BUDGET = uint64_t(0.8 * MAX_UPDATE_AVATARS_TIME_BUDGET);
+    const uint64_t MAX_UPDATE_HEROS_TIME_BUDGET = uint64_t(0.8 * _updateOtherAvatarsTimeBudget);
 
-    uint64_t updatePriorityExpiries[NumVariants] = { startTime + MAX_UPDATE_HEROS_TIME_BUDGET, startTime + MAX_UPDATE_AVATARS_TIME_BUDGET };
+    uint64_t updatePriorityExpiries[NumVariants] = { startTime + MAX_UPDATE_HEROS_TIME_BUDGET, startTime + _updateOtherAvatarsTimeBudget };
     int numHerosUpdated = 0;
     int numAvatarsUpdated = 0;
     int numAvatarsNotUpdated = 0;
@@ -313,6 +333,7 @@ void AvatarManager::updateOtherAvatars(float deltaTime) {
             if (avatar->getSkeletonModel()->isLoaded()) {
                 // remove the orb if it is there
                 avatar->removeOrb();
+                updateNearPhysicalInterest(avatar);
                 if (avatar->needsPhysicsUpdate()) {
                     _otherAvatarsToChangeInPhysics.insert(avatar);
                 }
@@ -435,6 +456,55 @@ DetailedMotionState* AvatarManager::createDetailedMotionState(OtherAvatarPointer
     return nullptr;
 }
 
+void AvatarManager::updatePhysicalInterests() {
+    _physicalInterests.clear();
+    _physicalInterests.push_back({ _myAvatar->getWorldPosition(), AVATAR_REACH * _myAvatar->getModelScale() });
+
+    auto grabTargetIDs = _myAvatar->getGrabTargetIDs();
+    if (!grabTargetIDs.empty()) {
+        auto entityTree = qApp->getEntities()->getTree();
+        for (const auto& targetID : grabTargetIDs) {
+            auto entity = entityTree->findEntityByID(targetID);
+            if (entity) {
+                _physicalInterests.push_back({ entity->getWorldPosition(), 0.5f * glm::length(entity->getScaledDimensions()) });
+            }
+        }
+    }
+
+    // when the last physics step didn't report any change nothing is moving anymore
+    if (!_movingEntityInterestsUpdated) {
+        _movingEntityInterests.clear();
+    }
+    _movingEntityInterestsUpdated = false;
+    _physicalInterests.insert(_physicalInterests.end(), _movingEntityInterests.begin(), _movingEntityInterests.end());
+
+    ++_physicalInterestFrame;
+}
+
+void AvatarManager::updateNearPhysicalInterest(const OtherAvatarPointer& avatar) {
+    // amortize the checks over several frames, staggered so that avatars don't all get checked in the same one
+    if ((_physicalInterestFrame + (uint32_t)avatar->getSpaceIndex()) % PHYSICAL_INTEREST_CHECK_PERIOD != 0) {
+        return;
+    }
+
+    // use a wider distance to demote than to promote, so that avatars hovering at the limit
+    // don't rebuild their bodies over and over
+    bool wasNear = avatar->isNearPhysicalInterest();
+    float maxGap = wasNear ? DETAILED_BODIES_DEMOTE_DISTANCE : DETAILED_BODIES_PROMOTE_DISTANCE;
+    glm::vec3 position = avatar->getWorldPosition();
+    float radius = AVATAR_REACH * avatar->getModelScale();
+
+    bool isNear = false;
+    for (const auto& interest : _physicalInterests) {
+        float maxDistance = radius + interest.radius + maxGap;
+        if (glm::distance2(position, interest.position) < maxDistance * maxDistance) {
+            isNear = true;
+            break;
+        }
+    }
+    avatar->setNearPhysicalInterest(isNear);
+}
+
 void AvatarManager::rebuildAvatarPhysics(PhysicsEngine::Transaction& transaction, const OtherAvatarPointer& avatar) {
     if (!avatar->_motionState) {
         avatar->_motionState = new AvatarMotionState(avatar, nullptr);
@@ -492,6 +562,10 @@ void AvatarManager::rebuildDetailedAvatarPhysics(PhysicsEngine::Transaction& tra
 
 void AvatarManager::buildPhysicsTransaction(PhysicsEngine::Transaction& transaction) {
     _myAvatar->getCharacterController()->buildPhysicsTransaction(transaction);
+
+    // detailed rebuilds add and remove one body per joint, spread them over several frames
+    int numDetailedRebuilds = 0;
+    SetOfOtherAvatars deferredAvatars;
     for (auto avatar : _otherAvatarsToChangeInPhysics) {
         bool isInPhysics = avatar->isInPhysicsSimulation();
         if (isInPhysics != avatar->shouldBeInPhysicsSimulation()) {
@@ -502,6 +576,7 @@ void AvatarManager::buildPhysicsTransaction(PhysicsEngine::Transaction& transact
             } else {
                 rebuildAvatarPhysics(transaction, avatar);
                 rebuildDetailedAvatarPhysics(transaction, avatar);
+                ++numDetailedRebuilds;
             }
         } else if (isInPhysics) {
             AvatarMotionState* motionState = avatar->_motionState;
@@ -522,11 +597,16 @@ void AvatarManager::buildPhysicsTransaction(PhysicsEngine::Transaction& transact
             }
 
             if (avatar->_needsDetailedRebuild) {
-                rebuildDetailedAvatarPhysics(transaction, avatar);
+                if (numDetailedRebuilds < MAX_DETAILED_REBUILDS_PER_FRAME) {
+                    rebuildDetailedAvatarPhysics(transaction, avatar);
+                    ++numDetailedRebuilds;
+                } else {
+                    deferredAvatars.insert(avatar);
+                }
             }
         }
     }
-    _otherAvatarsToChangeInPhysics.clear();
+    _otherAvatarsToChangeInPhysics.swap(deferredAvatars);
 }
 
 void AvatarManager::handleProcessedPhysicsTransaction(PhysicsEngine::Transaction& transaction) {
@@ -651,6 +731,20 @@ void AvatarManager::deleteAllAvatars() {
 
 void AvatarManager::handleChangedMotionStates(const VectorOfMotionStates& motionStates) {
     // TODO: extract the MyAvatar results once we use a MotionState for it.
+
+    // other avatars near the moving physical entities need their detailed collision bodies
+    _movingEntityInterests.clear();
+    for (const auto& motionState : motionStates) {
+        btRigidBody* body = motionState->getRigidBody();
+        if (body && motionState->getType() == MOTIONSTATE_TYPE_ENTITY && motionState->getMotionType() == MOTION_TYPE_DYNAMIC) {
+            btVector3 minCorner, maxCorner;
+            body->getAabb(minCorner, maxCorner);
+            glm::vec3 center = 0.5f * bulletToGLM(minCorner + maxCorner);
+            float radius = 0.5f * glm::length(bulletToGLM(maxCorner - minCorner));
+            _movingEntityInterests.push_back({ center, radius });
+        }
+    }
+    _movingEntityInterestsUpdated = true;
 }
 
 void AvatarManager::handleCollisionEvents(const CollisionEvents& collisionEvents) {
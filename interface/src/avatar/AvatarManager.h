@@ -21,6 +21,7 @@
 #include <AvatarHashMap.h>
 #include <PhysicsEngine.h>
 #include <PIDController.h>
+#include <PrioritySortUtil.h>
 #include <SimpleMovingAverage.h>
 #include <shared/RateCounter.h>
 #include <avatars-renderer/ScriptAvatar.h>
@@ -122,6 +123,9 @@ public:
     void updateMyAvatar(float deltaTime);
     void updateOtherAvatars(float deltaTime);
 
+    // The time updateOtherAvatars spends updating the avatars, the rest of them being updated on later frames
+    void setUpdateOtherAvatarsTimeBudget(uint64_t timeBudget) { _updateOtherAvatarsTimeBudget = timeBudget; }
+
     void setMyAvatarDataPacketsPaused(bool puase);
 
     void postUpdate(float deltaTime, const render::ScenePointer& scene);
@@ -277,6 +281,8 @@ protected:
     void rebuildAvatarPhysics(PhysicsEngine::Transaction& transaction, const OtherAvatarPointer& avatar);
     void removeDetailedAvatarPhysics(PhysicsEngine::Transaction& transaction, const OtherAvatarPointer& avatar);
     void rebuildDetailedAvatarPhysics(PhysicsEngine::Transaction& transaction, const OtherAvatarPointer& avatar);
+    void updatePhysicalInterests();
+    void updateNearPhysicalInterest(const OtherAvatarPointer& avatar);
 
 private:
     explicit AvatarManager(QObject* parent = 0);
@@ -294,6 +300,16 @@ private:
     using SetOfOtherAvatars = std::set<OtherAvatarPointer>;
     SetOfOtherAvatars _otherAvatarsToChangeInPhysics;
 
+    // places where other avatars could touch something: MyAvatar, what it grabs and the moving physical entities
+    struct PhysicalInterest {
+        glm::vec3 position;
+        float radius;
+    };
+    std::vector<PhysicalInterest> _physicalInterests;
+    std::vector<PhysicalInterest> _movingEntityInterests;
+    bool _movingEntityInterestsUpdated { false };
+    uint32_t _physicalInterestFrame { 0 };
+
     std::shared_ptr<MyAvatar> _myAvatar;
     quint64 _lastSendAvatarDataTime = 0; // Controls MyAvatar send data rate.
 
@@ -305,6 +321,7 @@ private:
     int _numHeroAvatars{ 0 };
     int _numHeroAvatarsUpdated{ 0 };
     float _avatarSimulationTime { 0.0f };
+    uint64_t _updateOtherAvatarsTimeBudget { MAX_UPDATE_AVATARS_TIME_BUDGET }; // usec
     bool _shouldRender { true };
     bool _myAvatarDataPacketsPaused { false };
 
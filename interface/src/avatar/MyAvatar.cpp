@@ -109,6 +109,12 @@ const QString POINT_BLEND_LINEAR_ALPHA_NAME = "pointBlendAlpha";
 const QString POINT_REF_JOINT_NAME = "RightShoulder";
 const float POINT_ALPHA_BLENDING = 1.0f;
 
+// Keys of the calls from script threads that replace each other when they are posted in the same frame
+static const char HEAD_LOOK_AT_COMMAND[] = "headLookAt";
+static const char EYES_LOOK_AT_COMMAND[] = "eyesLookAt";
+static const char POINT_AT_COMMAND[] = "pointAt";
+static const char ATTACHMENTS_COMMAND[] = "attachments";
+
 const std::array<QString, static_cast<uint>(MyAvatar::AllowAvatarStandingPreference::Count)>
     MyAvatar::allowAvatarStandingPreferenceStrings = {
     QStringLiteral("WhenUserIsStanding"),
@@ -660,6 +666,9 @@ void MyAvatar::updateSitStandState(float newHeightReading, float dt) {
 }
 
 void MyAvatar::update(float deltaTime) {
+    _scriptCommands.apply();
+    publishScriptSnapshots();
+
     // update moving average of HMD facing in xz plane.
     const float HMD_FACING_TIMESCALE = getRotationRecenterFilterLength();
     const float PERCENTAGE_WEIGHT_HEAD_VS_SHOULDERS_AZIMUTH = 0.0f; // 100 percent shoulders
@@ -2967,16 +2976,9 @@ void MyAvatar::attach(const QString& modelURL, const QString& jointName,
                       float scale, bool isSoft,
                       bool allowDuplicates, bool useSaved) {
     if (QThread::currentThread() != thread()) {
-        BLOCKING_INVOKE_METHOD(this, "attach",
-            Q_ARG(const QString&, modelURL), 
-            Q_ARG(const QString&, jointName), 
-            Q_ARG(const glm::vec3&, translation), 
-            Q_ARG(const glm::quat&, rotation),
-            Q_ARG(float, scale),
-            Q_ARG(bool, isSoft),
-            Q_ARG(bool, allowDuplicates),
-            Q_ARG(bool, useSaved)
-        );
+        _scriptCommands.post([=] {
+            attach(modelURL, jointName, translation, rotation, scale, isSoft, allowDuplicates, useSaved);
+        });
         return;
     }
     if (!DependencyManager::get<NodeList>()->getThisNodeCanRezAvatarEntities()) {
@@ -2999,10 +3001,9 @@ void MyAvatar::attach(const QString& modelURL, const QString& jointName,
 
 void MyAvatar::detachOne(const QString& modelURL, const QString& jointName) {
     if (QThread::currentThread() != thread()) {
-        BLOCKING_INVOKE_METHOD(this, "detachOne",
-            Q_ARG(const QString&, modelURL),
-            Q_ARG(const QString&, jointName)
-        );
+        _scriptCommands.post([=] {
+            detachOne(modelURL, jointName);
+        });
         return;
     }
     if (!DependencyManager::get<NodeList>()->getThisNodeCanRezAvatarEntities()) {
@@ -3019,10 +3020,9 @@ void MyAvatar::detachOne(const QString& modelURL, const QString& jointName) {
 
 void MyAvatar::detachAll(const QString& modelURL, const QString& jointName) {
     if (QThread::currentThread() != thread()) {
-        BLOCKING_INVOKE_METHOD(this, "detachAll",
-            Q_ARG(const QString&, modelURL),
-            Q_ARG(const QString&, jointName)
-        );
+        _scriptCommands.post([=] {
+            detachAll(modelURL, jointName);
+        });
         return;
     }
     if (!DependencyManager::get<NodeList>()->getThisNodeCanRezAvatarEntities()) {
@@ -3039,8 +3039,9 @@ void MyAvatar::detachAll(const QString& modelURL, const QString& jointName) {
 
 void MyAvatar::setAttachmentData(const QVector<AttachmentData>& attachmentData) {
     if (QThread::currentThread() != thread()) {
-        BLOCKING_INVOKE_METHOD(this, "setAttachmentData",
-            Q_ARG(const QVector<AttachmentData>&, attachmentData));
+        _scriptCommands.post(ATTACHMENTS_COMMAND, [=] {
+            setAttachmentData(attachmentData);
+        });
         return;
     }
     if (!DependencyManager::get<NodeList>()->getThisNodeCanRezAvatarEntities()) {
@@ -3105,8 +3106,9 @@ QVariantList MyAvatar::getAttachmentsVariant() const {
 
 void MyAvatar::setAttachmentsVariant(const QVariantList& variant) {
     if (QThread::currentThread() != thread()) {
-        BLOCKING_INVOKE_METHOD(this, "setAttachmentsVariant",
-            Q_ARG(const QVariantList&, variant));
+        _scriptCommands.post(ATTACHMENTS_COMMAND, [=] {
+            setAttachmentsVariant(variant);
+        });
         return;
     }
 
@@ -4187,6 +4189,10 @@ float MyAvatar::getGravity() {
 void MyAvatar::setSessionUUID(const QUuid& sessionUUID) {
     QUuid oldSessionID = getSessionUUID();
     Avatar::setSessionUUID(sessionUUID);
+    auto entityTreeRenderer = DependencyManager::get<EntityTreeRenderer>();
+    if (entityTreeRenderer && entityTreeRenderer->getTree() && sessionUUID != oldSessionID) {
+        entityTreeRenderer->getTree()->notifyParentAdded(sessionUUID);
+    }
     bool sendPackets = !DependencyManager::get<NodeList>()->getSessionUUID().isNull()
         && DependencyManager::get<NodeList>()->getThisNodeCanRezAvatarEntities();
     if (!sendPackets) {
@@ -6730,10 +6736,17 @@ void MyAvatar::useFlow(bool isActive, bool isCollidable, const QVariantMap& phys
 QVariantMap MyAvatar::getFlowData() {
     QVariantMap result;
     if (QThread::currentThread() != thread()) {
-        BLOCKING_INVOKE_METHOD(this, "getFlowData",
-            Q_RETURN_ARG(QVariantMap, result));
+        if (!_flowData.get(result)) {
+            BLOCKING_INVOKE_METHOD(this, "getFlowData",
+                Q_RETURN_ARG(QVariantMap, result));
+        }
         return result;
     }
+    return computeFlowData();
+}
+
+QVariantMap MyAvatar::computeFlowData() {
+    QVariantMap result;
     if (_skeletonModel->isLoaded()) {
         auto jointNames = getJointNames();
         auto &flow = _skeletonModel->getRig().getFlow();
@@ -6798,11 +6811,17 @@ QVariantMap MyAvatar::getFlowData() {
 QVariantList MyAvatar::getCollidingFlowJoints() {
     QVariantList result;
     if (QThread::currentThread() != thread()) {
-        BLOCKING_INVOKE_METHOD(this, "getCollidingFlowJoints",
-            Q_RETURN_ARG(QVariantList, result));
+        if (!_collidingFlowJoints.get(result)) {
+            BLOCKING_INVOKE_METHOD(this, "getCollidingFlowJoints",
+                Q_RETURN_ARG(QVariantList, result));
+        }
         return result;
     }
+    return computeCollidingFlowJoints();
+}
 
+QVariantList MyAvatar::computeCollidingFlowJoints() {
+    QVariantList result;
     if (_skeletonModel->isLoaded()) {
         auto& flow = _skeletonModel->getRig().getFlow();
         for (auto &joint : flow.getJoints()) {
@@ -7117,8 +7136,9 @@ void MyAvatar::updateHeadLookAt(float deltaTime) {
 
 void MyAvatar::setHeadLookAt(const glm::vec3& lookAtTarget) {
     if (QThread::currentThread() != thread()) {
-        BLOCKING_INVOKE_METHOD(this, "setHeadLookAt",
-            Q_ARG(const glm::vec3&, lookAtTarget));
+        _scriptCommands.post(HEAD_LOOK_AT_COMMAND, [=] {
+            setHeadLookAt(lookAtTarget);
+        });
         return;
     }
     _headLookAtActive = true;
@@ -7129,8 +7149,9 @@ void MyAvatar::setHeadLookAt(const glm::vec3& lookAtTarget) {
 
 void MyAvatar::setEyesLookAt(const glm::vec3& lookAtTarget) {
     if (QThread::currentThread() != thread()) {
-        BLOCKING_INVOKE_METHOD(this, "setEyesLookAt",
-            Q_ARG(const glm::vec3&, lookAtTarget));
+        _scriptCommands.post(EYES_LOOK_AT_COMMAND, [=] {
+            setEyesLookAt(lookAtTarget);
+        });
         return;
     }
     _eyesLookAtTarget.set(lookAtTarget);
@@ -7139,10 +7160,23 @@ void MyAvatar::setEyesLookAt(const glm::vec3& lookAtTarget) {
 }
 
 void MyAvatar::releaseHeadLookAtControl() {
+    if (QThread::currentThread() != thread()) {
+        // after any setHeadLookAt the script made before
+        _scriptCommands.post([=] {
+            releaseHeadLookAtControl();
+        });
+        return;
+    }
     _scriptHeadControlTimer = MAX_LOOK_AT_TIME_SCRIPT_CONTROL;
 }
 
 void MyAvatar::releaseEyesLookAtControl() {
+    if (QThread::currentThread() != thread()) {
+        _scriptCommands.post([=] {
+            releaseEyesLookAtControl();
+        });
+        return;
+    }
     _scriptEyesControlTimer = MAX_LOOK_AT_TIME_SCRIPT_CONTROL;
 }
 
@@ -7226,10 +7260,19 @@ bool MyAvatar::getHMDCrouchRecenterEnabled() const {
 
 bool MyAvatar::setPointAt(const glm::vec3& pointAtTarget) {
     if (QThread::currentThread() != thread()) {
-        bool result = false;
-        BLOCKING_INVOKE_METHOD(this, "setPointAt", Q_RETURN_ARG(bool, result),
-            Q_ARG(const glm::vec3&, pointAtTarget));
-        return result;
+        PointAtReference reference;
+        if (!_pointAtReference.get(reference)) {
+            bool result = false;
+            BLOCKING_INVOKE_METHOD(this, "setPointAt", Q_RETURN_ARG(bool, result),
+                Q_ARG(const glm::vec3&, pointAtTarget));
+            return result;
+        }
+        // answered from where the avatar was last frame, the same way as below
+        _scriptCommands.post(POINT_AT_COMMAND, [=] {
+            setPointAt(pointAtTarget);
+        });
+        glm::vec3 aimVector = pointAtTarget - reference.position;
+        return reference.canPointAt && glm::dot(aimVector, reference.orientation * Vectors::FRONT) > 0.0f;
     }
     if (_skeletonModel->isLoaded() && _pointAtActive) {
         glm::vec3 aimVector = pointAtTarget - getJointPosition(POINT_REF_JOINT_NAME);
@@ -7244,6 +7287,24 @@ bool MyAvatar::setPointAt(const glm::vec3& pointAtTarget) {
     return false;
 }
 
+void MyAvatar::publishScriptSnapshots() {
+    _pointAtReference.update([this] {
+        PointAtReference reference;
+        reference.canPointAt = _skeletonModel->isLoaded() && _pointAtActive;
+        if (reference.canPointAt) {
+            reference.position = getJointPosition(POINT_REF_JOINT_NAME);
+        }
+        reference.orientation = getWorldOrientation();
+        return reference;
+    });
+    _flowData.update([this] {
+        return computeFlowData();
+    });
+    _collidingFlowJoints.update([this] {
+        return computeCollidingFlowJoints();
+    });
+}
+
 void MyAvatar::resetPointAt() {
     if (_skeletonModel->isLoaded()) {
         _skeletonModel->getRig().setDirectionalBlending(POINT_BLEND_DIRECTIONAL_ALPHA_NAME, glm::vec3(),
@@ -30,6 +30,7 @@
 #include <SettingHandle.h>
 #include <Sound.h>
 #include <shared/Camera.h>
+#include <shared/FrameCommands.h>
 
 #include "AtRestDetector.h"
 #include "MyCharacterController.h"
@@ -2806,6 +2807,19 @@ private:
     bool _pointAtActive { false };
     bool _isPointTargetValid { true };
 
+    // Calls from script threads that don't need an answer, applied at the start of update()
+    hifi::FrameCommandQueue _scriptCommands;
+
+    // What scripts can see of the avatar without waiting for the main thread, published by update() when asked for
+    struct PointAtReference {
+        bool canPointAt { false };
+        glm::vec3 position;
+        glm::quat orientation;
+    };
+    hifi::FrameSnapshot<PointAtReference> _pointAtReference;
+    hifi::FrameSnapshot<QVariantMap> _flowData;
+    hifi::FrameSnapshot<QVariantList> _collidingFlowJoints;
+
     Setting::Handle<float> _realWorldFieldOfView;
     Setting::Handle<bool> _useAdvancedMovementControls;
     Setting::Handle<bool> _showPlayArea;
@@ -2834,6 +2848,9 @@ private:
     void resetHeadLookAt();
     void resetLookAtRotation(const glm::vec3& avatarPosition, const glm::quat& avatarOrientation);
     void resetPointAt();
+    void publishScriptSnapshots();
+    QVariantMap computeFlowData();
+    QVariantList computeCollidingFlowJoints();
     static glm::vec3 aimToBlendValues(const glm::vec3& aimVector, const glm::quat& frameOrientation);
     void centerBodyInternal(const bool forceFollowYPos = false);
 
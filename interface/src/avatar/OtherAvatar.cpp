@@ -190,11 +190,20 @@ void OtherAvatar::setWorkloadRegion(uint8_t region) {
     computeShapeLOD();
 }
 
+void OtherAvatar::setNearPhysicalInterest(bool isNear) {
+    if (isNear != _isNearPhysicalInterest) {
+        _isNearPhysicalInterest = isNear;
+        computeShapeLOD();
+    }
+}
+
 void OtherAvatar::computeShapeLOD() {
     // auto newBodyLOD = _workloadRegion < workload::Region::R3 ? BodyLOD::MultiSphereShapes : BodyLOD::CapsuleShape;
     // auto newBodyLOD = BodyLOD::CapsuleShape;
     BodyLOD newLOD;
-    switch (_workloadRegion) {
+    // avatars far from MyAvatar, its grabs and the moving physical entities only get a single proxy body
+    uint8_t region = _isNearPhysicalInterest ? _workloadRegion : (uint8_t)workload::Region::R3;
+    switch (region) {
     case workload::Region::R1:
         newLOD = BodyLOD::MultiSphereHigh;
         break;
@@ -58,6 +58,10 @@ public:
     BodyLOD getBodyLOD() { return _bodyLOD; }
     void computeShapeLOD();
 
+    // detailed per-joint bodies are only built while the avatar is near something it can collide with
+    void setNearPhysicalInterest(bool isNear);
+    bool isNearPhysicalInterest() const { return _isNearPhysicalInterest; }
+
     void updateCollisionGroup(bool myAvatarCollide);
     bool getCollideWithOtherAvatars() const { return _collideWithOtherAvatars; } 
 
@@ -91,6 +95,7 @@ protected:
     uint8_t _workloadRegion { workload::Region::INVALID };
     BodyLOD _bodyLOD { BodyLOD::Sphere };
     bool _needsDetailedRebuild { false };
+    bool _isNearPhysicalInterest { false };
 };
 
 using OtherAvatarPointer = std::shared_ptr<OtherAvatar>;
@@ -259,12 +259,27 @@ bool AssetMappingModel::isKnownFolder(QString path) const {
 
 void AssetMappingModel::refresh() {
     auto assetClient = DependencyManager::get<AssetClient>();
-    auto request = assetClient->createGetAllMappingsRequest();
 
-    connect(request, &GetAllMappingsRequest::finished, this, [this](GetAllMappingsRequest* request) mutable {
+    // only ask for what changed since the last refresh, the asset server falls back to all the mappings if it can't tell
+    auto request = assetClient->createGetMappingChangesRequest(_mappingsHistoryID, _mappingsVersion);
+
+    connect(request, &GetMappingChangesRequest::finished, this, [this](GetMappingChangesRequest* request) mutable {
         if (request->getError() == MappingRequest::NoError) {
+            if (request->isFullSnapshot()) {
+                _mappings = request->getChangedMappings();
+            } else {
+                for (auto& path : request->getRemovedPaths()) {
+                    _mappings.erase(path);
+                }
+                for (auto& mapping : request->getChangedMappings()) {
+                    _mappings[mapping.first] = mapping.second;
+                }
+            }
+            _mappingsHistoryID = request->getHistoryID();
+            _mappingsVersion = request->getVersion();
+
             int numPendingBakes = 0;
-            auto mappings = request->getMappings();
+            const auto& mappings = _mappings;
             auto existingPaths = _pathToItemMap.keys();
             for (auto& mapping : mappings) {
                 auto& path = mapping.first;
@@ -389,6 +404,9 @@ void AssetMappingModel::clear() {
     qDebug() << "Clearing loaded asset mappings for Asset Browser";
 
     _pathToItemMap.clear();
+    _mappings.clear();
+    _mappingsHistoryID = QUuid();
+    _mappingsVersion = 0;
     QStandardItemModel::clear();
 }
 
@@ -53,6 +53,11 @@ private:
     void setupRoles();
 
     QHash<QString, QStandardItem*> _pathToItemMap;
+
+    // local copy of the asset server mappings, kept up to date with the changes since _mappingsVersion
+    AssetUtils::AssetMappings _mappings;
+    QUuid _mappingsHistoryID;
+    uint64_t _mappingsVersion { 0 };
     QTimer _autoRefreshTimer;
     int _numPendingBakes{ 0 };
 };
@@ -13,6 +13,7 @@
 #include <ScriptEngines.h>
 #include <OffscreenUi.h>
 #include <Preferences.h>
+#include <ResourceCache.h>
 #include <plugins/PluginUtils.h>
 #include <display-plugins/CompositorHelper.h>
 #include <display-plugins/hmd/HmdDisplayPlugin.h>
@@ -577,5 +578,16 @@ void setupPreferences() {
             preference->setStep(10);
             preferences->addPreference(preference);
         }
+
+        {
+            auto getter = []()->int { return qApp->getResourceMemoryBudgetMB(); };
+            auto setter = [](int value) { qApp->setResourceMemoryBudgetMB(value); };
+            auto preference = new IntSpinnerPreference(NETWORKING, "Downloaded resources memory budget (MB, 0 for none)",
+                                                       getter, setter);
+            preference->setMin(0);
+            preference->setMax(BYTES_TO_MB(MAX_RESOURCE_MEMORY_BUDGET));
+            preference->setStep(256);
+            preferences->addPreference(preference);
+        }
     }
 }
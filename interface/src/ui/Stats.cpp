@@ -420,6 +420,7 @@ void Stats::updateStats(bool force) {
     STAT_UPDATE(drawcalls, gpuFrameStats._DSNumDrawcalls);
     STAT_UPDATE(lodTargetFramerate, DependencyManager::get<LODManager>()->getLODTargetFPS());
     STAT_UPDATE(lodAngle, DependencyManager::get<LODManager>()->getLODAngleDeg());
+    STAT_UPDATE_FLOAT(meshLODPixelError, DependencyManager::get<LODManager>()->getMeshLODPixelError(), 0.01f);
 
 
     // Incoming packets
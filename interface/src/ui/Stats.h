@@ -248,6 +248,8 @@ private: \
  *     <em>Read-only.</em>
  * @property {string} lodStatus - Description of the current LOD.
  *     <em>Read-only.</em>
+ * @property {number} meshLODPixelError - The largest error, in pixels on screen, of the mesh levels of detail drawn.
+ *     <em>Read-only.</em>
  * @property {number} numEntityUpdates - The number of entity updates that happened last frame.
  *     <em>Read-only.</em>
  * @property {number} numNeededEntityUpdates - The total number of entity updates scheduled for last frame.
@@ -547,6 +549,7 @@ class Stats : public QQuickItem {
     STATS_PROPERTY(int, lodAngle, 0)
     STATS_PROPERTY(int, lodTargetFramerate, 0)
     STATS_PROPERTY(QString, lodStatus, QString())
+    STATS_PROPERTY(float, meshLODPixelError, 0)
     STATS_PROPERTY(quint64, numEntityUpdates, 0)
     STATS_PROPERTY(quint64, numNeededEntityUpdates, 0)
     STATS_PROPERTY(QString, timingStats, QString())
@@ -1217,6 +1220,13 @@ signals:
      */
     void lodStatusChanged();
 
+    /*@jsdoc
+     * Triggered when the value of the <code>meshLODPixelError</code> property changes.
+     * @function Stats.meshLODPixelErrorChanged
+     * @returns {Signal}
+     */
+    void meshLODPixelErrorChanged();
+
     /*@jsdoc
      * Triggered when the value of the <code>numEntityUpdates</code> property changes.
      * @function Stats.numEntityUpdatesChanged
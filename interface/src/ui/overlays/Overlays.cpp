@@ -94,6 +94,9 @@ void Overlays::init() {
 
 void Overlays::update(float deltatime) {
     cleanupOverlaysToDelete();
+    _windowSize.update([this] {
+        return getWindowSize();
+    });
 }
 
 void Overlays::cleanupOverlaysToDelete() {
@@ -1206,26 +1209,37 @@ void Overlays::sendHoverLeaveOverlay(const QUuid& id, const PointerEvent& event)
 
 float Overlays::width() {
     if (QThread::currentThread() != thread()) {
+        QSizeF windowSize;
+        if (_windowSize.get(windowSize)) {
+            return windowSize.width();
+        }
         float result;
         PROFILE_RANGE(script, __FUNCTION__);
         BLOCKING_INVOKE_METHOD(this, "width", Q_RETURN_ARG(float, result));
         return result;
     }
 
-    auto offscreenUI = DependencyManager::get<OffscreenUi>();
-    return offscreenUI ? offscreenUI->getWindow()->size().width() : -1.0f;
+    return getWindowSize().width();
 }
 
 float Overlays::height() {
     if (QThread::currentThread() != thread()) {
+        QSizeF windowSize;
+        if (_windowSize.get(windowSize)) {
+            return windowSize.height();
+        }
         float result;
         PROFILE_RANGE(script, __FUNCTION__);
         BLOCKING_INVOKE_METHOD(this, "height", Q_RETURN_ARG(float, result));
         return result;
     }
 
+    return getWindowSize().height();
+}
+
+QSizeF Overlays::getWindowSize() const {
     auto offscreenUI = DependencyManager::get<OffscreenUi>();
-    return offscreenUI ? offscreenUI->getWindow()->size().height() : -1.0f;
+    return offscreenUI ? QSizeF(offscreenUI->getWindow()->size()) : QSizeF(-1.0f, -1.0f);
 }
 
 void Overlays::mousePressOnPointerEvent(const QUuid& id, const PointerEvent& event) {
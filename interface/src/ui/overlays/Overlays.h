@@ -23,6 +23,7 @@
 #include <QScriptValue>
 
 #include <PointerEvent.h>
+#include <shared/FrameCommands.h>
 
 #include "Overlay.h"
 
@@ -745,11 +746,15 @@ signals:
 
 private:
     void cleanupOverlaysToDelete();
+    QSizeF getWindowSize() const;
 
     mutable QMutex _mutex { QMutex::Recursive };
     QMap<QUuid, Overlay::Pointer> _overlays;
     QList<Overlay::Pointer> _overlaysToDelete;
 
+    // for width() and height() from script threads, published by update() when asked for
+    hifi::FrameSnapshot<QSizeF> _windowSize;
+
     unsigned int _stackOrder { 1 };
 
     bool _enabled { true };
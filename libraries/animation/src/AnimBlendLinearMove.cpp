@@ -14,10 +14,15 @@
 #include "AnimUtil.h"
 #include "AnimClip.h"
 
+static const AnimVarKey MOVE_BACKWARD_SPEED("moveBackwardSpeed");
+static const AnimVarKey MOVE_FORWARD_SPEED("moveForwardSpeed");
+static const AnimVarKey MOVE_LATERAL_SPEED("moveLateralSpeed");
+
 AnimBlendLinearMove::AnimBlendLinearMove(const QString& id, float alpha, float desiredSpeed, const std::vector<float>& characteristicSpeeds) :
     AnimNode(AnimNode::Type::BlendLinearMove, id),
     _alpha(alpha),
     _desiredSpeed(desiredSpeed),
+    _speedVar(MOVE_FORWARD_SPEED),
     _characteristicSpeeds(characteristicSpeeds) {
 
 }
@@ -26,6 +31,18 @@ AnimBlendLinearMove::~AnimBlendLinearMove() {
 
 }
 
+void AnimBlendLinearMove::setAlphaVar(const QString& alphaVar) {
+    _alphaVar = alphaVar;
+    if (alphaVar.contains("Lateral")) {
+        _speedVar = MOVE_LATERAL_SPEED;
+    } else if (alphaVar.contains("Backward")) {
+        _speedVar = MOVE_BACKWARD_SPEED;
+    } else {
+        //this is forward movement
+        _speedVar = MOVE_FORWARD_SPEED;
+    }
+}
+
 static float calculateAlpha(const float speed, const std::vector<float>& characteristicSpeeds) {
 
     assert(characteristicSpeeds.size() > 0);
@@ -52,15 +69,7 @@ const AnimPoseVec& AnimBlendLinearMove::evaluate(const AnimVariantMap& animVars,
 
     _desiredSpeed = animVars.lookup(_desiredSpeedVar, _desiredSpeed);
 
-    float speed = 0.0f;
-    if (_alphaVar.contains("Lateral")) {
-        speed = animVars.lookup("moveLateralSpeed", speed);
-    } else if (_alphaVar.contains("Backward")) {
-        speed = animVars.lookup("moveBackwardSpeed", speed);
-    } else {
-        //this is forward movement
-        speed = animVars.lookup("moveForwardSpeed", speed);
-    }
+    float speed = animVars.lookup(_speedVar, 0.0f);
     _alpha = calculateAlpha(speed, _characteristicSpeeds);
     float parentDebugAlpha = context.getDebugAlpha(_id);
 
@@ -11,6 +11,9 @@
 #include "AnimClip.h"
 
 #include <assert.h>
+#include <mutex>
+
+#include <QHash>
 
 #include "GLMHelpers.h"
 #include "AnimationLogging.h"
@@ -223,6 +226,39 @@ static std::vector<AnimPoseVec> copyAndRetargetFromNetworkAnim(AnimationPointer
     return anim;
 }
 
+// The frames of the clips loaded by every avatar, by animation and skeleton. Avatars using the same model share them,
+// and they are freed once the last clip using them is.
+static std::mutex sharedFramesMutex;
+static QHash<QByteArray, std::weak_ptr<const std::vector<AnimPoseVec>>> sharedFrames;
+
+static std::shared_ptr<const std::vector<AnimPoseVec>> findSharedFrames(const QByteArray& key) {
+    std::lock_guard<std::mutex> guard(sharedFramesMutex);
+    auto frames = sharedFrames.find(key);
+    return frames != sharedFrames.end() ? frames.value().lock() : nullptr;
+}
+
+static std::shared_ptr<const std::vector<AnimPoseVec>> shareFrames(const QByteArray& key,
+                                                                   std::shared_ptr<const std::vector<AnimPoseVec>> frames) {
+    std::lock_guard<std::mutex> guard(sharedFramesMutex);
+    auto& shared = sharedFrames[key];
+    auto existing = shared.lock();
+    if (existing) {
+        // another avatar got there first
+        return existing;
+    }
+    shared = frames;
+
+    // frames are only added when a clip is loaded, so this is where those no clip uses anymore are dropped
+    for (auto itr = sharedFrames.begin(); itr != sharedFrames.end();) {
+        if (itr.value().expired()) {
+            itr = sharedFrames.erase(itr);
+        } else {
+            ++itr;
+        }
+    }
+    return frames;
+}
+
 AnimClip::AnimClip(const QString& id, const QString& url, float startFrame, float endFrame, float timeScale, bool loopFlag, bool mirrorFlag,
                    AnimBlendType blendType, const QString& baseURL, float baseFrame) :
     AnimNode(AnimNode::Type::Clip, id),
@@ -260,51 +296,15 @@ const AnimPoseVec& AnimClip::evaluate(const AnimVariantMap& animVars, const Anim
 
     _frame = ::accumulateTime(_startFrame, _endFrame, _timeScale, frame, dt, _loopFlag, _id, triggersOut);
 
-    // poll network anim to see if it's finished loading yet.
-    if (_blendType == AnimBlendType_Normal) {
-        if (_networkAnim && _networkAnim->isLoaded() && _skeleton) {
-            // loading is complete, copy & retarget animation.
-            _anim = copyAndRetargetFromNetworkAnim(_networkAnim, _skeleton);
-
-            // we no longer need the actual animation resource anymore.
-            _networkAnim.reset();
-
-            // mirrorAnim will be re-built on demand, if needed.
-            _mirrorAnim.clear();
-
-            _poses.resize(_skeleton->getNumJoints());
-        }
-    } else {
-        // an additive blend type
-        if (_networkAnim && _networkAnim->isLoaded() && _baseNetworkAnim && _baseNetworkAnim->isLoaded() && _skeleton) {
-            // loading is complete, copy & retarget animation.
-            _anim = copyAndRetargetFromNetworkAnim(_networkAnim, _skeleton);
-
-            // we no longer need the actual animation resource anymore.
-            _networkAnim.reset();
-
-            // mirrorAnim will be re-built on demand, if needed.
-            // TODO: handle mirrored relative animations.
-            _mirrorAnim.clear();
-
-            _poses.resize(_skeleton->getNumJoints());
-
-            // copy & retarget baseAnim!
-            auto baseAnim = copyAndRetargetFromNetworkAnim(_baseNetworkAnim, _skeleton);
-
-            if (_blendType == AnimBlendType_AddAbsolute) {
-                bakeAbsoluteDeltaAnim(_anim, baseAnim[(int)_baseFrame], _skeleton);
-            } else {
-                // AnimBlendType_AddRelative
-                bakeRelativeDeltaAnim(_anim, baseAnim[(int)_baseFrame]);
-            }
-        }
+    // poll network anim to see if it's finished loading yet, unless an avatar with the same skeleton already loaded it.
+    if (_networkAnim && _skeleton) {
+        loadFrames();
     }
 
-    if (_anim.size()) {
+    if (_anim && _anim->size()) {
 
         // lazy creation of mirrored animation frames.
-        if (_mirrorFlag && _anim.size() != _mirrorAnim.size()) {
+        if (_mirrorFlag && !_mirrorAnim) {
             buildMirrorAnim();
         }
 
@@ -318,12 +318,13 @@ const AnimPoseVec& AnimClip::evaluate(const AnimVariantMap& animVars, const Anim
 
         // It can be quite possible for the user to set _startFrame and _endFrame to
         // values before or past valid ranges.  We clamp the frames here.
-        int frameCount = (int)_anim.size();
+        int frameCount = (int)_anim->size();
         prevIndex = std::min(std::max(0, prevIndex), frameCount - 1);
         nextIndex = std::min(std::max(0, nextIndex), frameCount - 1);
 
-        const AnimPoseVec& prevFrame = _mirrorFlag ? _mirrorAnim[prevIndex] : _anim[prevIndex];
-        const AnimPoseVec& nextFrame = _mirrorFlag ? _mirrorAnim[nextIndex] : _anim[nextIndex];
+        const Frames& frames = _mirrorFlag ? *_mirrorAnim : *_anim;
+        const AnimPoseVec& prevFrame = frames[prevIndex];
+        const AnimPoseVec& nextFrame = frames[nextIndex];
         float alpha = glm::fract(_frame);
 
         ::blend(_poses.size(), &prevFrame[0], &nextFrame[0], alpha, &_poses[0]);
@@ -341,15 +342,96 @@ void AnimClip::setCurrentFrameInternal(float frame) {
     _frame = ::accumulateTime(_startFrame, _endFrame, _timeScale, frame + _startFrame, dt, _loopFlag, _id, triggers);
 }
 
+void AnimClip::loadFrames() {
+    assert(_networkAnim && _skeleton);
+
+    std::shared_ptr<const Frames> frames;
+    if (_framesKey.isEmpty()) {
+        // the first time, unless the skeleton changed: an avatar with the same skeleton may already have the frames
+        _framesKey = getFramesKey(false);
+        frames = findSharedFrames(_framesKey);
+    }
+    if (!frames) {
+        if (!_networkAnim->isLoaded()) {
+            return;
+        }
+        if (_blendType != AnimBlendType_Normal && (!_baseNetworkAnim || !_baseNetworkAnim->isLoaded())) {
+            return;
+        }
+        // another avatar may have retargeted them while we waited
+        frames = findSharedFrames(_framesKey);
+    }
+    if (!frames) {
+        if (_blendType == AnimBlendType_Normal) {
+            // loading is complete, copy & retarget animation.
+            frames = shareFrames(_framesKey, std::make_shared<Frames>(copyAndRetargetFromNetworkAnim(_networkAnim, _skeleton)));
+        } else {
+            // an additive blend type, loading is complete, copy & retarget animation.
+            auto anim = std::make_shared<Frames>(copyAndRetargetFromNetworkAnim(_networkAnim, _skeleton));
+
+            // copy & retarget baseAnim!
+            auto baseAnim = copyAndRetargetFromNetworkAnim(_baseNetworkAnim, _skeleton);
+
+            if (_blendType == AnimBlendType_AddAbsolute) {
+                bakeAbsoluteDeltaAnim(*anim, baseAnim[(int)_baseFrame], _skeleton);
+            } else {
+                // AnimBlendType_AddRelative
+                bakeRelativeDeltaAnim(*anim, baseAnim[(int)_baseFrame]);
+            }
+            frames = shareFrames(_framesKey, anim);
+        }
+    }
+    _anim = frames;
+
+    // we no longer need the actual animation resource anymore.
+    _networkAnim.reset();
+
+    // mirrorAnim will be re-built on demand, if needed.
+    // TODO: handle mirrored relative animations.
+    _mirrorAnim.reset();
+
+    _poses.resize(_skeleton->getNumJoints());
+}
+
+void AnimClip::setSkeletonInternal(AnimSkeleton::ConstPointer skeleton) {
+    AnimNode::setSkeletonInternal(skeleton);
+    _framesKey.clear();
+}
+
 void AnimClip::buildMirrorAnim() {
-    assert(_skeleton);
+    assert(_skeleton && _anim);
+
+    // while another url loads, _anim still holds the frames of the previous one, which aren't shared under its key
+    bool isCurrent = !_networkAnim;
+    QByteArray key = getFramesKey(true);
+    if (isCurrent) {
+        _mirrorAnim = findSharedFrames(key);
+        if (_mirrorAnim) {
+            return;
+        }
+    }
 
-    _mirrorAnim.clear();
-    _mirrorAnim.reserve(_anim.size());
-    for (auto& relPoses : _anim) {
-        _mirrorAnim.push_back(relPoses);
-        _skeleton->mirrorRelativePoses(_mirrorAnim.back());
+    auto mirrorAnim = std::make_shared<Frames>();
+    mirrorAnim->reserve(_anim->size());
+    for (auto& relPoses : *_anim) {
+        mirrorAnim->push_back(relPoses);
+        _skeleton->mirrorRelativePoses(mirrorAnim->back());
     }
+    _mirrorAnim = isCurrent ? shareFrames(key, mirrorAnim) : mirrorAnim;
+}
+
+QByteArray AnimClip::getFramesKey(bool mirrored) const {
+    QByteArray key = _skeleton->getFingerprint();
+    key.append(_url.toUtf8());
+    if (_blendType != AnimBlendType_Normal) {
+        key.append('\n').append(QByteArray::number((int)_blendType));
+        key.append('\n').append(_baseURL.toUtf8());
+        key.append('\n').append(QByteArray::number((int)_baseFrame));
+    }
+    if (mirrored) {
+        key.append("\nmirrored");
+    }
+    return key;
 }
 
 const AnimPoseVec& AnimClip::getPosesInternal() const {
@@ -360,4 +442,8 @@ void AnimClip::loadURL(const QString& url) {
     auto animCache = DependencyManager::get<AnimationCache>();
     _networkAnim = animCache->getAnimation(url);
     _url = url;
+
+    // the frames of the previous url keep playing until these are loaded, but not under its key
+    _framesKey.clear();
+    _mirrorAnim.reset();
 }
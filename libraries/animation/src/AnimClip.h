@@ -60,8 +60,11 @@ public:
 protected:
 
     virtual void setCurrentFrameInternal(float frame) override;
+    virtual void setSkeletonInternal(AnimSkeleton::ConstPointer skeleton) override;
 
+    void loadFrames();
     void buildMirrorAnim();
+    QByteArray getFramesKey(bool mirrored) const;
 
     // for AnimDebugDraw rendering
     virtual const AnimPoseVec& getPosesInternal() const override;
@@ -71,9 +74,11 @@ protected:
 
     AnimPoseVec _poses;
 
-    // _anim[frame][joint]
-    std::vector<AnimPoseVec> _anim;
-    std::vector<AnimPoseVec> _mirrorAnim;
+    // (*_anim)[frame][joint], retargeted to the skeleton and shared with the clips of other avatars with the same one
+    using Frames = std::vector<AnimPoseVec>;
+    std::shared_ptr<const Frames> _anim;
+    std::shared_ptr<const Frames> _mirrorAnim;
+    QByteArray _framesKey; // the key of the frames of _url among the shared frames, for the current skeleton
 
     QString _url;
     float _startFrame;
@@ -86,12 +91,12 @@ protected:
     QString _baseURL;
     float _baseFrame;
 
-    QString _startFrameVar;
-    QString _endFrameVar;
-    QString _timeScaleVar;
-    QString _loopFlagVar;
-    QString _mirrorFlagVar;
-    QString _frameVar;
+    AnimVarKey _startFrameVar;
+    AnimVarKey _endFrameVar;
+    AnimVarKey _timeScaleVar;
+    AnimVarKey _loopFlagVar;
+    AnimVarKey _mirrorFlagVar;
+    AnimVarKey _frameVar;
 
     // no copies
     AnimClip(const AnimClip&) = delete;
@@ -51,7 +51,9 @@ public:
     const QString& getID() const { return _id; }
     Type getType() const { return _type; }
 
-    void addOutputJoint(const QString& outputJointName) { _outputJointNames.push_back(outputJointName); }
+    void addOutputJoint(const QString& outputJointName) {
+        _outputJoints.push_back({ outputJointName, _id + outputJointName + "Rotation", _id + outputJointName + "Position" });
+    }
 
     // hierarchy accessors
     Pointer getParent();
@@ -126,7 +128,12 @@ protected:
     std::vector<AnimNode::Pointer> _children;
     AnimSkeleton::ConstPointer _skeleton;
     std::weak_ptr<AnimNode> _parent;
-    std::vector<QString> _outputJointNames;
+    struct OutputJoint {
+        QString name;
+        AnimVarKey rotationVar;
+        AnimVarKey positionVar;
+    };
+    std::vector<OutputJoint> _outputJoints;
     bool _active { false };
 
     // no copies
@@ -10,9 +10,12 @@
 
 #include "AnimNodeLoader.h"
 
+#include <mutex>
+
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonArray>
+#include <QHash>
 #include <QFile>
 
 #include "AnimNode.h"
@@ -1080,18 +1083,19 @@ bool processBlendDirectionalNode(AnimNode::Pointer node, const QJsonObject& json
     return blendNode->lookupChildIds();
 }
 
-AnimNodeLoader::AnimNodeLoader(const QUrl& url) :
-    _url(url)
-{
-    _resource = QSharedPointer<Resource>::create(url);
-    _resource->setSelf(_resource);
-    _resource->setLoadPriority(this, ANIM_GRAPH_LOAD_PRIORITY);
-    connect(_resource.data(), &Resource::loaded, this, &AnimNodeLoader::onRequestDone);
-    connect(_resource.data(), &Resource::failed, this, &AnimNodeLoader::onRequestError);
-    _resource->ensureLoading();
+// The graphs loaded or being loaded, by url, for as long as a loader of that url is kept
+static std::mutex graphsMutex;
+static QHash<QUrl, std::weak_ptr<const AnimGraphTemplate>> graphTemplates;
+static QHash<QUrl, QWeakPointer<Resource>> graphResources;
+
+static AnimGraphTemplate::Pointer findGraphTemplate(const QUrl& url) {
+    std::lock_guard<std::mutex> guard(graphsMutex);
+    auto graphTemplate = graphTemplates.find(url);
+    return graphTemplate != graphTemplates.end() ? graphTemplate.value().lock() : nullptr;
 }
 
-AnimNode::Pointer AnimNodeLoader::load(const QByteArray& contents, const QUrl& jsonUrl) {
+AnimGraphTemplate::Pointer AnimGraphTemplate::create(const QByteArray& contents, const QUrl& jsonUrl, AnimNode::Pointer& node) {
+    node.reset();
 
     // convert string into a json doc
     QJsonParseError error;
@@ -1124,18 +1128,96 @@ AnimNode::Pointer AnimNodeLoader::load(const QByteArray& contents, const QUrl& j
         return nullptr;
     }
 
-    return loadNode(rootVal.toObject(), jsonUrl);
+    // the nodes are only validated while they are built, so that is done once here, for the first user of the graph
+    Pointer graphTemplate(new AnimGraphTemplate(rootVal.toObject(), jsonUrl));
+    node = graphTemplate->instantiate();
+    if (!node) {
+        return nullptr;
+    }
+    return graphTemplate;
+}
+
+AnimNode::Pointer AnimGraphTemplate::instantiate() const {
+    return loadNode(_root, _url);
+}
+
+AnimNodeLoader::AnimNodeLoader(const QUrl& url) :
+    _url(url)
+{
+    bool startLoading = false;
+    {
+        std::lock_guard<std::mutex> guard(graphsMutex);
+        _graphTemplate = graphTemplates.value(url).lock();
+        if (!_graphTemplate) {
+            // join the download of another loader of the same url, if there is one
+            _resource = graphResources.value(url).toStrongRef();
+            if (!_resource) {
+                _resource = QSharedPointer<Resource>::create(url);
+                _resource->setSelf(_resource);
+                graphResources.insert(url, _resource);
+                startLoading = true;
+            }
+        }
+    }
+
+    if (_graphTemplate) {
+        // signaled once the caller connected to it, as it would be after a download
+        QMetaObject::invokeMethod(this, "onGraphTemplateReady", Qt::QueuedConnection);
+        return;
+    }
+
+    _resource->setLoadPriority(this, ANIM_GRAPH_LOAD_PRIORITY);
+    connect(_resource.data(), &Resource::loaded, this, &AnimNodeLoader::onRequestDone);
+    connect(_resource.data(), &Resource::failed, this, &AnimNodeLoader::onRequestError);
+    if (startLoading) {
+        _resource->ensureLoading();
+    }
+}
+
+AnimNode::Pointer AnimNodeLoader::load(const QByteArray& contents, const QUrl& jsonUrl) {
+    AnimNode::Pointer node;
+    AnimGraphTemplate::create(contents, jsonUrl, node);
+    return node;
 }
 
 void AnimNodeLoader::onRequestDone(const QByteArray data) {
-    auto node = load(data, _url);
-    if (node) {
-        emit success(node);
+    // the first of the loaders sharing the download parses it for the others
+    AnimNode::Pointer node;
+    _graphTemplate = findGraphTemplate(_url);
+    if (!_graphTemplate) {
+        _graphTemplate = AnimGraphTemplate::create(data, _url, node);
+        std::lock_guard<std::mutex> guard(graphsMutex);
+        if (_graphTemplate) {
+            graphTemplates.insert(_url, _graphTemplate);
+        }
+        graphResources.remove(_url);
     } else {
-        emit error(0, "json parse error");
+        node = _graphTemplate->instantiate();
     }
+    _resource.reset();
+    emitLoaded(node);
 }
 
 void AnimNodeLoader::onRequestError(QNetworkReply::NetworkError netError) {
+    {
+        // the next loader of this url tries again
+        std::lock_guard<std::mutex> guard(graphsMutex);
+        if (graphResources.value(_url) == _resource) {
+            graphResources.remove(_url);
+        }
+    }
+    _resource.reset();
     emit error((int)netError, "Resource download error");
 }
+
+void AnimNodeLoader::onGraphTemplateReady() {
+    emitLoaded(_graphTemplate ? _graphTemplate->instantiate() : nullptr);
+}
+
+void AnimNodeLoader::emitLoaded(AnimNode::Pointer node) {
+    if (node) {
+        emit success(node);
+    } else {
+        emit error(0, "json parse error");
+    }
+}
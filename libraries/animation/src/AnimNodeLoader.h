@@ -13,6 +13,7 @@
 
 #include <memory>
 
+#include <QJsonObject>
 #include <QNetworkReply>
 #include <QString>
 #include <QUrl>
@@ -21,12 +22,39 @@
 
 class Resource;
 
+// The parsed and validated contents of an anim graph json file, shared by every avatar using that graph. Each avatar
+// builds its own tree of nodes from it, holding the runtime state of its graph, without the file being fetched or
+// parsed again. What the nodes compute from their skeleton, such as the retargeted frames of the clips, is shared in
+// turn by the avatars with the same skeleton.
+class AnimGraphTemplate {
+public:
+    using Pointer = std::shared_ptr<const AnimGraphTemplate>;
+
+    // nullptr if the contents are not a valid graph. The nodes are validated by building them, and that first tree
+    // is handed back in node for the first avatar to use rather than built again.
+    static Pointer create(const QByteArray& contents, const QUrl& jsonUrl, AnimNode::Pointer& node);
+
+    AnimNode::Pointer instantiate() const;
+
+    const QUrl& getURL() const { return _url; }
+
+private:
+    AnimGraphTemplate(const QJsonObject& root, const QUrl& url) : _root(root), _url(url) {}
+
+    QJsonObject _root;
+    QUrl _url;
+};
+
+// Loads the graph at a url, which is only fetched and parsed by the first of the loaders of that url, for as long as
+// one of them is kept.
 class AnimNodeLoader : public QObject {
     Q_OBJECT
 
 public:
     explicit AnimNodeLoader(const QUrl& url);
 
+    AnimGraphTemplate::Pointer getGraphTemplate() const { return _graphTemplate; }
+
 signals:
     void success(AnimNode::Pointer node);
     void error(int error, QString str);
@@ -38,10 +66,14 @@ protected:
 protected slots:
     void onRequestDone(const QByteArray data);
     void onRequestError(QNetworkReply::NetworkError error);
+    void onGraphTemplateReady();
 
 protected:
+    void emitLoaded(AnimNode::Pointer node);
+
     QUrl _url;
     QSharedPointer<Resource> _resource;
+    AnimGraphTemplate::Pointer _graphTemplate;
 
 private:
 
@@ -40,6 +40,10 @@ public:
     const AnimPoseVec& getAbsoluteDefaultPoses() const { return _absoluteDefaultPoses; }
     const glm::mat4& getGeometryOffset() const { return _geometryOffset; }
 
+    // identifies the joints and default poses, which are the same for skeletons built from the same model, so that
+    // what is computed from them can be shared between the avatars using that model.
+    const QByteArray& getFingerprint() const { return _fingerprint; }
+
     // get pre transform which should include FBX pre potations
     const AnimPose& getPreRotationPose(int jointIndex) const;
 
@@ -74,6 +78,7 @@ public:
 
 protected:
     void buildSkeletonFromJoints(const std::vector<HFMJoint>& joints, const QMap<int, glm::quat> jointOffsets);
+    void buildFingerprint();
 
     std::vector<HFMJoint> _joints;
     std::vector<int> _parentIndices;
@@ -88,6 +93,7 @@ protected:
     QHash<QString, int> _jointIndicesByName;
     std::vector<std::vector<HFMCluster>> _clusterBindMatrixOriginalValues;
     glm::mat4 _geometryOffset;
+    QByteArray _fingerprint;
 
     // no copies
     AnimSkeleton(const AnimSkeleton&) = delete;
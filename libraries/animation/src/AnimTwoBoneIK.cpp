@@ -34,8 +34,8 @@ AnimTwoBoneIK::AnimTwoBoneIK(const QString& id, float alpha, bool enabled, float
     _enabledVar(enabledVar),
     _endEffectorRotationVarVar(endEffectorRotationVarVar),
     _endEffectorPositionVarVar(endEffectorPositionVarVar),
-    _prevEndEffectorRotationVar(),
-    _prevEndEffectorPositionVar()
+    _endEffectorRotationVar(),
+    _endEffectorPositionVar()
 {
 
 }
@@ -108,33 +108,40 @@ const AnimPoseVec& AnimTwoBoneIK::evaluate(const AnimVariantMap& animVars, const
     QString endEffectorRotationVar = animVars.lookup(_endEffectorRotationVarVar, QString(""));
     QString endEffectorPositionVar = animVars.lookup(_endEffectorPositionVarVar, QString(""));
 
+    // the end effector names rarely change, so their keys are only interned again when they do
+    bool rotationVarChanged = _endEffectorRotationVar.getName() != endEffectorRotationVar;
+    bool positionVarChanged = _endEffectorPositionVar.getName() != endEffectorPositionVar;
+
     // if either of the endEffectorVars have changed
-    if ((!_prevEndEffectorRotationVar.isEmpty() && (_prevEndEffectorRotationVar != endEffectorRotationVar)) ||
-        (!_prevEndEffectorPositionVar.isEmpty() && (_prevEndEffectorPositionVar != endEffectorPositionVar))) {
+    if ((!_endEffectorRotationVar.isEmpty() && rotationVarChanged) ||
+        (!_endEffectorPositionVar.isEmpty() && positionVarChanged)) {
         // begin interp to smooth out transition between prev and new end effector.
         AnimChain poseChain;
         poseChain.buildFromRelativePoses(_skeleton, _poses, _tipJointIndex);
         beginInterp(InterpType::SnapshotToSolve, poseChain);
     }
+    if (rotationVarChanged) {
+        _endEffectorRotationVar = AnimVarKey(endEffectorRotationVar);
+    }
+    if (positionVarChanged) {
+        _endEffectorPositionVar = AnimVarKey(endEffectorPositionVar);
+    }
 
     // Look up end effector from animVars, make sure to convert into geom space.
     // First look in the triggers then look in the animVars, so we can follow output joints underneath us in the anim graph
     AnimPose targetPose(tipPose);
-    if (triggersOut.hasKey(endEffectorRotationVar)) {
-        targetPose.rot() = triggersOut.lookupRigToGeometry(endEffectorRotationVar, tipPose.rot());
-    } else if (animVars.hasKey(endEffectorRotationVar)) {
-        targetPose.rot() = animVars.lookupRigToGeometry(endEffectorRotationVar, tipPose.rot());
+    if (triggersOut.hasKey(_endEffectorRotationVar)) {
+        targetPose.rot() = triggersOut.lookupRigToGeometry(_endEffectorRotationVar, tipPose.rot());
+    } else if (animVars.hasKey(_endEffectorRotationVar)) {
+        targetPose.rot() = animVars.lookupRigToGeometry(_endEffectorRotationVar, tipPose.rot());
     }
 
-    if (triggersOut.hasKey(endEffectorPositionVar)) {
-        targetPose.trans() = triggersOut.lookupRigToGeometry(endEffectorPositionVar, tipPose.trans());
-    } else if (animVars.hasKey(endEffectorPositionVar)) {
-        targetPose.trans() = animVars.lookupRigToGeometry(endEffectorPositionVar, tipPose.trans());
+    if (triggersOut.hasKey(_endEffectorPositionVar)) {
+        targetPose.trans() = triggersOut.lookupRigToGeometry(_endEffectorPositionVar, tipPose.trans());
+    } else if (animVars.hasKey(_endEffectorPositionVar)) {
+        targetPose.trans() = animVars.lookupRigToGeometry(_endEffectorPositionVar, tipPose.trans());
     }
 
-    _prevEndEffectorRotationVar = endEffectorRotationVar;
-    _prevEndEffectorPositionVar = endEffectorPositionVar;
-
     glm::vec3 bicepVector = midPose.trans() - basePose.trans();
     float r0 = glm::length(bicepVector);
     bicepVector = bicepVector / r0;
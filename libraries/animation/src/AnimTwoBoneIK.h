@@ -59,13 +59,14 @@ protected:
     int _midJointIndex { -1 };
     int _tipJointIndex { -1 };
 
-    QString _alphaVar;  // float - (0, 1) 0 means underPoses only, 1 means IK only.
-    QString _enabledVar;  // bool
-    QString _endEffectorRotationVarVar; // string
-    QString _endEffectorPositionVarVar; // string
-
-    QString _prevEndEffectorRotationVar;
-    QString _prevEndEffectorPositionVar;
+    AnimVarKey _alphaVar;  // float - (0, 1) 0 means underPoses only, 1 means IK only.
+    AnimVarKey _enabledVar;  // bool
+    AnimVarKey _endEffectorRotationVarVar; // string
+    AnimVarKey _endEffectorPositionVarVar; // string
+
+    // keys of the names last read from the VarVars
+    AnimVarKey _endEffectorRotationVar;
+    AnimVarKey _endEffectorPositionVar;
 
     InterpType _interpType { InterpType::None };
     float _interpAlphaVel { 0.0f };
@@ -11,12 +11,77 @@
 
 #include "AnimVariant.h" // which has AnimVariant/AnimVariantMap
 
+#include <QHash>
+#include <QReadWriteLock>
 #include <QScriptEngine>
 #include <QScriptValueIterator>
 #include <QThread>
 #include <RegisteredMetaTypes.h>
 
 const AnimVariant AnimVariant::False = AnimVariant();
+const int AnimVarKey::INVALID_SLOT;
+
+// Names are only ever added, so a slot stays valid for the lifetime of the process.
+// Keys are interned when the anim graph and the Rig are set up, after that the table is almost only read.
+namespace {
+    struct AnimVarSlotTable {
+        QReadWriteLock lock;
+        QHash<QString, int> slots;
+        std::vector<QString> names;
+    };
+
+    AnimVarSlotTable& getSlotTable() {
+        static AnimVarSlotTable table;
+        return table;
+    }
+}
+
+int AnimVarKey::internSlot(const QString& name) {
+    if (name.isEmpty()) {
+        return INVALID_SLOT;
+    }
+    auto& table = getSlotTable();
+    {
+        QReadLocker locker(&table.lock);
+        auto it = table.slots.constFind(name);
+        if (it != table.slots.constEnd()) {
+            return it.value();
+        }
+    }
+    QWriteLocker locker(&table.lock);
+    auto it = table.slots.constFind(name);
+    if (it != table.slots.constEnd()) {
+        return it.value();
+    }
+    int slot = (int)table.names.size();
+    table.names.push_back(name);
+    table.slots.insert(name, slot);
+    return slot;
+}
+
+int AnimVarKey::findSlot(const QString& name) {
+    auto& table = getSlotTable();
+    QReadLocker locker(&table.lock);
+    return table.slots.value(name, INVALID_SLOT);
+}
+
+QString AnimVarKey::getSlotName(int slot) {
+    auto& table = getSlotTable();
+    QReadLocker locker(&table.lock);
+    return (slot >= 0 && slot < (int)table.names.size()) ? table.names[slot] : QString();
+}
+
+void AnimVariantMap::setVariant(int slot, const AnimVariant& value) {
+    if (slot < 0) {
+        return;
+    }
+    if (slot >= (int)_values.size()) {
+        _values.resize(slot + 1);
+        _isSet.resize(slot + 1, false);
+    }
+    _values[slot] = value;
+    _isSet[slot] = true;
+}
 
 QScriptValue AnimVariantMap::animVariantMapToScriptValue(QScriptEngine* engine, const QStringList& names, bool useNames) const {
     if (QThread::currentThread() != engine->thread()) {
@@ -52,25 +117,27 @@ QScriptValue AnimVariantMap::animVariantMapToScriptValue(QScriptEngine* engine,
     };
     if (useNames) { // copy only the requested names
         for (const QString& name : names) {
-            auto search = _map.find(name);
-            if (search != _map.end()) {
-                setOne(name, search->second);
-            } else if (_triggers.count(name) == 1) {
-                target.setProperty(name, true);
+            const AnimVariant* variant = find(AnimVarKey::findSlot(name));
+            if (variant) {
+                setOne(name, *variant);
             } // scripts are allowed to request names that do not exist
         }
 
     } else {  // copy all of them
-        for (auto& pair : _map) {
-            setOne(pair.first, pair.second);
+        for (int slot = 0; slot < (int)_values.size(); slot++) {
+            if (_isSet[slot]) {
+                setOne(AnimVarKey::getSlotName(slot), _values[slot]);
+            }
         }
     }
     return target;
 }
 
 void AnimVariantMap::copyVariantsFrom(const AnimVariantMap& other) {
-    for (auto& pair : other._map) {
-        _map[pair.first] = pair.second;
+    for (int slot = 0; slot < (int)other._values.size(); slot++) {
+        if (other._isSet[slot]) {
+            setVariant(slot, other._values[slot]);
+        }
     }
 }
 
@@ -128,21 +195,26 @@ void AnimVariantMap::animVariantMapFromScriptValue(const QScriptValue& source) {
 
 std::map<QString, QString> AnimVariantMap::toDebugMap() const {
     std::map<QString, QString> result;
-    for (auto& pair : _map) {
-        switch (pair.second.getType()) {
+    for (int slot = 0; slot < (int)_values.size(); slot++) {
+        if (!_isSet[slot]) {
+            continue;
+        }
+        const AnimVariant& variant = _values[slot];
+        const QString name = AnimVarKey::getSlotName(slot);
+        switch (variant.getType()) {
         case AnimVariant::Type::Bool:
-            result[pair.first] = QString("%1").arg(pair.second.getBool());
+            result[name] = QString("%1").arg(variant.getBool());
             break;
         case AnimVariant::Type::Int:
-            result[pair.first] = QString("%1").arg(pair.second.getInt());
+            result[name] = QString("%1").arg(variant.getInt());
             break;
         case AnimVariant::Type::Float:
-            result[pair.first] = QString::number(pair.second.getFloat(), 'f', 3);
+            result[name] = QString::number(variant.getFloat(), 'f', 3);
             break;
         case AnimVariant::Type::Vec3: {
             // To prevent filling up debug stats, don't show vec3 values
-            glm::vec3 value = pair.second.getVec3();
-            result[pair.first] = QString("(%1, %2, %3)").
+            glm::vec3 value = variant.getVec3();
+            result[name] = QString("(%1, %2, %3)").
                 arg(QString::number(value.x, 'f', 3)).
                 arg(QString::number(value.y, 'f', 3)).
                 arg(QString::number(value.z, 'f', 3));
@@ -150,8 +222,8 @@ std::map<QString, QString> AnimVariantMap::toDebugMap() const {
         }
         case AnimVariant::Type::Quat: {
             // To prevent filling up the anim stats, don't show quat values
-            glm::quat value = pair.second.getQuat();
-            result[pair.first] = QString("(%1, %2, %3, %4)").
+            glm::quat value = variant.getQuat();
+            result[name] = QString("(%1, %2, %3, %4)").
                 arg(QString::number(value.x, 'f', 3)).
                 arg(QString::number(value.y, 'f', 3)).
                 arg(QString::number(value.z, 'f', 3)).
@@ -160,7 +232,7 @@ std::map<QString, QString> AnimVariantMap::toDebugMap() const {
         }
         case AnimVariant::Type::String:
             // To prevent filling up anim stats, don't show string values
-            result[pair.first] = pair.second.getString();
+            result[name] = variant.getString();
             break;
         default:
             // invalid AnimVariant::Type
@@ -17,6 +17,7 @@
 #include <glm/gtx/quaternion.hpp>
 #include <map>
 #include <set>
+#include <vector>
 #include <QScriptValue>
 #include <StreamUtils.h>
 #include <GLMHelpers.h>
@@ -114,119 +115,137 @@ protected:
     } _val;
 };
 
+// The name of an animation variable, interned into a slot index.
+// Slots are shared by every AnimVariantMap in the process, so a key resolved once, when the anim graph is loaded,
+// indexes any map directly without hashing or comparing strings.
+class AnimVarKey {
+public:
+    static const int INVALID_SLOT = -1;
+
+    AnimVarKey() {}
+    AnimVarKey(const QString& name) : _name(name), _slot(internSlot(name)) {}
+
+    bool isValid() const { return _slot != INVALID_SLOT; }
+    bool isEmpty() const { return _name.isEmpty(); }
+    int getSlot() const { return _slot; }
+    const QString& getName() const { return _name; }
+
+    // Returns the slot of a name, adding it to the table if needed. Empty names get INVALID_SLOT.
+    static int internSlot(const QString& name);
+    // Returns INVALID_SLOT for names that were never interned
+    static int findSlot(const QString& name);
+    static QString getSlotName(int slot);
+
+    // A key for an existing name, without adding the name to the table. Used for string lookups,
+    // so that asking for names that were never set doesn't grow the table.
+    static AnimVarKey findKey(const QString& name) { return AnimVarKey(name, findSlot(name)); }
+
+private:
+    AnimVarKey(const QString& name, int slot) : _name(name), _slot(slot) {}
+
+    QString _name;
+    int _slot { INVALID_SLOT };
+};
+
 class AnimVariantMap {
 public:
 
-    bool lookup(const QString& key, bool defaultValue) const {
-        // check triggers first, then map
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else if (_triggers.find(key) != _triggers.end()) {
-            return true;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? iter->second.getBool() : defaultValue;
-        }
+    bool lookup(const AnimVarKey& key, bool defaultValue) const {
+        const AnimVariant* variant = find(key.getSlot());
+        return variant ? variant->getBool() : defaultValue;
     }
 
-    int lookup(const QString& key, int defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? iter->second.getInt() : defaultValue;
-        }
+    int lookup(const AnimVarKey& key, int defaultValue) const {
+        const AnimVariant* variant = find(key.getSlot());
+        return variant ? variant->getInt() : defaultValue;
     }
 
-    float lookup(const QString& key, float defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? iter->second.getFloat() : defaultValue;
-        }
+    float lookup(const AnimVarKey& key, float defaultValue) const {
+        const AnimVariant* variant = find(key.getSlot());
+        return variant ? variant->getFloat() : defaultValue;
     }
 
-    const glm::vec3& lookupRaw(const QString& key, const glm::vec3& defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? iter->second.getVec3() : defaultValue;
-        }
+    const glm::vec3& lookupRaw(const AnimVarKey& key, const glm::vec3& defaultValue) const {
+        const AnimVariant* variant = find(key.getSlot());
+        return variant ? variant->getVec3() : defaultValue;
     }
 
-    glm::vec3 lookupRigToGeometry(const QString& key, const glm::vec3& defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? transformPoint(_rigToGeometryMat, iter->second.getVec3()) : defaultValue;
-        }
+    glm::vec3 lookupRigToGeometry(const AnimVarKey& key, const glm::vec3& defaultValue) const {
+        const AnimVariant* variant = find(key.getSlot());
+        return variant ? transformPoint(_rigToGeometryMat, variant->getVec3()) : defaultValue;
     }
 
-    glm::vec3 lookupRigToGeometryVector(const QString& key, const glm::vec3& defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? transformVectorFast(_rigToGeometryMat, iter->second.getVec3()) : defaultValue;
-        }
+    glm::vec3 lookupRigToGeometryVector(const AnimVarKey& key, const glm::vec3& defaultValue) const {
+        const AnimVariant* variant = find(key.getSlot());
+        return variant ? transformVectorFast(_rigToGeometryMat, variant->getVec3()) : defaultValue;
     }
 
-    const glm::quat& lookupRaw(const QString& key, const glm::quat& defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? iter->second.getQuat() : defaultValue;
-        }
+    const glm::quat& lookupRaw(const AnimVarKey& key, const glm::quat& defaultValue) const {
+        const AnimVariant* variant = find(key.getSlot());
+        return variant ? variant->getQuat() : defaultValue;
     }
 
-    glm::quat lookupRigToGeometry(const QString& key, const glm::quat& defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? _rigToGeometryRot * iter->second.getQuat() : defaultValue;
-        }
+    glm::quat lookupRigToGeometry(const AnimVarKey& key, const glm::quat& defaultValue) const {
+        const AnimVariant* variant = find(key.getSlot());
+        return variant ? _rigToGeometryRot * variant->getQuat() : defaultValue;
     }
 
-    const QString& lookup(const QString& key, const QString& defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? iter->second.getString() : defaultValue;
-        }
+    const QString& lookup(const AnimVarKey& key, const QString& defaultValue) const {
+        const AnimVariant* variant = find(key.getSlot());
+        return variant ? variant->getString() : defaultValue;
+    }
+
+    // String keyed versions, for scripts and for names only known at runtime.
+    // These go through the name table, prefer holding an AnimVarKey for anything evaluated every frame.
+    bool lookup(const QString& key, bool defaultValue) const { return lookup(AnimVarKey::findKey(key), defaultValue); }
+    int lookup(const QString& key, int defaultValue) const { return lookup(AnimVarKey::findKey(key), defaultValue); }
+    float lookup(const QString& key, float defaultValue) const { return lookup(AnimVarKey::findKey(key), defaultValue); }
+    const glm::vec3& lookupRaw(const QString& key, const glm::vec3& defaultValue) const { return lookupRaw(AnimVarKey::findKey(key), defaultValue); }
+    glm::vec3 lookupRigToGeometry(const QString& key, const glm::vec3& defaultValue) const {
+        return lookupRigToGeometry(AnimVarKey::findKey(key), defaultValue);
+    }
+    glm::vec3 lookupRigToGeometryVector(const QString& key, const glm::vec3& defaultValue) const {
+        return lookupRigToGeometryVector(AnimVarKey::findKey(key), defaultValue);
+    }
+    const glm::quat& lookupRaw(const QString& key, const glm::quat& defaultValue) const { return lookupRaw(AnimVarKey::findKey(key), defaultValue); }
+    glm::quat lookupRigToGeometry(const QString& key, const glm::quat& defaultValue) const {
+        return lookupRigToGeometry(AnimVarKey::findKey(key), defaultValue);
     }
+    const QString& lookup(const QString& key, const QString& defaultValue) const { return lookup(AnimVarKey::findKey(key), defaultValue); }
 
-    void set(const QString& key, bool value) { _map[key] = AnimVariant(value); }
-    void set(const QString& key, int value) { _map[key] = AnimVariant(value); }
-    void set(const QString& key, float value) { _map[key] = AnimVariant(value); }
-    void set(const QString& key, const glm::vec3& value) { _map[key] = AnimVariant(value); }
-    void set(const QString& key, const glm::quat& value) { _map[key] = AnimVariant(value); }
-    void set(const QString& key, const QString& value) { _map[key] = AnimVariant(value); }
-    void unset(const QString& key) { _map.erase(key); }
+    void set(const AnimVarKey& key, bool value) { setVariant(key.getSlot(), AnimVariant(value)); }
+    void set(const AnimVarKey& key, int value) { setVariant(key.getSlot(), AnimVariant(value)); }
+    void set(const AnimVarKey& key, float value) { setVariant(key.getSlot(), AnimVariant(value)); }
+    void set(const AnimVarKey& key, const glm::vec3& value) { setVariant(key.getSlot(), AnimVariant(value)); }
+    void set(const AnimVarKey& key, const glm::quat& value) { setVariant(key.getSlot(), AnimVariant(value)); }
+    void set(const AnimVarKey& key, const QString& value) { setVariant(key.getSlot(), AnimVariant(value)); }
+    void unset(const AnimVarKey& key) { unsetVariant(key.getSlot()); }
 
-    void setTrigger(const QString& key) { _map[key] = AnimVariant(true); }
+    void set(const QString& key, bool value) { set(AnimVarKey(key), value); }
+    void set(const QString& key, int value) { set(AnimVarKey(key), value); }
+    void set(const QString& key, float value) { set(AnimVarKey(key), value); }
+    void set(const QString& key, const glm::vec3& value) { set(AnimVarKey(key), value); }
+    void set(const QString& key, const glm::quat& value) { set(AnimVarKey(key), value); }
+    void set(const QString& key, const QString& value) { set(AnimVarKey(key), value); }
+    void unset(const QString& key) { unsetVariant(AnimVarKey::findSlot(key)); }
+
+    void setTrigger(const AnimVarKey& key) { set(key, true); }
+    void setTrigger(const QString& key) { set(AnimVarKey(key), true); }
 
     void setRigToGeometryTransform(const glm::mat4& rigToGeometry) {
         _rigToGeometryMat = rigToGeometry;
         _rigToGeometryRot = glmExtractRotation(rigToGeometry);
     }
 
-    void clearMap() { _map.clear(); _triggers.clear(); }
-    bool hasKey(const QString& key) const { return _map.find(key) != _map.end(); }
+    void clearMap() { _values.clear(); _isSet.clear(); }
+    bool hasKey(const AnimVarKey& key) const { return find(key.getSlot()) != nullptr; }
+    bool hasKey(const QString& key) const { return find(AnimVarKey::findSlot(key)) != nullptr; }
 
-    const AnimVariant& get(const QString& key) const {
-        auto iter = _map.find(key);
-        if (iter != _map.end()) {
-            return iter->second;
-        } else {
-            return AnimVariant::False;
-        }
+    const AnimVariant& get(const AnimVarKey& key) const {
+        const AnimVariant* variant = find(key.getSlot());
+        return variant ? *variant : AnimVariant::False;
     }
+    const AnimVariant& get(const QString& key) const { return get(AnimVarKey::findKey(key)); }
 
     // Answer a Plain Old Javascript Object (for the given engine) all of our values set as properties.
     QScriptValue animVariantMapToScriptValue(QScriptEngine* engine, const QStringList& names, bool useNames) const;
@@ -240,25 +259,30 @@ public:
 #ifndef NDEBUG
     void dump() const {
         qCDebug(animation) << "AnimVariantMap =";
-        for (auto& pair : _map) {
-            switch (pair.second.getType()) {
+        for (int slot = 0; slot < (int)_values.size(); slot++) {
+            if (!_isSet[slot]) {
+                continue;
+            }
+            const AnimVariant& value = _values[slot];
+            QString name = AnimVarKey::getSlotName(slot);
+            switch (value.getType()) {
             case AnimVariant::Type::Bool:
-                qCDebug(animation) << "    " << pair.first << "=" << pair.second.getBool();
+                qCDebug(animation) << "    " << name << "=" << value.getBool();
                 break;
             case AnimVariant::Type::Int:
-                qCDebug(animation) << "    " << pair.first << "=" << pair.second.getInt();
+                qCDebug(animation) << "    " << name << "=" << value.getInt();
                 break;
             case AnimVariant::Type::Float:
-                qCDebug(animation) << "    " << pair.first << "=" << pair.second.getFloat();
+                qCDebug(animation) << "    " << name << "=" << value.getFloat();
                 break;
             case AnimVariant::Type::Vec3:
-                qCDebug(animation) << "    " << pair.first << "=" << pair.second.getVec3();
+                qCDebug(animation) << "    " << name << "=" << value.getVec3();
                 break;
             case AnimVariant::Type::Quat:
-                qCDebug(animation) << "    " << pair.first << "=" << pair.second.getQuat();
+                qCDebug(animation) << "    " << name << "=" << value.getQuat();
                 break;
             case AnimVariant::Type::String:
-                qCDebug(animation) << "    " << pair.first << "=" << pair.second.getString();
+                qCDebug(animation) << "    " << name << "=" << value.getString();
                 break;
             default:
                 assert(false);
@@ -268,8 +292,19 @@ public:
 #endif
 
 protected:
-    std::map<QString, AnimVariant> _map;
-    std::set<QString> _triggers;
+    const AnimVariant* find(int slot) const {
+        return (slot >= 0 && slot < (int)_isSet.size() && _isSet[slot]) ? &_values[slot] : nullptr;
+    }
+    void setVariant(int slot, const AnimVariant& value);
+    void unsetVariant(int slot) {
+        if (slot >= 0 && slot < (int)_isSet.size()) {
+            _isSet[slot] = false;
+        }
+    }
+
+    // indexed by AnimVarKey slot
+    std::vector<AnimVariant> _values;
+    std::vector<bool> _isSet;
     glm::mat4 _rigToGeometryMat;
     glm::quat _rigToGeometryRot;
 };
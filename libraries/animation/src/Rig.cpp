@@ -60,33 +60,127 @@ const glm::vec3 DEFAULT_RIGHT_EYE_POS(-0.3f, 0.9f, 0.0f);
 const glm::vec3 DEFAULT_LEFT_EYE_POS(0.3f, 0.9f, 0.0f);
 const glm::vec3 DEFAULT_HEAD_POS(0.0f, 0.75f, 0.0f);
 
-static const QString LEFT_FOOT_POSITION("leftFootPosition");
-static const QString LEFT_FOOT_ROTATION("leftFootRotation");
-static const QString LEFT_FOOT_IK_POSITION_VAR("leftFootIKPositionVar");
-static const QString LEFT_FOOT_IK_ROTATION_VAR("leftFootIKRotationVar");
-static const QString MAIN_STATE_MACHINE_LEFT_FOOT_POSITION("mainStateMachineLeftFootPosition");
-static const QString MAIN_STATE_MACHINE_LEFT_FOOT_ROTATION("mainStateMachineLeftFootRotation");
-
-static const QString RIGHT_FOOT_POSITION("rightFootPosition");
-static const QString RIGHT_FOOT_ROTATION("rightFootRotation");
-static const QString RIGHT_FOOT_IK_POSITION_VAR("rightFootIKPositionVar");
-static const QString RIGHT_FOOT_IK_ROTATION_VAR("rightFootIKRotationVar");
-static const QString MAIN_STATE_MACHINE_RIGHT_FOOT_ROTATION("mainStateMachineRightFootRotation");
-static const QString MAIN_STATE_MACHINE_RIGHT_FOOT_POSITION("mainStateMachineRightFootPosition");
-
-static const QString LEFT_HAND_POSITION("leftHandPosition");
-static const QString LEFT_HAND_ROTATION("leftHandRotation");
-static const QString LEFT_HAND_IK_POSITION_VAR("leftHandIKPositionVar");
-static const QString LEFT_HAND_IK_ROTATION_VAR("leftHandIKRotationVar");
-static const QString MAIN_STATE_MACHINE_LEFT_HAND_POSITION("mainStateMachineLeftHandPosition");
-static const QString MAIN_STATE_MACHINE_LEFT_HAND_ROTATION("mainStateMachineLeftHandRotation");
-
-static const QString RIGHT_HAND_POSITION("rightHandPosition");
-static const QString RIGHT_HAND_ROTATION("rightHandRotation");
-static const QString RIGHT_HAND_IK_POSITION_VAR("rightHandIKPositionVar");
-static const QString RIGHT_HAND_IK_ROTATION_VAR("rightHandIKRotationVar");
-static const QString MAIN_STATE_MACHINE_RIGHT_HAND_ROTATION("mainStateMachineRightHandRotation");
-static const QString MAIN_STATE_MACHINE_RIGHT_HAND_POSITION("mainStateMachineRightHandPosition");
+static const AnimVarKey LEFT_FOOT_POSITION("leftFootPosition");
+static const AnimVarKey LEFT_FOOT_ROTATION("leftFootRotation");
+static const AnimVarKey LEFT_FOOT_IK_POSITION_VAR("leftFootIKPositionVar");
+static const AnimVarKey LEFT_FOOT_IK_ROTATION_VAR("leftFootIKRotationVar");
+static const AnimVarKey MAIN_STATE_MACHINE_LEFT_FOOT_POSITION("mainStateMachineLeftFootPosition");
+static const AnimVarKey MAIN_STATE_MACHINE_LEFT_FOOT_ROTATION("mainStateMachineLeftFootRotation");
+
+static const AnimVarKey RIGHT_FOOT_POSITION("rightFootPosition");
+static const AnimVarKey RIGHT_FOOT_ROTATION("rightFootRotation");
+static const AnimVarKey RIGHT_FOOT_IK_POSITION_VAR("rightFootIKPositionVar");
+static const AnimVarKey RIGHT_FOOT_IK_ROTATION_VAR("rightFootIKRotationVar");
+static const AnimVarKey MAIN_STATE_MACHINE_RIGHT_FOOT_ROTATION("mainStateMachineRightFootRotation");
+static const AnimVarKey MAIN_STATE_MACHINE_RIGHT_FOOT_POSITION("mainStateMachineRightFootPosition");
+
+static const AnimVarKey LEFT_HAND_POSITION("leftHandPosition");
+static const AnimVarKey LEFT_HAND_ROTATION("leftHandRotation");
+static const AnimVarKey LEFT_HAND_IK_POSITION_VAR("leftHandIKPositionVar");
+static const AnimVarKey LEFT_HAND_IK_ROTATION_VAR("leftHandIKRotationVar");
+static const AnimVarKey MAIN_STATE_MACHINE_LEFT_HAND_POSITION("mainStateMachineLeftHandPosition");
+static const AnimVarKey MAIN_STATE_MACHINE_LEFT_HAND_ROTATION("mainStateMachineLeftHandRotation");
+
+static const AnimVarKey RIGHT_HAND_POSITION("rightHandPosition");
+static const AnimVarKey RIGHT_HAND_ROTATION("rightHandRotation");
+static const AnimVarKey RIGHT_HAND_IK_POSITION_VAR("rightHandIKPositionVar");
+static const AnimVarKey RIGHT_HAND_IK_ROTATION_VAR("rightHandIKRotationVar");
+static const AnimVarKey MAIN_STATE_MACHINE_RIGHT_HAND_ROTATION("mainStateMachineRightHandRotation");
+static const AnimVarKey MAIN_STATE_MACHINE_RIGHT_HAND_POSITION("mainStateMachineRightHandPosition");
+
+// animation variables set every frame, interned once so that setting them doesn't hash the names
+static const AnimVarKey DEFAULT_POSE_OVERLAY_ALPHA("defaultPoseOverlayAlpha");
+static const AnimVarKey DEFAULT_POSE_OVERLAY_BONE_SET("defaultPoseOverlayBoneSet");
+static const AnimVarKey HEAD_POSITION("headPosition");
+static const AnimVarKey HEAD_ROTATION("headRotation");
+static const AnimVarKey HEAD_TYPE("headType");
+static const AnimVarKey HEAD_WEIGHT("headWeight");
+static const AnimVarKey HIPS_POSITION("hipsPosition");
+static const AnimVarKey HIPS_ROTATION("hipsRotation");
+static const AnimVarKey HIPS_TYPE("hipsType");
+static const AnimVarKey IDLE_ANIM("idleAnim");
+static const AnimVarKey IDLE_OVERLAY_ALPHA("idleOverlayAlpha");
+static const AnimVarKey IK_OVERLAY_ALPHA("ikOverlayAlpha");
+static const AnimVarKey IN_AIR_ALPHA("inAirAlpha");
+static const AnimVarKey IS_FLYING("isFlying");
+static const AnimVarKey IS_IN_AIR_RUN("isInAirRun");
+static const AnimVarKey IS_IN_AIR_STAND("isInAirStand");
+static const AnimVarKey IS_INPUT_BACKWARD("isInputBackward");
+static const AnimVarKey IS_INPUT_FORWARD("isInputForward");
+static const AnimVarKey IS_INPUT_LEFT("isInputLeft");
+static const AnimVarKey IS_INPUT_RIGHT("isInputRight");
+static const AnimVarKey IS_MOVING_BACKWARD("isMovingBackward");
+static const AnimVarKey IS_MOVING_FORWARD("isMovingForward");
+static const AnimVarKey IS_MOVING_LEFT("isMovingLeft");
+static const AnimVarKey IS_MOVING_LEFT_HMD("isMovingLeftHmd");
+static const AnimVarKey IS_MOVING_RIGHT("isMovingRight");
+static const AnimVarKey IS_MOVING_RIGHT_HMD("isMovingRightHmd");
+static const AnimVarKey IS_NOT_FLYING("isNotFlying");
+static const AnimVarKey IS_NOT_IN_AIR("isNotInAir");
+static const AnimVarKey IS_NOT_INPUT("isNotInput");
+static const AnimVarKey IS_NOT_INPUT_NO_MOMENTUM("isNotInputNoMomentum");
+static const AnimVarKey IS_NOT_INPUT_SLOW("isNotInputSlow");
+static const AnimVarKey IS_NOT_MOVING("isNotMoving");
+static const AnimVarKey IS_NOT_SEATED("isNotSeated");
+static const AnimVarKey IS_NOT_TAKEOFF("isNotTakeoff");
+static const AnimVarKey IS_NOT_TURNING("isNotTurning");
+static const AnimVarKey IS_SEATED("isSeated");
+static const AnimVarKey IS_SEATED_NOT_TURNING("isSeatedNotTurning");
+static const AnimVarKey IS_SEATED_TURNING_LEFT("isSeatedTurningLeft");
+static const AnimVarKey IS_SEATED_TURNING_RIGHT("isSeatedTurningRight");
+static const AnimVarKey IS_TAKEOFF_RUN("isTakeoffRun");
+static const AnimVarKey IS_TAKEOFF_STAND("isTakeoffStand");
+static const AnimVarKey IS_TURNING_LEFT("isTurningLeft");
+static const AnimVarKey IS_TURNING_RIGHT("isTurningRight");
+static const AnimVarKey LEFT_FOOT_IK_ENABLED("leftFootIKEnabled");
+static const AnimVarKey LEFT_FOOT_POLE_VECTOR("leftFootPoleVector");
+static const AnimVarKey LEFT_FOOT_POLE_VECTOR_ENABLED("leftFootPoleVectorEnabled");
+static const AnimVarKey LEFT_HAND_ANIM_A("leftHandAnimA");
+static const AnimVarKey LEFT_HAND_ANIM_B("leftHandAnimB");
+static const AnimVarKey LEFT_HAND_ANIM_NONE("leftHandAnimNone");
+static const AnimVarKey LEFT_HAND_IK_ENABLED("leftHandIKEnabled");
+static const AnimVarKey LEFT_HAND_POLE_REFERENCE_VECTOR("leftHandPoleReferenceVector");
+static const AnimVarKey LEFT_HAND_POLE_VECTOR("leftHandPoleVector");
+static const AnimVarKey LEFT_HAND_POLE_VECTOR_ENABLED("leftHandPoleVectorEnabled");
+static const AnimVarKey LEFT_HAND_TYPE("leftHandType");
+static const AnimVarKey MOVE_BACKWARD_SPEED("moveBackwardSpeed");
+static const AnimVarKey MOVE_FORWARD_SPEED("moveForwardSpeed");
+static const AnimVarKey MOVE_LATERAL_SPEED("moveLateralSpeed");
+static const AnimVarKey POST_TRANSIT_ANIM("postTransitAnim");
+static const AnimVarKey PRE_TRANSIT_ANIM("preTransitAnim");
+static const AnimVarKey REACTION_APPLAUD_DISABLED("reactionApplaudDisabled");
+static const AnimVarKey REACTION_APPLAUD_ENABLED("reactionApplaudEnabled");
+static const AnimVarKey REACTION_NEGATIVE_TRIGGER("reactionNegativeTrigger");
+static const AnimVarKey REACTION_POINT_DISABLED("reactionPointDisabled");
+static const AnimVarKey REACTION_POINT_ENABLED("reactionPointEnabled");
+static const AnimVarKey REACTION_POSITIVE_TRIGGER("reactionPositiveTrigger");
+static const AnimVarKey REACTION_RAISE_HAND_DISABLED("reactionRaiseHandDisabled");
+static const AnimVarKey REACTION_RAISE_HAND_ENABLED("reactionRaiseHandEnabled");
+static const AnimVarKey RIGHT_FOOT_IK_ENABLED("rightFootIKEnabled");
+static const AnimVarKey RIGHT_FOOT_POLE_VECTOR("rightFootPoleVector");
+static const AnimVarKey RIGHT_FOOT_POLE_VECTOR_ENABLED("rightFootPoleVectorEnabled");
+static const AnimVarKey RIGHT_HAND_ANIM_A("rightHandAnimA");
+static const AnimVarKey RIGHT_HAND_ANIM_B("rightHandAnimB");
+static const AnimVarKey RIGHT_HAND_ANIM_NONE("rightHandAnimNone");
+static const AnimVarKey RIGHT_HAND_IK_ENABLED("rightHandIKEnabled");
+static const AnimVarKey RIGHT_HAND_POLE_REFERENCE_VECTOR("rightHandPoleReferenceVector");
+static const AnimVarKey RIGHT_HAND_POLE_VECTOR("rightHandPoleVector");
+static const AnimVarKey RIGHT_HAND_POLE_VECTOR_ENABLED("rightHandPoleVectorEnabled");
+static const AnimVarKey RIGHT_HAND_TYPE("rightHandType");
+static const AnimVarKey SINE("sine");
+static const AnimVarKey SOLUTION_SOURCE("solutionSource");
+static const AnimVarKey SPINE2_POSITION("spine2Position");
+static const AnimVarKey SPINE2_ROTATION("spine2Rotation");
+static const AnimVarKey SPINE2_TYPE("spine2Type");
+static const AnimVarKey SPLINE_IK_ENABLED("splineIKEnabled");
+static const AnimVarKey TALK_OVERLAY_ALPHA("talkOverlayAlpha");
+static const AnimVarKey TRANSIT_ANIM("transitAnim");
+static const AnimVarKey TRANSIT_ANIM_STATE_MACHINE("transitAnimStateMachine");
+static const AnimVarKey USER_ANIM_A("userAnimA");
+static const AnimVarKey USER_ANIM_B("userAnimB");
+static const AnimVarKey USER_ANIM_NONE("userAnimNone");
+static const AnimVarKey USER_NETWORK_ANIM_A("userNetworkAnimA");
+static const AnimVarKey USER_NETWORK_ANIM_B("userNetworkAnimB");
 
 
 /*@jsdoc
@@ -355,9 +449,9 @@ void Rig::overrideAnimation(const QString& url, float fps, bool loop, float firs
     _userAnimState = { clipNodeEnum, url, fps, loop, firstFrame, lastFrame };
 
     // notify the userAnimStateMachine the desired state.
-    _animVars.set("userAnimNone", false);
-    _animVars.set("userAnimA", clipNodeEnum == UserAnimState::A);
-    _animVars.set("userAnimB", clipNodeEnum == UserAnimState::B);
+    _animVars.set(USER_ANIM_NONE, false);
+    _animVars.set(USER_ANIM_A, clipNodeEnum == UserAnimState::A);
+    _animVars.set(USER_ANIM_B, clipNodeEnum == UserAnimState::B);
 }
 
 void Rig::restoreAnimation() {
@@ -365,9 +459,9 @@ void Rig::restoreAnimation() {
         _userAnimState.clipNodeEnum = UserAnimState::None;
 
         // notify the userAnimStateMachine the desired state.
-        _animVars.set("userAnimNone", true);
-        _animVars.set("userAnimA", false);
-        _animVars.set("userAnimB", false);
+        _animVars.set(USER_ANIM_NONE, true);
+        _animVars.set(USER_ANIM_A, false);
+        _animVars.set(USER_ANIM_B, false);
     }
 }
 
@@ -419,15 +513,15 @@ void Rig::overrideHandAnimation(bool isLeft, const QString& url, float fps, bool
     if (isLeft) {
         // store current hand anim state.
         _leftHandAnimState = { clipNodeEnum, url, fps, loop, firstFrame, lastFrame };
-        _animVars.set("leftHandAnimNone", false);
-        _animVars.set("leftHandAnimA", clipNodeEnum == HandAnimState::A);
-        _animVars.set("leftHandAnimB", clipNodeEnum == HandAnimState::B);
+        _animVars.set(LEFT_HAND_ANIM_NONE, false);
+        _animVars.set(LEFT_HAND_ANIM_A, clipNodeEnum == HandAnimState::A);
+        _animVars.set(LEFT_HAND_ANIM_B, clipNodeEnum == HandAnimState::B);
     } else {
         // store current hand anim state.
         _rightHandAnimState = { clipNodeEnum, url, fps, loop, firstFrame, lastFrame };
-        _animVars.set("rightHandAnimNone", false);
-        _animVars.set("rightHandAnimA", clipNodeEnum == HandAnimState::A);
-        _animVars.set("rightHandAnimB", clipNodeEnum == HandAnimState::B);
+        _animVars.set(RIGHT_HAND_ANIM_NONE, false);
+        _animVars.set(RIGHT_HAND_ANIM_A, clipNodeEnum == HandAnimState::A);
+        _animVars.set(RIGHT_HAND_ANIM_B, clipNodeEnum == HandAnimState::B);
     }
 }
 
@@ -437,18 +531,18 @@ void Rig::restoreHandAnimation(bool isLeft) {
             _leftHandAnimState.clipNodeEnum = HandAnimState::None;
 
             // notify the handAnimStateMachine the desired state.
-            _animVars.set("leftHandAnimNone", true);
-            _animVars.set("leftHandAnimA", false);
-            _animVars.set("leftHandAnimB", false);
+            _animVars.set(LEFT_HAND_ANIM_NONE, true);
+            _animVars.set(LEFT_HAND_ANIM_A, false);
+            _animVars.set(LEFT_HAND_ANIM_B, false);
         }
     } else {
         if (_rightHandAnimState.clipNodeEnum != HandAnimState::None) {
             _rightHandAnimState.clipNodeEnum = HandAnimState::None;
 
             // notify the handAnimStateMachine the desired state.
-            _animVars.set("rightHandAnimNone", true);
-            _animVars.set("rightHandAnimA", false);
-            _animVars.set("rightHandAnimB", false);
+            _animVars.set(RIGHT_HAND_ANIM_NONE, true);
+            _animVars.set(RIGHT_HAND_ANIM_A, false);
+            _animVars.set(RIGHT_HAND_ANIM_B, false);
         }
     }
 }
@@ -486,9 +580,9 @@ void Rig::overrideNetworkAnimation(const QString& url, float fps, bool loop, flo
     _networkAnimState = { clipNodeEnum, url, fps, loop, firstFrame, lastFrame };
 
     // notify the userAnimStateMachine the desired state.
-    _networkVars.set("transitAnimStateMachine", false);
-    _networkVars.set("userNetworkAnimA", clipNodeEnum == NetworkAnimState::A);
-    _networkVars.set("userNetworkAnimB", clipNodeEnum == NetworkAnimState::B);
+    _networkVars.set(TRANSIT_ANIM_STATE_MACHINE, false);
+    _networkVars.set(USER_NETWORK_ANIM_A, clipNodeEnum == NetworkAnimState::A);
+    _networkVars.set(USER_NETWORK_ANIM_B, clipNodeEnum == NetworkAnimState::B);
     if (!_computeNetworkAnimation) {
         _networkAnimState.blendTime = 0.0f;
         _computeNetworkAnimation = true;
@@ -496,29 +590,29 @@ void Rig::overrideNetworkAnimation(const QString& url, float fps, bool loop, flo
 }
 
 void Rig::triggerNetworkRole(const QString& role) {
-    _networkVars.set("transitAnimStateMachine", false);
-    _networkVars.set("idleAnim", false);
-    _networkVars.set("userNetworkAnimA", false);
-    _networkVars.set("userNetworkAnimB", false);
-    _networkVars.set("preTransitAnim", false);
-    _networkVars.set("preTransitAnim", false);
-    _networkVars.set("transitAnim", false);
-    _networkVars.set("postTransitAnim", false);
+    _networkVars.set(TRANSIT_ANIM_STATE_MACHINE, false);
+    _networkVars.set(IDLE_ANIM, false);
+    _networkVars.set(USER_NETWORK_ANIM_A, false);
+    _networkVars.set(USER_NETWORK_ANIM_B, false);
+    _networkVars.set(PRE_TRANSIT_ANIM, false);
+    _networkVars.set(PRE_TRANSIT_ANIM, false);
+    _networkVars.set(TRANSIT_ANIM, false);
+    _networkVars.set(POST_TRANSIT_ANIM, false);
     _computeNetworkAnimation = true;
     if (role == "idleAnim") {
-        _networkVars.set("idleAnim", true);
+        _networkVars.set(IDLE_ANIM, true);
         _networkAnimState.clipNodeEnum = NetworkAnimState::None;
         _computeNetworkAnimation = false;
         _networkAnimState.blendTime = 0.0f;
     } else if (role == "preTransitAnim") {
-        _networkVars.set("preTransitAnim", true);
+        _networkVars.set(PRE_TRANSIT_ANIM, true);
         _networkAnimState.clipNodeEnum = NetworkAnimState::PreTransit;
         _networkAnimState.blendTime = 0.0f;
     } else if (role == "transitAnim") {
-        _networkVars.set("transitAnim", true);
+        _networkVars.set(TRANSIT_ANIM, true);
         _networkAnimState.clipNodeEnum = NetworkAnimState::Transit;
     } else if (role == "postTransitAnim") {
-        _networkVars.set("postTransitAnim", true);
+        _networkVars.set(POST_TRANSIT_ANIM, true);
         _networkAnimState.clipNodeEnum = NetworkAnimState::PostTransit;
     }
     
@@ -531,9 +625,9 @@ void Rig::restoreNetworkAnimation() {
             _computeNetworkAnimation = false;
         }
         _networkAnimState.clipNodeEnum = NetworkAnimState::None;
-        _networkVars.set("transitAnimStateMachine", true);
-        _networkVars.set("userNetworkAnimA", false);
-        _networkVars.set("userNetworkAnimB", false);
+        _networkVars.set(TRANSIT_ANIM_STATE_MACHINE, true);
+        _networkVars.set(USER_NETWORK_ANIM_A, false);
+        _networkVars.set(USER_NETWORK_ANIM_B, false);
     }
 }
 
@@ -1083,10 +1177,10 @@ void Rig::computeMotionAnimationState(float deltaTime, const glm::vec3& worldPos
 
         // sine wave LFO var for testing.
         static float t = 0.0f;
-        _animVars.set("sine", 2.0f * 0.5f * sinf(t) + 0.5f);
-        _animVars.set("moveForwardSpeed", _averageForwardSpeed.getAverage());
-        _animVars.set("moveBackwardSpeed", -_averageForwardSpeed.getAverage());
-        _animVars.set("moveLateralSpeed", fabsf(_averageLateralSpeed.getAverage()));
+        _animVars.set(SINE, 2.0f * 0.5f * sinf(t) + 0.5f);
+        _animVars.set(MOVE_FORWARD_SPEED, _averageForwardSpeed.getAverage());
+        _animVars.set(MOVE_BACKWARD_SPEED, -_averageForwardSpeed.getAverage());
+        _animVars.set(MOVE_LATERAL_SPEED, fabsf(_averageLateralSpeed.getAverage()));
 
         const float MOVE_ENTER_SPEED_THRESHOLD = 0.2f; // m/sec
         const float MOVE_EXIT_SPEED_THRESHOLD = 0.07f;  // m/sec
@@ -1184,228 +1278,228 @@ void Rig::computeMotionAnimationState(float deltaTime, const glm::vec3& worldPos
                 if (fabsf(forwardSpeed) > 0.5f * fabsf(lateralSpeed)) {
                     if (forwardSpeed > 0.0f) {
                         // forward
-                        _animVars.set("isMovingForward", true);
-                        _animVars.set("isMovingBackward", false);
-                        _animVars.set("isMovingRight", false);
-                        _animVars.set("isMovingLeft", false);
-                        _animVars.set("isMovingRightHmd", false);
-                        _animVars.set("isMovingLeftHmd", false);
-                        _animVars.set("isNotMoving", false);
+                        _animVars.set(IS_MOVING_FORWARD, true);
+                        _animVars.set(IS_MOVING_BACKWARD, false);
+                        _animVars.set(IS_MOVING_RIGHT, false);
+                        _animVars.set(IS_MOVING_LEFT, false);
+                        _animVars.set(IS_MOVING_RIGHT_HMD, false);
+                        _animVars.set(IS_MOVING_LEFT_HMD, false);
+                        _animVars.set(IS_NOT_MOVING, false);
 
                     } else {
                         // backward
-                        _animVars.set("isMovingBackward", true);
-                        _animVars.set("isMovingForward", false);
-                        _animVars.set("isMovingRight", false);
-                        _animVars.set("isMovingLeft", false);
-                        _animVars.set("isMovingRightHmd", false);
-                        _animVars.set("isMovingLeftHmd", false);
-                        _animVars.set("isNotMoving", false);
+                        _animVars.set(IS_MOVING_BACKWARD, true);
+                        _animVars.set(IS_MOVING_FORWARD, false);
+                        _animVars.set(IS_MOVING_RIGHT, false);
+                        _animVars.set(IS_MOVING_LEFT, false);
+                        _animVars.set(IS_MOVING_RIGHT_HMD, false);
+                        _animVars.set(IS_MOVING_LEFT_HMD, false);
+                        _animVars.set(IS_NOT_MOVING, false);
                     }
                 } else {
                     if (lateralSpeed > 0.0f) {
                         // right
                         if (!_headEnabled) {
-                            _animVars.set("isMovingRight", true);
-                            _animVars.set("isMovingLeft", false);
-                            _animVars.set("isMovingRightHmd", false);
-                            _animVars.set("isMovingLeftHmd", false);
+                            _animVars.set(IS_MOVING_RIGHT, true);
+                            _animVars.set(IS_MOVING_LEFT, false);
+                            _animVars.set(IS_MOVING_RIGHT_HMD, false);
+                            _animVars.set(IS_MOVING_LEFT_HMD, false);
                         } else {
-                            _animVars.set("isMovingRight", false);
-                            _animVars.set("isMovingLeft", false);
-                            _animVars.set("isMovingRightHmd", true);
-                            _animVars.set("isMovingLeftHmd", false);
+                            _animVars.set(IS_MOVING_RIGHT, false);
+                            _animVars.set(IS_MOVING_LEFT, false);
+                            _animVars.set(IS_MOVING_RIGHT_HMD, true);
+                            _animVars.set(IS_MOVING_LEFT_HMD, false);
                         }
-                        _animVars.set("isMovingForward", false);
-                        _animVars.set("isMovingBackward", false);
-                        _animVars.set("isNotMoving", false);
+                        _animVars.set(IS_MOVING_FORWARD, false);
+                        _animVars.set(IS_MOVING_BACKWARD, false);
+                        _animVars.set(IS_NOT_MOVING, false);
                     } else {
                         // left
                         if (!_headEnabled) {
-                            _animVars.set("isMovingRight", false);
-                            _animVars.set("isMovingLeft", true);
-                            _animVars.set("isMovingRightHmd", false);
-                            _animVars.set("isMovingLeftHmd", false);
+                            _animVars.set(IS_MOVING_RIGHT, false);
+                            _animVars.set(IS_MOVING_LEFT, true);
+                            _animVars.set(IS_MOVING_RIGHT_HMD, false);
+                            _animVars.set(IS_MOVING_LEFT_HMD, false);
                         } else {
-                            _animVars.set("isMovingRight", false);
-                            _animVars.set("isMovingLeft", false);
-                            _animVars.set("isMovingRightHmd", false);
-                            _animVars.set("isMovingLeftHmd", true);
+                            _animVars.set(IS_MOVING_RIGHT, false);
+                            _animVars.set(IS_MOVING_LEFT, false);
+                            _animVars.set(IS_MOVING_RIGHT_HMD, false);
+                            _animVars.set(IS_MOVING_LEFT_HMD, true);
                         }
-                        _animVars.set("isMovingForward", false);
-                        _animVars.set("isMovingBackward", false);
-                        _animVars.set("isNotMoving", false);
+                        _animVars.set(IS_MOVING_FORWARD, false);
+                        _animVars.set(IS_MOVING_BACKWARD, false);
+                        _animVars.set(IS_NOT_MOVING, false);
                     }
                 }
             }
-            _animVars.set("isTurningRight", false);
-            _animVars.set("isTurningLeft", false);
-            _animVars.set("isNotTurning", true);
-            _animVars.set("isFlying", false);
-            _animVars.set("isNotFlying", true);
-            _animVars.set("isTakeoffStand", false);
-            _animVars.set("isTakeoffRun", false);
-            _animVars.set("isNotTakeoff", true);
-            _animVars.set("isInAirStand", false);
-            _animVars.set("isInAirRun", false);
-            _animVars.set("isNotInAir", true);
-            _animVars.set("isSeated", false);
-            _animVars.set("isNotSeated", true);
-            _animVars.set("isSeatedTurningRight", false);
-            _animVars.set("isSeatedTurningLeft", false);
-            _animVars.set("isSeatedNotTurning", false);
+            _animVars.set(IS_TURNING_RIGHT, false);
+            _animVars.set(IS_TURNING_LEFT, false);
+            _animVars.set(IS_NOT_TURNING, true);
+            _animVars.set(IS_FLYING, false);
+            _animVars.set(IS_NOT_FLYING, true);
+            _animVars.set(IS_TAKEOFF_STAND, false);
+            _animVars.set(IS_TAKEOFF_RUN, false);
+            _animVars.set(IS_NOT_TAKEOFF, true);
+            _animVars.set(IS_IN_AIR_STAND, false);
+            _animVars.set(IS_IN_AIR_RUN, false);
+            _animVars.set(IS_NOT_IN_AIR, true);
+            _animVars.set(IS_SEATED, false);
+            _animVars.set(IS_NOT_SEATED, true);
+            _animVars.set(IS_SEATED_TURNING_RIGHT, false);
+            _animVars.set(IS_SEATED_TURNING_LEFT, false);
+            _animVars.set(IS_SEATED_NOT_TURNING, false);
 
         } else if (_state == RigRole::Turn) {
             if (turningSpeed > 0.0f) {
                 // turning right
-                _animVars.set("isTurningRight", true);
-                _animVars.set("isTurningLeft", false);
-                _animVars.set("isNotTurning", false);
+                _animVars.set(IS_TURNING_RIGHT, true);
+                _animVars.set(IS_TURNING_LEFT, false);
+                _animVars.set(IS_NOT_TURNING, false);
             } else {
                 // turning left
-                _animVars.set("isTurningRight", false);
-                _animVars.set("isTurningLeft", true);
-                _animVars.set("isNotTurning", false);
+                _animVars.set(IS_TURNING_RIGHT, false);
+                _animVars.set(IS_TURNING_LEFT, true);
+                _animVars.set(IS_NOT_TURNING, false);
             }
-            _animVars.set("isMovingForward", false);
-            _animVars.set("isMovingBackward", false);
-            _animVars.set("isMovingRight", false);
-            _animVars.set("isMovingLeft", false);
-            _animVars.set("isMovingRightHmd", false);
-            _animVars.set("isMovingLeftHmd", false);
-            _animVars.set("isNotMoving", true);
-            _animVars.set("isFlying", false);
-            _animVars.set("isNotFlying", true);
-            _animVars.set("isTakeoffStand", false);
-            _animVars.set("isTakeoffRun", false);
-            _animVars.set("isNotTakeoff", true);
-            _animVars.set("isInAirStand", false);
-            _animVars.set("isInAirRun", false);
-            _animVars.set("isNotInAir", true);
-            _animVars.set("isSeated", false);
-            _animVars.set("isNotSeated", true);
-            _animVars.set("isSeatedTurningRight", false);
-            _animVars.set("isSeatedTurningLeft", false);
-            _animVars.set("isSeatedNotTurning", false);
+            _animVars.set(IS_MOVING_FORWARD, false);
+            _animVars.set(IS_MOVING_BACKWARD, false);
+            _animVars.set(IS_MOVING_RIGHT, false);
+            _animVars.set(IS_MOVING_LEFT, false);
+            _animVars.set(IS_MOVING_RIGHT_HMD, false);
+            _animVars.set(IS_MOVING_LEFT_HMD, false);
+            _animVars.set(IS_NOT_MOVING, true);
+            _animVars.set(IS_FLYING, false);
+            _animVars.set(IS_NOT_FLYING, true);
+            _animVars.set(IS_TAKEOFF_STAND, false);
+            _animVars.set(IS_TAKEOFF_RUN, false);
+            _animVars.set(IS_NOT_TAKEOFF, true);
+            _animVars.set(IS_IN_AIR_STAND, false);
+            _animVars.set(IS_IN_AIR_RUN, false);
+            _animVars.set(IS_NOT_IN_AIR, true);
+            _animVars.set(IS_SEATED, false);
+            _animVars.set(IS_NOT_SEATED, true);
+            _animVars.set(IS_SEATED_TURNING_RIGHT, false);
+            _animVars.set(IS_SEATED_TURNING_LEFT, false);
+            _animVars.set(IS_SEATED_NOT_TURNING, false);
 
         } else if (_state == RigRole::Idle) {
             // default anim vars to notMoving and notTurning
-            _animVars.set("isMovingForward", false);
-            _animVars.set("isMovingBackward", false);
-            _animVars.set("isMovingRight", false);
-            _animVars.set("isMovingLeft", false);
-            _animVars.set("isMovingRightHmd", false);
-            _animVars.set("isMovingLeftHmd", false);
-            _animVars.set("isNotMoving", true);
-            _animVars.set("isTurningRight", false);
-            _animVars.set("isTurningLeft", false);
-            _animVars.set("isNotTurning", true);
-            _animVars.set("isFlying", false);
-            _animVars.set("isNotFlying", true);
-            _animVars.set("isTakeoffStand", false);
-            _animVars.set("isTakeoffRun", false);
-            _animVars.set("isNotTakeoff", true);
-            _animVars.set("isInAirStand", false);
-            _animVars.set("isInAirRun", false);
-            _animVars.set("isNotInAir", true);
-            _animVars.set("isSeated", false);
-            _animVars.set("isNotSeated", true);
-            _animVars.set("isSeatedTurningRight", false);
-            _animVars.set("isSeatedTurningLeft", false);
-            _animVars.set("isSeatedNotTurning", false);
+            _animVars.set(IS_MOVING_FORWARD, false);
+            _animVars.set(IS_MOVING_BACKWARD, false);
+            _animVars.set(IS_MOVING_RIGHT, false);
+            _animVars.set(IS_MOVING_LEFT, false);
+            _animVars.set(IS_MOVING_RIGHT_HMD, false);
+            _animVars.set(IS_MOVING_LEFT_HMD, false);
+            _animVars.set(IS_NOT_MOVING, true);
+            _animVars.set(IS_TURNING_RIGHT, false);
+            _animVars.set(IS_TURNING_LEFT, false);
+            _animVars.set(IS_NOT_TURNING, true);
+            _animVars.set(IS_FLYING, false);
+            _animVars.set(IS_NOT_FLYING, true);
+            _animVars.set(IS_TAKEOFF_STAND, false);
+            _animVars.set(IS_TAKEOFF_RUN, false);
+            _animVars.set(IS_NOT_TAKEOFF, true);
+            _animVars.set(IS_IN_AIR_STAND, false);
+            _animVars.set(IS_IN_AIR_RUN, false);
+            _animVars.set(IS_NOT_IN_AIR, true);
+            _animVars.set(IS_SEATED, false);
+            _animVars.set(IS_NOT_SEATED, true);
+            _animVars.set(IS_SEATED_TURNING_RIGHT, false);
+            _animVars.set(IS_SEATED_TURNING_LEFT, false);
+            _animVars.set(IS_SEATED_NOT_TURNING, false);
 
         } else if (_state == RigRole::Hover) {
             // flying.
-            _animVars.set("isMovingForward", false);
-            _animVars.set("isMovingBackward", false);
-            _animVars.set("isMovingRight", false);
-            _animVars.set("isMovingLeft", false);
-            _animVars.set("isMovingRightHmd", false);
-            _animVars.set("isMovingLeftHmd", false);
-            _animVars.set("isNotMoving", true);
-            _animVars.set("isTurningRight", false);
-            _animVars.set("isTurningLeft", false);
-            _animVars.set("isNotTurning", true);
-            _animVars.set("isFlying", true);
-            _animVars.set("isNotFlying", false);
-            _animVars.set("isTakeoffStand", false);
-            _animVars.set("isTakeoffRun", false);
-            _animVars.set("isNotTakeoff", true);
-            _animVars.set("isInAirStand", false);
-            _animVars.set("isInAirRun", false);
-            _animVars.set("isNotInAir", true);
-            _animVars.set("isSeated", false);
-            _animVars.set("isNotSeated", true);
-            _animVars.set("isSeatedTurningRight", false);
-            _animVars.set("isSeatedTurningLeft", false);
-            _animVars.set("isSeatedNotTurning", false);
+            _animVars.set(IS_MOVING_FORWARD, false);
+            _animVars.set(IS_MOVING_BACKWARD, false);
+            _animVars.set(IS_MOVING_RIGHT, false);
+            _animVars.set(IS_MOVING_LEFT, false);
+            _animVars.set(IS_MOVING_RIGHT_HMD, false);
+            _animVars.set(IS_MOVING_LEFT_HMD, false);
+            _animVars.set(IS_NOT_MOVING, true);
+            _animVars.set(IS_TURNING_RIGHT, false);
+            _animVars.set(IS_TURNING_LEFT, false);
+            _animVars.set(IS_NOT_TURNING, true);
+            _animVars.set(IS_FLYING, true);
+            _animVars.set(IS_NOT_FLYING, false);
+            _animVars.set(IS_TAKEOFF_STAND, false);
+            _animVars.set(IS_TAKEOFF_RUN, false);
+            _animVars.set(IS_NOT_TAKEOFF, true);
+            _animVars.set(IS_IN_AIR_STAND, false);
+            _animVars.set(IS_IN_AIR_RUN, false);
+            _animVars.set(IS_NOT_IN_AIR, true);
+            _animVars.set(IS_SEATED, false);
+            _animVars.set(IS_NOT_SEATED, true);
+            _animVars.set(IS_SEATED_TURNING_RIGHT, false);
+            _animVars.set(IS_SEATED_TURNING_LEFT, false);
+            _animVars.set(IS_SEATED_NOT_TURNING, false);
 
         } else if (_state == RigRole::Takeoff) {
             // jumping in-air
-            _animVars.set("isMovingForward", false);
-            _animVars.set("isMovingBackward", false);
-            _animVars.set("isMovingRight", false);
-            _animVars.set("isMovingLeft", false);
-            _animVars.set("isMovingRightHmd", false);
-            _animVars.set("isMovingLeftHmd", false);
-            _animVars.set("isNotMoving", true);
-            _animVars.set("isTurningRight", false);
-            _animVars.set("isTurningLeft", false);
-            _animVars.set("isNotTurning", true);
-            _animVars.set("isFlying", false);
-            _animVars.set("isNotFlying", true);
+            _animVars.set(IS_MOVING_FORWARD, false);
+            _animVars.set(IS_MOVING_BACKWARD, false);
+            _animVars.set(IS_MOVING_RIGHT, false);
+            _animVars.set(IS_MOVING_LEFT, false);
+            _animVars.set(IS_MOVING_RIGHT_HMD, false);
+            _animVars.set(IS_MOVING_LEFT_HMD, false);
+            _animVars.set(IS_NOT_MOVING, true);
+            _animVars.set(IS_TURNING_RIGHT, false);
+            _animVars.set(IS_TURNING_LEFT, false);
+            _animVars.set(IS_NOT_TURNING, true);
+            _animVars.set(IS_FLYING, false);
+            _animVars.set(IS_NOT_FLYING, true);
 
             bool takeOffRun = forwardSpeed > 0.1f;
             if (takeOffRun) {
-                _animVars.set("isTakeoffStand", false);
-                _animVars.set("isTakeoffRun", true);
+                _animVars.set(IS_TAKEOFF_STAND, false);
+                _animVars.set(IS_TAKEOFF_RUN, true);
             } else {
-                _animVars.set("isTakeoffStand", true);
-                _animVars.set("isTakeoffRun", false);
+                _animVars.set(IS_TAKEOFF_STAND, true);
+                _animVars.set(IS_TAKEOFF_RUN, false);
             }
 
-            _animVars.set("isNotTakeoff", false);
-            _animVars.set("isInAirStand", false);
-            _animVars.set("isInAirRun", false);
-            _animVars.set("isNotInAir", false);
-            _animVars.set("isSeated", false);
-            _animVars.set("isNotSeated", true);
-            _animVars.set("isSeatedTurningRight", false);
-            _animVars.set("isSeatedTurningLeft", false);
-            _animVars.set("isSeatedNotTurning", false);
+            _animVars.set(IS_NOT_TAKEOFF, false);
+            _animVars.set(IS_IN_AIR_STAND, false);
+            _animVars.set(IS_IN_AIR_RUN, false);
+            _animVars.set(IS_NOT_IN_AIR, false);
+            _animVars.set(IS_SEATED, false);
+            _animVars.set(IS_NOT_SEATED, true);
+            _animVars.set(IS_SEATED_TURNING_RIGHT, false);
+            _animVars.set(IS_SEATED_TURNING_LEFT, false);
+            _animVars.set(IS_SEATED_NOT_TURNING, false);
 
         } else if (_state == RigRole::InAir) {
             // jumping in-air
-            _animVars.set("isMovingForward", false);
-            _animVars.set("isMovingBackward", false);
-            _animVars.set("isMovingRight", false);
-            _animVars.set("isMovingLeft", false);
-            _animVars.set("isMovingRightHmd", false);
-            _animVars.set("isMovingLeftHmd", false);
-            _animVars.set("isNotMoving", true);
-            _animVars.set("isTurningRight", false);
-            _animVars.set("isTurningLeft", false);
-            _animVars.set("isNotTurning", true);
-            _animVars.set("isFlying", false);
-            _animVars.set("isNotFlying", true);
-            _animVars.set("isTakeoffStand", false);
-            _animVars.set("isTakeoffRun", false);
-            _animVars.set("isNotTakeoff", true);
-            _animVars.set("isSeated", false);
-            _animVars.set("isNotSeated", true);
-            _animVars.set("isSeatedTurningRight", false);
-            _animVars.set("isSeatedTurningLeft", false);
-            _animVars.set("isSeatedNotTurning", false);
+            _animVars.set(IS_MOVING_FORWARD, false);
+            _animVars.set(IS_MOVING_BACKWARD, false);
+            _animVars.set(IS_MOVING_RIGHT, false);
+            _animVars.set(IS_MOVING_LEFT, false);
+            _animVars.set(IS_MOVING_RIGHT_HMD, false);
+            _animVars.set(IS_MOVING_LEFT_HMD, false);
+            _animVars.set(IS_NOT_MOVING, true);
+            _animVars.set(IS_TURNING_RIGHT, false);
+            _animVars.set(IS_TURNING_LEFT, false);
+            _animVars.set(IS_NOT_TURNING, true);
+            _animVars.set(IS_FLYING, false);
+            _animVars.set(IS_NOT_FLYING, true);
+            _animVars.set(IS_TAKEOFF_STAND, false);
+            _animVars.set(IS_TAKEOFF_RUN, false);
+            _animVars.set(IS_NOT_TAKEOFF, true);
+            _animVars.set(IS_SEATED, false);
+            _animVars.set(IS_NOT_SEATED, true);
+            _animVars.set(IS_SEATED_TURNING_RIGHT, false);
+            _animVars.set(IS_SEATED_TURNING_LEFT, false);
+            _animVars.set(IS_SEATED_NOT_TURNING, false);
 
             bool inAirRun = forwardSpeed > 0.1f;
             if (inAirRun) {
-                _animVars.set("isInAirStand", false);
-                _animVars.set("isInAirRun", true);
+                _animVars.set(IS_IN_AIR_STAND, false);
+                _animVars.set(IS_IN_AIR_RUN, true);
             } else {
-                _animVars.set("isInAirStand", true);
-                _animVars.set("isInAirRun", false);
+                _animVars.set(IS_IN_AIR_STAND, true);
+                _animVars.set(IS_IN_AIR_RUN, false);
             }
-            _animVars.set("isNotInAir", false);
+            _animVars.set(IS_NOT_IN_AIR, false);
 
             // We want to preserve the apparent jump height in sensor space.
             const float jumpHeight = std::max(sensorToWorldScale * DEFAULT_AVATAR_JUMP_HEIGHT, DEFAULT_AVATAR_MIN_JUMP_HEIGHT);
@@ -1416,62 +1510,62 @@ void Rig::computeMotionAnimationState(float deltaTime, const glm::vec3& worldPos
             // compute inAirAlpha blend based on velocity
             float alpha = glm::clamp((-workingVelocity.y * sensorToWorldScale) / jumpSpeed, -1.0f, 1.0f) + 1.0f;
 
-            _animVars.set("inAirAlpha", alpha);
+            _animVars.set(IN_AIR_ALPHA, alpha);
         } else if (_state == RigRole::Seated) {
             if (fabsf(_previousControllerParameters.inputX) <= INPUT_DEADZONE_THRESHOLD) {
                 // seated not turning
-                _animVars.set("isSeatedTurningRight", false);
-                _animVars.set("isSeatedTurningLeft", false);
-                _animVars.set("isSeatedNotTurning", true);
+                _animVars.set(IS_SEATED_TURNING_RIGHT, false);
+                _animVars.set(IS_SEATED_TURNING_LEFT, false);
+                _animVars.set(IS_SEATED_NOT_TURNING, true);
             } else if (_previousControllerParameters.inputX > 0.0f) {
                 // seated turning right
-                _animVars.set("isSeatedTurningRight", true);
-                _animVars.set("isSeatedTurningLeft", false);
-                _animVars.set("isSeatedNotTurning", false);
+                _animVars.set(IS_SEATED_TURNING_RIGHT, true);
+                _animVars.set(IS_SEATED_TURNING_LEFT, false);
+                _animVars.set(IS_SEATED_NOT_TURNING, false);
             } else {
                 // seated turning left
-                _animVars.set("isSeatedTurningRight", false);
-                _animVars.set("isSeatedTurningLeft", true);
-                _animVars.set("isSeatedNotTurning", false);
+                _animVars.set(IS_SEATED_TURNING_RIGHT, false);
+                _animVars.set(IS_SEATED_TURNING_LEFT, true);
+                _animVars.set(IS_SEATED_NOT_TURNING, false);
             }
 
-            _animVars.set("isMovingForward", false);
-            _animVars.set("isMovingBackward", false);
-            _animVars.set("isMovingRight", false);
-            _animVars.set("isMovingLeft", false);
-            _animVars.set("isMovingRightHmd", false);
-            _animVars.set("isMovingLeftHmd", false);
-            _animVars.set("isNotMoving", false);
-            _animVars.set("isTurningRight", false);
-            _animVars.set("isTurningLeft", false);
-            _animVars.set("isNotTurning", true);
-            _animVars.set("isFlying", false);
-            _animVars.set("isNotFlying", true);
-            _animVars.set("isTakeoffStand", false);
-            _animVars.set("isTakeoffRun", false);
-            _animVars.set("isNotTakeoff", true);
-            _animVars.set("isInAirStand", false);
-            _animVars.set("isInAirRun", false);
-            _animVars.set("isNotInAir", true);
-            _animVars.set("isSeated", true);
-            _animVars.set("isNotSeated", false);
+            _animVars.set(IS_MOVING_FORWARD, false);
+            _animVars.set(IS_MOVING_BACKWARD, false);
+            _animVars.set(IS_MOVING_RIGHT, false);
+            _animVars.set(IS_MOVING_LEFT, false);
+            _animVars.set(IS_MOVING_RIGHT_HMD, false);
+            _animVars.set(IS_MOVING_LEFT_HMD, false);
+            _animVars.set(IS_NOT_MOVING, false);
+            _animVars.set(IS_TURNING_RIGHT, false);
+            _animVars.set(IS_TURNING_LEFT, false);
+            _animVars.set(IS_NOT_TURNING, true);
+            _animVars.set(IS_FLYING, false);
+            _animVars.set(IS_NOT_FLYING, true);
+            _animVars.set(IS_TAKEOFF_STAND, false);
+            _animVars.set(IS_TAKEOFF_RUN, false);
+            _animVars.set(IS_NOT_TAKEOFF, true);
+            _animVars.set(IS_IN_AIR_STAND, false);
+            _animVars.set(IS_IN_AIR_RUN, false);
+            _animVars.set(IS_NOT_IN_AIR, true);
+            _animVars.set(IS_SEATED, true);
+            _animVars.set(IS_NOT_SEATED, false);
         }
 
         t += deltaTime;
 
         if (_enableInverseKinematics) {
-            _animVars.set("ikOverlayAlpha", 1.0f);
+            _animVars.set(IK_OVERLAY_ALPHA, 1.0f);
         } else {
-            _animVars.set("ikOverlayAlpha", 0.0f);
-            _animVars.set("splineIKEnabled", false);
-            _animVars.set("leftHandIKEnabled", false);
-            _animVars.set("rightHandIKEnabled", false);
-            _animVars.set("leftFootIKEnabled", false);
-            _animVars.set("rightFootIKEnabled", false);
-            _animVars.set("leftHandPoleVectorEnabled", false);
-            _animVars.set("rightHandPoleVectorEnabled", false);
-            _animVars.set("leftFootPoleVectorEnabled", false);
-            _animVars.set("rightFootPoleVectorEnabled", false);
+            _animVars.set(IK_OVERLAY_ALPHA, 0.0f);
+            _animVars.set(SPLINE_IK_ENABLED, false);
+            _animVars.set(LEFT_HAND_IK_ENABLED, false);
+            _animVars.set(RIGHT_HAND_IK_ENABLED, false);
+            _animVars.set(LEFT_FOOT_IK_ENABLED, false);
+            _animVars.set(RIGHT_FOOT_IK_ENABLED, false);
+            _animVars.set(LEFT_HAND_POLE_VECTOR_ENABLED, false);
+            _animVars.set(RIGHT_HAND_POLE_VECTOR_ENABLED, false);
+            _animVars.set(LEFT_FOOT_POLE_VECTOR_ENABLED, false);
+            _animVars.set(RIGHT_FOOT_POLE_VECTOR_ENABLED, false);
         }
         _lastEnableInverseKinematics = _enableInverseKinematics;
 
@@ -1490,31 +1584,31 @@ void Rig::computeMotionAnimationState(float deltaTime, const glm::vec3& worldPos
                 }
 
 
-                _animVars.set("isInputForward", false);
-                _animVars.set("isInputBackward", false);
-                _animVars.set("isInputRight", false);
-                _animVars.set("isInputLeft", false);
+                _animVars.set(IS_INPUT_FORWARD, false);
+                _animVars.set(IS_INPUT_BACKWARD, false);
+                _animVars.set(IS_INPUT_RIGHT, false);
+                _animVars.set(IS_INPUT_LEFT, false);
 
                 // directly reflects input
-                _animVars.set("isNotInput", true);  
+                _animVars.set(IS_NOT_INPUT, true);  
 
                 // no input + speed drops to SLOW_SPEED_THRESHOLD
                 // (don't transition run->idle - slow to walk first)
-                _animVars.set("isNotInputSlow", _isMovingWithMomentum);
+                _animVars.set(IS_NOT_INPUT_SLOW, _isMovingWithMomentum);
 
                 // no input + speed didn't get above HAS_MOMENTUM_THRESHOLD since last idle
                 // (brief inputs and movement adjustments)
-                _animVars.set("isNotInputNoMomentum", !_isMovingWithMomentum);
+                _animVars.set(IS_NOT_INPUT_NO_MOMENTUM, !_isMovingWithMomentum);
 
 
             } else {
-                _animVars.set("isInputForward", false);
-                _animVars.set("isInputBackward", false);
-                _animVars.set("isInputRight", false);
-                _animVars.set("isInputLeft", false);
-                _animVars.set("isNotInput", true);
-                _animVars.set("isNotInputSlow", false);
-                _animVars.set("isNotInputNoMomentum", false);
+                _animVars.set(IS_INPUT_FORWARD, false);
+                _animVars.set(IS_INPUT_BACKWARD, false);
+                _animVars.set(IS_INPUT_RIGHT, false);
+                _animVars.set(IS_INPUT_LEFT, false);
+                _animVars.set(IS_NOT_INPUT, true);
+                _animVars.set(IS_NOT_INPUT_SLOW, false);
+                _animVars.set(IS_NOT_INPUT_NO_MOMENTUM, false);
             }
         } else if (fabsf(_previousControllerParameters.inputZ) >= fabsf(_previousControllerParameters.inputX)) {
             if (fabsf(forwardSpeed) > HAS_MOMENTUM_THRESHOLD) {
@@ -1523,22 +1617,22 @@ void Rig::computeMotionAnimationState(float deltaTime, const glm::vec3& worldPos
 
             if (_previousControllerParameters.inputZ > 0.0f) {
                 // forward
-                _animVars.set("isInputForward", true);
-                _animVars.set("isInputBackward", false);
-                _animVars.set("isInputRight", false);
-                _animVars.set("isInputLeft", false);
-                _animVars.set("isNotInput", false);
-                _animVars.set("isNotInputSlow", false);
-                _animVars.set("isNotInputNoMomentum", false);
+                _animVars.set(IS_INPUT_FORWARD, true);
+                _animVars.set(IS_INPUT_BACKWARD, false);
+                _animVars.set(IS_INPUT_RIGHT, false);
+                _animVars.set(IS_INPUT_LEFT, false);
+                _animVars.set(IS_NOT_INPUT, false);
+                _animVars.set(IS_NOT_INPUT_SLOW, false);
+                _animVars.set(IS_NOT_INPUT_NO_MOMENTUM, false);
             } else {
                 // backward
-                _animVars.set("isInputForward", false);
-                _animVars.set("isInputBackward", true);
-                _animVars.set("isInputRight", false);
-                _animVars.set("isInputLeft", false);
-                _animVars.set("isNotInput", false);
-                _animVars.set("isNotInputSlow", false);
-                _animVars.set("isNotInputNoMomentum", false);
+                _animVars.set(IS_INPUT_FORWARD, false);
+                _animVars.set(IS_INPUT_BACKWARD, true);
+                _animVars.set(IS_INPUT_RIGHT, false);
+                _animVars.set(IS_INPUT_LEFT, false);
+                _animVars.set(IS_NOT_INPUT, false);
+                _animVars.set(IS_NOT_INPUT_SLOW, false);
+                _animVars.set(IS_NOT_INPUT_NO_MOMENTUM, false);
             }
         } else {
             if (fabsf(lateralSpeed) > HAS_MOMENTUM_THRESHOLD) {
@@ -1548,31 +1642,31 @@ void Rig::computeMotionAnimationState(float deltaTime, const glm::vec3& worldPos
             if (_previousControllerParameters.inputX > 0.0f) {
                 // right
                 if (!_headEnabled) {
-                    _animVars.set("isInputRight", true);
+                    _animVars.set(IS_INPUT_RIGHT, true);
                 } else {
-                    _animVars.set("isInputRight", false);
+                    _animVars.set(IS_INPUT_RIGHT, false);
                 }
 
-                _animVars.set("isInputLeft", false);
-                _animVars.set("isInputForward", false);
-                _animVars.set("isInputBackward", false);
-                _animVars.set("isNotInput", false);
-                _animVars.set("isNotInputSlow", false);
-                _animVars.set("isNotInputNoMomentum", false);
+                _animVars.set(IS_INPUT_LEFT, false);
+                _animVars.set(IS_INPUT_FORWARD, false);
+                _animVars.set(IS_INPUT_BACKWARD, false);
+                _animVars.set(IS_NOT_INPUT, false);
+                _animVars.set(IS_NOT_INPUT_SLOW, false);
+                _animVars.set(IS_NOT_INPUT_NO_MOMENTUM, false);
             } else {
                 // left
                 if (!_headEnabled) {
-                    _animVars.set("isInputLeft", true);
+                    _animVars.set(IS_INPUT_LEFT, true);
                 } else {
-                    _animVars.set("isInputLeft", false);
+                    _animVars.set(IS_INPUT_LEFT, false);
                 }
 
-                _animVars.set("isInputForward", false);
-                _animVars.set("isInputBackward", false);
-                _animVars.set("isInputRight", false);
-                _animVars.set("isNotInput", false);
-                _animVars.set("isNotInputSlow", false);
-                _animVars.set("isNotInputNoMomentum", false);
+                _animVars.set(IS_INPUT_FORWARD, false);
+                _animVars.set(IS_INPUT_BACKWARD, false);
+                _animVars.set(IS_INPUT_RIGHT, false);
+                _animVars.set(IS_NOT_INPUT, false);
+                _animVars.set(IS_NOT_INPUT_SLOW, false);
+                _animVars.set(IS_NOT_INPUT_NO_MOMENTUM, false);
             }
         }
 
@@ -1785,25 +1879,25 @@ void Rig::computeHeadFromHMD(const AnimPose& hmdPose, glm::vec3& headPositionOut
 void Rig::updateHead(bool headEnabled, bool hipsEnabled, const AnimPose& headPose) {
     if (_animSkeleton) {
         if (headEnabled) {
-            _animVars.set("splineIKEnabled", true);
-            _animVars.set("headPosition", headPose.trans());
-            _animVars.set("headRotation", headPose.rot());
+            _animVars.set(SPLINE_IK_ENABLED, true);
+            _animVars.set(HEAD_POSITION, headPose.trans());
+            _animVars.set(HEAD_ROTATION, headPose.rot());
             if (hipsEnabled) {
                 // Since there is an explicit hips ik target, switch the head to use the more flexible Spline IK chain type.
                 // this will allow the spine to compress/expand and bend more natrually, ensuring that it can reach the head target position.
-                _animVars.set("headType", (int)IKTarget::Type::Spline);
-                _animVars.unset("headWeight");  // use the default weight for this target.
+                _animVars.set(HEAD_TYPE, (int)IKTarget::Type::Spline);
+                _animVars.unset(HEAD_WEIGHT);  // use the default weight for this target.
             } else {
                 // When there is no hips IK target, use the HmdHead IK chain type.  This will make the spine very stiff,
                 // but because the IK _hipsOffset is enabled, the hips will naturally follow underneath the head.
-                _animVars.set("headType", (int)IKTarget::Type::HmdHead);
-                _animVars.set("headWeight", 8.0f);
+                _animVars.set(HEAD_TYPE, (int)IKTarget::Type::HmdHead);
+                _animVars.set(HEAD_WEIGHT, 8.0f);
             }
         } else {
-            _animVars.set("splineIKEnabled", false);
-            _animVars.unset("headPosition");
-            _animVars.set("headRotation", headPose.rot());
-            _animVars.set("headType", (int)IKTarget::Type::Unknown);
+            _animVars.set(SPLINE_IK_ENABLED, false);
+            _animVars.unset(HEAD_POSITION);
+            _animVars.set(HEAD_ROTATION, headPose.rot());
+            _animVars.set(HEAD_TYPE, (int)IKTarget::Type::Unknown);
         }
     }
 }
@@ -1876,19 +1970,19 @@ void Rig::updateHands(bool leftHandEnabled, bool rightHandEnabled, bool hipsEnab
 
     if (headEnabled) {
         // always do IK if head is enabled
-        _animVars.set("leftHandIKEnabled", true);
-        _animVars.set("rightHandIKEnabled", true);
+        _animVars.set(LEFT_HAND_IK_ENABLED, true);
+        _animVars.set(RIGHT_HAND_IK_ENABLED, true);
     } else {
         // only do IK if we have a valid foot.
-        _animVars.set("leftHandIKEnabled", leftHandEnabled);
-        _animVars.set("rightHandIKEnabled", rightHandEnabled);
+        _animVars.set(LEFT_HAND_IK_ENABLED, leftHandEnabled);
+        _animVars.set(RIGHT_HAND_IK_ENABLED, rightHandEnabled);
     }
 
     if (leftHandEnabled) {
 
         // we need this for twoBoneIK version of hands.
-        _animVars.set(LEFT_HAND_IK_POSITION_VAR, LEFT_HAND_POSITION);
-        _animVars.set(LEFT_HAND_IK_ROTATION_VAR, LEFT_HAND_ROTATION);
+        _animVars.set(LEFT_HAND_IK_POSITION_VAR, LEFT_HAND_POSITION.getName());
+        _animVars.set(LEFT_HAND_IK_ROTATION_VAR, LEFT_HAND_ROTATION.getName());
 
         glm::vec3 handPosition = leftHandPose.trans();
         glm::quat handRotation = leftHandPose.rot();
@@ -1898,9 +1992,9 @@ void Rig::updateHands(bool leftHandEnabled, bool rightHandEnabled, bool hipsEnab
             handPosition = deflectHandFromTorso(handPosition, hipsShapeInfo, spineShapeInfo, spine1ShapeInfo, spine2ShapeInfo);
         }
 
-        _animVars.set("leftHandPosition", handPosition);
-        _animVars.set("leftHandRotation", handRotation);
-        _animVars.set("leftHandType", (int)IKTarget::Type::RotationAndPosition);
+        _animVars.set(LEFT_HAND_POSITION, handPosition);
+        _animVars.set(LEFT_HAND_ROTATION, handRotation);
+        _animVars.set(LEFT_HAND_TYPE, (int)IKTarget::Type::RotationAndPosition);
 
         // compute pole vector
         int handJointIndex = _animSkeleton->nameToJointIndex("LeftHand");
@@ -1912,37 +2006,37 @@ void Rig::updateHands(bool leftHandEnabled, bool rightHandEnabled, bool hipsEnab
             bool usePoleVector = calculateElbowPoleVector(handJointIndex, elbowJointIndex, armJointIndex, oppositeArmJointIndex, poleVector);
             if (usePoleVector) {
                 glm::vec3 sensorPoleVector = transformVectorFast(rigToSensorMatrix, poleVector);
-                _animVars.set("leftHandPoleVectorEnabled", true);
-                _animVars.set("leftHandPoleReferenceVector", Vectors::UNIT_X);
-                _animVars.set("leftHandPoleVector", transformVectorFast(sensorToRigMatrix, sensorPoleVector));
+                _animVars.set(LEFT_HAND_POLE_VECTOR_ENABLED, true);
+                _animVars.set(LEFT_HAND_POLE_REFERENCE_VECTOR, Vectors::UNIT_X);
+                _animVars.set(LEFT_HAND_POLE_VECTOR, transformVectorFast(sensorToRigMatrix, sensorPoleVector));
             } else {
-                _animVars.set("leftHandPoleVectorEnabled", false);
+                _animVars.set(LEFT_HAND_POLE_VECTOR_ENABLED, false);
             }
         } else {
-            _animVars.set("leftHandPoleVectorEnabled", false);
+            _animVars.set(LEFT_HAND_POLE_VECTOR_ENABLED, false);
         }
     } else {
         // need this for two bone ik
-        _animVars.set(LEFT_HAND_IK_POSITION_VAR, MAIN_STATE_MACHINE_LEFT_HAND_POSITION);
-        _animVars.set(LEFT_HAND_IK_ROTATION_VAR, MAIN_STATE_MACHINE_LEFT_HAND_ROTATION);
+        _animVars.set(LEFT_HAND_IK_POSITION_VAR, MAIN_STATE_MACHINE_LEFT_HAND_POSITION.getName());
+        _animVars.set(LEFT_HAND_IK_ROTATION_VAR, MAIN_STATE_MACHINE_LEFT_HAND_ROTATION.getName());
 
-        _animVars.set("leftHandPoleVectorEnabled", false);
-        _animVars.unset("leftHandPosition");
-        _animVars.unset("leftHandRotation");
+        _animVars.set(LEFT_HAND_POLE_VECTOR_ENABLED, false);
+        _animVars.unset(LEFT_HAND_POSITION);
+        _animVars.unset(LEFT_HAND_ROTATION);
 
         if (headEnabled) {
-            _animVars.set("leftHandType", (int)IKTarget::Type::HipsRelativeRotationAndPosition);
+            _animVars.set(LEFT_HAND_TYPE, (int)IKTarget::Type::HipsRelativeRotationAndPosition);
         } else {
             // disable hand IK for desktop mode
-            _animVars.set("leftHandType", (int)IKTarget::Type::Unknown);
+            _animVars.set(LEFT_HAND_TYPE, (int)IKTarget::Type::Unknown);
         }
     }
 
     if (rightHandEnabled) {
 
         // need this for two bone IK
-        _animVars.set(RIGHT_HAND_IK_POSITION_VAR, RIGHT_HAND_POSITION);
-        _animVars.set(RIGHT_HAND_IK_ROTATION_VAR, RIGHT_HAND_ROTATION);
+        _animVars.set(RIGHT_HAND_IK_POSITION_VAR, RIGHT_HAND_POSITION.getName());
+        _animVars.set(RIGHT_HAND_IK_ROTATION_VAR, RIGHT_HAND_ROTATION.getName());
 
         glm::vec3 handPosition = rightHandPose.trans();
         glm::quat handRotation = rightHandPose.rot();
@@ -1952,9 +2046,9 @@ void Rig::updateHands(bool leftHandEnabled, bool rightHandEnabled, bool hipsEnab
             handPosition = deflectHandFromTorso(handPosition, hipsShapeInfo, spineShapeInfo, spine1ShapeInfo, spine2ShapeInfo);
         }
 
-        _animVars.set("rightHandPosition", handPosition);
-        _animVars.set("rightHandRotation", handRotation);
-        _animVars.set("rightHandType", (int)IKTarget::Type::RotationAndPosition);
+        _animVars.set(RIGHT_HAND_POSITION, handPosition);
+        _animVars.set(RIGHT_HAND_ROTATION, handRotation);
+        _animVars.set(RIGHT_HAND_TYPE, (int)IKTarget::Type::RotationAndPosition);
 
         // compute pole vector
         int handJointIndex = _animSkeleton->nameToJointIndex("RightHand");
@@ -1967,30 +2061,30 @@ void Rig::updateHands(bool leftHandEnabled, bool rightHandEnabled, bool hipsEnab
             bool usePoleVector = calculateElbowPoleVector(handJointIndex, elbowJointIndex, armJointIndex, oppositeArmJointIndex, poleVector);
             if (usePoleVector) {
                 glm::vec3 sensorPoleVector = transformVectorFast(rigToSensorMatrix, poleVector);
-                _animVars.set("rightHandPoleVectorEnabled", true);
-                _animVars.set("rightHandPoleReferenceVector", -Vectors::UNIT_X);
-                _animVars.set("rightHandPoleVector", transformVectorFast(sensorToRigMatrix, sensorPoleVector));
+                _animVars.set(RIGHT_HAND_POLE_VECTOR_ENABLED, true);
+                _animVars.set(RIGHT_HAND_POLE_REFERENCE_VECTOR, -Vectors::UNIT_X);
+                _animVars.set(RIGHT_HAND_POLE_VECTOR, transformVectorFast(sensorToRigMatrix, sensorPoleVector));
             } else {
-                _animVars.set("rightHandPoleVectorEnabled", false);
+                _animVars.set(RIGHT_HAND_POLE_VECTOR_ENABLED, false);
             }
         } else {
-            _animVars.set("rightHandPoleVectorEnabled", false);
+            _animVars.set(RIGHT_HAND_POLE_VECTOR_ENABLED, false);
         }
     } else {
 
         // need this for two bone IK
-        _animVars.set(RIGHT_HAND_IK_POSITION_VAR, MAIN_STATE_MACHINE_RIGHT_HAND_POSITION);
-        _animVars.set(RIGHT_HAND_IK_ROTATION_VAR, MAIN_STATE_MACHINE_RIGHT_HAND_ROTATION);
+        _animVars.set(RIGHT_HAND_IK_POSITION_VAR, MAIN_STATE_MACHINE_RIGHT_HAND_POSITION.getName());
+        _animVars.set(RIGHT_HAND_IK_ROTATION_VAR, MAIN_STATE_MACHINE_RIGHT_HAND_ROTATION.getName());
 
-        _animVars.set("rightHandPoleVectorEnabled", false);
-        _animVars.unset("rightHandPosition");
-        _animVars.unset("rightHandRotation");
+        _animVars.set(RIGHT_HAND_POLE_VECTOR_ENABLED, false);
+        _animVars.unset(RIGHT_HAND_POSITION);
+        _animVars.unset(RIGHT_HAND_ROTATION);
 
         if (headEnabled) {
-            _animVars.set("rightHandType", (int)IKTarget::Type::HipsRelativeRotationAndPosition);
+            _animVars.set(RIGHT_HAND_TYPE, (int)IKTarget::Type::HipsRelativeRotationAndPosition);
         } else {
             // disable hand IK for desktop mode
-            _animVars.set("rightHandType", (int)IKTarget::Type::Unknown);
+            _animVars.set(RIGHT_HAND_TYPE, (int)IKTarget::Type::Unknown);
         }
     }
 }
@@ -2006,12 +2100,12 @@ void Rig::updateFeet(bool leftFootEnabled, bool rightFootEnabled, bool headEnabl
 
     if (headEnabled && !isSeated) {
         // enable leg IK if head is enabled and we arent sitting down.
-        _animVars.set("leftFootIKEnabled", true);
-        _animVars.set("rightFootIKEnabled", true);
+        _animVars.set(LEFT_FOOT_IK_ENABLED, true);
+        _animVars.set(RIGHT_FOOT_IK_ENABLED, true);
     } else {
         // only do IK if we have a valid foot.
-        _animVars.set("leftFootIKEnabled", leftFootEnabled);
-        _animVars.set("rightFootIKEnabled", rightFootEnabled);
+        _animVars.set(LEFT_FOOT_IK_ENABLED, leftFootEnabled);
+        _animVars.set(RIGHT_FOOT_IK_ENABLED, rightFootEnabled);
     }
 
     if (leftFootEnabled) {
@@ -2020,8 +2114,8 @@ void Rig::updateFeet(bool leftFootEnabled, bool rightFootEnabled, bool headEnabl
         _animVars.set(LEFT_FOOT_ROTATION, leftFootPose.rot());
 
         // We want to drive the IK directly from the trackers.
-        _animVars.set(LEFT_FOOT_IK_POSITION_VAR, LEFT_FOOT_POSITION);
-        _animVars.set(LEFT_FOOT_IK_ROTATION_VAR, LEFT_FOOT_ROTATION);
+        _animVars.set(LEFT_FOOT_IK_POSITION_VAR, LEFT_FOOT_POSITION.getName());
+        _animVars.set(LEFT_FOOT_IK_ROTATION_VAR, LEFT_FOOT_ROTATION.getName());
 
         int footJointIndex = _animSkeleton->nameToJointIndex("LeftFoot");
         int kneeJointIndex = _animSkeleton->nameToJointIndex("LeftLeg");
@@ -2038,16 +2132,16 @@ void Rig::updateFeet(bool leftFootEnabled, bool rightFootEnabled, bool headEnabl
         glm::quat smoothDeltaRot = safeMix(deltaRot, Quaternions::IDENTITY, KNEE_POLE_VECTOR_BLEND_FACTOR);
         _prevLeftFootPoleVector = smoothDeltaRot * _prevLeftFootPoleVector;
 
-        _animVars.set("leftFootPoleVectorEnabled", true);
-        _animVars.set("leftFootPoleVector", transformVectorFast(sensorToRigMatrix, _prevLeftFootPoleVector));
+        _animVars.set(LEFT_FOOT_POLE_VECTOR_ENABLED, true);
+        _animVars.set(LEFT_FOOT_POLE_VECTOR, transformVectorFast(sensorToRigMatrix, _prevLeftFootPoleVector));
     } else {
         // We want to drive the IK from the underlying animation.
         // This gives us the ability to squat while in the HMD, without the feet from dipping under the floor.
-        _animVars.set(LEFT_FOOT_IK_POSITION_VAR, MAIN_STATE_MACHINE_LEFT_FOOT_POSITION);
-        _animVars.set(LEFT_FOOT_IK_ROTATION_VAR, MAIN_STATE_MACHINE_LEFT_FOOT_ROTATION);
+        _animVars.set(LEFT_FOOT_IK_POSITION_VAR, MAIN_STATE_MACHINE_LEFT_FOOT_POSITION.getName());
+        _animVars.set(LEFT_FOOT_IK_ROTATION_VAR, MAIN_STATE_MACHINE_LEFT_FOOT_ROTATION.getName());
 
         // We want to match the animated knee pose as close as possible, so don't use poleVectors
-        _animVars.set("leftFootPoleVectorEnabled", false);
+        _animVars.set(LEFT_FOOT_POLE_VECTOR_ENABLED, false);
         _prevLeftFootPoleVectorValid = false;
     }
 
@@ -2056,8 +2150,8 @@ void Rig::updateFeet(bool leftFootEnabled, bool rightFootEnabled, bool headEnabl
         _animVars.set(RIGHT_FOOT_ROTATION, rightFootPose.rot());
 
         // We want to drive the IK directly from the trackers.
-        _animVars.set(RIGHT_FOOT_IK_POSITION_VAR, RIGHT_FOOT_POSITION);
-        _animVars.set(RIGHT_FOOT_IK_ROTATION_VAR, RIGHT_FOOT_ROTATION);
+        _animVars.set(RIGHT_FOOT_IK_POSITION_VAR, RIGHT_FOOT_POSITION.getName());
+        _animVars.set(RIGHT_FOOT_IK_ROTATION_VAR, RIGHT_FOOT_ROTATION.getName());
 
         int footJointIndex = _animSkeleton->nameToJointIndex("RightFoot");
         int kneeJointIndex = _animSkeleton->nameToJointIndex("RightLeg");
@@ -2074,16 +2168,16 @@ void Rig::updateFeet(bool leftFootEnabled, bool rightFootEnabled, bool headEnabl
         glm::quat smoothDeltaRot = safeMix(deltaRot, Quaternions::IDENTITY, KNEE_POLE_VECTOR_BLEND_FACTOR);
         _prevRightFootPoleVector = smoothDeltaRot * _prevRightFootPoleVector;
 
-        _animVars.set("rightFootPoleVectorEnabled", true);
-        _animVars.set("rightFootPoleVector", transformVectorFast(sensorToRigMatrix, _prevRightFootPoleVector));
+        _animVars.set(RIGHT_FOOT_POLE_VECTOR_ENABLED, true);
+        _animVars.set(RIGHT_FOOT_POLE_VECTOR, transformVectorFast(sensorToRigMatrix, _prevRightFootPoleVector));
     } else {
         // We want to drive the IK from the underlying animation.
         // This gives us the ability to squat while in the HMD, without the feet from dipping under the floor.
-        _animVars.set(RIGHT_FOOT_IK_POSITION_VAR, MAIN_STATE_MACHINE_RIGHT_FOOT_POSITION);
-        _animVars.set(RIGHT_FOOT_IK_ROTATION_VAR, MAIN_STATE_MACHINE_RIGHT_FOOT_ROTATION);
+        _animVars.set(RIGHT_FOOT_IK_POSITION_VAR, MAIN_STATE_MACHINE_RIGHT_FOOT_POSITION.getName());
+        _animVars.set(RIGHT_FOOT_IK_ROTATION_VAR, MAIN_STATE_MACHINE_RIGHT_FOOT_ROTATION.getName());
 
         // We want to match the animated knee pose as close as possible, so don't use poleVectors
-        _animVars.set("rightFootPoleVectorEnabled", false);
+        _animVars.set(RIGHT_FOOT_POLE_VECTOR_ENABLED, false);
         _prevRightFootPoleVectorValid = false;
     }
 }
@@ -2092,29 +2186,29 @@ void Rig::updateReactions(const ControllerParameters& params) {
 
     // trigger reactions
     if (params.reactionTriggers[AVATAR_REACTION_POSITIVE]) {
-        _animVars.set("reactionPositiveTrigger", true);
+        _animVars.set(REACTION_POSITIVE_TRIGGER, true);
     } else {
-        _animVars.set("reactionPositiveTrigger", false);
+        _animVars.set(REACTION_POSITIVE_TRIGGER, false);
     }
 
     if (params.reactionTriggers[AVATAR_REACTION_NEGATIVE]) {
-        _animVars.set("reactionNegativeTrigger", true);
+        _animVars.set(REACTION_NEGATIVE_TRIGGER, true);
     } else {
-        _animVars.set("reactionNegativeTrigger", false);
+        _animVars.set(REACTION_NEGATIVE_TRIGGER, false);
     }
 
     // begin end reactions
     bool enabled = params.reactionEnabledFlags[AVATAR_REACTION_RAISE_HAND];
-    _animVars.set("reactionRaiseHandEnabled", enabled);
-    _animVars.set("reactionRaiseHandDisabled", !enabled);
+    _animVars.set(REACTION_RAISE_HAND_ENABLED, enabled);
+    _animVars.set(REACTION_RAISE_HAND_DISABLED, !enabled);
 
     enabled = params.reactionEnabledFlags[AVATAR_REACTION_APPLAUD];
-    _animVars.set("reactionApplaudEnabled", enabled);
-    _animVars.set("reactionApplaudDisabled", !enabled);
+    _animVars.set(REACTION_APPLAUD_ENABLED, enabled);
+    _animVars.set(REACTION_APPLAUD_DISABLED, !enabled);
 
     enabled = params.reactionEnabledFlags[AVATAR_REACTION_POINT];
-    _animVars.set("reactionPointEnabled", enabled);
-    _animVars.set("reactionPointDisabled", !enabled);
+    _animVars.set(REACTION_POINT_ENABLED, enabled);
+    _animVars.set(REACTION_POINT_DISABLED, !enabled);
 
     // determine if we should ramp off IK
     if (_enableInverseKinematics) {
@@ -2132,7 +2226,7 @@ void Rig::updateReactions(const ControllerParameters& params) {
         if ((reactionPlaying || isSeated) && !hmdMode) {
             // TODO: make this smooth.
             // disable head IK while reaction is playing, but only in "desktop" mode.
-            _animVars.set("headType", (int)IKTarget::Type::Unknown);
+            _animVars.set(HEAD_TYPE, (int)IKTarget::Type::Unknown);
         }
     }
 }
@@ -2293,11 +2387,11 @@ void Rig::updateFromControllerParameters(const ControllerParameters& params, flo
                 _talkIdleInterpTime = 1.0f;
             }
             float easeOutInValue = _talkIdleInterpTime < 0.5f ? 4.0f * powf(_talkIdleInterpTime, 3.0f) : 4.0f * powf((_talkIdleInterpTime - 1.0f), 3.0f) + 1.0f;
-            _animVars.set("talkOverlayAlpha", easeOutInValue);
-            _animVars.set("idleOverlayAlpha", easeOutInValue);  // backward compatibility for older anim graphs.
+            _animVars.set(TALK_OVERLAY_ALPHA, easeOutInValue);
+            _animVars.set(IDLE_OVERLAY_ALPHA, easeOutInValue);  // backward compatibility for older anim graphs.
         } else {
-            _animVars.set("talkOverlayAlpha", 1.0f);
-            _animVars.set("idleOverlayAlpha", 1.0f);  // backward compatibility for older anim graphs.
+            _animVars.set(TALK_OVERLAY_ALPHA, 1.0f);
+            _animVars.set(IDLE_OVERLAY_ALPHA, 1.0f);  // backward compatibility for older anim graphs.
         }
     } else {
         if (_talkIdleInterpTime < 1.0f) {
@@ -2307,11 +2401,11 @@ void Rig::updateFromControllerParameters(const ControllerParameters& params, flo
             }
             float easeOutInValue = _talkIdleInterpTime < 0.5f ? 4.0f * powf(_talkIdleInterpTime, 3.0f) : 4.0f * powf((_talkIdleInterpTime - 1.0f), 3.0f) + 1.0f;
             float talkAlpha = 1.0f - easeOutInValue;
-            _animVars.set("talkOverlayAlpha", talkAlpha);
-            _animVars.set("idleOverlayAlpha", talkAlpha);  // backward compatibility for older anim graphs.
+            _animVars.set(TALK_OVERLAY_ALPHA, talkAlpha);
+            _animVars.set(IDLE_OVERLAY_ALPHA, talkAlpha);  // backward compatibility for older anim graphs.
         } else {
-            _animVars.set("talkOverlayAlpha", 0.0f);
-            _animVars.set("idleOverlayAlpha", 0.0f);  // backward compatibility for older anim graphs.
+            _animVars.set(TALK_OVERLAY_ALPHA, 0.0f);
+            _animVars.set(IDLE_OVERLAY_ALPHA, 0.0f);  // backward compatibility for older anim graphs.
         }
     }
 
@@ -2343,21 +2437,21 @@ void Rig::updateFromControllerParameters(const ControllerParameters& params, flo
 
     if (_headEnabled) {
         // Blend IK chains toward the joint limit centers, this should stablize head and hand ik.
-        _animVars.set("solutionSource", (int)AnimInverseKinematics::SolutionSource::RelaxToLimitCenterPoses);
+        _animVars.set(SOLUTION_SOURCE, (int)AnimInverseKinematics::SolutionSource::RelaxToLimitCenterPoses);
     } else {
         // Blend IK chains toward the UnderPoses, so some of the animaton motion is present in the IK solution.
-        _animVars.set("solutionSource", (int)AnimInverseKinematics::SolutionSource::RelaxToUnderPoses);
+        _animVars.set(SOLUTION_SOURCE, (int)AnimInverseKinematics::SolutionSource::RelaxToUnderPoses);
     }
 
     // if the hips or the feet are being controlled.
     if (hipsEnabled || rightFootEnabled || leftFootEnabled) {
         // replace the feet animation with the default pose, this is to prevent unexpected toe wiggling.
-        _animVars.set("defaultPoseOverlayAlpha", 1.0f);
-        _animVars.set("defaultPoseOverlayBoneSet", (int)AnimOverlay::BothFeetBoneSet);
+        _animVars.set(DEFAULT_POSE_OVERLAY_ALPHA, 1.0f);
+        _animVars.set(DEFAULT_POSE_OVERLAY_BONE_SET, (int)AnimOverlay::BothFeetBoneSet);
     } else {
         // feet should follow source animation
-        _animVars.unset("defaultPoseOverlayAlpha");
-        _animVars.unset("defaultPoseOverlayBoneSet");
+        _animVars.unset(DEFAULT_POSE_OVERLAY_ALPHA);
+        _animVars.unset(DEFAULT_POSE_OVERLAY_BONE_SET);
     }
 
     if (hipsEnabled) {
@@ -2378,19 +2472,19 @@ void Rig::updateFromControllerParameters(const ControllerParameters& params, flo
 
         AnimPose hips = _hipsBlendHelper.update(params.primaryControllerPoses[PrimaryControllerType_Hips], dt);
 
-        _animVars.set("hipsType", (int)IKTarget::Type::RotationAndPosition);
-        _animVars.set("hipsPosition", hips.trans());
-        _animVars.set("hipsRotation", hips.rot());
+        _animVars.set(HIPS_TYPE, (int)IKTarget::Type::RotationAndPosition);
+        _animVars.set(HIPS_POSITION, hips.trans());
+        _animVars.set(HIPS_ROTATION, hips.rot());
     } else {
-        _animVars.set("hipsType", (int)IKTarget::Type::Unknown);
+        _animVars.set(HIPS_TYPE, (int)IKTarget::Type::Unknown);
     }
 
     if (hipsEnabled && spine2Enabled) {
-        _animVars.set("spine2Type", (int)IKTarget::Type::Spline);
-        _animVars.set("spine2Position", params.primaryControllerPoses[PrimaryControllerType_Spine2].trans());
-        _animVars.set("spine2Rotation", params.primaryControllerPoses[PrimaryControllerType_Spine2].rot());
+        _animVars.set(SPINE2_TYPE, (int)IKTarget::Type::Spline);
+        _animVars.set(SPINE2_POSITION, params.primaryControllerPoses[PrimaryControllerType_Spine2].trans());
+        _animVars.set(SPINE2_ROTATION, params.primaryControllerPoses[PrimaryControllerType_Spine2].rot());
     } else {
-        _animVars.set("spine2Type", (int)IKTarget::Type::Unknown);
+        _animVars.set(SPINE2_TYPE, (int)IKTarget::Type::Unknown);
     }
 
     // set secondary targets
@@ -0,0 +1,73 @@
+//
+//  AudioCodecAdapter.cpp
+//  libraries/audio/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioCodecAdapter.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <plugins/CodecPlugin.h>
+
+// above this the link is congested and we back off
+static const float CONGESTED_LOSS_RATE = 0.03f;
+// below this (and without starves, jitter or long round trips) the link is clean and we grow
+static const float CLEAN_LOSS_RATE = 0.005f;
+static const int STRAINED_JITTER_MSECS = 40;
+static const int STRAINED_RTT_MSECS = 400;
+
+// FEC costs bitrate, so it is only worth it once losses are audible
+static const float FEC_LOSS_RATE = 0.01f;
+static const int MAX_EXPECTED_LOSS_PERCENTAGE = 30;
+static const float LOSS_SMOOTHING = 0.5f;
+
+// complexity matters most for quality at low bitrates, high bitrates are good enough with less CPU
+static const int HIGH_BITRATE = 96000;
+static const int HIGH_BITRATE_COMPLEXITY = 6;
+static const int LOW_BITRATE_COMPLEXITY = 10;
+
+void AudioCodecAdapter::setBitrateRange(int minBitrate, int maxBitrate) {
+    _minBitrate = std::min(minBitrate, maxBitrate);
+    _maxBitrate = maxBitrate;
+    _settings.bitrate = std::max(_minBitrate, std::min(_settings.bitrate, _maxBitrate));
+    updateDerivedSettings();
+}
+
+bool AudioCodecAdapter::update(const LinkStats& stats) {
+    Settings previous = _settings;
+
+    _smoothedLossRate = LOSS_SMOOTHING * _smoothedLossRate + (1.0f - LOSS_SMOOTHING) * stats.lossRate;
+
+    bool congested = stats.lossRate > CONGESTED_LOSS_RATE || stats.starves > 0;
+    bool clean = stats.lossRate < CLEAN_LOSS_RATE && stats.starves == 0 &&
+        stats.jitterMsecs < STRAINED_JITTER_MSECS && stats.rttMsecs < STRAINED_RTT_MSECS;
+
+    if (congested) {
+        _settings.bitrate = std::max(_minBitrate, (int)(_settings.bitrate * BITRATE_DECREASE_FACTOR));
+    } else if (clean) {
+        _settings.bitrate = std::min(_maxBitrate, _settings.bitrate + BITRATE_INCREASE);
+    }
+
+    updateDerivedSettings();
+    return _settings != previous;
+}
+
+void AudioCodecAdapter::applyTo(Encoder& encoder) const {
+    encoder.setBitrate(_settings.bitrate);
+    encoder.setComplexity(_settings.complexity);
+    encoder.setInbandFEC(_settings.inbandFEC ? 1 : 0);
+    encoder.setExpectedPacketLossPercentage(_settings.expectedLossPercentage);
+}
+
+void AudioCodecAdapter::updateDerivedSettings() {
+    _settings.complexity = _settings.bitrate >= HIGH_BITRATE ? HIGH_BITRATE_COMPLEXITY : LOW_BITRATE_COMPLEXITY;
+    _settings.inbandFEC = _smoothedLossRate > FEC_LOSS_RATE;
+    _settings.expectedLossPercentage = _settings.inbandFEC ?
+        std::min(MAX_EXPECTED_LOSS_PERCENTAGE, (int)std::ceil(_smoothedLossRate * 100.0f)) : 0;
+}
@@ -0,0 +1,74 @@
+//
+//  AudioCodecAdapter.h
+//  libraries/audio/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioCodecAdapter_h
+#define hifi_AudioCodecAdapter_h
+
+class Encoder;
+
+//
+// Picks the encoder settings of an audio stream from how well the stream gets to its receiver.
+//
+// The bitrate backs off multiplicatively when the receiver loses frames or starves, holds while the link
+// looks strained (some loss, high jitter or a long round trip) and grows back additively on a clean link,
+// always within the configured range. In-band FEC is turned on, with the smoothed loss rate as the expected
+// loss, once the link loses enough frames for it to pay off.
+//
+class AudioCodecAdapter {
+public:
+    static const int DEFAULT_MIN_BITRATE = 24000;
+    static const int DEFAULT_MAX_BITRATE = 128000;
+    static const int BITRATE_INCREASE = 8000; // per update on a clean link
+    static constexpr float BITRATE_DECREASE_FACTOR = 0.75f;
+
+    // What the receiver saw since the previous update (about a second)
+    struct LinkStats {
+        float lossRate { 0.0f }; // fraction of the frames that were lost
+        int starves { 0 }; // times the receiver ran out of frames to play
+        int jitterMsecs { 0 }; // largest gap between frames beyond the frame duration
+        int rttMsecs { 0 };
+    };
+
+    struct Settings {
+        int bitrate { DEFAULT_MAX_BITRATE };
+        int complexity { 10 };
+        bool inbandFEC { false };
+        int expectedLossPercentage { 0 };
+
+        bool operator==(const Settings& other) const {
+            return bitrate == other.bitrate && complexity == other.complexity && inbandFEC == other.inbandFEC &&
+                expectedLossPercentage == other.expectedLossPercentage;
+        }
+        bool operator!=(const Settings& other) const { return !(*this == other); }
+    };
+
+    // The range the bitrate adapts within, the current bitrate is clamped to it
+    void setBitrateRange(int minBitrate, int maxBitrate);
+    int getMinBitrate() const { return _minBitrate; }
+    int getMaxBitrate() const { return _maxBitrate; }
+
+    // Returns true if the settings changed
+    bool update(const LinkStats& stats);
+
+    const Settings& getSettings() const { return _settings; }
+    float getSmoothedLossRate() const { return _smoothedLossRate; }
+
+    void applyTo(Encoder& encoder) const;
+
+private:
+    void updateDerivedSettings();
+
+    int _minBitrate { DEFAULT_MIN_BITRATE };
+    int _maxBitrate { DEFAULT_MAX_BITRATE };
+    float _smoothedLossRate { 0.0f };
+    Settings _settings;
+};
+
+#endif // hifi_AudioCodecAdapter_h
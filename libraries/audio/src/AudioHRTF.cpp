@@ -1085,7 +1085,7 @@ void AudioHRTF::render(int16_t* input, float* output, int index, float azimuth,
     if (_resetState) {
         _azimuthState = azimuth;
         _distanceState = distance;
-        _gainState = gain;
+        _gainState = _fadeInState ? 0.0f : gain;
         _lpfState = lpf;
     }
 
@@ -1160,6 +1160,7 @@ void AudioHRTF::render(int16_t* input, float* output, int index, float azimuth,
     crossfade_4x2(bqBuffer, output, crossfadeTable, HRTF_BLOCK);
 
     _resetState = false;
+    _fadeInState = false;
 }
 
 void AudioHRTF::mixMono(int16_t* input, float* output, float gain, int numFrames) {
@@ -1171,7 +1172,7 @@ void AudioHRTF::mixMono(int16_t* input, float* output, float gain, int numFrames
 
     // disable interpolation from reset state
     if (_resetState) {
-        _gainState = gain;
+        _gainState = _fadeInState ? 0.0f : gain;
     }
 
     // crossfade gain and accumulate
@@ -1181,6 +1182,7 @@ void AudioHRTF::mixMono(int16_t* input, float* output, float gain, int numFrames
     _gainState = gain;
 
     _resetState = false;
+    _fadeInState = false;
 }
 
 void AudioHRTF::mixStereo(int16_t* input, float* output, float gain, int numFrames) {
@@ -1192,7 +1194,7 @@ void AudioHRTF::mixStereo(int16_t* input, float* output, float gain, int numFram
 
     // disable interpolation from reset state
     if (_resetState) {
-        _gainState = gain;
+        _gainState = _fadeInState ? 0.0f : gain;
     }
 
     // crossfade gain and accumulate
@@ -1202,4 +1204,5 @@ void AudioHRTF::mixStereo(int16_t* input, float* output, float gain, int numFram
     _gainState = gain;
 
     _resetState = false;
+    _fadeInState = false;
 }
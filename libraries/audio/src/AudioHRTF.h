@@ -107,6 +107,12 @@ public:
         }
     }
 
+    // clear internal state, and fade in from silence on the next render instead of starting at full gain
+    void resetToSilence() {
+        reset();
+        _fadeInState = true;
+    }
+
 private:
     AudioHRTF(const AudioHRTF&) = delete;
     AudioHRTF& operator=(const AudioHRTF&) = delete;
@@ -141,6 +147,7 @@ private:
     float _gainAdjust = HRTF_GAIN;
 
     bool _resetState = true;
+    bool _fadeInState = false;
 };
 
 #endif // AudioHRTF_h
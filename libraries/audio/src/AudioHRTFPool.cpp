@@ -0,0 +1,79 @@
+//
+//  AudioHRTFPool.cpp
+//  libraries/audio/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioHRTFPool.h"
+
+#include <algorithm>
+#include <assert.h>
+
+AudioHRTFPool::~AudioHRTFPool() {
+    // every pointer handed out must have been released before the pool goes away
+    assert(getNumInUse() == 0);
+}
+
+AudioHRTFPool::Pointer AudioHRTFPool::acquire() {
+    if (_free.empty()) {
+        Slab slab;
+        slab.instances.reset(new AudioHRTF[SLAB_SIZE]);
+
+        // hand out the instances of a new slab in address order
+        for (int i = SLAB_SIZE - 1; i >= 0; i--) {
+            _free.push_back(&slab.instances[i]);
+        }
+        _slabs.push_back(std::move(slab));
+    }
+
+    AudioHRTF* hrtf = _free.back();
+    _free.pop_back();
+
+    Slab* slab = findSlab(hrtf);
+    assert(slab);
+    slab->numInUse++;
+    _highWaterMark = std::max(_highWaterMark, getNumInUse());
+
+    // whatever this instance rendered before belongs to another source
+    hrtf->resetToSilence();
+    hrtf->setGainAdjustment(1.0f);
+
+    return Pointer(hrtf, Releaser(this));
+}
+
+void AudioHRTFPool::release(AudioHRTF* hrtf) {
+    Slab* slab = findSlab(hrtf);
+    assert(slab);
+    if (slab) {
+        slab->numInUse--;
+        _free.push_back(hrtf);
+    }
+}
+
+void AudioHRTFPool::trim() {
+    for (auto it = _slabs.begin(); it != _slabs.end();) {
+        if (it->numInUse == 0 && getNumAllocated() - SLAB_SIZE >= _highWaterMark) {
+            const Slab& slab = *it;
+            _free.erase(std::remove_if(_free.begin(), _free.end(), [&](const AudioHRTF* hrtf) {
+                return slab.contains(hrtf);
+            }), _free.end());
+            it = _slabs.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    _highWaterMark = getNumInUse();
+}
+
+AudioHRTFPool::Slab* AudioHRTFPool::findSlab(const AudioHRTF* hrtf) {
+    for (auto& slab : _slabs) {
+        if (slab.contains(hrtf)) {
+            return &slab;
+        }
+    }
+    return nullptr;
+}
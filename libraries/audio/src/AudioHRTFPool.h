@@ -0,0 +1,83 @@
+//
+//  AudioHRTFPool.h
+//  libraries/audio/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioHRTFPool_h
+#define hifi_AudioHRTFPool_h
+
+#include <memory>
+#include <vector>
+
+#include "AudioHRTF.h"
+
+//
+// Recycled storage for AudioHRTF state.
+//
+// Instances are allocated in contiguous slabs and handed out from a free list, so the state of the
+// sources rendered together stays close in memory, and releasing a source doesn't free anything.
+// Slabs that end up completely unused are only given back by trim(), and only those that weren't needed for the
+// most instances in use at once since the last trim, so that a source going silent and back doesn't reallocate.
+//
+// Not thread-safe: each pool is meant to be used by a single mixing thread at a time.
+//
+class AudioHRTFPool {
+public:
+    class Releaser {
+    public:
+        Releaser() {}
+        Releaser(AudioHRTFPool* pool) : _pool(pool) {}
+        void operator()(AudioHRTF* hrtf) const {
+            if (_pool) {
+                _pool->release(hrtf);
+            }
+        }
+
+    private:
+        AudioHRTFPool* _pool { nullptr };
+    };
+    using Pointer = std::unique_ptr<AudioHRTF, Releaser>;
+
+    static const int SLAB_SIZE = 32;
+
+    AudioHRTFPool() {}
+    ~AudioHRTFPool();
+
+    // Returns a cleared instance that fades in from silence on its first render.
+    // The instance goes back to the pool when the pointer is destroyed or reset.
+    Pointer acquire();
+
+    // Frees the slabs that have no instance in use, as long as what is left still covers the most instances that were
+    // in use at once since the last trim. Meant to be called at a regular interval.
+    void trim();
+
+    size_t getNumAllocated() const { return _slabs.size() * SLAB_SIZE; }
+    size_t getNumInUse() const { return getNumAllocated() - _free.size(); }
+    size_t getNumFree() const { return _free.size(); }
+    size_t getAllocatedBytes() const { return getNumAllocated() * sizeof(AudioHRTF); }
+
+private:
+    AudioHRTFPool(const AudioHRTFPool&) = delete;
+    AudioHRTFPool& operator=(const AudioHRTFPool&) = delete;
+
+    struct Slab {
+        std::unique_ptr<AudioHRTF[]> instances;
+        int numInUse { 0 };
+
+        bool contains(const AudioHRTF* hrtf) const { return hrtf >= instances.get() && hrtf < instances.get() + SLAB_SIZE; }
+    };
+
+    void release(AudioHRTF* hrtf);
+    Slab* findSlab(const AudioHRTF* hrtf);
+
+    std::vector<Slab> _slabs;
+    std::vector<AudioHRTF*> _free;
+    size_t _highWaterMark { 0 }; // the most instances in use at once since the last trim
+};
+
+#endif // hifi_AudioHRTFPool_h
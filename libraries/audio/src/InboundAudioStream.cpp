@@ -148,7 +148,16 @@ int InboundAudioStream::parseData(ReceivedMessage& message) {
             // also result in allowing the codec to interpolate lost data. Then
             // fall through to the "on time" logic to actually handle this packet
             int packetsDropped = arrivalInfo._seqDiffFromExpected;
-            lostAudioData(packetsDropped);
+
+            // the codec may be able to rebuild the frame right before this one from redundancy in this packet
+            QByteArray nextEncodedPacket;
+            bool isSilentFrame = message.getType() == PacketType::SilentAudioFrame
+                || message.getType() == PacketType::ReplicatedSilentAudioFrame;
+            if (!isSilentFrame && _decoder && codecInPacket == _selectedCodecName) {
+                nextEncodedPacket = QByteArray::fromRawData(message.getRawMessage() + message.getPosition(),
+                                                            message.getBytesLeftToRead());
+            }
+            lostAudioData(packetsDropped, nextEncodedPacket);
 
             // fall through to OnTime case
         }
@@ -244,7 +253,7 @@ int InboundAudioStream::parseStreamProperties(PacketType type, const QByteArray&
     }
 }
 
-int InboundAudioStream::lostAudioData(int numPackets) {
+int InboundAudioStream::lostAudioData(int numPackets, const QByteArray& nextEncodedPacket) {
     QByteArray decodedBuffer;
 
     while (numPackets--) {
@@ -256,7 +265,9 @@ int InboundAudioStream::lostAudioData(int numPackets) {
             qCInfo(audiostream, "Packet currently being unpacked or lost frame already being generated.  Not generating lost frame.");
             return 0;
         }
-        if (_decoder) {
+        if (_decoder && numPackets == 0 && !nextEncodedPacket.isEmpty()) {
+            _decoder->recoverFrame(nextEncodedPacket, decodedBuffer);
+        } else if (_decoder) {
             _decoder->lostFrame(decodedBuffer);
         } else {
             decodedBuffer.resize(AudioConstants::NETWORK_FRAME_BYTES_PER_CHANNEL * _numChannels);
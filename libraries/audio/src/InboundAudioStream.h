@@ -135,7 +135,8 @@ protected:
     virtual int parseAudioData(PacketType type, const QByteArray& packetAfterStreamProperties);
 
     /// produces audio data for lost network packets.
-    virtual int lostAudioData(int numPackets);
+    /// the last one is rebuilt from nextEncodedPacket, the packet that followed them, when it is given.
+    virtual int lostAudioData(int numPackets, const QByteArray& nextEncodedPacket = QByteArray());
 
     /// writes silent frames to the buffer that may be dropped to reduce latency caused by the buffer
     virtual int writeDroppableSilentFrames(int silentFrames);
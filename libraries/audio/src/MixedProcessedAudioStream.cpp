@@ -32,7 +32,7 @@ int MixedProcessedAudioStream::writeDroppableSilentFrames(int silentFrames) {
     return deviceSilentFramesWritten;
 }
 
-int MixedProcessedAudioStream::lostAudioData(int numPackets) {
+int MixedProcessedAudioStream::lostAudioData(int numPackets, const QByteArray& nextEncodedPacket) {
     QByteArray decodedBuffer;
     QByteArray outputBuffer;
 
@@ -45,7 +45,9 @@ int MixedProcessedAudioStream::lostAudioData(int numPackets) {
             qCInfo(audiostream, "Packet currently being unpacked or lost frame already being generated.  Not generating lost frame.");
             return 0;
         }
-        if (_decoder) {
+        if (_decoder && numPackets == 0 && !nextEncodedPacket.isEmpty()) {
+            _decoder->recoverFrame(nextEncodedPacket, decodedBuffer);
+        } else if (_decoder) {
             _decoder->lostFrame(decodedBuffer);
         } else {
             decodedBuffer.resize(AudioConstants::NETWORK_FRAME_BYTES_STEREO);
@@ -454,6 +454,19 @@ void Avatar::accumulateGrabPositions(std::map<QUuid, GrabLocationAccumulator>& g
     });
 }
 
+std::vector<QUuid> Avatar::getGrabTargetIDs() const {
+    std::vector<QUuid> targetIDs;
+    _avatarGrabsLock.withReadLock([&] {
+        for (const auto& entry : _avatarGrabs) {
+            const GrabPointer& grab = entry.second;
+            if (grab && !grab->getReleased()) {
+                targetIDs.push_back(grab->getTargetID());
+            }
+        }
+    });
+    return targetIDs;
+}
+
 void Avatar::tearDownGrabs() {
     _avatarGrabsLock.withWriteLock([&] {
         for (const auto& entry : _avatarGrabs) {
@@ -282,11 +282,73 @@ QByteArray AvatarData::toByteArrayStateful(AvatarDataDetail dataDetail, bool dro
     return avatarByteArray;
 }
 
-QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSentTime,
-                                   const QVector<JointData>& lastSentJointData, AvatarDataPacket::SendStatus& sendStatus,
-                                   bool dropFaceTracking, bool distanceAdjust, glm::vec3 viewerPosition,
-                                   QVector<JointData>* sentJointDataOut,
-                                   int maxDataSize, AvatarDataRate* outboundDataRateOut) const {
+namespace {
+
+// The joints last sent as JointData, with the same interface as PackedJointData for packToByteArray
+class UnpackedSentJoints {
+public:
+    UnpackedSentJoints(const QVector<JointData>& lastSentJointData, QVector<JointData>* sentJointDataOut) :
+        _lastSentJointData(lastSentJointData), _sentJointDataOut(sentJointDataOut) {}
+
+    void resize(int numJoints) {
+        // sentJointDataOut and lastSentJointData might be the same vector
+        if (_sentJointDataOut) {
+            _sentJointDataOut->resize(numJoints); // Make sure the destination is resized before using it
+            _sentJoints = _sentJointDataOut->data();
+        }
+    }
+
+    bool rotationChanged(int i, const glm::quat& rotation, bool cullSmallChanges, float minRotationDOT) const {
+        const JointData& last = _lastSentJointData[i];
+        // The dot product for larger rotations is a lower number,
+        // so if the dot() is less than the value, then the rotation is a larger angle of rotation
+        return last.rotationIsDefaultPose || (!cullSmallChanges && last.rotation != rotation)
+            || (cullSmallChanges && fabsf(glm::dot(last.rotation, rotation)) < minRotationDOT);
+    }
+
+    bool translationChanged(int i, const glm::vec3& translation, bool cullSmallChanges, float minTranslation) const {
+        const JointData& last = _lastSentJointData[i];
+        return last.translationIsDefaultPose || (!cullSmallChanges && last.translation != translation)
+            || (cullSmallChanges && glm::distance(translation, last.translation) > minTranslation);
+    }
+
+    void rotationSent(int i, const glm::quat& rotation, const uint8_t*) {
+        if (_sentJoints) {
+            _sentJoints[i].rotation = rotation;
+        }
+    }
+
+    void translationSent(int i, const glm::vec3& translation) {
+        if (_sentJoints) {
+            _sentJoints[i].translation = translation;
+        }
+    }
+
+    void setRotationIsDefaultPose(int i, bool isDefaultPose) {
+        if (_sentJoints) {
+            _sentJoints[i].rotationIsDefaultPose = isDefaultPose;
+        }
+    }
+
+    void setTranslationIsDefaultPose(int i, bool isDefaultPose) {
+        if (_sentJoints) {
+            _sentJoints[i].translationIsDefaultPose = isDefaultPose;
+        }
+    }
+
+private:
+    const QVector<JointData>& _lastSentJointData;
+    QVector<JointData>* _sentJointDataOut;
+    JointData* _sentJoints { nullptr };
+};
+
+}  // namespace
+
+template <typename SentJoints>
+QByteArray AvatarData::packToByteArray(AvatarDataDetail dataDetail, quint64 lastSentTime,
+                                       SentJoints& sentJointData, AvatarDataPacket::SendStatus& sendStatus,
+                                       bool dropFaceTracking, bool distanceAdjust, glm::vec3 viewerPosition,
+                                       int maxDataSize, AvatarDataRate* outboundDataRateOut) const {
 
     bool cullSmallChanges = (dataDetail == CullSmallData);
     bool sendAll = (dataDetail == SendAllData);
@@ -719,45 +781,32 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
 
         destinationBuffer += jointBitVectorSize; // Move pointer past the validity bytes
 
-        // sentJointDataOut and lastSentJointData might be the same vector
-        if (sentJointDataOut) {
-            sentJointDataOut->resize(numJoints); // Make sure the destination is resized before using it
-        }
+        sentJointData.resize(numJoints);
         const JointData *const joints = jointData.data();
-        JointData *const sentJoints = sentJointDataOut ? sentJointDataOut->data() : nullptr;
 
         float minRotationDOT = (distanceAdjust && cullSmallChanges) ? getDistanceBasedMinRotationDOT(viewerPosition) : AVATAR_MIN_ROTATION_DOT;
 
         int i = sendStatus.rotationsSent;
         for (; i < numJoints; ++i) {
             const JointData& data = joints[i];
-            const JointData& last = lastSentJointData[i];
 
             if (packetEnd - destinationBuffer >= minSizeForJoint) {
                 if (!data.rotationIsDefaultPose) {
-                    // The dot product for larger rotations is a lower number,
-                    // so if the dot() is less than the value, then the rotation is a larger angle of rotation
-                    if (sendAll || last.rotationIsDefaultPose || (!cullSmallChanges && last.rotation != data.rotation)
-                        || (cullSmallChanges && fabsf(glm::dot(last.rotation, data.rotation)) < minRotationDOT)) {
+                    if (sendAll || sentJointData.rotationChanged(i, data.rotation, cullSmallChanges, minRotationDOT)) {
                         validityPosition[i / BITS_IN_BYTE] |= 1 << (i % BITS_IN_BYTE);
 #ifdef WANT_DEBUG
                         rotationSentCount++;
 #endif
+                        auto packedRotation = destinationBuffer;
                         destinationBuffer += packOrientationQuatToSixBytes(destinationBuffer, data.rotation);
-
-                        if (sentJoints) {
-                            sentJoints[i].rotation = data.rotation;
-                        }
+                        sentJointData.rotationSent(i, data.rotation, packedRotation);
                     }
                 }
             } else {
                 break;
             }
 
-            if (sentJoints) {
-                sentJoints[i].rotationIsDefaultPose = data.rotationIsDefaultPose;
-            }
-
+            sentJointData.setRotationIsDefaultPose(i, data.rotationIsDefaultPose);
         }
         sendStatus.rotationsSent = i;
 
@@ -780,13 +829,11 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
         i = sendStatus.translationsSent;
         for (; i < numJoints; ++i) {
             const JointData& data = joints[i];
-            const JointData& last = lastSentJointData[i];
 
             // Note minSizeForJoint is conservative since there isn't a following bit-vector + scale.
             if (packetEnd - destinationBuffer >= minSizeForJoint) {
                 if (!data.translationIsDefaultPose) {
-                    if (sendAll || last.translationIsDefaultPose || (!cullSmallChanges && last.translation != data.translation)
-                        || (cullSmallChanges && glm::distance(data.translation, lastSentJointData[i].translation) > minTranslation)) {
+                    if (sendAll || sentJointData.translationChanged(i, data.translation, cullSmallChanges, minTranslation)) {
                         validityPosition[i / BITS_IN_BYTE] |= 1 << (i % BITS_IN_BYTE);
 #ifdef WANT_DEBUG
                         translationSentCount++;
@@ -794,19 +841,14 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
                         destinationBuffer += packFloatVec3ToSignedTwoByteFixed(destinationBuffer, data.translation / maxTranslationDimension,
                                                                                TRANSLATION_COMPRESSION_RADIX);
 
-                        if (sentJoints) {
-                            sentJoints[i].translation = data.translation;
-                        }
+                        sentJointData.translationSent(i, data.translation);
                     }
                 }
             } else {
                 break;
             }
 
-            if (sentJoints) {
-                sentJoints[i].translationIsDefaultPose = data.translationIsDefaultPose;
-            }
-
+            sentJointData.setTranslationIsDefaultPose(i, data.translationIsDefaultPose);
         }
         sendStatus.translationsSent = i;
 
@@ -901,6 +943,23 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
 #undef IF_AVATAR_SPACE
 }
 
+QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSentTime,
+                                   const QVector<JointData>& lastSentJointData, AvatarDataPacket::SendStatus& sendStatus,
+                                   bool dropFaceTracking, bool distanceAdjust, glm::vec3 viewerPosition,
+                                   QVector<JointData>* sentJointDataOut,
+                                   int maxDataSize, AvatarDataRate* outboundDataRateOut) const {
+    UnpackedSentJoints sentJointData { lastSentJointData, sentJointDataOut };
+    return packToByteArray(dataDetail, lastSentTime, sentJointData, sendStatus, dropFaceTracking, distanceAdjust,
+                           viewerPosition, maxDataSize, outboundDataRateOut);
+}
+
+QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSentTime, PackedJointData& sentJointData,
+                                   AvatarDataPacket::SendStatus& sendStatus, bool dropFaceTracking, bool distanceAdjust,
+                                   glm::vec3 viewerPosition, int maxDataSize, AvatarDataRate* outboundDataRateOut) const {
+    return packToByteArray(dataDetail, lastSentTime, sentJointData, sendStatus, dropFaceTracking, distanceAdjust,
+                           viewerPosition, maxDataSize, outboundDataRateOut);
+}
+
 // NOTE: This is never used in a "distanceAdjust" mode, so it's ok that it doesn't use a variable minimum rotation/translation
 void AvatarData::doneEncoding(bool cullSmallChanges) {
     // The server has finished sending this version of the joint-data to other nodes.  Update _lastSentJointData.
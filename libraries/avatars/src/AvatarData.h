@@ -53,6 +53,7 @@
 #include "AABox.h"
 #include "AvatarTraits.h"
 #include "HeadData.h"
+#include "PackedJointData.h"
 #include "PathUtils.h"
 
 using AvatarSharedPointer = std::shared_ptr<AvatarData>;
@@ -627,6 +628,12 @@ public:
         AvatarDataPacket::SendStatus& sendStatus, bool dropFaceTracking, bool distanceAdjust, glm::vec3 viewerPosition,
         QVector<JointData>* sentJointDataOut, int maxDataSize = 0, AvatarDataRate* outboundDataRateOut = nullptr) const;
 
+    // Used by the avatar mixer, which compares the joints against what it last sent to the receiver and records what it
+    // sends in the same PackedJointData.
+    QByteArray toByteArray(AvatarDataDetail dataDetail, quint64 lastSentTime, PackedJointData& sentJointData,
+        AvatarDataPacket::SendStatus& sendStatus, bool dropFaceTracking, bool distanceAdjust, glm::vec3 viewerPosition,
+        int maxDataSize = 0, AvatarDataRate* outboundDataRateOut = nullptr) const;
+
     virtual void doneEncoding(bool cullSmallChanges);
 
     /// \return true if an error should be logged
@@ -1886,6 +1893,13 @@ protected:
     virtual void clearAvatarGrabData(const QUuid& grabID);
 
 private:
+    // Packs the avatar for either form of toByteArray, SentJoints being what the joints are compared against and
+    // what records the joints that were sent
+    template <typename SentJoints>
+    QByteArray packToByteArray(AvatarDataDetail dataDetail, quint64 lastSentTime, SentJoints& sentJointData,
+        AvatarDataPacket::SendStatus& sendStatus, bool dropFaceTracking, bool distanceAdjust, glm::vec3 viewerPosition,
+        int maxDataSize, AvatarDataRate* outboundDataRateOut) const;
+
     friend void avatarStateFromFrame(const QByteArray& frameData, AvatarData* _avatar);
     static QUrl _defaultFullAvatarModelUrl;
     // privatize the copy constructor and assignment operator so they cannot be called
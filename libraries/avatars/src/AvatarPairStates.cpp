@@ -0,0 +1,62 @@
+//
+//  AvatarPairStates.cpp
+//  libraries/avatars/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AvatarPairStates.h"
+
+#include <algorithm>
+#include <cassert>
+
+const AvatarPairStates::State* AvatarPairStates::find(int index, NetworkLocalID localID) const {
+    if (index < 0 || index >= (int)_states.size() || _states[index].localID != localID) {
+        return nullptr;
+    }
+    return &_states[index];
+}
+
+AvatarPairStates::State& AvatarPairStates::get(int index, NetworkLocalID localID) {
+    assert(index >= 0);
+    if (index >= (int)_states.size()) {
+        // grow by more than needed, indices are handed out lowest first
+        size_t size = std::max((size_t)index + 1, _states.size() * 3 / 2);
+        _states.resize(size);
+        _sentJoints.resize(size);
+    }
+
+    State& state = _states[index];
+    if (state.localID != localID) {
+        state = State();
+        state.localID = localID;
+        _sentJoints[index].clear();
+    }
+    return state;
+}
+
+PackedJointData& AvatarPairStates::getSentJoints(int index, NetworkLocalID localID) {
+    get(index, localID);
+    return _sentJoints[index];
+}
+
+void AvatarPairStates::remove(NetworkLocalID localID) {
+    for (size_t i = 0; i < _states.size(); ++i) {
+        if (_states[i].localID == localID) {
+            _states[i] = State();
+            _sentJoints[i].clear();
+        }
+    }
+}
+
+size_t AvatarPairStates::getMemoryUsage() const {
+    size_t usage = sizeof(AvatarPairStates) + _states.capacity() * sizeof(State);
+    usage += (_sentJoints.capacity() - _sentJoints.size()) * sizeof(PackedJointData);
+    for (const auto& sentJoints : _sentJoints) {
+        usage += sentJoints.getMemoryUsage();
+    }
+    return usage;
+}
@@ -0,0 +1,53 @@
+//
+//  AvatarPairStates.h
+//  libraries/avatars/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AvatarPairStates_h
+#define hifi_AvatarPairStates_h
+
+#include <chrono>
+#include <vector>
+
+#include <UUID.h>
+
+#include "PackedJointData.h"
+
+// What the avatar mixer last sent one receiver about each of the other avatars.
+//
+// The states are kept in dense tables indexed by the pair index the mixer gives each avatar while it is connected
+// and reuses once it is gone, instead of in maps keyed by node. Each state keeps the local ID of its avatar, so what
+// was left behind by an avatar that disconnected is reset rather than taken for the next avatar at that index.
+// The joints are kept apart from the rest, so sorting the other avatars every frame only touches a few bytes of each.
+class AvatarPairStates {
+public:
+    using TraitsCheckTimestamp = std::chrono::steady_clock::time_point;
+
+    struct State {
+        uint64_t lastBroadcastTime { 0 }; // when identity data was last sent
+        uint64_t lastEncodeTime { 0 };
+        TraitsCheckTimestamp lastSentTraitsTimestamp;
+        NetworkLocalID localID { 0 };
+        uint16_t lastBroadcastSequenceNumber { 0 };
+    };
+
+    // Returns nullptr if nothing was sent about that avatar
+    const State* find(int index, NetworkLocalID localID) const;
+    State& get(int index, NetworkLocalID localID);
+    PackedJointData& getSentJoints(int index, NetworkLocalID localID);
+
+    void remove(NetworkLocalID localID);
+
+    size_t getMemoryUsage() const;
+
+private:
+    std::vector<State> _states;
+    std::vector<PackedJointData> _sentJoints;
+};
+
+#endif // hifi_AvatarPairStates_h
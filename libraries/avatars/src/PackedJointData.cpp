@@ -0,0 +1,80 @@
+//
+//  PackedJointData.cpp
+//  libraries/avatars/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PackedJointData.h"
+
+#include <cmath>
+#include <cstring>
+
+#include <GLMHelpers.h>
+
+static const float TRANSLATION_SCALE = (float)(1 << PackedJointData::TRANSLATION_RADIX);
+static const float MAX_TRANSLATION = (float)INT16_MAX / TRANSLATION_SCALE;
+
+// Rounded rather than truncated like packFloatVec3ToSignedTwoByteFixed, so a translation that was kept is within
+// AVATAR_MIN_TRANSLATION of what was sent
+static void packTranslation(uint8_t* buffer, const glm::vec3& translation) {
+    int16_t fixed[3];
+    for (int i = 0; i < 3; i++) {
+        fixed[i] = (int16_t)glm::clamp(roundf(translation[i] * TRANSLATION_SCALE), (float)INT16_MIN, (float)INT16_MAX);
+    }
+    memcpy(buffer, fixed, sizeof(fixed));
+}
+
+glm::quat PackedJointData::getRotation(int i) const {
+    glm::quat rotation;
+    unpackOrientationQuatFromSixBytes(_joints[i].rotation, rotation);
+    return rotation;
+}
+
+glm::vec3 PackedJointData::getTranslation(int i) const {
+    int16_t fixed[3];
+    memcpy(fixed, _joints[i].translation, sizeof(fixed));
+    return glm::vec3(fixed[0], fixed[1], fixed[2]) / TRANSLATION_SCALE;
+}
+
+bool PackedJointData::rotationChanged(int i, const glm::quat& rotation, bool cullSmallChanges, float minRotationDOT) const {
+    const Joint& last = _joints[i];
+    if (last.flags & ROTATION_IS_DEFAULT_POSE) {
+        return true;
+    }
+    // what the receiver would get is what it already has, which also keeps rounding in the dot product below
+    // from sending a joint at rest again
+    uint8_t packedRotation[sizeof(last.rotation)];
+    packOrientationQuatToSixBytes(packedRotation, rotation);
+    if (memcmp(packedRotation, last.rotation, sizeof(packedRotation)) == 0) {
+        return false;
+    }
+    return !cullSmallChanges || fabsf(glm::dot(getRotation(i), rotation)) < minRotationDOT;
+}
+
+bool PackedJointData::translationChanged(int i, const glm::vec3& translation, bool cullSmallChanges,
+                                         float minTranslation) const {
+    const Joint& last = _joints[i];
+    if (last.flags & (TRANSLATION_IS_DEFAULT_POSE | TRANSLATION_OUT_OF_RANGE)) {
+        return true;
+    }
+    uint8_t packedTranslation[sizeof(last.translation)];
+    packTranslation(packedTranslation, translation);
+    if (memcmp(packedTranslation, last.translation, sizeof(packedTranslation)) == 0) {
+        return false;
+    }
+    return !cullSmallChanges || glm::distance(getTranslation(i), translation) > minTranslation;
+}
+
+void PackedJointData::rotationSent(int i, const glm::quat&, const uint8_t* packedRotation) {
+    memcpy(_joints[i].rotation, packedRotation, sizeof(_joints[i].rotation));
+}
+
+void PackedJointData::translationSent(int i, const glm::vec3& translation) {
+    bool inRange = glm::all(glm::lessThanEqual(glm::abs(translation), glm::vec3(MAX_TRANSLATION)));
+    setFlag(i, TRANSLATION_OUT_OF_RANGE, !inRange);
+    packTranslation(_joints[i].translation, translation);
+}
@@ -0,0 +1,73 @@
+//
+//  PackedJointData.h
+//  libraries/avatars/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_PackedJointData_h
+#define hifi_PackedJointData_h
+
+#include <stdint.h>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+// The joint data last sent about an avatar to one receiver, kept at the precision of the wire instead of as JointData.
+//
+// Rotations are kept in their six byte wire form, which is exactly what the receiver has. Translations go out
+// normalized by a scale that changes from packet to packet, so they are kept as 16-bit fixed point instead, to within
+// 0.03 mm up to two meters from their parent. A translation outside of that range is never considered sent, so it is
+// sent every time. The avatar mixer keeps one of these for every pair of avatars, 13 bytes per joint where a
+// JointData takes 32.
+class PackedJointData {
+public:
+    static const int TRANSLATION_RADIX = 14;
+
+    int size() const { return (int)_joints.size(); }
+    void resize(int numJoints) { _joints.resize(numJoints); }
+    void clear() { _joints.clear(); _joints.shrink_to_fit(); }
+
+    bool rotationIsDefaultPose(int i) const { return _joints[i].flags & ROTATION_IS_DEFAULT_POSE; }
+    bool translationIsDefaultPose(int i) const { return _joints[i].flags & TRANSLATION_IS_DEFAULT_POSE; }
+    void setRotationIsDefaultPose(int i, bool isDefaultPose) { setFlag(i, ROTATION_IS_DEFAULT_POSE, isDefaultPose); }
+    void setTranslationIsDefaultPose(int i, bool isDefaultPose) { setFlag(i, TRANSLATION_IS_DEFAULT_POSE, isDefaultPose); }
+
+    glm::quat getRotation(int i) const;
+    glm::vec3 getTranslation(int i) const;
+
+    // Whether the joint should be sent again, with the same rules as for JointData in AvatarData::toByteArray
+    bool rotationChanged(int i, const glm::quat& rotation, bool cullSmallChanges, float minRotationDOT) const;
+    bool translationChanged(int i, const glm::vec3& translation, bool cullSmallChanges, float minTranslation) const;
+
+    // Records a rotation from the six bytes it was sent as
+    void rotationSent(int i, const glm::quat& rotation, const uint8_t* packedRotation);
+    void translationSent(int i, const glm::vec3& translation);
+
+    size_t getMemoryUsage() const { return sizeof(PackedJointData) + _joints.capacity() * sizeof(Joint); }
+
+private:
+    enum Flag : uint8_t {
+        ROTATION_IS_DEFAULT_POSE = 1,
+        TRANSLATION_IS_DEFAULT_POSE = 2,
+        TRANSLATION_OUT_OF_RANGE = 4
+    };
+
+    struct Joint {
+        uint8_t rotation[6];
+        uint8_t translation[6];
+        uint8_t flags { ROTATION_IS_DEFAULT_POSE | TRANSLATION_IS_DEFAULT_POSE };
+    };
+
+    void setFlag(int i, Flag flag, bool value) {
+        _joints[i].flags = value ? (_joints[i].flags | flag) : (_joints[i].flags & ~flag);
+    }
+
+    std::vector<Joint> _joints;
+};
+
+#endif // hifi_PackedJointData_h
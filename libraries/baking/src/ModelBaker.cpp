@@ -241,6 +241,8 @@ void ModelBaker::bakeSourceCopy() {
         auto config = baker.getConfiguration();
         // Enable compressed draco mesh generation
         config->getJobConfig("BuildDracoMesh")->setEnabled(true);
+        // Levels of detail aren't part of the baked output, they are generated when the model is loaded
+        config->getJobConfig("BuildMeshLODs")->setEnabled(false);
         // Do not permit potentially lossy modification of joint data meant for runtime
         ((PrepareJointsConfig*)config->getJobConfig("PrepareJoints"))->passthrough = true;
     
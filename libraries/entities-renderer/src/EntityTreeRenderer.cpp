@@ -464,7 +464,7 @@ void EntityTreeRenderer::updateChangedEntities(const render::ScenePointer& scene
 
     float expectedUpdateCost = _avgRenderableUpdateCost * _renderablesToUpdate.size();
     _prevTotalNeededEntityUpdates = _renderablesToUpdate.size();
-    if (expectedUpdateCost < MAX_UPDATE_RENDERABLES_TIME_BUDGET) {
+    if (expectedUpdateCost < _updateRenderablesTimeBudget) {
         // we expect to update all renderables within available time budget
         PROFILE_RANGE_EX(simulation_physics, "UpdateRenderables", 0xffff00ff, (uint64_t)_renderablesToUpdate.size());
         uint64_t updateStart = usecTimestampNow();
@@ -517,9 +517,10 @@ void EntityTreeRenderer::updateChangedEntities(const render::ScenePointer& scene
             const auto& sortedRenderablesVector = sortedRenderables.getSortedVector();
             uint64_t updateStart = usecTimestampNow();
             uint64_t sortCost = updateStart - sortStart;
-            uint64_t timeBudget = MIN_SORTED_UPDATE_RENDERABLES_TIME_BUDGET;
-            if (sortCost < MAX_UPDATE_RENDERABLES_TIME_BUDGET - MIN_SORTED_UPDATE_RENDERABLES_TIME_BUDGET) {
-                timeBudget = MAX_UPDATE_RENDERABLES_TIME_BUDGET - sortCost;
+            uint64_t minTimeBudget = std::min(MIN_SORTED_UPDATE_RENDERABLES_TIME_BUDGET, _updateRenderablesTimeBudget / 2);
+            uint64_t timeBudget = minTimeBudget;
+            if (sortCost < _updateRenderablesTimeBudget - minTimeBudget) {
+                timeBudget = _updateRenderablesTimeBudget - sortCost;
             }
             uint64_t expiry = updateStart + timeBudget;
 
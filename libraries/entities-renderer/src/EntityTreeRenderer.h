@@ -20,6 +20,7 @@
 #include <EntityScriptingInterface.h> // for RayToEntityIntersectionResult
 #include <EntityTree.h>
 #include <PointerEvent.h>
+#include <PrioritySortUtil.h>
 #include <ScriptCache.h>
 #include <TextureCache.h>
 #include <OctreeProcessor.h>
@@ -137,6 +138,9 @@ public:
     static bool removeMaterialFromAvatar(const QUuid& avatarID, graphics::MaterialPointer material, const std::string& parentMaterialName);
 
     size_t getPrevNumEntityUpdates() const { return _prevNumEntityUpdates; }
+
+    // The time update spends updating the renderables in the scene, the rest of them being updated on later frames
+    void setUpdateRenderablesTimeBudget(uint64_t timeBudget) { _updateRenderablesTimeBudget = timeBudget; }
     size_t getPrevTotalNeededEntityUpdates() const { return _prevTotalNeededEntityUpdates; }
 
 signals:
@@ -250,6 +254,7 @@ private:
     const float ZONE_CHECK_DISTANCE = 0.001f;
 
     float _avgRenderableUpdateCost { 0.0f };
+    uint64_t _updateRenderablesTimeBudget { MAX_UPDATE_RENDERABLES_TIME_BUDGET }; // usec
 
     ReadWriteLockable _changedEntitiesGuard;
     std::unordered_set<EntityItemID> _changedEntities;
@@ -0,0 +1,34 @@
+//
+//  DenseIndexAllocator.cpp
+//  libraries/entities/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "DenseIndexAllocator.h"
+
+int denseIndexMetaTypeId = qRegisterMetaType<DenseIndex>();
+
+DenseIndex DenseIndexAllocator::allocate() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_freeIndices.empty()) {
+        _generations.push_back(0);
+        return { _capacity++, 0 };
+    }
+    uint32_t index = _freeIndices.top();
+    _freeIndices.pop();
+    return { index, ++_generations[index] };
+}
+
+void DenseIndexAllocator::release(const DenseIndex& denseIndex) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _freeIndices.push(denseIndex.index);
+}
+
+uint32_t DenseIndexAllocator::getCapacity() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _capacity;
+}
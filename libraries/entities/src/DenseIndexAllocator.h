@@ -0,0 +1,48 @@
+//
+//  DenseIndexAllocator.h
+//  libraries/entities/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_DenseIndexAllocator_h
+#define hifi_DenseIndexAllocator_h
+
+#include <stdint.h>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <vector>
+
+#include <QtCore/QMetaType>
+
+// An index handed out by a DenseIndexAllocator, and how many times it was handed out before. State kept for an index
+// may still be that of its previous holder, the generation tells them apart.
+struct DenseIndex {
+    uint32_t index { 0 };
+    uint32_t generation { 0 };
+};
+Q_DECLARE_METATYPE(DenseIndex)
+
+// Hands out small indices to objects while they are alive, lowest first, so that per object state can be kept in
+// arrays instead of in maps keyed by pointer or ID. An index is handed out again once it was released, with the next
+// generation.
+class DenseIndexAllocator {
+public:
+    DenseIndex allocate();
+    void release(const DenseIndex& denseIndex);
+
+    // one more than the highest index handed out so far
+    uint32_t getCapacity() const;
+
+private:
+    mutable std::mutex _mutex;
+    std::priority_queue<uint32_t, std::vector<uint32_t>, std::greater<uint32_t>> _freeIndices;
+    std::vector<uint32_t> _generations;
+    uint32_t _capacity { 0 };
+};
+
+#endif // hifi_DenseIndexAllocator_h
@@ -0,0 +1,44 @@
+//
+//  DenseTimestamps.cpp
+//  libraries/entities/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "DenseTimestamps.h"
+
+void DenseTimestamps::set(const DenseIndex& denseIndex, uint64_t timestamp) {
+    uint32_t page = denseIndex.index >> PAGE_BITS;
+    if (page >= _pages.size()) {
+        _pages.resize(page + 1);
+    }
+    if (!_pages[page]) {
+        _pages[page].reset(new Page());
+    }
+    uint32_t offset = denseIndex.index & (PAGE_SIZE - 1);
+    _pages[page]->timestamps[offset] = timestamp;
+    _pages[page]->generations[offset] = denseIndex.generation;
+}
+
+void DenseTimestamps::reset(const DenseIndex& denseIndex) {
+    // doesn't allocate a page to hold a zero
+    uint32_t pageIndex = denseIndex.index >> PAGE_BITS;
+    Page* page = pageIndex < _pages.size() ? _pages[pageIndex].get() : nullptr;
+    uint32_t offset = denseIndex.index & (PAGE_SIZE - 1);
+    if (page && page->generations[offset] == denseIndex.generation) {
+        page->timestamps[offset] = 0;
+    }
+}
+
+size_t DenseTimestamps::getMemoryUsage() const {
+    size_t usage = sizeof(DenseTimestamps) + _pages.capacity() * sizeof(std::unique_ptr<Page>);
+    for (const auto& page : _pages) {
+        if (page) {
+            usage += sizeof(Page);
+        }
+    }
+    return usage;
+}
@@ -0,0 +1,57 @@
+//
+//  DenseTimestamps.h
+//  libraries/entities/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_DenseTimestamps_h
+#define hifi_DenseTimestamps_h
+
+#include <stdint.h>
+#include <memory>
+#include <vector>
+
+#include "DenseIndexAllocator.h"
+
+// A timestamp for each index handed out by a DenseIndexAllocator, zero when there is none.
+//
+// The timestamps are kept in pages of consecutive indices that are only allocated once one of them is set, so a
+// table costs twelve bytes for each index around the ones that are used, where a map would cost a node per entry.
+// The generation of the index is kept with its timestamp: an index is reused as soon as it is released, possibly
+// before the table hears of it, and the timestamp of its previous holder must not be taken for the new one's.
+class DenseTimestamps {
+public:
+    static const int PAGE_BITS = 8;
+    static const uint32_t PAGE_SIZE = 1 << PAGE_BITS;
+
+    uint64_t get(const DenseIndex& denseIndex) const {
+        const Page* page = findPage(denseIndex);
+        uint32_t offset = denseIndex.index & (PAGE_SIZE - 1);
+        return page && page->generations[offset] == denseIndex.generation ? page->timestamps[offset] : 0;
+    }
+    void set(const DenseIndex& denseIndex, uint64_t timestamp);
+    // leaves the timestamp of a later holder of the index alone
+    void reset(const DenseIndex& denseIndex);
+    void clear() { _pages.clear(); _pages.shrink_to_fit(); }
+
+    size_t getMemoryUsage() const;
+
+private:
+    struct Page {
+        uint64_t timestamps[PAGE_SIZE] {};
+        uint32_t generations[PAGE_SIZE] {};
+    };
+
+    const Page* findPage(const DenseIndex& denseIndex) const {
+        uint32_t page = denseIndex.index >> PAGE_BITS;
+        return page < _pages.size() ? _pages[page].get() : nullptr;
+    }
+
+    std::vector<std::unique_ptr<Page>> _pages;
+};
+
+#endif // hifi_DenseTimestamps_h
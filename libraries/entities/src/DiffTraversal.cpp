@@ -15,13 +15,22 @@
 
 #include "EntityPriorityQueue.h"
 
-DiffTraversal::Waypoint::Waypoint(EntityTreeElementPointer& element) : _nextIndex(0) {
+// whether the receiver had everything in the subtree when it was last traversed and nothing in it changed since
+static bool isKnownSubtree(const EntityTreeElement& element, const DenseTimestamps& knownSubtrees) {
+    uint64_t knownSince = knownSubtrees.get(element.getDenseIndex());
+    return knownSince != 0 && element.getLastChanged() < knownSince && element.getLastChangedContent() < knownSince;
+}
+
+DiffTraversal::Waypoint::Waypoint(EntityTreeElementPointer& element, uint64_t scanTime) :
+    _scanTime(scanTime),
+    _nextIndex(0)
+{
     assert(element);
     _weakElement = element;
 }
 
 void DiffTraversal::Waypoint::getNextVisibleElementFirstTime(DiffTraversal::VisibleElement& next,
-        const DiffTraversal::View& view) {
+        const DiffTraversal::View& view, const DenseTimestamps& knownSubtrees) {
     // NOTE: no need to set next.intersection in the "FirstTime" context
     if (_nextIndex == -1) {
         // root case is special:
@@ -37,10 +46,14 @@ void DiffTraversal::Waypoint::getNextVisibleElementFirstTime(DiffTraversal::Visi
             while (_nextIndex < NUMBER_OF_CHILDREN) {
                 EntityTreeElementPointer nextElement = element->getChildAtIndex(_nextIndex);
                 ++_nextIndex;
-                if (nextElement && view.shouldTraverseElement(*nextElement)) {
+                if (!nextElement || isKnownSubtree(*nextElement, knownSubtrees)) {
+                    continue;
+                }
+                if (view.shouldTraverseElement(*nextElement)) {
                     next.element = nextElement;
                     return;
                 }
+                _subtreeKnown = false;
             }
         }
     }
@@ -48,7 +61,8 @@ void DiffTraversal::Waypoint::getNextVisibleElementFirstTime(DiffTraversal::Visi
 }
 
 void DiffTraversal::Waypoint::getNextVisibleElementRepeat(
-        DiffTraversal::VisibleElement& next, const DiffTraversal::View& view, uint64_t lastTime) {
+        DiffTraversal::VisibleElement& next, const DiffTraversal::View& view, uint64_t lastTime,
+        const DenseTimestamps& knownSubtrees) {
     if (_nextIndex == -1) {
         // root case is special
         ++_nextIndex;
@@ -57,6 +71,9 @@ void DiffTraversal::Waypoint::getNextVisibleElementRepeat(
             next.element = element;
             return;
         }
+        if (element->hasContent()) {
+            _subtreeKnown = false;
+        }
     }
     if (_nextIndex < NUMBER_OF_CHILDREN) {
         EntityTreeElementPointer element = _weakElement.lock();
@@ -64,13 +81,16 @@ void DiffTraversal::Waypoint::getNextVisibleElementRepeat(
             while (_nextIndex < NUMBER_OF_CHILDREN) {
                 EntityTreeElementPointer nextElement = element->getChildAtIndex(_nextIndex);
                 ++_nextIndex;
-                if (nextElement &&
-                    nextElement->getLastChanged() > lastTime &&
+                if (!nextElement || isKnownSubtree(*nextElement, knownSubtrees)) {
+                    continue;
+                }
+                if (nextElement->getLastChanged() > lastTime &&
                     view.shouldTraverseElement(*nextElement)) {
 
                     next.element = nextElement;
                     return;
                 }
+                _subtreeKnown = false;
             }
         }
     }
@@ -78,7 +98,7 @@ void DiffTraversal::Waypoint::getNextVisibleElementRepeat(
 }
 
 void DiffTraversal::Waypoint::getNextVisibleElementDifferential(DiffTraversal::VisibleElement& next,
-        const DiffTraversal::View& view, const DiffTraversal::View& lastView) {
+        const DiffTraversal::View& view, const DiffTraversal::View& lastView, const DenseTimestamps& knownSubtrees) {
     if (_nextIndex == -1) {
         // root case is special
         ++_nextIndex;
@@ -91,10 +111,14 @@ void DiffTraversal::Waypoint::getNextVisibleElementDifferential(DiffTraversal::V
             while (_nextIndex < NUMBER_OF_CHILDREN) {
                 EntityTreeElementPointer nextElement = element->getChildAtIndex(_nextIndex);
                 ++_nextIndex;
-                if (nextElement && view.shouldTraverseElement(*nextElement)) {
+                if (!nextElement || isKnownSubtree(*nextElement, knownSubtrees)) {
+                    continue;
+                }
+                if (view.shouldTraverseElement(*nextElement)) {
                     next.element = nextElement;
                     return;
                 }
+                _subtreeKnown = false;
             }
         }
     }
@@ -217,30 +241,33 @@ DiffTraversal::Type DiffTraversal::prepareNewTraversal(const DiffTraversal::View
         type = Type::First;
         _currentView.viewFrustums = view.viewFrustums;
         _currentView.lodScaleFactor = view.lodScaleFactor;
+        // the receiver is about to be treated as having nothing
+        _knownSubtrees.clear();
         _getNextVisibleElementCallback = [this](DiffTraversal::VisibleElement& next) {
-            _path.back().getNextVisibleElementFirstTime(next, _currentView);
+            _path.back().getNextVisibleElementFirstTime(next, _currentView, _knownSubtrees);
         };
     } else if (!_currentView.usesViewFrustums() || _completedView.isVerySimilar(view)) {
         type = Type::Repeat;
         _getNextVisibleElementCallback = [this](DiffTraversal::VisibleElement& next) {
-            _path.back().getNextVisibleElementRepeat(next, _completedView, _completedView.startTime);
+            _path.back().getNextVisibleElementRepeat(next, _completedView, _completedView.startTime, _knownSubtrees);
         };
     } else {
         type = Type::Differential;
         _currentView.viewFrustums = view.viewFrustums;
         _currentView.lodScaleFactor = view.lodScaleFactor;
         _getNextVisibleElementCallback = [this](DiffTraversal::VisibleElement& next) {
-            _path.back().getNextVisibleElementDifferential(next, _currentView, _completedView);
+            _path.back().getNextVisibleElementDifferential(next, _currentView, _completedView, _knownSubtrees);
         };
     }
 
+    _currentView.startTime = usecTimestampNow();
+    _scanTime = _currentView.startTime;
+
     _path.clear();
-    _path.push_back(DiffTraversal::Waypoint(root));
+    _path.push_back(DiffTraversal::Waypoint(root, _scanTime));
     // set root fork's index such that root element returned at getNextElement()
     _path.back().initRootNextIndex();
 
-    _currentView.startTime = usecTimestampNow();
-
     return type;
 }
 
@@ -253,13 +280,13 @@ void DiffTraversal::getNextVisibleElement(DiffTraversal::VisibleElement& next) {
     if (next.element) {
         int8_t nextIndex = _path.back().getNextIndex();
         if (nextIndex > 0) {
-            _path.push_back(DiffTraversal::Waypoint(next.element));
+            _path.push_back(DiffTraversal::Waypoint(next.element, _scanTime));
         }
     } else {
         // we're done at this level
         while (!next.element) {
             // pop one level
-            _path.pop_back();
+            popWaypoint();
             if (_path.empty()) {
                 // we've traversed the entire tree
                 _completedView = _currentView;
@@ -269,12 +296,31 @@ void DiffTraversal::getNextVisibleElement(DiffTraversal::VisibleElement& next) {
             _getNextVisibleElementCallback(next);
             if (next.element) {
                 // we've descended one level so add it to the path
-                _path.push_back(DiffTraversal::Waypoint(next.element));
+                _path.push_back(DiffTraversal::Waypoint(next.element, _scanTime));
             }
         }
     }
 }
 
+void DiffTraversal::popWaypoint() {
+    const Waypoint& waypoint = _path.back();
+    bool subtreeKnown = waypoint.isSubtreeKnown();
+    EntityTreeElementPointer element = waypoint.getElement();
+    if (element) {
+        // the rest of the subtree was scanned after the element, anything that changed in it since then
+        // also marked the element as changed
+        if (subtreeKnown) {
+            _knownSubtrees.set(element->getDenseIndex(), waypoint.getScanTime());
+        } else {
+            _knownSubtrees.reset(element->getDenseIndex());
+        }
+    }
+    _path.pop_back();
+    if (!subtreeKnown && !_path.empty()) {
+        _path.back().setSubtreeUnknown();
+    }
+}
+
 void DiffTraversal::setScanCallback(std::function<void (DiffTraversal::VisibleElement&)> cb) {
     if (!cb) {
         _scanElementCallback = [](DiffTraversal::VisibleElement& a){};
@@ -284,14 +330,21 @@ void DiffTraversal::setScanCallback(std::function<void (DiffTraversal::VisibleEl
 }
 
 void DiffTraversal::traverse(uint64_t timeBudget) {
-    uint64_t expiry = usecTimestampNow() + timeBudget;
+    _scanTime = usecTimestampNow();
+    uint64_t expiry = _scanTime + timeBudget;
     DiffTraversal::VisibleElement next;
     getNextVisibleElement(next);
     while (next.element) {
         if (next.element->hasContent()) {
+            next.allKnown = false;
             _scanElementCallback(next);
+            if (!next.allKnown) {
+                // the last waypoint is the element's own
+                _path.back().setSubtreeUnknown();
+            }
         }
-        if (usecTimestampNow() > expiry) {
+        _scanTime = usecTimestampNow();
+        if (_scanTime > expiry) {
             break;
         }
         getNextVisibleElement(next);
@@ -14,6 +14,7 @@
 
 #include <shared/ConicalViewFrustum.h>
 
+#include "DenseTimestamps.h"
 #include "EntityTreeElement.h"
 
 // DiffTraversal traverses the tree and applies _scanElementCallback on elements it finds
@@ -24,6 +25,9 @@ public:
     class VisibleElement {
     public:
         EntityTreeElementPointer element;
+        // set by the scan callback when the receiver has every entity of the element up to date, once that is
+        // true for a whole subtree it is skipped by later traversals until something in it changes
+        bool allKnown { false };
     };
 
     // View is a struct with a ViewFrustum and LOD parameters
@@ -43,18 +47,27 @@ public:
     // Waypoint is an bookmark in a "path" of waypoints during a traversal.
     class Waypoint {
     public:
-        Waypoint(EntityTreeElementPointer& element);
+        Waypoint(EntityTreeElementPointer& element, uint64_t scanTime);
 
-        void getNextVisibleElementFirstTime(VisibleElement& next, const View& view);
-        void getNextVisibleElementRepeat(VisibleElement& next, const View& view, uint64_t lastTime);
-        void getNextVisibleElementDifferential(VisibleElement& next, const View& view, const View& lastView);
+        void getNextVisibleElementFirstTime(VisibleElement& next, const View& view, const DenseTimestamps& knownSubtrees);
+        void getNextVisibleElementRepeat(VisibleElement& next, const View& view, uint64_t lastTime,
+                                         const DenseTimestamps& knownSubtrees);
+        void getNextVisibleElementDifferential(VisibleElement& next, const View& view, const View& lastView,
+                                               const DenseTimestamps& knownSubtrees);
 
         int8_t getNextIndex() const { return _nextIndex; }
         void initRootNextIndex() { _nextIndex = -1; }
 
+        EntityTreeElementPointer getElement() const { return _weakElement.lock(); }
+        uint64_t getScanTime() const { return _scanTime; }
+        bool isSubtreeKnown() const { return _subtreeKnown; }
+        void setSubtreeUnknown() { _subtreeKnown = false; }
+
     protected:
         EntityTreeElementWeakPointer _weakElement;
+        uint64_t _scanTime;
         int8_t _nextIndex;
+        bool _subtreeKnown { true };
     };
 
     typedef enum { First, Repeat, Differential } Type;
@@ -71,14 +84,21 @@ public:
     void setScanCallback(std::function<void (VisibleElement&)> cb);
     void traverse(uint64_t timeBudget);
 
-    void reset() { _path.clear(); _completedView.startTime = 0; } // resets our state to force a new "First" traversal
+    // resets our state to force a new "First" traversal
+    void reset() { _path.clear(); _completedView.startTime = 0; _knownSubtrees.clear(); }
+
+    size_t getMemoryUsage() const { return _knownSubtrees.getMemoryUsage(); }
 
 private:
     void getNextVisibleElement(VisibleElement& next);
+    void popWaypoint();
 
     View _currentView;
     View _completedView;
     std::vector<Waypoint> _path;
+    // when each subtree was last found to hold nothing the receiver doesn't have, by element dense index
+    DenseTimestamps _knownSubtrees;
+    uint64_t _scanTime { 0 };
     std::function<void (VisibleElement&)> _getNextVisibleElementCallback { nullptr };
     std::function<void (VisibleElement&)> _scanElementCallback { [](VisibleElement& e){} };
 };
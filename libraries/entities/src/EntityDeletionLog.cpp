@@ -0,0 +1,120 @@
+//
+//  EntityDeletionLog.cpp
+//  libraries/entities/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityDeletionLog.h"
+
+#include <algorithm>
+
+#include <NLPacket.h>
+#include <OctreePacketData.h>
+#include <UUID.h>
+
+int EntityDeletionLog::getIDsPerErasePacket() {
+    // flags, sequence number, sent time and the number of IDs, as EntityServer::sendSpecialPackets writes them
+    const int ERASE_HEADER_SIZE = sizeof(OCTREE_PACKET_FLAGS) + sizeof(OCTREE_PACKET_SEQUENCE) +
+        sizeof(OCTREE_PACKET_SENT_TIME) + sizeof(uint16_t);
+    return (NLPacket::maxPayloadSize(PacketType::EntityErase) - ERASE_HEADER_SIZE) / NUM_BYTES_RFC4122_UUID;
+}
+
+EntityDeletionLog::EntityDeletionLog(int idsPerSegment) : _idsPerSegment(std::max(idsPerSegment, 1)) {
+}
+
+int EntityDeletionLog::getNumIDs(const Segment& segment) const {
+    return segment.encodedIDs.size() / NUM_BYTES_RFC4122_UUID;
+}
+
+void EntityDeletionLog::append(const QUuid& entityID) {
+    QByteArray encodedID = entityID.toRfc4122();
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_segments.empty() || getNumIDs(_segments.back()) >= _idsPerSegment) {
+        Segment segment;
+        segment.first = _end;
+        segment.encodedIDs.reserve(_idsPerSegment * NUM_BYTES_RFC4122_UUID);
+        _segments.push_back(segment);
+    }
+    // a sender still holding the bytes of this segment keeps its own copy of them
+    _segments.back().encodedIDs.append(encodedID);
+    ++_end;
+}
+
+EntityDeletionLog::Sequence EntityDeletionLog::getEnd() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _end;
+}
+
+bool EntityDeletionLog::isEmpty() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _segments.empty();
+}
+
+EntityDeletionLog::Sequence EntityDeletionLog::getDeletedSince(Sequence cursor, std::vector<Run>& runs) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (cursor >= _end) {
+        return _end;
+    }
+
+    // the segment holding the cursor, or the first one if it was pruned past it
+    auto segment = std::upper_bound(_segments.begin(), _segments.end(), cursor,
+        [](Sequence sequence, const Segment& segment) { return sequence < segment.first; });
+    if (segment != _segments.begin()) {
+        --segment;
+    }
+    for (; segment != _segments.end(); ++segment) {
+        int skip = cursor > segment->first ? (int)(cursor - segment->first) : 0;
+        int numIDs = getNumIDs(*segment) - skip;
+        if (numIDs > 0) {
+            runs.push_back({ segment->encodedIDs, skip * NUM_BYTES_RFC4122_UUID, numIDs });
+        }
+    }
+    return _end;
+}
+
+EntityDeletionLog::Sequence EntityDeletionLog::addCursor() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    ++_cursors[_end];
+    return _end;
+}
+
+void EntityDeletionLog::moveCursor(Sequence from, Sequence to) {
+    if (from == to) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto cursor = _cursors.find(from);
+    if (cursor != _cursors.end() && --cursor->second == 0) {
+        _cursors.erase(cursor);
+    }
+    ++_cursors[to];
+}
+
+void EntityDeletionLog::removeCursor(Sequence cursor) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto itr = _cursors.find(cursor);
+    if (itr != _cursors.end() && --itr->second == 0) {
+        _cursors.erase(itr);
+    }
+}
+
+EntityDeletionLog::Sequence EntityDeletionLog::getLowestCursorLocked() const {
+    return _cursors.empty() ? _end : _cursors.begin()->first;
+}
+
+EntityDeletionLog::Sequence EntityDeletionLog::getLowestCursor() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return getLowestCursorLocked();
+}
+
+void EntityDeletionLog::prune() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    Sequence lowestCursor = getLowestCursorLocked();
+    while (!_segments.empty() && _segments.front().first + getNumIDs(_segments.front()) <= lowestCursor) {
+        _segments.pop_front();
+    }
+}
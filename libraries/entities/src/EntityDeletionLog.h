@@ -0,0 +1,89 @@
+//
+//  EntityDeletionLog.h
+//  libraries/entities/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntityDeletionLog_h
+#define hifi_EntityDeletionLog_h
+
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QUuid>
+
+//
+// Server-side log of the deleted entities, for the entity server to send their erase packets to every client.
+//
+// Each delete gets the next sequence number, and each client holds a cursor: the sequence number of the first
+// delete it wasn't sent yet. The IDs are kept encoded as they go in an erase packet, in segments of as many as fit
+// in one packet, which every client reads from its cursor on without encoding them again. The segments that every
+// cursor is past are dropped, from the lowest cursor rather than by asking each client where it is.
+//
+class EntityDeletionLog {
+public:
+    using Sequence = uint64_t;
+
+    // The encoded IDs of a segment from one of its deletes on. The bytes are shared with the log, not copied.
+    struct Run {
+        QByteArray encodedIDs;
+        int offset;
+        int numIDs;
+
+        const char* data() const { return encodedIDs.constData() + offset; }
+        int size() const { return encodedIDs.size() - offset; }
+    };
+
+    // As many encoded IDs as fit in an erase packet after its header
+    static int getIDsPerErasePacket();
+
+    EntityDeletionLog() : EntityDeletionLog(getIDsPerErasePacket()) {}
+    explicit EntityDeletionLog(int idsPerSegment);
+
+    void append(const QUuid& entityID);
+
+    // The sequence number the next delete will get
+    Sequence getEnd() const;
+    bool isEmpty() const;
+
+    // Fills runs with the deletes from the cursor on, and returns the cursor to continue from
+    Sequence getDeletedSince(Sequence cursor, std::vector<Run>& runs) const;
+
+    // A cursor starts at the end of the log, and has to be removed when its client goes away
+    Sequence addCursor();
+    void moveCursor(Sequence from, Sequence to);
+    void removeCursor(Sequence cursor);
+    Sequence getLowestCursor() const;
+
+    // Drops the segments every cursor is past, all of them when there are no cursors
+    void prune();
+
+private:
+    struct Segment {
+        Sequence first;
+        QByteArray encodedIDs;
+    };
+
+    int getNumIDs(const Segment& segment) const;
+    Sequence getLowestCursorLocked() const;
+
+    const int _idsPerSegment;
+
+    mutable std::mutex _mutex;
+    std::deque<Segment> _segments;
+    std::map<Sequence, int> _cursors; // the number of clients at each cursor
+    Sequence _end { 0 };
+};
+
+using EntityDeletionLogPointer = std::shared_ptr<EntityDeletionLog>;
+
+#endif // hifi_EntityDeletionLog_h
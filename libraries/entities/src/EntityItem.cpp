@@ -51,8 +51,15 @@ int EntityItem::_maxActionsDataSize = 800;
 quint64 EntityItem::_rememberDeletedActionTime = 20 * USECS_PER_SECOND;
 QString EntityItem::_marketplacePublicKey;
 
+static DenseIndexAllocator& denseIndices() {
+    // never destroyed, entities can outlive static destruction
+    static DenseIndexAllocator* allocator = new DenseIndexAllocator();
+    return *allocator;
+}
+
 EntityItem::EntityItem(const EntityItemID& entityItemID) :
-    SpatiallyNestable(NestableType::Entity, entityItemID)
+    SpatiallyNestable(NestableType::Entity, entityItemID),
+    _denseIndex(denseIndices().allocate())
 {
     setLocalVelocity(ENTITY_ITEM_DEFAULT_VELOCITY);
     setLocalAngularVelocity(ENTITY_ITEM_DEFAULT_ANGULAR_VELOCITY);
@@ -71,6 +78,7 @@ EntityItem::~EntityItem() {
     assert(!_simulated || (!_element && !_physicsInfo));
     assert(!_element);
     assert(!_physicsInfo);
+    denseIndices().release(_denseIndex);
 }
 
 EntityPropertyFlags EntityItem::getEntityProperties(EncodeBitstreamParams& params) const {
@@ -616,6 +624,7 @@ int EntityItem::readEntityDataFromBuffer(const unsigned char* data, int bytesLef
         _lastEdited = lastEditedFromBufferAdjusted;
         _lastEditedFromRemote = now;
         _lastEditedFromRemoteInRemoteTime = lastEditedFromBuffer;
+        _lastSentFromRemoteInRemoteTime = args.packetSentTime;
     }
 
     // last updated is stored as ByteCountCoded delta from lastEdited
@@ -2760,6 +2769,16 @@ void EntityItem::setLastEdited(quint64 lastEdited) {
     }
 }
 
+void EntityItem::restoreRemoteVersion(quint64 lastEditedInRemoteTime, quint64 sentInRemoteTime) {
+    withWriteLock([&] {
+        // no local edit time, so that any data the server sends for this entity is accepted
+        _lastEdited = _lastUpdated = 0;
+        _lastEditedFromRemote = 0;
+        _lastEditedFromRemoteInRemoteTime = lastEditedInRemoteTime;
+        _lastSentFromRemoteInRemoteTime = sentInRemoteTime;
+    });
+}
+
 void EntityItem::markAsChangedOnServer() {
     withWriteLock([&] {
         _changedOnServer = usecTimestampNow();
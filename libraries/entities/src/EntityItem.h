@@ -30,6 +30,7 @@
 #include <SpatiallyNestable.h>
 #include <Interpolate.h>
 
+#include "DenseIndexAllocator.h"
 #include "EntityItemID.h"
 #include "EntityItemPropertiesDefaults.h"
 #include "EntityPropertyFlags.h"
@@ -442,6 +443,9 @@ public:
 
     EntityTreeElementPointer getElement() const { return _element; }
     EntityTreePointer getTree() const;
+
+    // small number unique among the entities alive in this process, reused once the entity is destroyed
+    const DenseIndex& getDenseIndex() const { return _denseIndex; }
     virtual SpatialParentTree* getParentTree() const override;
     bool wantTerseEditLogging() const;
 
@@ -453,6 +457,12 @@ public:
     quint64 getLastEditedFromRemote() const { return _lastEditedFromRemote; }
     void updateLastEditedFromRemote() { _lastEditedFromRemote = usecTimestampNow(); }
 
+    // the server version of the data we hold, used to tell an entity server what a cached copy is based on
+    quint64 getLastEditedFromRemoteInRemoteTime() const { return _lastEditedFromRemoteInRemoteTime; }
+    quint64 getLastSentFromRemoteInRemoteTime() const { return _lastSentFromRemoteInRemoteTime; }
+    bool hasLocalEditsSinceRemote() const { return getLastEdited() > _lastEditedFromRemote; }
+    void restoreRemoteVersion(quint64 lastEditedInRemoteTime, quint64 sentInRemoteTime);
+
     void getTransformAndVelocityProperties(EntityItemProperties& properties) const;
 
     void flagForMotionStateChange() { _flags |= Simulation::DIRTY_MOTION_TYPE; }
@@ -615,6 +625,7 @@ protected:
 
     quint64 _lastEditedFromRemote { 0 }; // last time we received and edit from the server
     quint64 _lastEditedFromRemoteInRemoteTime { 0 }; // last time we received an edit from the server (in server-time-frame)
+    quint64 _lastSentFromRemoteInRemoteTime { 0 }; // when the server sent the data we last accepted (in server-time-frame)
     quint64 _created { 0 };
     quint64 _changedOnServer { 0 };
 
@@ -705,6 +716,8 @@ protected:
     bool _simulated { false }; // set by EntitySimulation
     bool _visuallyReady { true };
 
+    const DenseIndex _denseIndex;
+
     void enableNoBootstrap();
     void disableNoBootstrap();
 
@@ -11,6 +11,25 @@
 
 #include "EntityNodeData.h"
 
+EntityNodeData::EntityNodeData(EntityDeletionLogPointer deletionLog) : _deletionLog(deletionLog) {
+    if (_deletionLog) {
+        _deletedEntitiesCursor = _deletionLog->addCursor();
+    }
+}
+
+EntityNodeData::~EntityNodeData() {
+    if (_deletionLog) {
+        _deletionLog->removeCursor(_deletedEntitiesCursor);
+    }
+}
+
+void EntityNodeData::setDeletedEntitiesCursor(EntityDeletionLog::Sequence cursor) {
+    if (_deletionLog) {
+        _deletionLog->moveCursor(_deletedEntitiesCursor, cursor);
+    }
+    _deletedEntitiesCursor = cursor;
+}
+
 bool EntityNodeData::insertFlaggedExtraEntity(const QUuid& filteredEntityID, const QUuid& extraEntityID) {
     _flaggedExtraEntities[filteredEntityID].insert(extraEntityID);
     return !_previousFlaggedExtraEntities[filteredEntityID].contains(extraEntityID);
@@ -28,3 +47,20 @@ bool EntityNodeData::isEntityFlaggedAsExtra(const QUuid& entityID) const {
 
     return false;
 }
+
+void EntityNodeData::setEntityCacheManifest(EntityTreeCache::Manifest manifest) {
+    std::lock_guard<std::mutex> lock(_entityCacheManifestMutex);
+    _entityCacheManifest = std::move(manifest);
+    _hasEntityCacheManifest = true;
+}
+
+bool EntityNodeData::takeEntityCacheManifest(EntityTreeCache::Manifest& manifest) {
+    std::lock_guard<std::mutex> lock(_entityCacheManifestMutex);
+    if (!_hasEntityCacheManifest) {
+        return false;
+    }
+    manifest = std::move(_entityCacheManifest);
+    _entityCacheManifest.clear();
+    _hasEntityCacheManifest = false;
+    return true;
+}
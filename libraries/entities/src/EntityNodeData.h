@@ -12,10 +12,15 @@
 #ifndef hifi_EntityNodeData_h
 #define hifi_EntityNodeData_h
 
+#include <mutex>
+
 #include <udt/PacketHeaders.h>
 
 #include <OctreeQueryNode.h>
 
+#include "EntityDeletionLog.h"
+#include "EntityTreeCache.h"
+
 namespace EntityJSONQueryProperties {
     static const QString SERVER_SCRIPTS_PROPERTY = "serverScripts";
     static const QString FLAGS_PROPERTY = "flags";
@@ -27,9 +32,16 @@ class EntityNodeData : public OctreeQueryNode {
 public:
     virtual PacketType getMyPacketType() const override { return PacketType::EntityData; }
 
-    quint64 getLastDeletedEntitiesSentAt() const { return _lastDeletedEntitiesSentAt; }
-    void setLastDeletedEntitiesSentAt(quint64 sentAt) { _lastDeletedEntitiesSentAt = sentAt; }
-    
+    EntityNodeData() = default;
+    // the node is sent the entities deleted from now on
+    explicit EntityNodeData(EntityDeletionLogPointer deletionLog);
+    ~EntityNodeData();
+
+    // where the node is in the log of deleted entities, only used from the OctreeSendThread for the given Node
+    const EntityDeletionLogPointer& getDeletionLog() const { return _deletionLog; }
+    EntityDeletionLog::Sequence getDeletedEntitiesCursor() const { return _deletedEntitiesCursor; }
+    void setDeletedEntitiesCursor(EntityDeletionLog::Sequence cursor);
+
     // these can only be called from the OctreeSendThread for the given Node
     void insertSentFilteredEntity(const QUuid& entityID) { _sentFilteredEntities.insert(entityID); }
     void removeSentFilteredEntity(const QUuid& entityID) { _sentFilteredEntities.remove(entityID); }
@@ -44,11 +56,26 @@ public:
     bool isEntityFlaggedAsExtra(const QUuid& entityID) const;
     void resetFlaggedExtraEntities() { _previousFlaggedExtraEntities = _flaggedExtraEntities; _flaggedExtraEntities.clear(); }
 
+    // the manifest of a client's entity cache is set when it arrives and taken by the OctreeSendThread for the node
+    void setEntityCacheManifest(EntityTreeCache::Manifest manifest);
+    bool takeEntityCacheManifest(EntityTreeCache::Manifest& manifest);
+
+    // cached entities the client has to erase because they no longer exist, only used from the OctreeSendThread
+    void addStaleCachedEntities(const QVector<QUuid>& entityIDs) { _staleCachedEntities += entityIDs; }
+    bool hasStaleCachedEntities() const { return !_staleCachedEntities.isEmpty(); }
+    QVector<QUuid> takeStaleCachedEntities() { return std::move(_staleCachedEntities); }
+
 private:
-    quint64 _lastDeletedEntitiesSentAt { usecTimestampNow() };
+    EntityDeletionLogPointer _deletionLog;
+    EntityDeletionLog::Sequence _deletedEntitiesCursor { 0 };
     QSet<QUuid> _sentFilteredEntities;
     QHash<QUuid, QSet<QUuid>> _flaggedExtraEntities;
     QHash<QUuid, QSet<QUuid>> _previousFlaggedExtraEntities;
+
+    std::mutex _entityCacheManifestMutex;
+    EntityTreeCache::Manifest _entityCacheManifest;
+    bool _hasEntityCacheManifest { false };
+    QVector<QUuid> _staleCachedEntities;
 };
 
 #endif // hifi_EntityNodeData_h
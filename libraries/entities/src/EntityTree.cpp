@@ -43,7 +43,6 @@
 #include "EntityEditFilters.h"
 #include "EntityDynamicFactoryInterface.h"
 
-static const quint64 DELETED_ENTITIES_EXTRA_USECS_TO_CONSIDER = USECS_PER_MSEC * 50;
 const float EntityTree::DEFAULT_MAX_TMP_ENTITY_LIFETIME = 60 * 60; // 1 hour
 static const QString DOMAIN_UNLIMITED = "domainUnlimited";
 
@@ -130,6 +129,21 @@ void EntityTree::eraseDomainAndNonOwnedEntities() {
         }
 
         _needsParentFixup = needParentFixup;
+
+        QHash<QUuid, QVector<EntityItemWeakPointer>> waitingForParent;
+        QHash<EntityItemID, QUuid> missingParentIDs;
+        for (auto itr = _waitingForParent.begin(); itr != _waitingForParent.end(); ++itr) {
+            for (const auto& entityItem : itr.value()) {
+                auto entity = entityItem.lock();
+                if (entity && (entity->isLocalEntity() || entity->isMyAvatarEntity()) &&
+                    _missingParentIDs.value(entity->getEntityItemID()) == itr.key()) {
+                    waitingForParent[itr.key()].push_back(entityItem);
+                    missingParentIDs[entity->getEntityItemID()] = itr.key();
+                }
+            }
+        }
+        _waitingForParent.swap(waitingForParent);
+        _missingParentIDs.swap(missingParentIDs);
     }
 }
 
@@ -165,6 +179,8 @@ void EntityTree::eraseAllOctreeElements(bool createNewRoot) {
     {
         QWriteLocker locker(&_needsParentFixupLock);
         _needsParentFixup.clear();
+        _waitingForParent.clear();
+        _missingParentIDs.clear();
     }
 }
 
@@ -307,6 +323,7 @@ void EntityTree::postAddEntity(EntityItemPointer entity) {
     _isDirty = true;
 
     // find and hook up any entities with this entity as a (previously) missing parent
+    notifyParentAdded(entity->getEntityItemID());
     fixupNeedsParentFixups();
 
     emit addingEntity(entity->getEntityItemID());
@@ -746,7 +763,7 @@ void EntityTree::deleteEntitiesByPointer(const std::vector<EntityItemPointer>& e
         if (entity->getElement()) {
             theOperator.addEntityToDeleteList(entity);
             emit deletingEntity(entity->getID());
-            emit deletingEntityPointer(entity.get());
+            emit deletingEntityPointer(entity.get(), entity->getDenseIndex());
         }
     }
 
@@ -759,16 +776,17 @@ void EntityTree::deleteEntitiesByPointer(const std::vector<EntityItemPointer>& e
 
 void EntityTree::processRemovedEntities(const DeleteEntityOperator& theOperator) {
     // NOTE: assume tree already write-locked because this method only called in deleteEntitiesByPointer()
-    quint64 deletedAt = usecTimestampNow();
     const RemovedEntities& entities = theOperator.getEntities();
     foreach(const EntityToDeleteDetails& details, entities) {
         EntityItemPointer theEntity = details.entity;
+        removeFromWaitingForParent(theEntity);
+        // the descendants that outlive it now wait for it rather than for an ancestor above it
+        requeueDescendantsWaitingForParent(theEntity);
         if (getIsServer()) {
             removeCertifiedEntityOnServer(theEntity);
 
             // set up the deleted entities ID
-            QWriteLocker recentlyDeletedEntitiesLocker(&_recentlyDeletedEntitiesLock);
-            _recentlyDeletedEntityItemIDs.insert(deletedAt, theEntity->getEntityItemID());
+            _deletionLog->append(theEntity->getEntityItemID());
         } else {
             theEntity->forEachDescendant([&](SpatiallyNestablePointer child) {
                 if (child->getNestableType() == NestableType::Avatar) {
@@ -1890,8 +1908,7 @@ int EntityTree::processEditPacketData(ReceivedMessage& message, const unsigned c
 
                         // If this was an add, we also want to tell the client that sent this edit that the entity was not added.
                         if (isAdd) {
-                            QWriteLocker locker(&_recentlyDeletedEntitiesLock);
-                            _recentlyDeletedEntityItemIDs.insert(usecTimestampNow(), entityItemID);
+                            _deletionLog->append(entityItemID);
                             validEditPacket = false;
                             wasDeletedBecauseOfClientScript = true;
                         } else {
@@ -1915,8 +1932,7 @@ int EntityTree::processEditPacketData(ReceivedMessage& message, const unsigned c
                             // Make sure we didn't already need to send back a delete because the client script failed
                             // the whitelist check
                             if (!wasDeletedBecauseOfClientScript) {
-                                QWriteLocker locker(&_recentlyDeletedEntitiesLock);
-                                _recentlyDeletedEntityItemIDs.insert(usecTimestampNow(), entityItemID);
+                                _deletionLog->append(entityItemID);
                                 validEditPacket = false;
                             }
                         } else {
@@ -1934,8 +1950,7 @@ int EntityTree::processEditPacketData(ReceivedMessage& message, const unsigned c
 
                 // If this was an add, we also want to tell the client that sent this edit that the entity was not added.
                 if (isAdd) {
-                    QWriteLocker locker(&_recentlyDeletedEntitiesLock);
-                    _recentlyDeletedEntityItemIDs.insert(usecTimestampNow(), entityItemID);
+                    _deletionLog->append(entityItemID);
                     validEditPacket = false;
                 } else {
                     suppressDisallowedPrivateUserData = true;
@@ -2099,8 +2114,7 @@ int EntityTree::processEditPacketData(ReceivedMessage& message, const unsigned c
                         }
                     }
                     if (failedAdd) { // Let client know it failed, so that they don't have an entity that no one else sees.
-                        QWriteLocker locker(&_recentlyDeletedEntitiesLock);
-                        _recentlyDeletedEntityItemIDs.insert(usecTimestampNow(), entityItemID);
+                        _deletionLog->append(entityItemID);
                     }
                 } else {
                     HIFI_FCDEBUG(entities(), "Edit failed. [" << message.getType() <<"] " <<
@@ -2210,6 +2224,7 @@ void EntityTree::fixupNeedsParentFixups() {
         bool doMove = false;
         if (entity->isParentIDValid() && maxAACubeSuccess) { // maxAACubeSuccess of true means all ancestors are known
             iter.remove(); // this entity is all hooked up; we can remove it from the list
+            removeFromWaitingForParent(entity);
             // this entity's parent was previously not known, and now is.  Update its location in the EntityTree...
             doMove = true;
             // the bounds on the render-item may need to be updated, the rigid body in the physics engine may
@@ -2220,6 +2235,8 @@ void EntityTree::fixupNeedsParentFixups() {
             entityChanged(entity);
             entity->locationChanged(true, false);
 
+            // descendants which were waiting for a missing ancestor above this entity may now be all hooked up
+            requeueDescendantsWaitingForParent(entity);
             entity->forEachDescendant([&](SpatiallyNestablePointer object) {
                 if (object->getNestableType() == NestableType::Entity) {
                     EntityItemPointer descendantEntity = std::static_pointer_cast<EntityItem>(object);
@@ -2256,6 +2273,20 @@ void EntityTree::fixupNeedsParentFixups() {
                 _childrenOfAvatars[entity->getParentID()] += entity->getEntityItemID();
                 doMove = true;
                 iter.remove(); // and pull it out of the list
+                removeFromWaitingForParent(entity);
+            } else {
+                // wait for the missing ancestor to be added rather than checking again every update.  When all the
+                // ancestors are known but the entity still can't be placed, it stays in the list to check again.
+                QUuid missingAncestorID = findMissingAncestorID(entity);
+                if (!missingAncestorID.isNull()) {
+                    iter.remove();
+                    QWriteLocker locker(&_needsParentFixupLock);
+                    auto missingParentID = _missingParentIDs.find(entity->getEntityItemID());
+                    if (missingParentID == _missingParentIDs.end() || missingParentID.value() != missingAncestorID) {
+                        _missingParentIDs[entity->getEntityItemID()] = missingAncestorID;
+                        _waitingForParent[missingAncestorID].push_back(entity);
+                    }
+                }
             }
         }
 
@@ -2277,8 +2308,11 @@ void EntityTree::fixupNeedsParentFixups() {
 }
 
 void EntityTree::knowAvatarID(const QUuid& avatarID) {
-    std::lock_guard<std::mutex> lock(_avatarIDsLock);
-    _avatarIDs += avatarID;
+    {
+        std::lock_guard<std::mutex> lock(_avatarIDsLock);
+        _avatarIDs += avatarID;
+    }
+    notifyParentAdded(avatarID);
 }
 
 void EntityTree::forgetAvatarID(const QUuid& avatarID) {
@@ -2318,6 +2352,91 @@ void EntityTree::addToNeedsParentFixupList(EntityItemPointer entity) {
     _needsParentFixup.append(entity);
 }
 
+void EntityTree::notifyParentAdded(const QUuid& parentID) {
+    QWriteLocker locker(&_needsParentFixupLock);
+    auto itr = _waitingForParent.find(parentID);
+    if (itr == _waitingForParent.end()) {
+        return;
+    }
+    for (const auto& entityItem : itr.value()) {
+        auto entity = entityItem.lock();
+        if (!entity) {
+            continue;
+        }
+        // skip the entities which have since been moved to wait for another ancestor
+        auto missingParentID = _missingParentIDs.find(entity->getEntityItemID());
+        if (missingParentID != _missingParentIDs.end() && missingParentID.value() == parentID) {
+            _missingParentIDs.erase(missingParentID);
+            _needsParentFixup.append(entityItem);
+        }
+    }
+    _waitingForParent.erase(itr);
+}
+
+QUuid EntityTree::getWaitingForParentID(const EntityItemID& entityID) const {
+    QReadLocker locker(&_needsParentFixupLock);
+    return _missingParentIDs.value(entityID);
+}
+
+QUuid EntityTree::findMissingAncestorID(const EntityItemPointer& entity) const {
+    // walk up the known ancestors, guarding against parenting loops
+    const int MAX_ANCESTOR_DEPTH = 64;
+    SpatiallyNestablePointer nestable = entity;
+    for (int depth = 0; nestable && depth < MAX_ANCESTOR_DEPTH; depth++) {
+        QUuid parentID = nestable->getParentID();
+        if (parentID.isNull()) {
+            break;
+        }
+        bool success = false;
+        SpatiallyNestablePointer parent = nestable->getParentPointer(success);
+        if (!success) {
+            return parentID;
+        }
+        nestable = parent;
+    }
+    return QUuid();
+}
+
+bool EntityTree::removeFromWaitingForParent(const EntityItemPointer& entity) {
+    QWriteLocker locker(&_needsParentFixupLock);
+    auto missingParentID = _missingParentIDs.find(entity->getEntityItemID());
+    if (missingParentID == _missingParentIDs.end()) {
+        return false;
+    }
+    auto itr = _waitingForParent.find(missingParentID.value());
+    if (itr != _waitingForParent.end()) {
+        auto& waiting = itr.value();
+        for (int i = waiting.size() - 1; i >= 0; i--) {
+            auto waitingEntity = waiting[i].lock();
+            if (!waitingEntity || waitingEntity == entity) {
+                waiting.remove(i);
+            }
+        }
+        if (waiting.empty()) {
+            _waitingForParent.erase(itr);
+        }
+    }
+    _missingParentIDs.erase(missingParentID);
+    return true;
+}
+
+void EntityTree::requeueDescendantsWaitingForParent(const EntityItemPointer& entity) {
+    // the missing ancestor they wait for may no longer be one of theirs, so they get checked again
+    QVector<EntityItemWeakPointer> requeued;
+    entity->forEachDescendant([&](SpatiallyNestablePointer object) {
+        if (object->getNestableType() == NestableType::Entity) {
+            EntityItemPointer descendantEntity = std::static_pointer_cast<EntityItem>(object);
+            if (removeFromWaitingForParent(descendantEntity)) {
+                requeued.push_back(descendantEntity);
+            }
+        }
+    });
+    if (!requeued.empty()) {
+        QWriteLocker locker(&_needsParentFixupLock);
+        _needsParentFixup.append(requeued);
+    }
+}
+
 void EntityTree::preUpdate() {
     withWriteLock([&] {
         fixupNeedsParentFixups();
@@ -2337,61 +2456,6 @@ void EntityTree::update(bool simulate) {
     }
 }
 
-quint64 EntityTree::getAdjustedConsiderSince(quint64 sinceTime) {
-    return (sinceTime - DELETED_ENTITIES_EXTRA_USECS_TO_CONSIDER);
-}
-
-
-bool EntityTree::hasEntitiesDeletedSince(quint64 sinceTime) {
-    quint64 considerEntitiesSince = getAdjustedConsiderSince(sinceTime);
-
-    // we can probably leverage the ordered nature of QMultiMap to do this quickly...
-    bool hasSomethingNewer = false;
-
-    QReadLocker locker(&_recentlyDeletedEntitiesLock);
-    QMultiMap<quint64, QUuid>::const_iterator iterator = _recentlyDeletedEntityItemIDs.constBegin();
-    while (iterator != _recentlyDeletedEntityItemIDs.constEnd()) {
-        if (iterator.key() > considerEntitiesSince) {
-            hasSomethingNewer = true;
-            break; // if we have at least one item, we don't need to keep searching
-        }
-        ++iterator;
-    }
-
-#ifdef EXTRA_ERASE_DEBUGGING
-    if (hasSomethingNewer) {
-        int elapsed = usecTimestampNow() - considerEntitiesSince;
-        int difference = considerEntitiesSince - sinceTime;
-        qCDebug(entities) << "EntityTree::hasEntitiesDeletedSince() sinceTime:" << sinceTime 
-                    << "considerEntitiesSince:" << considerEntitiesSince << "elapsed:" << elapsed << "difference:" << difference;
-    }
-#endif
-
-    return hasSomethingNewer;
-}
-
-// called by the server when it knows all nodes have been sent deleted packets
-void EntityTree::forgetEntitiesDeletedBefore(quint64 sinceTime) {
-    quint64 considerSinceTime = sinceTime - DELETED_ENTITIES_EXTRA_USECS_TO_CONSIDER;
-    QSet<quint64> keysToRemove;
-    QWriteLocker locker(&_recentlyDeletedEntitiesLock);
-    QMultiMap<quint64, QUuid>::iterator iterator = _recentlyDeletedEntityItemIDs.begin();
-
-    // First find all the keys in the map that are older and need to be deleted
-    while (iterator != _recentlyDeletedEntityItemIDs.end()) {
-        if (iterator.key() <= considerSinceTime) {
-            keysToRemove << iterator.key();
-        }
-        ++iterator;
-    }
-
-    // Now run through the keysToRemove and remove them
-    foreach (quint64 value, keysToRemove) {
-        _recentlyDeletedEntityItemIDs.remove(value);
-    }
-}
-
-
 bool EntityTree::shouldEraseEntity(EntityItemID entityID, const SharedNodePointer& sourceNode) {
     EntityItemPointer existingEntity;
 
@@ -19,6 +19,7 @@
 #include <SpatialParentFinder.h>
 
 #include "AddEntityOperator.h"
+#include "EntityDeletionLog.h"
 #include "EntityTreeElement.h"
 #include "DeleteEntityOperator.h"
 #include "MovingEntitiesOperator.h"
@@ -148,20 +149,10 @@ public:
     void addNewlyCreatedHook(NewlyCreatedEntityHook* hook);
     void removeNewlyCreatedHook(NewlyCreatedEntityHook* hook);
 
-    bool hasAnyDeletedEntities() const { 
-        QReadLocker locker(&_recentlyDeletedEntitiesLock);
-        return _recentlyDeletedEntityItemIDs.size() > 0;
-    }
-
-    bool hasEntitiesDeletedSince(quint64 sinceTime);
-    static quint64 getAdjustedConsiderSince(quint64 sinceTime);
-
-    QMultiMap<quint64, QUuid> getRecentlyDeletedEntityIDs() const { 
-        QReadLocker locker(&_recentlyDeletedEntitiesLock);
-        return _recentlyDeletedEntityItemIDs;
-    }
+    bool hasAnyDeletedEntities() const { return !_deletionLog->isEmpty(); }
 
-    void forgetEntitiesDeletedBefore(quint64 sinceTime);
+    // the entities deleted on the server, for every client to be sent their erase packets
+    const EntityDeletionLogPointer& getDeletionLog() const { return _deletionLog; }
 
     int processEraseMessage(ReceivedMessage& message, const SharedNodePointer& sourceNode);
     int processEraseMessageDetails(const QByteArray& buffer, const SharedNodePointer& sourceNode);
@@ -246,6 +237,10 @@ public:
     void removeFromChildrenOfAvatars(EntityItemPointer entity);
 
     void addToNeedsParentFixupList(EntityItemPointer entity);
+    // checks again the entities that were waiting for the entity or avatar with this ID to be known
+    void notifyParentAdded(const QUuid& parentID);
+    // the ID of the missing ancestor the entity waits for, null when it isn't waiting
+    QUuid getWaitingForParentID(const EntityItemID& entityID) const;
 
     void notifyNewCollisionSoundURL(const QString& newCollisionSoundURL, const EntityItemID& entityID);
 
@@ -285,7 +280,8 @@ public:
 
 signals:
     void deletingEntity(const EntityItemID& entityID);
-    void deletingEntityPointer(EntityItem* entityID);
+    // the dense index is passed along for queued receivers, which can't read it from the entity anymore
+    void deletingEntityPointer(EntityItem* entityID, DenseIndex denseIndex);
     void addingEntity(const EntityItemID& entityID);
     void addingEntityPointer(EntityItem* entityID);
     void editingEntityPointer(const EntityItemPointer& entityID);
@@ -311,8 +307,7 @@ protected:
     QReadWriteLock _newlyCreatedHooksLock;
     QVector<NewlyCreatedEntityHook*> _newlyCreatedHooks;
 
-    mutable QReadWriteLock _recentlyDeletedEntitiesLock; /// lock of server side recent deletes
-    QMultiMap<quint64, QUuid> _recentlyDeletedEntityItemIDs; /// server side recent deletes
+    EntityDeletionLogPointer _deletionLog { std::make_shared<EntityDeletionLog>() }; /// server side recent deletes
 
     mutable QReadWriteLock _deletedEntitiesLock; /// lock of client side recent deletes
     QSet<QUuid> _deletedEntityItemIDs; /// client side recent deletes
@@ -362,7 +357,14 @@ protected:
     quint64 _treeResetTime = 0;
 
     void fixupNeedsParentFixups(); // try to hook members of _needsParentFixup to parent instances
-    QVector<EntityItemWeakPointer> _needsParentFixup; // entites with a parentID but no (yet) known parent instance
+    QUuid findMissingAncestorID(const EntityItemPointer& entity) const;
+    bool removeFromWaitingForParent(const EntityItemPointer& entity);
+    void requeueDescendantsWaitingForParent(const EntityItemPointer& entity);
+    QVector<EntityItemWeakPointer> _needsParentFixup; // entites to hook to their parent instance on the next update
+    // entities with a parentID but no (yet) known parent instance, by the ID of the ancestor they wait for, which
+    // puts them back in _needsParentFixup once it is known
+    QHash<QUuid, QVector<EntityItemWeakPointer>> _waitingForParent;
+    QHash<EntityItemID, QUuid> _missingParentIDs; // the ancestor each entity in _waitingForParent waits for
     mutable QReadWriteLock _needsParentFixupLock;
 
     std::mutex _avatarIDsLock;
@@ -0,0 +1,260 @@
+//
+//  EntityTreeCache.cpp
+//  libraries/entities/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityTreeCache.h"
+
+#include <vector>
+
+#include <QtCore/QDataStream>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QSaveFile>
+#include <QtScript/QScriptEngine>
+
+#include <Gzip.h>
+#include <NLPacketList.h>
+#include <NodeList.h>
+#include <PathUtils.h>
+#include <UUID.h>
+#include <VariantMapToScriptValue.h>
+
+#include "EntitiesLogging.h"
+#include "EntityTreeElement.h"
+
+static const QString CACHE_DIRECTORY = "entity-cache/";
+static const QString ENTITIES_KEY = "Entities";
+static const QString VERSIONS_KEY = "Versions";
+static const QString CONTENT_VERSION_KEY = "Version";
+static const int LOAD_BATCH_SIZE = 1000;
+
+static int currentContentVersion() {
+    return (int)versionForPacketType(PacketType::EntityData);
+}
+
+QString EntityTreeCache::getCacheFilePath(const QUuid& domainID) {
+    return PathUtils::getAppLocalDataPath() + CACHE_DIRECTORY + uuidStringWithoutCurlyBraces(domainID) + ".json.gz";
+}
+
+void EntityTreeCache::pruneCacheFiles(const QString& directoryPath, qint64 maxTotalSize) {
+    QDir directory(directoryPath);
+    auto cacheFiles = directory.entryInfoList(QStringList { "*.json.gz" }, QDir::Files, QDir::Time);
+
+    // keep the most recently written ones
+    qint64 totalSize = 0;
+    for (const auto& fileInfo : cacheFiles) {
+        totalSize += fileInfo.size();
+        if (totalSize > maxTotalSize) {
+            qCDebug(entities) << "Removing the entity cache" << fileInfo.fileName() << "to stay under" << maxTotalSize << "bytes";
+            QFile::remove(fileInfo.absoluteFilePath());
+        }
+    }
+}
+
+int EntityTreeCache::save(const EntityTreePointer& tree, const QUuid& domainID) {
+    if (!tree || domainID.isNull()) {
+        return -1;
+    }
+
+    QVariantList entities;
+    QVariantMap versions;
+    QScriptEngine scriptEngine;
+
+    tree->withReadLock([&] {
+        tree->recurseTreeWithOperation([&](const OctreeElementPointer& element, void* extraData) {
+            auto entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
+            entityTreeElement->forEachEntity([&](EntityItemPointer entity) {
+                // only keep entities exactly as the entity server last sent them, anything else would have to be resent anyway
+                if (!entity->isDomainEntity() || entity->getLastSentFromRemoteInRemoteTime() == 0 ||
+                    entity->hasLocalEditsSinceRemote() || entities.size() >= MAX_MANIFEST_ENTRIES) {
+                    return;
+                }
+
+                entities << EntityItemNonDefaultPropertiesToScriptValue(&scriptEngine, entity->getProperties()).toVariant();
+
+                // timestamps are kept as strings since JSON numbers can't hold every quint64
+                versions[entity->getID().toString()] = QVariantList {
+                    QString::number(entity->getLastEditedFromRemoteInRemoteTime()),
+                    QString::number(entity->getLastSentFromRemoteInRemoteTime())
+                };
+            });
+            return true;
+        });
+    });
+
+    QString filePath = getCacheFilePath(domainID);
+    if (entities.isEmpty()) {
+        QFile::remove(filePath);
+        return 0;
+    }
+
+    QVariantMap cache;
+    cache[CONTENT_VERSION_KEY] = currentContentVersion();
+    cache[ENTITIES_KEY] = entities;
+    cache[VERSIONS_KEY] = versions;
+
+    QByteArray compressedData;
+    if (!gzip(QJsonDocument::fromVariant(cache).toJson(QJsonDocument::Compact), compressedData)) {
+        qCWarning(entities) << "Unable to compress the entity cache for domain" << domainID;
+        return -1;
+    }
+
+    QDir().mkpath(QFileInfo(filePath).absolutePath());
+    QSaveFile cacheFile(filePath);
+    if (!cacheFile.open(QIODevice::WriteOnly) || cacheFile.write(compressedData) == -1 || !cacheFile.commit()) {
+        qCWarning(entities) << "Unable to write the entity cache" << filePath << "-" << cacheFile.errorString();
+        return -1;
+    }
+
+    qCDebug(entities) << "Cached" << entities.size() << "entities for domain" << domainID;
+    pruneCacheFiles(QFileInfo(filePath).absolutePath(), MAX_CACHE_SIZE);
+    return entities.size();
+}
+
+int EntityTreeCache::load(const EntityTreePointer& tree, const QUuid& domainID, Manifest& manifest) {
+    manifest.clear();
+    if (!tree || domainID.isNull()) {
+        return 0;
+    }
+
+    QFile cacheFile(getCacheFilePath(domainID));
+    if (!cacheFile.open(QIODevice::ReadOnly)) {
+        return 0;
+    }
+
+    QByteArray jsonData;
+    if (!gunzip(cacheFile.readAll(), jsonData)) {
+        qCWarning(entities) << "Ignoring unreadable entity cache" << cacheFile.fileName();
+        return 0;
+    }
+
+    QVariantMap cache = QJsonDocument::fromJson(jsonData).toVariant().toMap();
+    if (cache[CONTENT_VERSION_KEY].toInt() != currentContentVersion()) {
+        // the entity server will send everything again, and we'll cache it in the current format when we leave
+        qCDebug(entities) << "Ignoring entity cache written by another entity protocol version" << cacheFile.fileName();
+        return 0;
+    }
+
+    QVariantList entities = cache[ENTITIES_KEY].toList();
+    QVariantMap versions = cache[VERSIONS_KEY].toMap();
+    QScriptEngine scriptEngine;
+
+    // convert the properties without the tree lock, that's where nearly all of the time goes, and only take it to add
+    // each batch of entities (batches keep the converted properties we hold at any time bounded)
+    struct CachedEntity {
+        QUuid id;
+        Version version;
+        EntityItemProperties properties;
+    };
+    std::vector<CachedEntity> batch;
+    batch.reserve(LOAD_BATCH_SIZE);
+    auto addBatch = [&] {
+        if (batch.empty()) {
+            return;
+        }
+        tree->withWriteLock([&] {
+            for (const auto& cachedEntity : batch) {
+                if (tree->findEntityByID(cachedEntity.id)) {
+                    continue;
+                }
+
+                // these were sent to us by the entity server, so our own rez permissions don't apply (hence isImport)
+                EntityItemPointer entity = tree->addEntity(EntityItemID(cachedEntity.id), cachedEntity.properties, false, true);
+                if (entity) {
+                    entity->restoreRemoteVersion(cachedEntity.version.lastEdited, cachedEntity.version.sentAt);
+                    manifest[cachedEntity.id] = cachedEntity.version;
+                }
+            }
+        });
+        batch.clear();
+    };
+
+    for (const QVariant& entityVariant : entities) {
+        if (manifest.size() + (int)batch.size() >= MAX_MANIFEST_ENTRIES) {
+            // the entity server wouldn't accept a larger manifest
+            break;
+        }
+        QVariantMap entityMap = entityVariant.toMap();
+        QUuid entityID = QUuid(entityMap["id"].toString());
+        QVariantList versionList = versions[entityID.toString()].toList();
+        if (entityID.isNull() || versionList.size() != 2) {
+            continue;
+        }
+
+        CachedEntity cachedEntity;
+        cachedEntity.id = entityID;
+        cachedEntity.version.lastEdited = versionList[0].toString().toULongLong();
+        cachedEntity.version.sentAt = versionList[1].toString().toULongLong();
+        EntityItemPropertiesFromScriptValueIgnoreReadOnly(variantMapToScriptValue(entityMap, scriptEngine),
+                                                          cachedEntity.properties);
+        cachedEntity.properties.setEntityHostType(entity::HostType::DOMAIN);
+        batch.push_back(std::move(cachedEntity));
+
+        if ((int)batch.size() >= LOAD_BATCH_SIZE) {
+            addBatch();
+        }
+    }
+    addBatch();
+
+    qCDebug(entities) << "Loaded" << manifest.size() << "cached entities for domain" << domainID;
+    return manifest.size();
+}
+
+QByteArray EntityTreeCache::encodeManifest(const Manifest& manifest) {
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+
+    stream << (quint32)manifest.size();
+    for (auto it = manifest.cbegin(); it != manifest.cend(); ++it) {
+        stream.writeRawData(it.key().toRfc4122().constData(), NUM_BYTES_RFC4122_UUID);
+        stream << it.value().lastEdited << it.value().sentAt;
+    }
+
+    return data;
+}
+
+bool EntityTreeCache::decodeManifest(const QByteArray& data, Manifest& manifest) {
+    manifest.clear();
+
+    QDataStream stream(data);
+    quint32 numEntries = 0;
+    stream >> numEntries;
+
+    const int ENTRY_SIZE = NUM_BYTES_RFC4122_UUID + 2 * sizeof(quint64);
+    if (stream.status() != QDataStream::Ok || numEntries > (quint32)MAX_MANIFEST_ENTRIES ||
+        (qint64)numEntries * ENTRY_SIZE > data.size() - (qint64)sizeof(quint32)) {
+        return false;
+    }
+
+    manifest.reserve(numEntries);
+    char idBytes[NUM_BYTES_RFC4122_UUID];
+    for (quint32 i = 0; i < numEntries; ++i) {
+        Version version;
+        stream.readRawData(idBytes, NUM_BYTES_RFC4122_UUID);
+        stream >> version.lastEdited >> version.sentAt;
+        manifest[QUuid::fromRfc4122(QByteArray::fromRawData(idBytes, NUM_BYTES_RFC4122_UUID))] = version;
+    }
+
+    return stream.status() == QDataStream::Ok;
+}
+
+bool EntityTreeCache::sendManifest(const Manifest& manifest) {
+    auto nodeList = DependencyManager::get<NodeList>();
+    SharedNodePointer entityServer = nodeList->soloNodeOfType(NodeType::EntityServer);
+    if (!entityServer || !entityServer->getActiveSocket()) {
+        return false;
+    }
+
+    auto packetList = NLPacketList::create(PacketType::EntityCacheManifest, QByteArray(), true, true);
+    packetList->write(encodeManifest(manifest));
+    nodeList->sendPacketList(std::move(packetList), *entityServer);
+    return true;
+}
@@ -0,0 +1,66 @@
+//
+//  EntityTreeCache.h
+//  libraries/entities/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntityTreeCache_h
+#define hifi_EntityTreeCache_h
+
+#include <QtCore/QByteArray>
+#include <QtCore/QHash>
+#include <QtCore/QString>
+#include <QtCore/QUuid>
+
+#include "EntityTree.h"
+
+//
+// Client-side persistence of the domain entities received from an entity server.
+//
+// When leaving a domain the entities we hold, as last sent by the entity server, are written to a per-domain
+// cache file. When coming back, they are loaded into the tree before the first query and the entity server is sent
+// a manifest of the server versions we have, so that it only sends the entities that changed in the meantime and
+// erases the ones that are gone.
+//
+// Both are bounded: a cache holds at most MAX_MANIFEST_ENTRIES entities, which is as many as the entity server accepts
+// in a manifest, and the least recently written cache files are removed once they add up to more than MAX_CACHE_SIZE.
+//
+class EntityTreeCache {
+public:
+    static const int MAX_MANIFEST_ENTRIES = 100000;
+    static const qint64 MAX_CACHE_SIZE = 256 * 1024 * 1024;
+
+    struct Version {
+        quint64 lastEdited { 0 }; // the server's lastEdited for the cached copy
+        quint64 sentAt { 0 }; // when the server sent the cached copy (in server-time-frame)
+
+        bool operator==(const Version& other) const { return lastEdited == other.lastEdited && sentAt == other.sentAt; }
+    };
+    using Manifest = QHash<QUuid, Version>;
+
+    static QString getCacheFilePath(const QUuid& domainID);
+
+    // Removes the least recently written cache files in the directory until they add up to maxTotalSize at most
+    static void pruneCacheFiles(const QString& directoryPath, qint64 maxTotalSize);
+
+    // Writes the domain entities of the tree that are unchanged since the entity server sent them.
+    // Returns the number of entities written, or -1 if the cache couldn't be written.
+    static int save(const EntityTreePointer& tree, const QUuid& domainID);
+
+    // Adds the cached entities for the domain to the tree and fills the manifest with their versions.
+    // Returns the number of entities added.
+    static int load(const EntityTreePointer& tree, const QUuid& domainID, Manifest& manifest);
+
+    static QByteArray encodeManifest(const Manifest& manifest);
+    // Fails for data that isn't a whole manifest, or a manifest of more than MAX_MANIFEST_ENTRIES entities
+    static bool decodeManifest(const QByteArray& data, Manifest& manifest);
+
+    // Sends the manifest to our entity server, returns false if we don't have one
+    static bool sendManifest(const Manifest& manifest);
+};
+
+#endif // hifi_EntityTreeCache_h
@@ -23,12 +23,19 @@
 #include "EntityTree.h"
 #include "EntityTypes.h"
 
-EntityTreeElement::EntityTreeElement(unsigned char* octalCode) : OctreeElement() {
+static DenseIndexAllocator& denseIndices() {
+    // never destroyed, elements can outlive static destruction
+    static DenseIndexAllocator* allocator = new DenseIndexAllocator();
+    return *allocator;
+}
+
+EntityTreeElement::EntityTreeElement(unsigned char* octalCode) : OctreeElement(), _denseIndex(denseIndices().allocate()) {
     init(octalCode);
 };
 
 EntityTreeElement::~EntityTreeElement() {
     _octreeMemoryUsage -= sizeof(EntityTreeElement);
+    denseIndices().release(_denseIndex);
 }
 
 OctreeElementPointer EntityTreeElement::createNewElement(unsigned char* octalCode) {
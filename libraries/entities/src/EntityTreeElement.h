@@ -171,6 +171,9 @@ public:
     void setTree(EntityTreePointer tree) { _myTree = tree; }
     EntityTreePointer getTree() const { return _myTree; }
 
+    // small number unique among the elements alive in this process, reused once the element is destroyed
+    const DenseIndex& getDenseIndex() const { return _denseIndex; }
+
     void addEntityItem(EntityItemPointer entity);
 
     QUuid evalClosetEntity(const glm::vec3& position, PickFilter searchFilter, float& closestDistanceSquared) const;
@@ -229,6 +232,7 @@ protected:
     virtual void init(unsigned char * octalCode) override;
     EntityTreePointer _myTree;
     EntityItems _entityItems;
+    const DenseIndex _denseIndex;
 };
 
 #endif // hifi_EntityTreeElement_h
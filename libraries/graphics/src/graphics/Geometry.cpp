@@ -26,7 +26,10 @@ Mesh::Mesh(const Mesh& mesh) :
     _vertexBuffer(mesh._vertexBuffer),
     _attributeBuffers(mesh._attributeBuffers),
     _indexBuffer(mesh._indexBuffer),
-    _partBuffer(mesh._partBuffer) {
+    _partBuffer(mesh._partBuffer),
+    _lodIndexBuffer(mesh._lodIndexBuffer),
+    _lodParts(mesh._lodParts),
+    _lodErrors(mesh._lodErrors) {
 }
 
 Mesh::~Mesh() {
@@ -126,6 +129,20 @@ Box Mesh::evalPartBound(int partNum) const {
     return box;
 }
 
+void Mesh::setLODs(const BufferView& lodIndexBuffer, const std::vector<Part>& lodParts, const std::vector<float>& lodErrors) {
+    assert(lodParts.size() == lodErrors.size() * getNumParts());
+    _lodIndexBuffer = lodIndexBuffer;
+    _lodParts = lodParts;
+    _lodErrors = lodErrors;
+}
+
+Mesh::Part Mesh::getLODPart(int lod, int partNum) const {
+    if (lod <= 0 || lod >= getNumLODs()) {
+        return _partBuffer.get<Part>(partNum);
+    }
+    return _lodParts[(lod - 1) * getNumParts() + partNum];
+}
+
 Box Mesh::evalPartsBound(int partStart, int partEnd) const {
     Box totalBound;
     auto part = _partBuffer.cbegin<Part>() + partStart;
@@ -117,6 +117,15 @@ public:
     const BufferView& getPartBuffer() const { return _partBuffer; }
     size_t getNumParts() const { return _partBuffer.getNumElements(); }
 
+    // Simplified levels of detail, indexing the same vertices as the original parts from their own index buffer
+    // Level 0 is the original mesh, part partNum of level lod > 0 is lodParts[(lod - 1) * getNumParts() + partNum]
+    void setLODs(const BufferView& lodIndexBuffer, const std::vector<Part>& lodParts, const std::vector<float>& lodErrors);
+    const BufferView& getLODIndexBuffer() const { return _lodIndexBuffer; }
+    int getNumLODs() const { return (int)_lodErrors.size() + 1; }
+    // geometric error of a level of detail, in mesh units
+    float getLODError(int lod) const { return lod > 0 ? _lodErrors[lod - 1] : 0.0f; }
+    Part getLODPart(int lod, int partNum) const;
+
     // evaluate the bounding box of A part
     Box evalPartBound(int partNum) const;
     // evaluate the bounding boxes of the parts in the range [start, end]
@@ -154,6 +163,10 @@ protected:
 
     BufferView _partBuffer;
 
+    BufferView _lodIndexBuffer;
+    std::vector<Part> _lodParts;
+    std::vector<float> _lodErrors;
+
     void evalVertexFormat();
     void evalVertexStream();
 
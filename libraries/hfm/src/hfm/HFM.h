@@ -156,6 +156,8 @@ public:
     QVector<int> quadTrianglesIndices; // original indices from the FBX mesh of the quad converted as triangles
     QVector<int> triangleIndices; // original indices from the FBX mesh
 
+    QVector<QVector<int>> lodTriangleIndices; // triangle indices of each simplified level of detail, finest first
+
     QString materialID;
 };
 
@@ -250,6 +252,8 @@ public:
 
     QVector<Blendshape> blendshapes;
 
+    QVector<float> lodErrors; // geometric error bound of each simplified level of detail, in mesh units
+
     unsigned int meshIndex; // the order the meshes appeared in the object file
 
     graphics::MeshPointer _mesh;
@@ -41,6 +41,12 @@ class TextureCacheScriptingInterface : public ScriptableResourceCache, public De
      *     <em>Read-only.</em>
      * @property {number} numGlobalQueriesLoading - Total number of global queries loading (across all resource cache managers).
      *     <em>Read-only.</em>
+     * @property {number} globalMemoryUsage - Size in bytes of all resources, in use or cached (across all resource cache
+     *     managers). <em>Read-only.</em>
+     * @property {number} globalMemoryBudget - Size in bytes that the resources of all resource cache managers should fit in.
+     *     When exceeded, the cached resources that are the quickest to load again and have been unused for the longest are
+     *     evicted first, whichever the cache manager, as long as evicting them brings the total under budget.
+     *     <code>0</code>, the default, for no budget.
      *
      * @borrows ResourceCache.getResourceList as getResourceList
      * @borrows ResourceCache.updateTotalSize as updateTotalSize
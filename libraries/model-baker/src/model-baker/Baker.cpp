@@ -20,6 +20,7 @@
 #include "CalculateBlendshapeTangentsTask.h"
 #include "PrepareJointsTask.h"
 #include "BuildDracoMeshTask.h"
+#include "BuildMeshLODsTask.h"
 #include "ParseFlowDataTask.h"
 
 namespace baker {
@@ -75,7 +76,7 @@ namespace baker {
 
     class BuildMeshesTask {
     public:
-        using Input = VaryingSet5<std::vector<hfm::Mesh>, std::vector<graphics::MeshPointer>, NormalsPerMesh, TangentsPerMesh, BlendshapesPerMesh>;
+        using Input = VaryingSet6<std::vector<hfm::Mesh>, std::vector<graphics::MeshPointer>, NormalsPerMesh, TangentsPerMesh, BlendshapesPerMesh, LODsPerMesh>;
         using Output = std::vector<hfm::Mesh>;
         using JobModel = Job::ModelIO<BuildMeshesTask, Input, Output>;
 
@@ -86,6 +87,7 @@ namespace baker {
             auto& normalsPerMeshIn = input.get2();
             auto& tangentsPerMeshIn = input.get3();
             auto& blendshapesPerMeshIn = input.get4();
+            auto& lodsPerMeshIn = input.get5();
 
             auto meshesOut = meshesIn;
             for (int i = 0; i < numMeshes; i++) {
@@ -94,6 +96,15 @@ namespace baker {
                 meshOut.normals = QVector<glm::vec3>::fromStdVector(safeGet(normalsPerMeshIn, i));
                 meshOut.tangents = QVector<glm::vec3>::fromStdVector(safeGet(tangentsPerMeshIn, i));
                 meshOut.blendshapes = QVector<hfm::Blendshape>::fromStdVector(safeGet(blendshapesPerMeshIn, i));
+
+                const auto& lods = safeGet(lodsPerMeshIn, i);
+                meshOut.lodErrors.clear();
+                for (const auto& lod : lods) {
+                    meshOut.lodErrors.push_back(lod.error);
+                    for (int j = 0; j < meshOut.parts.size(); j++) {
+                        meshOut.parts[j].lodTriangleIndices.push_back(QVector<int>::fromStdVector(safeGet(lod.triangleIndicesPerPart, j)));
+                    }
+                }
             }
             output = meshesOut;
         }
@@ -145,8 +156,12 @@ namespace baker {
             const auto calculateBlendshapeTangentsInputs = CalculateBlendshapeTangentsTask::Input(normalsPerBlendshapePerMesh, blendshapesPerMeshIn, meshesIn).asVarying();
             const auto tangentsPerBlendshapePerMesh = model.addJob<CalculateBlendshapeTangentsTask>("CalculateBlendshapeTangents", calculateBlendshapeTangentsInputs);
 
+            // Simplify meshes into levels of detail sharing the original vertices
+            const auto buildMeshLODsInputs = BuildMeshLODsTask::Input(meshesIn, normalsPerMesh).asVarying();
+            const auto lodsPerMesh = model.addJob<BuildMeshLODsTask>("BuildMeshLODs", buildMeshLODsInputs);
+
             // Build the graphics::MeshPointer for each hfm::Mesh
-            const auto buildGraphicsMeshInputs = BuildGraphicsMeshTask::Input(meshesIn, url, meshIndicesToModelNames, normalsPerMesh, tangentsPerMesh).asVarying();
+            const auto buildGraphicsMeshInputs = BuildGraphicsMeshTask::Input(meshesIn, url, meshIndicesToModelNames, normalsPerMesh, tangentsPerMesh, lodsPerMesh).asVarying();
             const auto graphicsMeshes = model.addJob<BuildGraphicsMeshTask>("BuildGraphicsMesh", buildGraphicsMeshInputs);
 
             // Prepare joint information
@@ -177,7 +192,7 @@ namespace baker {
             // Combine the outputs into a new hfm::Model
             const auto buildBlendshapesInputs = BuildBlendshapesTask::Input(blendshapesPerMeshIn, normalsPerBlendshapePerMesh, tangentsPerBlendshapePerMesh).asVarying();
             const auto blendshapesPerMeshOut = model.addJob<BuildBlendshapesTask>("BuildBlendshapes", buildBlendshapesInputs);
-            const auto buildMeshesInputs = BuildMeshesTask::Input(meshesIn, graphicsMeshes, normalsPerMesh, tangentsPerMesh, blendshapesPerMeshOut).asVarying();
+            const auto buildMeshesInputs = BuildMeshesTask::Input(meshesIn, graphicsMeshes, normalsPerMesh, tangentsPerMesh, blendshapesPerMeshOut, lodsPerMesh).asVarying();
             const auto meshesOut = model.addJob<BuildMeshesTask>("BuildMeshes", buildMeshesInputs);
             const auto buildModelInputs = BuildModelTask::Input(hfmModelIn, meshesOut, jointsOut, jointRotationOffsets, jointIndices, flowData).asVarying();
             const auto hfmModelOut = model.addJob<BuildModelTask>("BuildModel", buildModelInputs);
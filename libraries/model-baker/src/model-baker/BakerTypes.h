@@ -36,6 +36,15 @@ namespace baker {
     using TangentsPerBlendshape = std::vector<std::vector<glm::vec3>>;
 
     using MeshIndicesToModelNames = QHash<int, QString>;
+
+    // A simplified level of detail of a mesh, sharing the vertices of the original
+    class MeshLOD {
+    public:
+        float error { 0.0f }; // geometric error bound, in mesh units
+        std::vector<MeshIndices> triangleIndicesPerPart;
+    };
+    using MeshLODs = std::vector<MeshLOD>; // from finest to coarsest
+    using LODsPerMesh = std::vector<MeshLODs>;
 };
 
 #endif // hifi_BakerTypes_h
@@ -27,7 +27,37 @@ glm::vec3 normalizeDirForPacking(const glm::vec3& dir) {
     return dir;
 }
 
-void buildGraphicsMesh(const hfm::Mesh& hfmMesh, graphics::MeshPointer& graphicsMeshPointer, const baker::MeshNormals& meshNormals, const baker::MeshTangents& meshTangentsIn) {
+void buildGraphicsMeshLODs(const baker::MeshLODs& meshLODs, size_t numParts, graphics::Mesh& graphicsMesh) {
+    if (meshLODs.empty()) {
+        return;
+    }
+
+    size_t totalIndices = 0;
+    for (const auto& lod : meshLODs) {
+        for (const auto& triangleIndices : lod.triangleIndicesPerPart) {
+            totalIndices += triangleIndices.size();
+        }
+    }
+
+    std::vector<int> indices;
+    indices.reserve(totalIndices);
+    std::vector<graphics::Mesh::Part> lodParts;
+    std::vector<float> lodErrors;
+    for (const auto& lod : meshLODs) {
+        for (size_t i = 0; i < numParts; i++) {
+            const auto& triangleIndices = baker::safeGet(lod.triangleIndicesPerPart, i);
+            lodParts.emplace_back((graphics::Index)indices.size(), (graphics::Index)triangleIndices.size(), 0, graphics::Mesh::TRIANGLES);
+            indices.insert(indices.end(), triangleIndices.cbegin(), triangleIndices.cend());
+        }
+        lodErrors.push_back(lod.error);
+    }
+
+    auto indexBuffer = std::make_shared<gpu::Buffer>(indices.size() * sizeof(int), (const gpu::Byte*) indices.data());
+    gpu::BufferView indexBufferView(indexBuffer, gpu::Element(gpu::SCALAR, gpu::UINT32, gpu::XYZ));
+    graphicsMesh.setLODs(indexBufferView, lodParts, lodErrors);
+}
+
+void buildGraphicsMesh(const hfm::Mesh& hfmMesh, graphics::MeshPointer& graphicsMeshPointer, const baker::MeshNormals& meshNormals, const baker::MeshTangents& meshTangentsIn, const baker::MeshLODs& meshLODs) {
     auto graphicsMesh = std::make_shared<graphics::Mesh>();
 
     // Fill tangents with a dummy value to force tangents to be present if there are normals
@@ -366,6 +396,8 @@ void buildGraphicsMesh(const hfm::Mesh& hfmMesh, graphics::MeshPointer& graphics
         return;
     }
 
+    buildGraphicsMeshLODs(meshLODs, parts.size(), *graphicsMesh);
+
     graphicsMesh->evalPartBound(0);
 
     graphicsMeshPointer = graphicsMesh;
@@ -377,6 +409,7 @@ void BuildGraphicsMeshTask::run(const baker::BakeContextPointer& context, const
     const auto& meshIndicesToModelNames = input.get2();
     const auto& normalsPerMesh = input.get3();
     const auto& tangentsPerMesh = input.get4();
+    const auto& lodsPerMesh = input.get5();
 
     auto& graphicsMeshes = output;
 
@@ -386,7 +419,7 @@ void BuildGraphicsMeshTask::run(const baker::BakeContextPointer& context, const
         auto& graphicsMesh = graphicsMeshes[i];
         
         // Try to create the graphics::Mesh
-        buildGraphicsMesh(meshes[i], graphicsMesh, baker::safeGet(normalsPerMesh, i), baker::safeGet(tangentsPerMesh, i));
+        buildGraphicsMesh(meshes[i], graphicsMesh, baker::safeGet(normalsPerMesh, i), baker::safeGet(tangentsPerMesh, i), baker::safeGet(lodsPerMesh, i));
 
         // Choose a name for the mesh
         if (graphicsMesh) {
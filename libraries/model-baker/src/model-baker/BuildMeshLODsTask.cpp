@@ -0,0 +1,92 @@
+//
+//  BuildMeshLODsTask.cpp
+//  model-baker/src/model-baker
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BuildMeshLODsTask.h"
+
+#include "ModelBakerLogging.h"
+#include "ModelMath.h"
+#include "MeshSimplifier.h"
+
+// A level that doesn't remove at least this fraction of the previous level's triangles isn't worth its memory
+static const float MIN_LOD_REDUCTION = 0.2f;
+
+void BuildMeshLODsTask::configure(const Config& config) {
+    _settings.maxLODs = config.maxLODs;
+    _settings.minTriangles = config.minTriangles;
+    _settings.reductionRatio = config.reductionRatio;
+    _settings.maxRelativeError = config.maxRelativeError;
+}
+
+baker::MeshLODs BuildMeshLODsTask::buildMeshLODs(const hfm::Mesh& mesh, const baker::MeshNormals& normals, const Settings& settings) {
+    baker::MeshLODs lods;
+
+    std::vector<baker::MeshIndices> triangleIndicesPerPart;
+    size_t numTriangles = 0;
+    for (const auto& part : mesh.parts) {
+        triangleIndicesPerPart.emplace_back();
+        auto& triangleIndices = triangleIndicesPerPart.back();
+        triangleIndices.reserve(part.quadTrianglesIndices.size() + part.triangleIndices.size());
+        triangleIndices.insert(triangleIndices.end(), part.quadTrianglesIndices.cbegin(), part.quadTrianglesIndices.cend());
+        triangleIndices.insert(triangleIndices.end(), part.triangleIndices.cbegin(), part.triangleIndices.cend());
+        numTriangles += triangleIndices.size() / 3;
+    }
+
+    if (numTriangles < (size_t)settings.minTriangles || mesh.vertices.isEmpty()) {
+        return lods;
+    }
+
+    Extents extents;
+    for (const auto& vertex : mesh.vertices) {
+        extents.addPoint(vertex);
+    }
+    const float meshSize = glm::length(extents.size());
+    const float maxError = settings.maxRelativeError * (meshSize > 0.0f ? meshSize : 1.0f);
+
+    baker::MeshSimplifier simplifier(mesh, normals, triangleIndicesPerPart);
+    size_t previousTriangleCount = simplifier.getTriangleCount();
+    for (int level = 0; level < settings.maxLODs; level++) {
+        size_t targetTriangleCount = (size_t)(previousTriangleCount * settings.reductionRatio);
+        if (targetTriangleCount < (size_t)settings.minTriangles / 4) {
+            break;
+        }
+
+        float error = simplifier.simplify(targetTriangleCount, maxError);
+        size_t triangleCount = simplifier.getTriangleCount();
+        if (triangleCount > previousTriangleCount * (1.0f - MIN_LOD_REDUCTION)) {
+            // the error bound or the locked features prevent any meaningful reduction
+            break;
+        }
+
+        baker::MeshLOD lod;
+        lod.error = error;
+        lod.triangleIndicesPerPart = simplifier.getTriangleIndicesPerPart();
+        for (auto& triangleIndices : lod.triangleIndicesPerPart) {
+            baker::optimizeVertexCache(triangleIndices, mesh.vertices.size());
+            baker::optimizeOverdraw(triangleIndices, mesh.vertices);
+        }
+        lods.push_back(lod);
+
+        previousTriangleCount = triangleCount;
+    }
+
+    return lods;
+}
+
+void BuildMeshLODsTask::run(const baker::BakeContextPointer& context, const Input& input, Output& output) {
+    const auto& meshes = input.get0();
+    const auto& normalsPerMesh = input.get1();
+    auto& lodsPerMesh = output;
+
+    lodsPerMesh.clear();
+    lodsPerMesh.reserve(meshes.size());
+    for (size_t i = 0; i < meshes.size(); i++) {
+        lodsPerMesh.push_back(buildMeshLODs(meshes[i], baker::safeGet(normalsPerMesh, i), _settings));
+    }
+}
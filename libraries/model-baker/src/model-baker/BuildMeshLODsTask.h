@@ -0,0 +1,59 @@
+//
+//  BuildMeshLODsTask.h
+//  model-baker/src/model-baker
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_BuildMeshLODsTask_h
+#define hifi_BuildMeshLODsTask_h
+
+#include <hfm/HFM.h>
+
+#include "Engine.h"
+#include "BakerTypes.h"
+
+// Each level of detail targets reductionRatio times the triangles of the previous one,
+// and may deviate from the original surface by at most maxRelativeError times the size of the mesh
+class BuildMeshLODsConfig : public baker::JobConfig {
+    Q_OBJECT
+    Q_PROPERTY(int maxLODs MEMBER maxLODs)
+    Q_PROPERTY(int minTriangles MEMBER minTriangles)
+    Q_PROPERTY(float reductionRatio MEMBER reductionRatio)
+    Q_PROPERTY(float maxRelativeError MEMBER maxRelativeError)
+public:
+    int maxLODs { 3 };
+    int minTriangles { 256 };
+    float reductionRatio { 0.5f };
+    float maxRelativeError { 0.05f };
+};
+
+// Generate simplified levels of detail for each mesh, with the triangles of each level reordered for vertex cache and overdraw
+class BuildMeshLODsTask {
+public:
+    using Config = BuildMeshLODsConfig;
+    using Input = baker::VaryingSet2<std::vector<hfm::Mesh>, baker::NormalsPerMesh>;
+    using Output = baker::LODsPerMesh;
+    using JobModel = baker::Job::ModelIO<BuildMeshLODsTask, Input, Output, Config>;
+
+    class Settings {
+    public:
+        int maxLODs { 3 };
+        int minTriangles { 256 };
+        float reductionRatio { 0.5f };
+        float maxRelativeError { 0.05f };
+    };
+
+    void configure(const Config& config);
+    void run(const baker::BakeContextPointer& context, const Input& input, Output& output);
+
+    static baker::MeshLODs buildMeshLODs(const hfm::Mesh& mesh, const baker::MeshNormals& normals, const Settings& settings);
+
+protected:
+    Settings _settings;
+};
+
+#endif // hifi_BuildMeshLODsTask_h
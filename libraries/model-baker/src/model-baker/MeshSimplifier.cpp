@@ -0,0 +1,557 @@
+//
+//  MeshSimplifier.cpp
+//  model-baker/src/model-baker
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "MeshSimplifier.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include <NumericalConstants.h>
+
+using namespace baker;
+
+// Weights of the attribute terms of the collapse cost, relative to the size of the mesh
+static const float TEXCOORD_ERROR_WEIGHT = 0.25f;
+static const float NORMAL_ERROR_WEIGHT = 0.1f;
+
+// Collapses that rotate a remaining triangle further than this (cosine) are rejected
+static const float MIN_TRIANGLE_NORMAL_DOT = 0.25f;
+
+void MeshSimplifier::Quadric::addPlane(const glm::dvec3& n, double d) {
+    _a[0] += n.x * n.x; _a[1] += n.x * n.y; _a[2] += n.x * n.z; _a[3] += n.x * d;
+    _a[4] += n.y * n.y; _a[5] += n.y * n.z; _a[6] += n.y * d;
+    _a[7] += n.z * n.z; _a[8] += n.z * d;
+    _a[9] += d * d;
+}
+
+MeshSimplifier::Quadric& MeshSimplifier::Quadric::operator+=(const Quadric& other) {
+    for (int i = 0; i < 10; i++) {
+        _a[i] += other._a[i];
+    }
+    return *this;
+}
+
+double MeshSimplifier::Quadric::evaluate(const glm::dvec3& p) const {
+    return _a[0] * p.x * p.x + 2.0 * _a[1] * p.x * p.y + 2.0 * _a[2] * p.x * p.z + 2.0 * _a[3] * p.x
+        + _a[4] * p.y * p.y + 2.0 * _a[5] * p.y * p.z + 2.0 * _a[6] * p.y
+        + _a[7] * p.z * p.z + 2.0 * _a[8] * p.z
+        + _a[9];
+}
+
+MeshSimplifier::MeshSimplifier(const hfm::Mesh& mesh, const MeshNormals& normals, const std::vector<MeshIndices>& triangleIndicesPerPart) {
+    const int numVertices = mesh.vertices.size();
+
+    _positions = mesh.vertices.toStdVector();
+    _normals = normals;
+    _normals.resize(numVertices, glm::vec3(0.0f));
+    _texCoords = mesh.texCoords.toStdVector();
+    _texCoords.resize(numVertices, glm::vec2(0.0f));
+
+    // Only vertices mostly driven by the same joint can be merged, to keep the skinned silhouette
+    _dominantClusters.resize(numVertices, -1);
+    if (numVertices > 0 && !mesh.clusterIndices.empty() && mesh.clusterIndices.size() == mesh.clusterWeights.size()) {
+        const int weightsPerVertex = mesh.clusterIndices.size() / numVertices;
+        for (int i = 0; i < numVertices; i++) {
+            uint16_t maxWeight = 0;
+            for (int j = 0; j < weightsPerVertex; j++) {
+                const int k = i * weightsPerVertex + j;
+                if (mesh.clusterWeights[k] > maxWeight) {
+                    maxWeight = mesh.clusterWeights[k];
+                    _dominantClusters[i] = mesh.clusterIndices[k];
+                }
+            }
+        }
+    }
+
+    _vertexTriangles.resize(numVertices);
+    _quadrics.resize(numVertices);
+    _versions.resize(numVertices, 0);
+    _locked.resize(numVertices, false);
+    _collapsed.resize(numVertices, false);
+
+    _numParts = triangleIndicesPerPart.size();
+    for (int part = 0; part < (int)_numParts; part++) {
+        const auto& indices = triangleIndicesPerPart[part];
+        for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+            Triangle triangle { { indices[i], indices[i + 1], indices[i + 2] }, part };
+            bool valid = true;
+            for (int v : triangle.vertices) {
+                valid &= v >= 0 && v < numVertices;
+            }
+            if (!valid || triangle.vertices[0] == triangle.vertices[1] || triangle.vertices[1] == triangle.vertices[2] ||
+                triangle.vertices[2] == triangle.vertices[0]) {
+                continue;
+            }
+
+            glm::dvec3 p0(_positions[triangle.vertices[0]]);
+            glm::dvec3 p1(_positions[triangle.vertices[1]]);
+            glm::dvec3 p2(_positions[triangle.vertices[2]]);
+            glm::dvec3 normal = glm::cross(p1 - p0, p2 - p0);
+            double length = glm::length(normal);
+            if (length > 0.0) {
+                normal /= length;
+            }
+            Quadric quadric;
+            quadric.addPlane(normal, -glm::dot(normal, p0));
+
+            int triangleIndex = (int)_triangles.size();
+            for (int v : triangle.vertices) {
+                _quadrics[v] += quadric;
+                _vertexTriangles[v].push_back(triangleIndex);
+            }
+            _triangles.push_back(triangle);
+        }
+    }
+    _triangleCount = _triangles.size();
+
+    if (numVertices > 0) {
+        glm::vec3 minimum = _positions[0];
+        glm::vec3 maximum = _positions[0];
+        for (const auto& position : _positions) {
+            minimum = glm::min(minimum, position);
+            maximum = glm::max(maximum, position);
+        }
+        _attributeScale = glm::length(maximum - minimum);
+    }
+
+    lockSharedVertices(mesh);
+
+    for (const auto& triangle : _triangles) {
+        for (int i = 0; i < 3; i++) {
+            pushCollapse(triangle.vertices[i], triangle.vertices[(i + 1) % 3]);
+            pushCollapse(triangle.vertices[(i + 1) % 3], triangle.vertices[i]);
+        }
+    }
+}
+
+void MeshSimplifier::lockSharedVertices(const hfm::Mesh& mesh) {
+    const int numVertices = (int)_positions.size();
+
+    // Attribute seams: split vertices at the same position must stay together
+    std::vector<int> sortedVertices(numVertices);
+    for (int i = 0; i < numVertices; i++) {
+        sortedVertices[i] = i;
+    }
+    auto lessPosition = [this](int a, int b) {
+        const auto& pa = _positions[a];
+        const auto& pb = _positions[b];
+        return pa.x < pb.x || (pa.x == pb.x && (pa.y < pb.y || (pa.y == pb.y && pa.z < pb.z)));
+    };
+    std::sort(sortedVertices.begin(), sortedVertices.end(), lessPosition);
+    for (int i = 1; i < numVertices; i++) {
+        if (_positions[sortedVertices[i]] == _positions[sortedVertices[i - 1]]) {
+            _locked[sortedVertices[i]] = true;
+            _locked[sortedVertices[i - 1]] = true;
+        }
+    }
+
+    // Open borders and part (material) boundaries
+    std::unordered_map<uint64_t, int> edgeCounts;
+    std::vector<int> vertexParts(numVertices, -1);
+    for (const auto& triangle : _triangles) {
+        for (int i = 0; i < 3; i++) {
+            uint32_t a = (uint32_t)triangle.vertices[i];
+            uint32_t b = (uint32_t)triangle.vertices[(i + 1) % 3];
+            edgeCounts[((uint64_t)std::min(a, b) << 32) | std::max(a, b)]++;
+
+            int& vertexPart = vertexParts[a];
+            if (vertexPart == -1) {
+                vertexPart = triangle.part;
+            } else if (vertexPart != triangle.part) {
+                _locked[a] = true;
+            }
+        }
+    }
+    for (const auto& edgeCount : edgeCounts) {
+        if (edgeCount.second == 1) {
+            _locked[(uint32_t)(edgeCount.first >> 32)] = true;
+            _locked[(uint32_t)(edgeCount.first & 0xFFFFFFFF)] = true;
+        }
+    }
+
+    // Blendshape targets keep their own offsets, so they cannot be merged into their neighbors
+    for (const auto& blendshape : mesh.blendshapes) {
+        for (int index : blendshape.indices) {
+            if (index >= 0 && index < numVertices) {
+                _locked[index] = true;
+            }
+        }
+    }
+}
+
+float MeshSimplifier::evalCost(int from, int to) const {
+    Quadric quadric = _quadrics[from];
+    quadric += _quadrics[to];
+    double geometricError = std::max(0.0, quadric.evaluate(glm::dvec3(_positions[to])));
+
+    float normalDeviation = std::max(0.0f, 1.0f - glm::dot(_normals[from], _normals[to]));
+    if (_normals[from] == glm::vec3(0.0f) || _normals[to] == glm::vec3(0.0f)) {
+        normalDeviation = 0.0f;
+    }
+    float attributeError = _attributeScale * (TEXCOORD_ERROR_WEIGHT * glm::distance(_texCoords[from], _texCoords[to]) +
+        NORMAL_ERROR_WEIGHT * normalDeviation);
+
+    return (float)sqrt(geometricError + (double)(attributeError * attributeError));
+}
+
+void MeshSimplifier::pushCollapse(int from, int to) {
+    if (from == to || _locked[from] || _collapsed[from] || _collapsed[to] ||
+        _dominantClusters[from] != _dominantClusters[to]) {
+        return;
+    }
+    _collapses.push({ evalCost(from, to), from, to, _versions[from], _versions[to] });
+}
+
+void MeshSimplifier::pushCollapses(int vertex) {
+    for (int triangleIndex : _vertexTriangles[vertex]) {
+        const auto& triangle = _triangles[triangleIndex];
+        for (int other : triangle.vertices) {
+            if (other != vertex) {
+                pushCollapse(vertex, other);
+                pushCollapse(other, vertex);
+            }
+        }
+    }
+}
+
+bool MeshSimplifier::isCollapseValid(int from, int to) const {
+    for (int triangleIndex : _vertexTriangles[from]) {
+        const auto& triangle = _triangles[triangleIndex];
+        if (triangle.removed) {
+            continue;
+        }
+
+        glm::vec3 oldPositions[3];
+        glm::vec3 newPositions[3];
+        bool containsTarget = false;
+        for (int i = 0; i < 3; i++) {
+            int vertex = triangle.vertices[i];
+            containsTarget |= vertex == to;
+            oldPositions[i] = _positions[vertex];
+            newPositions[i] = _positions[vertex == from ? to : vertex];
+        }
+        if (containsTarget) {
+            // this triangle degenerates and gets removed
+            continue;
+        }
+
+        glm::vec3 oldNormal = glm::cross(oldPositions[1] - oldPositions[0], oldPositions[2] - oldPositions[0]);
+        glm::vec3 newNormal = glm::cross(newPositions[1] - newPositions[0], newPositions[2] - newPositions[0]);
+        float oldLength = glm::length(oldNormal);
+        float newLength = glm::length(newNormal);
+        if (newLength <= EPSILON * oldLength || glm::dot(oldNormal, newNormal) < MIN_TRIANGLE_NORMAL_DOT * oldLength * newLength) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void MeshSimplifier::collapse(int from, int to) {
+    std::vector<int> fromTriangles;
+    fromTriangles.swap(_vertexTriangles[from]);
+
+    auto& toTriangles = _vertexTriangles[to];
+    for (int triangleIndex : fromTriangles) {
+        auto& triangle = _triangles[triangleIndex];
+        if (triangle.removed) {
+            continue;
+        }
+
+        if (triangle.vertices[0] == to || triangle.vertices[1] == to || triangle.vertices[2] == to) {
+            triangle.removed = true;
+            --_triangleCount;
+        } else {
+            for (int& vertex : triangle.vertices) {
+                if (vertex == from) {
+                    vertex = to;
+                }
+            }
+            toTriangles.push_back(triangleIndex);
+        }
+    }
+    toTriangles.erase(std::remove_if(toTriangles.begin(), toTriangles.end(), [this](int triangleIndex) {
+        return _triangles[triangleIndex].removed;
+    }), toTriangles.end());
+
+    _quadrics[to] += _quadrics[from];
+    _collapsed[from] = true;
+    ++_versions[to];
+
+    // the cost of every collapse involving the target changed
+    pushCollapses(to);
+}
+
+float MeshSimplifier::simplify(size_t targetTriangleCount, float maxError) {
+    while (_triangleCount > targetTriangleCount && !_collapses.empty()) {
+        Collapse next = _collapses.top();
+        if (_collapsed[next.from] || _collapsed[next.to] ||
+            next.fromVersion != _versions[next.from] || next.toVersion != _versions[next.to]) {
+            _collapses.pop();
+            continue;
+        }
+        if (next.cost > maxError) {
+            // keep it for the next, coarser, level
+            break;
+        }
+        _collapses.pop();
+
+        if (isCollapseValid(next.from, next.to)) {
+            collapse(next.from, next.to);
+            _error = std::max(_error, next.cost);
+        }
+    }
+    return _error;
+}
+
+std::vector<MeshIndices> MeshSimplifier::getTriangleIndicesPerPart() const {
+    std::vector<MeshIndices> triangleIndicesPerPart(_numParts);
+    for (const auto& triangle : _triangles) {
+        if (!triangle.removed) {
+            auto& indices = triangleIndicesPerPart[triangle.part];
+            indices.insert(indices.end(), triangle.vertices, triangle.vertices + 3);
+        }
+    }
+    return triangleIndicesPerPart;
+}
+
+static const int FORSYTH_CACHE_SIZE = 32;
+
+static float evalForsythScore(int cachePosition, int remainingValence) {
+    if (remainingValence == 0) {
+        return -1.0f;
+    }
+
+    const float LAST_TRIANGLE_SCORE = 0.75f;
+    const float CACHE_DECAY_POWER = 1.5f;
+    const float VALENCE_BOOST_SCALE = 2.0f;
+    const float VALENCE_BOOST_POWER = 0.5f;
+
+    float score = 0.0f;
+    if (cachePosition >= 0) {
+        if (cachePosition < 3) {
+            score = LAST_TRIANGLE_SCORE;
+        } else {
+            float scaler = 1.0f / (FORSYTH_CACHE_SIZE - 3);
+            score = powf(1.0f - (cachePosition - 3) * scaler, CACHE_DECAY_POWER);
+        }
+    }
+    score += VALENCE_BOOST_SCALE * powf((float)remainingValence, -VALENCE_BOOST_POWER);
+    return score;
+}
+
+void baker::optimizeVertexCache(MeshIndices& triangleIndices, size_t numVertices) {
+    const size_t numTriangles = triangleIndices.size() / 3;
+    if (numTriangles < 2) {
+        return;
+    }
+    for (int index : triangleIndices) {
+        if (index < 0 || (size_t)index >= numVertices) {
+            return;
+        }
+    }
+
+    // Vertex to triangle adjacency, the first remainingValence[v] entries of each range are the triangles not emitted yet
+    std::vector<int> adjacencyOffsets(numVertices + 1, 0);
+    for (int index : triangleIndices) {
+        adjacencyOffsets[index + 1]++;
+    }
+    for (size_t v = 0; v < numVertices; v++) {
+        adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+    }
+    std::vector<int> remainingValence(numVertices);
+    for (size_t v = 0; v < numVertices; v++) {
+        remainingValence[v] = adjacencyOffsets[v + 1] - adjacencyOffsets[v];
+    }
+    std::vector<int> adjacency(triangleIndices.size());
+    {
+        std::vector<int> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+        for (size_t t = 0; t < numTriangles; t++) {
+            for (int k = 0; k < 3; k++) {
+                adjacency[fill[triangleIndices[t * 3 + k]]++] = (int)t;
+            }
+        }
+    }
+
+    std::vector<int> cachePositions(numVertices, -1);
+    std::vector<float> vertexScores(numVertices);
+    for (size_t v = 0; v < numVertices; v++) {
+        vertexScores[v] = evalForsythScore(-1, remainingValence[v]);
+    }
+
+    std::vector<float> triangleScores(numTriangles);
+    std::vector<bool> emitted(numTriangles, false);
+    int bestTriangle = 0;
+    for (size_t t = 0; t < numTriangles; t++) {
+        const int* triangle = &triangleIndices[t * 3];
+        triangleScores[t] = vertexScores[triangle[0]] + vertexScores[triangle[1]] + vertexScores[triangle[2]];
+        if (triangleScores[t] > triangleScores[bestTriangle]) {
+            bestTriangle = (int)t;
+        }
+    }
+
+    std::vector<int> cache;
+    std::vector<int> newCache;
+    cache.reserve(FORSYTH_CACHE_SIZE + 3);
+    newCache.reserve(FORSYTH_CACHE_SIZE + 3);
+
+    MeshIndices output;
+    output.reserve(triangleIndices.size());
+    size_t scanCursor = 0;
+
+    for (size_t emittedCount = 0; emittedCount < numTriangles; emittedCount++) {
+        if (bestTriangle < 0) {
+            // nothing useful left around the cache, start again from the next unemitted triangle
+            while (emitted[scanCursor]) {
+                scanCursor++;
+            }
+            bestTriangle = (int)scanCursor;
+        }
+
+        emitted[bestTriangle] = true;
+        const int* triangle = &triangleIndices[bestTriangle * 3];
+
+        newCache.clear();
+        for (int k = 0; k < 3; k++) {
+            int vertex = triangle[k];
+            output.push_back(vertex);
+            newCache.push_back(vertex);
+
+            // remove the emitted triangle from the active adjacency of the vertex
+            int* begin = &adjacency[adjacencyOffsets[vertex]];
+            int* end = begin + remainingValence[vertex];
+            int* found = std::find(begin, end, bestTriangle);
+            if (found != end) {
+                std::swap(*found, *(end - 1));
+                remainingValence[vertex]--;
+            }
+        }
+        for (int vertex : cache) {
+            if (vertex != triangle[0] && vertex != triangle[1] && vertex != triangle[2]) {
+                newCache.push_back(vertex);
+            }
+        }
+
+        for (int i = 0; i < (int)newCache.size(); i++) {
+            int vertex = newCache[i];
+            cachePositions[vertex] = i < FORSYTH_CACHE_SIZE ? i : -1;
+            vertexScores[vertex] = evalForsythScore(cachePositions[vertex], remainingValence[vertex]);
+        }
+
+        bestTriangle = -1;
+        float bestScore = -1.0f;
+        for (int vertex : newCache) {
+            for (int i = 0; i < remainingValence[vertex]; i++) {
+                int t = adjacency[adjacencyOffsets[vertex] + i];
+                const int* candidate = &triangleIndices[t * 3];
+                triangleScores[t] = vertexScores[candidate[0]] + vertexScores[candidate[1]] + vertexScores[candidate[2]];
+                if (triangleScores[t] > bestScore) {
+                    bestScore = triangleScores[t];
+                    bestTriangle = t;
+                }
+            }
+        }
+
+        if ((int)newCache.size() > FORSYTH_CACHE_SIZE) {
+            newCache.resize(FORSYTH_CACHE_SIZE);
+        }
+        cache.swap(newCache);
+    }
+
+    triangleIndices.swap(output);
+}
+
+void baker::optimizeOverdraw(MeshIndices& triangleIndices, const QVector<glm::vec3>& vertices) {
+    // clusters are small enough to sort by facing, but large enough to keep most of the vertex cache benefits
+    const size_t TRIANGLES_PER_CLUSTER = 64;
+
+    const size_t numTriangles = triangleIndices.size() / 3;
+    if (numTriangles <= TRIANGLES_PER_CLUSTER) {
+        return;
+    }
+    for (int index : triangleIndices) {
+        if (index < 0 || index >= vertices.size()) {
+            return;
+        }
+    }
+
+    struct Cluster {
+        size_t start;
+        size_t count;
+        glm::vec3 centroid;
+        glm::vec3 normal;
+        float sortKey;
+    };
+
+    std::vector<Cluster> clusters;
+    glm::vec3 meshCentroid(0.0f);
+    float meshArea = 0.0f;
+    for (size_t start = 0; start < numTriangles; start += TRIANGLES_PER_CLUSTER) {
+        Cluster cluster { start, std::min(TRIANGLES_PER_CLUSTER, numTriangles - start), glm::vec3(0.0f), glm::vec3(0.0f), 0.0f };
+        float clusterArea = 0.0f;
+        for (size_t t = cluster.start; t < cluster.start + cluster.count; t++) {
+            const auto& p0 = vertices[triangleIndices[t * 3]];
+            const auto& p1 = vertices[triangleIndices[t * 3 + 1]];
+            const auto& p2 = vertices[triangleIndices[t * 3 + 2]];
+            glm::vec3 normal = glm::cross(p1 - p0, p2 - p0);
+            float area = glm::length(normal);
+            cluster.centroid += (p0 + p1 + p2) * (area / 3.0f);
+            cluster.normal += normal;
+            clusterArea += area;
+        }
+        meshCentroid += cluster.centroid;
+        meshArea += clusterArea;
+        if (clusterArea > 0.0f) {
+            cluster.centroid /= clusterArea;
+        }
+        clusters.push_back(cluster);
+    }
+    if (meshArea > 0.0f) {
+        meshCentroid /= meshArea;
+    }
+
+    // clusters facing away from the center are the likely occluders, draw them first
+    for (auto& cluster : clusters) {
+        float normalLength = glm::length(cluster.normal);
+        cluster.sortKey = normalLength > 0.0f ? glm::dot(cluster.centroid - meshCentroid, cluster.normal / normalLength) : 0.0f;
+    }
+    std::stable_sort(clusters.begin(), clusters.end(), [](const Cluster& a, const Cluster& b) {
+        return a.sortKey > b.sortKey;
+    });
+
+    MeshIndices output;
+    output.reserve(triangleIndices.size());
+    for (const auto& cluster : clusters) {
+        auto begin = triangleIndices.begin() + cluster.start * 3;
+        output.insert(output.end(), begin, begin + cluster.count * 3);
+    }
+    triangleIndices.swap(output);
+}
+
+float baker::evalCacheMissRatio(const MeshIndices& triangleIndices, size_t numVertices, size_t cacheSize) {
+    const size_t numTriangles = triangleIndices.size() / 3;
+    if (numTriangles == 0) {
+        return 0.0f;
+    }
+
+    // FIFO cache, tracked by the time each vertex entered it
+    std::vector<size_t> insertionTimes(numVertices, 0);
+    size_t time = cacheSize + 1;
+    size_t misses = 0;
+    for (int index : triangleIndices) {
+        if (index < 0 || (size_t)index >= numVertices) {
+            continue;
+        }
+        if (time - insertionTimes[index] > cacheSize) {
+            insertionTimes[index] = time++;
+            misses++;
+        }
+    }
+    return (float)misses / (float)numTriangles;
+}
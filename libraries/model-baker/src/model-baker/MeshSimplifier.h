@@ -0,0 +1,110 @@
+//
+//  MeshSimplifier.h
+//  model-baker/src/model-baker
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_MeshSimplifier_h
+#define hifi_MeshSimplifier_h
+
+#include <functional>
+#include <queue>
+
+#include <hfm/HFM.h>
+
+#include "BakerTypes.h"
+
+namespace baker {
+
+    // Progressive quadric error simplification of the triangles of an hfm::Mesh.
+    // Edges are collapsed onto existing vertices, so the vertex data (including skinning and blendshapes)
+    // can be shared between all the levels of detail and only the index lists change.
+    // Vertices on attribute seams, open borders, part boundaries and blendshapes are never moved,
+    // and collapses are only allowed between vertices bound to the same dominant joint.
+    class MeshSimplifier {
+    public:
+        MeshSimplifier(const hfm::Mesh& mesh, const MeshNormals& normals, const std::vector<MeshIndices>& triangleIndicesPerPart);
+
+        // Collapses edges until at most targetTriangleCount triangles remain, or until the next collapse would
+        // introduce an error greater than maxError (in mesh units).
+        // Successive calls continue from the current state, so a chain of levels of detail is built by lowering the target.
+        // Returns the error bound of the current state.
+        float simplify(size_t targetTriangleCount, float maxError);
+
+        size_t getTriangleCount() const { return _triangleCount; }
+        float getError() const { return _error; }
+        std::vector<MeshIndices> getTriangleIndicesPerPart() const;
+
+    private:
+        class Quadric {
+        public:
+            void addPlane(const glm::dvec3& normal, double distance);
+            Quadric& operator+=(const Quadric& other);
+            double evaluate(const glm::dvec3& point) const;
+
+        private:
+            // upper triangle of the symmetric 4x4 matrix
+            double _a[10] { 0.0 };
+        };
+
+        class Triangle {
+        public:
+            int vertices[3];
+            int part;
+            bool removed { false };
+        };
+
+        class Collapse {
+        public:
+            float cost;
+            int from;
+            int to;
+            uint32_t fromVersion;
+            uint32_t toVersion;
+
+            bool operator>(const Collapse& other) const { return cost > other.cost; }
+        };
+
+        void lockSharedVertices(const hfm::Mesh& mesh);
+        void pushCollapses(int vertex);
+        void pushCollapse(int from, int to);
+        float evalCost(int from, int to) const;
+        bool isCollapseValid(int from, int to) const;
+        void collapse(int from, int to);
+
+        std::vector<glm::vec3> _positions;
+        std::vector<glm::vec3> _normals;
+        std::vector<glm::vec2> _texCoords;
+        std::vector<int> _dominantClusters;
+
+        std::vector<Triangle> _triangles;
+        std::vector<std::vector<int>> _vertexTriangles;
+        std::vector<Quadric> _quadrics;
+        std::vector<uint32_t> _versions;
+        std::vector<bool> _locked;
+        std::vector<bool> _collapsed;
+
+        std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>> _collapses;
+
+        size_t _numParts { 0 };
+        size_t _triangleCount { 0 };
+        float _attributeScale { 1.0f };
+        float _error { 0.0f };
+    };
+
+    // Reorders triangles to improve post-transform vertex cache hit rate (Forsyth's linear-speed algorithm)
+    void optimizeVertexCache(MeshIndices& triangleIndices, size_t numVertices);
+
+    // Reorders clusters of triangles so that outward facing geometry is drawn first, reducing overdraw
+    // while mostly keeping the vertex cache locality of the input order
+    void optimizeOverdraw(MeshIndices& triangleIndices, const QVector<glm::vec3>& vertices);
+
+    // Average number of vertex shader invocations per triangle for a FIFO cache of the given size
+    float evalCacheMissRatio(const MeshIndices& triangleIndices, size_t numVertices, size_t cacheSize = 16);
+};
+
+#endif // hifi_MeshSimplifier_h
@@ -15,6 +15,7 @@
 
 #include <gpu/Batch.h>
 #include <gpu/Stream.h>
+#include <graphics/BufferViewHelpers.h>
 
 #include <QThreadPool>
 
@@ -317,6 +318,10 @@ void GeometryResource::setExtra(void* extra) {
 }
 
 void GeometryResource::setGeometryDefinition(HFMModel::Pointer hfmModel, const MaterialMapping& materialMapping) {
+    // The graphics meshes hold everything needed to render, keep only what the CPU side still uses
+    auto modelCache = qobject_cast<ModelCache*>(_cache.data());
+    trimMeshAttributes(*hfmModel, modelCache ? modelCache->getResidentMeshAttributes() : Geometry::ALL_MESH_ATTRIBUTES);
+
     // Assume ownership of the processed HFMModel
     _hfmModel = hfmModel;
     _materialMapping = materialMapping;
@@ -348,6 +353,32 @@ void GeometryResource::setGeometryDefinition(HFMModel::Pointer hfmModel, const M
     finishedLoading(true);
 }
 
+void GeometryResource::trimMeshAttributes(HFMModel& hfmModel, MeshAttributes residentAttributes) {
+    for (HFMMesh& mesh : hfmModel.meshes) {
+        if (!mesh._mesh) {
+            // the graphics mesh couldn't be built, so there's nothing to read the attributes back from
+            continue;
+        }
+        if (!(residentAttributes & NORMALS)) {
+            mesh.normals = QVector<glm::vec3>();
+        }
+        if (!(residentAttributes & COLORS)) {
+            mesh.colors = QVector<glm::vec3>();
+        }
+        if (!(residentAttributes & TEXCOORDS)) {
+            mesh.texCoords = QVector<glm::vec2>();
+            mesh.texCoords1 = QVector<glm::vec2>();
+        }
+        if (!(residentAttributes & SKINNING)) {
+            mesh.clusterIndices = QVector<uint16_t>();
+            mesh.clusterWeights = QVector<uint16_t>();
+        }
+        if (!(residentAttributes & ORIGINAL_INDICES)) {
+            mesh.originalIndices = QVector<int>();
+        }
+    }
+}
+
 void GeometryResource::deleter() {
     resetTextures();
     Resource::deleter();
@@ -410,6 +441,32 @@ GeometryResource::Pointer ModelCache::getCollisionGeometryResource(const QUrl& u
     return resource;
 }
 
+QVector<glm::vec3> Geometry::getMeshNormals(int meshIndex) const {
+    const HFMMesh& mesh = _hfmModel->meshes.at(meshIndex);
+    if (!mesh.normals.isEmpty() || !mesh._mesh) {
+        return mesh.normals;
+    }
+    return buffer_helpers::mesh::attributeToVector<glm::vec3>(mesh._mesh, gpu::Stream::NORMAL);
+}
+
+QVector<glm::vec3> Geometry::getMeshColors(int meshIndex) const {
+    const HFMMesh& mesh = _hfmModel->meshes.at(meshIndex);
+    if (!mesh.colors.isEmpty() || !mesh._mesh) {
+        return mesh.colors;
+    }
+    return buffer_helpers::mesh::attributeToVector<glm::vec3>(mesh._mesh, gpu::Stream::COLOR);
+}
+
+QVector<glm::vec2> Geometry::getMeshTexCoords(int meshIndex, int channel) const {
+    const HFMMesh& mesh = _hfmModel->meshes.at(meshIndex);
+    const auto& texCoords = (channel == 0) ? mesh.texCoords : mesh.texCoords1;
+    if (!texCoords.isEmpty() || !mesh._mesh) {
+        return texCoords;
+    }
+    return buffer_helpers::mesh::attributeToVector<glm::vec2>(mesh._mesh,
+        (channel == 0) ? gpu::Stream::TEXCOORD0 : gpu::Stream::TEXCOORD1);
+}
+
 const QVariantMap Geometry::getTextures() const {
     QVariantMap textures;
     for (const auto& material : _materials) {
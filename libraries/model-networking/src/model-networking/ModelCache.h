@@ -43,6 +43,21 @@ public:
     // Mutable, but must retain structure of vector
     using NetworkMaterials = std::vector<std::shared_ptr<NetworkMaterial>>;
 
+    // Vertex attributes of the HFM meshes that only the graphics meshes need. Once those are built, the attributes
+    // that no consumer declared through ModelCache::setResidentMeshAttributes are dropped from the HFMModel.
+    // Positions, indices, tangents and blendshapes, which picking, collision shapes and blending rely on, always stay.
+    enum MeshAttribute {
+        NORMALS = 0x01,
+        COLORS = 0x02,
+        TEXCOORDS = 0x04,
+        SKINNING = 0x08,
+        ORIGINAL_INDICES = 0x10,
+
+        NO_MESH_ATTRIBUTES = 0x00,
+        ALL_MESH_ATTRIBUTES = 0x1F
+    };
+    using MeshAttributes = int;
+
     bool isHFMModelLoaded() const { return (bool)_hfmModel; }
 
     const HFMModel& getHFMModel() const { return *_hfmModel; }
@@ -51,6 +66,11 @@ public:
     const GeometryMeshes& getMeshes() const { return *_meshes; }
     const std::shared_ptr<NetworkMaterial> getShapeMaterial(int shapeID) const;
 
+    // Read a vertex attribute of an HFM mesh, from the HFMModel when resident or else back from the graphics mesh
+    QVector<glm::vec3> getMeshNormals(int meshIndex) const;
+    QVector<glm::vec3> getMeshColors(int meshIndex) const;
+    QVector<glm::vec2> getMeshTexCoords(int meshIndex, int channel = 0) const;
+
     const QVariantMap getTextures() const;
     void setTextures(const QVariantMap& textureMap);
 
@@ -101,6 +121,9 @@ protected:
 
     Q_INVOKABLE void setGeometryDefinition(HFMModel::Pointer hfmModel, const MaterialMapping& materialMapping);
 
+    // Drops the mesh attributes the graphics meshes have been built from, except the declared ones
+    static void trimMeshAttributes(HFMModel& hfmModel, MeshAttributes residentAttributes);
+
     // Geometries may not hold onto textures while cached - that is for the texture cache
     // Instead, these methods clear and reset textures from the geometry when caching/loading
     bool shouldSetTextures() const { return _hfmModel && _materials.empty(); }
@@ -168,6 +191,11 @@ public:
                                                                  GeometryMappingPair(QUrl(), QVariantHash()),
                                                            const QUrl& textureBaseUrl = QUrl());
 
+    // Declares the mesh attributes that must stay resident in the HFMModel of the geometries loaded from now on,
+    // on top of the ones that always stay (see Geometry::MeshAttribute)
+    void setResidentMeshAttributes(Geometry::MeshAttributes attributes) { _residentMeshAttributes = attributes; }
+    Geometry::MeshAttributes getResidentMeshAttributes() const { return _residentMeshAttributes; }
+
 protected:
     friend class GeometryResource;
 
@@ -178,6 +206,7 @@ private:
     ModelCache();
     virtual ~ModelCache() = default;
     ModelLoader _modelLoader;
+    std::atomic<Geometry::MeshAttributes> _residentMeshAttributes { Geometry::NO_MESH_ATTRIBUTES };
 };
 
 class MeshPart {
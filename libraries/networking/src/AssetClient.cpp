@@ -378,6 +378,14 @@ GetAllMappingsRequest* AssetClient::createGetAllMappingsRequest() {
     return request;
 }
 
+GetMappingChangesRequest* AssetClient::createGetMappingChangesRequest(const QUuid& historyID, uint64_t sinceVersion) {
+    auto request = new GetMappingChangesRequest(historyID, sinceVersion);
+
+    request->moveToThread(thread());
+
+    return request;
+}
+
 DeleteMappingsRequest* AssetClient::createDeleteMappingsRequest(const AssetUtils::AssetPathList& paths) {
     auto request = new DeleteMappingsRequest(paths);
 
@@ -726,6 +734,34 @@ MessageID AssetClient::getAllAssetMappings(MappingOperationCallback callback) {
     return INVALID_MESSAGE_ID;
 }
 
+MessageID AssetClient::getAssetMappingChanges(const QUuid& historyID, uint64_t sinceVersion, MappingOperationCallback callback) {
+    Q_ASSERT(QThread::currentThread() == thread());
+
+    auto nodeList = DependencyManager::get<LimitedNodeList>();
+    SharedNodePointer assetServer = nodeList->soloNodeOfType(NodeType::AssetServer);
+
+    if (assetServer) {
+        auto packetList = NLPacketList::create(PacketType::AssetMappingOperation, QByteArray(), true, true);
+
+        auto messageID = ++_currentID;
+        packetList->writePrimitive(messageID);
+
+        packetList->writePrimitive(AssetUtils::AssetMappingOperationType::GetChanges);
+
+        packetList->write(historyID.toRfc4122());
+        packetList->writePrimitive(sinceVersion);
+
+        if (nodeList->sendPacketList(std::move(packetList), *assetServer) != -1) {
+            _pendingMappingRequests[assetServer][messageID] = callback;
+
+            return messageID;
+        }
+    }
+
+    callback(false, AssetUtils::AssetServerError::NoError, QSharedPointer<ReceivedMessage>());
+    return INVALID_MESSAGE_ID;
+}
+
 MessageID AssetClient::deleteAssetMappings(const AssetUtils::AssetPathList& paths, MappingOperationCallback callback) {
     auto nodeList = DependencyManager::get<LimitedNodeList>();
     SharedNodePointer assetServer = nodeList->soloNodeOfType(NodeType::AssetServer);
@@ -905,17 +941,12 @@ MessageID AssetClient::uploadAsset(const QByteArray& data, UploadResultCallback
     SharedNodePointer assetServer = nodeList->soloNodeOfType(NodeType::AssetServer);
 
     if (assetServer) {
-        auto packetList = NLPacketList::create(PacketType::AssetUpload, QByteArray(), true, true);
-
         auto messageID = ++_currentID;
-        packetList->writePrimitive(messageID);
+        PendingUpload upload { data, AssetUtils::hashData(data), callback };
 
-        uint64_t size = data.length();
-        packetList->writePrimitive(size);
-        packetList->write(data.constData(), size);
-
-        if (nodeList->sendPacketList(std::move(packetList), *assetServer) != -1) {
-            _pendingUploads[assetServer][messageID] = callback;
+        // the asset server tells us where to start from, if anything has to be sent at all
+        if (sendUploadMessage(assetServer, messageID, upload, AssetUtils::UploadBegin)) {
+            _pendingUploads[assetServer][messageID] = upload;
 
             return messageID;
         }
@@ -925,6 +956,27 @@ MessageID AssetClient::uploadAsset(const QByteArray& data, UploadResultCallback
     return INVALID_MESSAGE_ID;
 }
 
+bool AssetClient::sendUploadMessage(const SharedNodePointer& assetServer, MessageID messageID, const PendingUpload& upload,
+                                    AssetUtils::AssetUploadOperation operation, uint64_t offset) {
+    auto nodeList = DependencyManager::get<LimitedNodeList>();
+    auto packetList = NLPacketList::create(PacketType::AssetUpload, QByteArray(), true, true);
+
+    packetList->writePrimitive(messageID);
+    packetList->writePrimitive(operation);
+    packetList->write(upload.hash);
+
+    uint64_t size = upload.data.length();
+    packetList->writePrimitive(size);
+
+    if (operation == AssetUtils::UploadChunk) {
+        uint64_t chunkSize = std::min(size - offset, AssetUtils::UPLOAD_CHUNK_SIZE);
+        packetList->writePrimitive(offset);
+        packetList->write(upload.data.constData() + offset, chunkSize);
+    }
+
+    return nodeList->sendPacketList(std::move(packetList), *assetServer) != -1;
+}
+
 void AssetClient::handleAssetUploadReply(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
     Q_ASSERT(QThread::currentThread() == thread());
 
@@ -934,34 +986,46 @@ void AssetClient::handleAssetUploadReply(QSharedPointer<ReceivedMessage> message
     AssetUtils::AssetServerError error;
     message->readPrimitive(&error);
 
-    QString hashString;
+    // Check if we have any pending requests for this node
+    auto messageMapIt = _pendingUploads.find(senderNode);
+    if (messageMapIt == _pendingUploads.end()) {
+        return;
+    }
+
+    // Found the node, get the MessageID -> PendingUpload map
+    // Although the map may end up empty, we won't delete the node until we have disconnected from
+    // it to avoid constantly creating/deleting the map on subsequent requests.
+    auto& uploads = messageMapIt->second;
+    auto requestIt = uploads.find(messageID);
+    if (requestIt == uploads.end()) {
+        return;
+    }
 
     if (error) {
         qCWarning(asset_client) << "Error uploading file to asset server";
-    } else {
-        auto hash = message->read(AssetUtils::SHA256_HASH_LENGTH);
-        hashString = hash.toHex();
 
-        qCDebug(asset_client) << "Successfully uploaded asset to asset-server - SHA256 hash is " << hashString;
+        auto callback = requestIt->second.callback;
+        uploads.erase(requestIt);
+        callback(true, error, QString());
+        return;
     }
 
-    // Check if we have any pending requests for this node
-    auto messageMapIt = _pendingUploads.find(senderNode);
-    if (messageMapIt != _pendingUploads.end()) {
-
-        // Found the node, get the MessageID -> Callback map
-        auto& messageCallbackMap = messageMapIt->second;
+    auto hash = message->read(AssetUtils::SHA256_HASH_LENGTH);
+    uint64_t offset;
+    message->readPrimitive(&offset);
 
-        // Check if we have this pending request
-        auto requestIt = messageCallbackMap.find(messageID);
-        if (requestIt != messageCallbackMap.end()) {
-            auto callback = requestIt->second;
-            callback(true, error, hashString);
-            messageCallbackMap.erase(requestIt);
-        }
+    const auto& upload = requestIt->second;
+    if (offset >= (uint64_t)upload.data.length()) {
+        QString hashString = hash.toHex();
+        qCDebug(asset_client) << "Successfully uploaded asset to asset-server - SHA256 hash is " << hashString;
 
-        // Although the messageCallbackMap may now be empty, we won't delete the node until we have disconnected from
-        // it to avoid constantly creating/deleting the map on subsequent requests.
+        auto callback = upload.callback;
+        uploads.erase(requestIt);
+        callback(true, AssetUtils::AssetServerError::NoError, hashString);
+    } else if (!sendUploadMessage(senderNode, messageID, upload, AssetUtils::UploadChunk, offset)) {
+        auto callback = upload.callback;
+        uploads.erase(requestIt);
+        callback(false, AssetUtils::AssetServerError::NoError, QString());
     }
 }
 
@@ -978,7 +1042,7 @@ void AssetClient::handleNodeKilled(SharedNodePointer node) {
         auto messageMapIt = _pendingUploads.find(node);
         if (messageMapIt != _pendingUploads.end()) {
             for (const auto& value : messageMapIt->second) {
-                value.second(false, AssetUtils::AssetServerError::NoError, "");
+                value.second.callback(false, AssetUtils::AssetServerError::NoError, "");
             }
             messageMapIt->second.clear();
         }
@@ -993,9 +1057,24 @@ void AssetClient::handleNodeClientConnectionReset(SharedNodePointer node) {
         return;
     }
 
-    qCDebug(asset_client) << "AssetClient detected client connection reset handshake with Asset Server - failing any pending requests";
+    qCDebug(asset_client) << "AssetClient detected client connection reset handshake with Asset Server - failing any pending requests and resuming uploads";
 
     forceFailureOfPendingRequests(node);
+
+    // uploads pick up from what the asset server kept of them
+    auto messageMapIt = _pendingUploads.find(node);
+    if (messageMapIt != _pendingUploads.end()) {
+        auto& uploads = messageMapIt->second;
+        for (auto it = uploads.begin(); it != uploads.end();) {
+            if (sendUploadMessage(node, it->first, it->second, AssetUtils::UploadBegin)) {
+                ++it;
+            } else {
+                auto callback = it->second.callback;
+                it = uploads.erase(it);
+                callback(false, AssetUtils::AssetServerError::NoError, QString());
+            }
+        }
+    }
 }
 
 void AssetClient::forceFailureOfPendingRequests(SharedNodePointer node) {
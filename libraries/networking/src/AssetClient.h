@@ -31,6 +31,7 @@
 class GetMappingRequest;
 class SetMappingRequest;
 class GetAllMappingsRequest;
+class GetMappingChangesRequest;
 class DeleteMappingsRequest;
 class RenameMappingRequest;
 class SetBakingEnabledRequest;
@@ -55,6 +56,7 @@ public:
 
     Q_INVOKABLE GetMappingRequest* createGetMappingRequest(const AssetUtils::AssetPath& path);
     Q_INVOKABLE GetAllMappingsRequest* createGetAllMappingsRequest();
+    Q_INVOKABLE GetMappingChangesRequest* createGetMappingChangesRequest(const QUuid& historyID, uint64_t sinceVersion);
     Q_INVOKABLE DeleteMappingsRequest* createDeleteMappingsRequest(const AssetUtils::AssetPathList& paths);
     Q_INVOKABLE SetMappingRequest* createSetMappingRequest(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& hash);
     Q_INVOKABLE RenameMappingRequest* createRenameMappingRequest(const AssetUtils::AssetPath& oldPath, const AssetUtils::AssetPath& newPath);
@@ -85,6 +87,7 @@ private slots:
 private:
     MessageID getAssetMapping(const AssetUtils::AssetHash& hash, MappingOperationCallback callback);
     MessageID getAllAssetMappings(MappingOperationCallback callback);
+    MessageID getAssetMappingChanges(const QUuid& historyID, uint64_t sinceVersion, MappingOperationCallback callback);
     MessageID setAssetMapping(const QString& path, const AssetUtils::AssetHash& hash, MappingOperationCallback callback);
     MessageID deleteAssetMappings(const AssetUtils::AssetPathList& paths, MappingOperationCallback callback);
     MessageID renameAssetMapping(const AssetUtils::AssetPath& oldPath, const AssetUtils::AssetPath& newPath, MappingOperationCallback callback);
@@ -105,6 +108,14 @@ private:
 
     void forceFailureOfPendingRequests(SharedNodePointer node);
 
+    struct PendingUpload {
+        QByteArray data;
+        QByteArray hash;
+        UploadResultCallback callback;
+    };
+    bool sendUploadMessage(const SharedNodePointer& assetServer, MessageID messageID, const PendingUpload& upload,
+                           AssetUtils::AssetUploadOperation operation, uint64_t offset = 0);
+
     struct GetAssetRequestData {
         QSharedPointer<ReceivedMessage> message;
         ReceivedAssetCallback completeCallback;
@@ -115,7 +126,7 @@ private:
     std::unordered_map<SharedNodePointer, std::unordered_map<MessageID, MappingOperationCallback>> _pendingMappingRequests;
     std::unordered_map<SharedNodePointer, std::unordered_map<MessageID, GetAssetRequestData>> _pendingRequests;
     std::unordered_map<SharedNodePointer, std::unordered_map<MessageID, GetInfoCallback>> _pendingInfoRequests;
-    std::unordered_map<SharedNodePointer, std::unordered_map<MessageID, UploadResultCallback>> _pendingUploads;
+    std::unordered_map<SharedNodePointer, std::unordered_map<MessageID, PendingUpload>> _pendingUploads;
 
     QString _cacheDir;
 
@@ -124,6 +135,7 @@ private:
     friend class MappingRequest;
     friend class GetMappingRequest;
     friend class GetAllMappingsRequest;
+    friend class GetMappingChangesRequest;
     friend class SetMappingRequest;
     friend class DeleteMappingsRequest;
     friend class RenameMappingRequest;
@@ -30,6 +30,7 @@ using AssetPathList = QStringList;
 const size_t SHA256_HASH_LENGTH = 32;
 const size_t SHA256_HASH_HEX_LENGTH = 64;
 const uint64_t MAX_UPLOAD_SIZE = 1000 * 1000 * 1000; // 1GB
+const uint64_t UPLOAD_CHUNK_SIZE = 1024 * 1024; // 1MB
 
 const QString ASSET_FILE_PATH_REGEX_STRING = "^(\\/[^\\/\\0]+)+$";
 const QString ASSET_PATH_REGEX_STRING = "^\\/([^\\/\\0]+(\\/)?)+$";
@@ -49,13 +50,22 @@ enum AssetServerError : uint8_t {
     LostConnection
 };
 
+// Uploads start with the hash and size of the file, the asset server then replies with the offset to send from:
+// the size of the file if it already has it, or what it kept of a previous attempt. The data is then sent in
+// chunks of at most UPLOAD_CHUNK_SIZE, each one replied to with the offset to continue from.
+enum AssetUploadOperation : uint8_t {
+    UploadBegin = 0,
+    UploadChunk
+};
+
 enum AssetMappingOperationType : uint8_t {
     Get = 0,
     GetAll,
     Set,
     Delete,
     Rename,
-    SetBakingEnabled
+    SetBakingEnabled,
+    GetChanges
 };
 
 enum BakingStatus {
@@ -88,6 +88,30 @@ void DomainHandler::disconnect(QString reason) {
     setIsConnected(false);
 }
 
+static QString sessionTicketKey(const QUrl& domainURL, quint16 port) {
+    return domainURL.host() + ":" + QString::number(port);
+}
+
+QUuid DomainHandler::getSessionTicket() const {
+    if (_domainURL.host().isEmpty()) {
+        return QUuid();
+    }
+    return _sessionTickets.get().value(sessionTicketKey(_domainURL, getPort())).toUuid();
+}
+
+void DomainHandler::setSessionTicket(const QUuid& sessionTicket) {
+    if (_domainURL.host().isEmpty()) {
+        return;
+    }
+
+    auto sessionTickets = _sessionTickets.get();
+    auto key = sessionTicketKey(_domainURL, getPort());
+    if (sessionTickets.value(key).toUuid() != sessionTicket) {
+        sessionTickets[key] = sessionTicket;
+        _sessionTickets.set(sessionTickets);
+    }
+}
+
 void DomainHandler::sendDisconnectPacket() {
     // The DomainDisconnect packet is not verified - we're relying on the eventual addition of DTLS to the
     // domain-server connection to stop greifing here
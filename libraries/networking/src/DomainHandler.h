@@ -118,6 +118,10 @@ public:
     const QUuid& getConnectionToken() const { return _connectionToken; }
     void setConnectionToken(const QUuid& connectionToken) { _connectionToken = connectionToken; }
 
+    // Ticket issued by the current domain that lets us resume our session after a reconnect, kept across restarts
+    QUuid getSessionTicket() const;
+    void setSessionTicket(const QUuid& sessionTicket);
+
     const QUuid& getAssignmentUUID() const { return _assignmentUUID; }
     void setAssignmentUUID(const QUuid& assignmentUUID) { _assignmentUUID = assignmentUUID; }
 
@@ -309,6 +313,8 @@ private:
     Setting::Handle<bool> _enableInterstitialMode { "enableInterstitialMode", false };
 #endif
 
+    Setting::Handle<QVariantMap> _sessionTickets { "domainSessionTickets" }; // keyed by domain host and port
+
     QSet<QString> _domainConnectionRefusals;
     bool _hasCheckedForAccessToken { false };
     bool _hasCheckedForDomainAccessToken { false };
@@ -515,6 +515,11 @@ qint64 LimitedNodeList::sendPacketList(std::unique_ptr<NLPacketList> packetList,
     // close the last packet in the list
     packetList->closeCurrentPacket();
 
+    // messages go out in packets as large as the path to the destination allows
+    if (packetList->isOrdered()) {
+        packetList->resegment(_nodeSocket.getMaxPacketSize(sockAddr));
+    }
+
     for (std::unique_ptr<udt::Packet>& packet : packetList->_packets) {
         NLPacket* nlPacket = static_cast<NLPacket*>(packet.get());
         fillPacketHeader(*nlPacket);
@@ -529,6 +534,11 @@ qint64 LimitedNodeList::sendPacketList(std::unique_ptr<NLPacketList> packetList,
         // close the last packet in the list
         packetList->closeCurrentPacket();
 
+        // messages go out in packets as large as the path to the destination allows
+        if (packetList->isOrdered()) {
+            packetList->resegment(_nodeSocket.getMaxPacketSize(*activeSocket));
+        }
+
         for (std::unique_ptr<udt::Packet>& packet : packetList->_packets) {
             NLPacket* nlPacket = static_cast<NLPacket*>(packet.get());
             fillPacketHeader(*nlPacket, destinationNode.getAuthenticateHash());
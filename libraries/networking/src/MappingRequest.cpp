@@ -14,6 +14,7 @@
 #include <QtCore/QThread>
 
 #include <DependencyManager.h>
+#include <UUID.h>
 
 MappingRequest::~MappingRequest() {
     auto assetClient = DependencyManager::get<AssetClient>();
@@ -143,6 +144,67 @@ void GetAllMappingsRequest::doStart() {
     });
 };
 
+GetMappingChangesRequest::GetMappingChangesRequest(const QUuid& historyID, uint64_t sinceVersion) :
+    _historyID(historyID),
+    _version(sinceVersion)
+{
+
+};
+
+void GetMappingChangesRequest::doStart() {
+    auto assetClient = DependencyManager::get<AssetClient>();
+    _mappingRequestID = assetClient->getAssetMappingChanges(_historyID, _version,
+            [this, assetClient](bool responseReceived, AssetUtils::AssetServerError error, QSharedPointer<ReceivedMessage> message) {
+
+        _mappingRequestID = INVALID_MESSAGE_ID;
+
+        if (!responseReceived) {
+            _error = NetworkError;
+        } else {
+            switch (error) {
+                case AssetUtils::AssetServerError::NoError:
+                    _error = NoError;
+                    break;
+                default:
+                    _error = UnknownError;
+                    break;
+            }
+        }
+
+        if (!_error) {
+            _historyID = QUuid::fromRfc4122(message->read(NUM_BYTES_RFC4122_UUID));
+            message->readPrimitive(&_version);
+
+            quint8 isFullSnapshot;
+            message->readPrimitive(&isFullSnapshot);
+            _isFullSnapshot = isFullSnapshot;
+
+            uint32_t numberOfMappings;
+            message->readPrimitive(&numberOfMappings);
+            for (uint32_t i = 0; i < numberOfMappings; ++i) {
+                auto path = message->readString();
+                auto hash = message->read(AssetUtils::SHA256_HASH_LENGTH).toHex();
+                AssetUtils::BakingStatus status;
+                QString lastBakeErrors;
+                message->readPrimitive(&status);
+                if (status == AssetUtils::BakingStatus::Error) {
+                    lastBakeErrors = message->readString();
+                }
+                _changedMappings[path] = { hash, status, lastBakeErrors };
+            }
+
+            if (!_isFullSnapshot) {
+                uint32_t numberOfRemovedPaths;
+                message->readPrimitive(&numberOfRemovedPaths);
+                for (uint32_t i = 0; i < numberOfRemovedPaths; ++i) {
+                    _removedPaths << message->readString();
+                }
+            }
+        }
+        emit finished(this);
+    });
+};
+
 SetMappingRequest::SetMappingRequest(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& hash) :
     _path(path.trimmed()),
     _hash(hash)
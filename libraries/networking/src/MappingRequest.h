@@ -15,6 +15,7 @@
 #define hifi_MappingRequest_h
 
 #include <QtCore/QObject>
+#include <QtCore/QUuid>
 
 #include "AssetUtils.h"
 #include "AssetClient.h"
@@ -131,6 +132,35 @@ private:
     AssetUtils::AssetMappings _mappings;
 };
 
+// Asks for the mappings changed since a version previously returned by the asset server.
+// If the server no longer knows the changes since that version, it answers with a full snapshot instead.
+class GetMappingChangesRequest : public MappingRequest {
+    Q_OBJECT
+public:
+    GetMappingChangesRequest(const QUuid& historyID, uint64_t sinceVersion);
+
+    QUuid getHistoryID() const { return _historyID; }
+    uint64_t getVersion() const { return _version; }
+    bool isFullSnapshot() const { return _isFullSnapshot; }
+
+    // The mappings set since the requested version, or every mapping for a full snapshot
+    AssetUtils::AssetMappings getChangedMappings() const { return _changedMappings; }
+    AssetUtils::AssetPathList getRemovedPaths() const { return _removedPaths; }
+
+signals:
+    void finished(GetMappingChangesRequest* thisRequest);
+
+private:
+    virtual void doStart() override;
+
+    QUuid _historyID;
+    uint64_t _version;
+    bool _isFullSnapshot { false };
+
+    AssetUtils::AssetMappings _changedMappings;
+    AssetUtils::AssetPathList _removedPaths;
+};
+
 class SetBakingEnabledRequest : public MappingRequest {
     Q_OBJECT
 public:
@@ -42,5 +42,7 @@ NLPacketList::NLPacketList(PacketList&& other) : PacketList(std::move(other)) {
 }
 
 std::unique_ptr<udt::Packet> NLPacketList::createPacket() {
-    return NLPacket::create(getType(), -1, isReliable(), isOrdered());
+    // the size given to NLPacket::create doesn't count the base packet header nor our own
+    qint64 size = (_packetSize == -1) ? -1 : _packetSize - udt::Packet::localHeaderSize() - NLPacket::localHeaderSize(getType());
+    return NLPacket::create(getType(), size, isReliable(), isOrdered());
 }
@@ -488,6 +488,9 @@ void NodeList::sendDomainServerCheckIn() {
 
             packetStream << previousConnectionUptime;
 
+            // present the ticket of our previous session with this domain, if we have one, so that it can be resumed
+            // without verifying our identity again
+            packetStream << _domainHandler.getSessionTicket();
         }
 
         packetStream << quint64(duration_cast<microseconds>(system_clock::now().time_since_epoch()).count());
@@ -756,6 +759,9 @@ void NodeList::processDomainServerList(QSharedPointer<ReceivedMessage> message)
     bool newConnection;
     packetStream >> newConnection;
 
+    QUuid sessionTicket;
+    packetStream >> sessionTicket;
+
     if (newConnection) {
         _nodeConnectTimestamp = usecTimestampNow();
         _connectReason = Connect;
@@ -821,6 +827,10 @@ void NodeList::processDomainServerList(QSharedPointer<ReceivedMessage> message)
     setSessionLocalID(newLocalID);
     setSessionUUID(newUUID);
 
+    if (!sessionTicket.isNull()) {
+        _domainHandler.setSessionTicket(sessionTicket);
+    }
+
     // FIXME: Remove this call to requestDomainSettings() and reinstate the one in DomainHandler::setIsConnected(), in version 
     // 2021.2.0. (New protocol version implies a domain server upgrade.)
     if (!_domainHandler.isConnected() 
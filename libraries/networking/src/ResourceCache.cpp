@@ -147,6 +147,122 @@ void ResourceCacheSharedItems::clear() {
     _loadingRequests.clear();
 }
 
+void ResourceCacheSharedItems::addCache(ResourceCache* cache) {
+    Lock lock(_mutex);
+    _caches.append(cache);
+}
+
+void ResourceCacheSharedItems::removeCache(ResourceCache* cache) {
+    Lock lock(_mutex);
+    for (int i = 0; i < _caches.size();) {
+        if (!_caches.at(i) || _caches.at(i).data() == cache) {
+            _caches.removeAt(i);
+            continue;
+        }
+        i++;
+    }
+}
+
+QList<QPointer<ResourceCache>> ResourceCacheSharedItems::getCaches() const {
+    Lock lock(_mutex);
+    return _caches;
+}
+
+void ResourceCacheSharedItems::setMemoryBudget(qint64 budget) {
+    _memoryBudget = glm::clamp(budget, MIN_RESOURCE_MEMORY_BUDGET, MAX_RESOURCE_MEMORY_BUDGET);
+    enforceMemoryBudget();
+}
+
+qint64 ResourceCacheSharedItems::getMemoryUsage() const {
+    qint64 usage = 0;
+    for (auto& cache : getCaches()) {
+        if (cache) {
+            usage += cache->getSizeTotalResources();
+        }
+    }
+    return usage;
+}
+
+qint64 ResourceCacheSharedItems::getBytesToEvict(qint64 usage, qint64 unusedUsage, qint64 budget) {
+    if (budget <= 0 || usage <= budget || usage - unusedUsage > budget) {
+        return 0;
+    }
+    return usage - budget;
+}
+
+void ResourceCacheSharedItems::enforceMemoryBudget() {
+    // Evicting a resource can release the last references to others, which then come back here as they are
+    // added to the unused resources of their own cache
+    if (_isEnforcingMemoryBudget.exchange(true)) {
+        return;
+    }
+
+    auto caches = getCaches();
+    qint64 usage = 0;
+    qint64 unusedUsage = 0;
+    for (auto& cache : caches) {
+        if (cache) {
+            usage += cache->getSizeTotalResources();
+            unusedUsage += cache->getSizeCachedResources();
+        }
+    }
+    qint64 bytesToEvict = getBytesToEvict(usage, unusedUsage, _memoryBudget);
+
+    auto now = usecTimestampNow();
+    qint64 evictedBytes = 0;
+    while (evictedBytes < bytesToEvict) {
+        QPointer<ResourceCache> evictionCache;
+        int evictionKey = 0;
+        float evictionScore = -FLT_MAX;
+        for (auto& cache : caches) {
+            if (!cache) {
+                continue;
+            }
+            float score;
+            int key = cache->findEvictionCandidate(now, score);
+            if (key != 0 && score > evictionScore) {
+                evictionCache = cache;
+                evictionKey = key;
+                evictionScore = score;
+            }
+        }
+
+        if (!evictionCache) {
+            // everything left is in use
+            break;
+        }
+
+        qint64 resourceBytes = evictionCache->evictUnusedResource(evictionKey);
+        evictedBytes += resourceBytes;
+        _evictedBytes += resourceBytes;
+        _numEvictions++;
+    }
+
+    _isEnforcingMemoryBudget = false;
+}
+
+QVariantMap ResourceCacheSharedItems::getMemoryStats() const {
+    QVariantMap caches;
+    for (auto& cache : getCaches()) {
+        if (cache) {
+            caches[cache->metaObject()->className()] = QVariantMap {
+                { "size_total", (qint64)cache->getSizeTotalResources() },
+                { "size_cached", (qint64)cache->getSizeCachedResources() },
+                { "num_total", (qulonglong)cache->getNumTotalResources() },
+                { "num_cached", (qulonglong)cache->getNumCachedResources() }
+            };
+        }
+    }
+
+    return QVariantMap {
+        { "budget", _memoryBudget.load() },
+        { "usage", getMemoryUsage() },
+        { "num_evictions", (qulonglong)_numEvictions.load() },
+        { "evicted_bytes", _evictedBytes.load() },
+        { "caches", caches }
+    };
+}
+
 ScriptableResourceCache::ScriptableResourceCache(QSharedPointer<ResourceCache> resourceCache) {
     _resourceCache = resourceCache;
     connect(&(*_resourceCache), &ResourceCache::dirty,
@@ -259,9 +375,15 @@ ResourceCache::ResourceCache(QObject* parent) : QObject(parent) {
         connect(&domainHandler, &DomainHandler::disconnectedFromDomain,
             this, &ResourceCache::clearATPAssets, Qt::DirectConnection);
     }
+    if (DependencyManager::isSet<ResourceCacheSharedItems>()) {
+        DependencyManager::get<ResourceCacheSharedItems>()->addCache(this);
+    }
 }
 
 ResourceCache::~ResourceCache() {
+    if (DependencyManager::isSet<ResourceCacheSharedItems>()) {
+        DependencyManager::get<ResourceCacheSharedItems>()->removeCache(this);
+    }
     clearUnusedResources();
 }
 
@@ -340,6 +462,29 @@ QVariantList ResourceCache::getResourceList() {
     return list;
 }
  
+static void enforceResourceMemoryBudget() {
+    // the shared items can be gone while the last resources are released on shutdown
+    if (DependencyManager::isSet<ResourceCacheSharedItems>()) {
+        DependencyManager::get<ResourceCacheSharedItems>()->enforceMemoryBudget();
+    }
+}
+
+void ResourceCache::setMemoryBudget(qint64 budget) {
+    DependencyManager::get<ResourceCacheSharedItems>()->setMemoryBudget(budget);
+}
+
+qint64 ResourceCache::getMemoryBudget() {
+    return DependencyManager::get<ResourceCacheSharedItems>()->getMemoryBudget();
+}
+
+qint64 ResourceCache::getMemoryUsage() {
+    return DependencyManager::get<ResourceCacheSharedItems>()->getMemoryUsage();
+}
+
+QVariantMap ResourceCache::getMemoryStats() {
+    return DependencyManager::get<ResourceCacheSharedItems>()->getMemoryStats();
+}
+
 void ResourceCache::setRequestLimit(uint32_t limit) {
     auto sharedItems = DependencyManager::get<ResourceCacheSharedItems>();
     sharedItems->setRequestLimit(limit);
@@ -420,6 +565,7 @@ void ResourceCache::addUnusedResource(const QSharedPointer<Resource>& resource)
     reserveUnusedResource(resource->getBytes());
     
     resource->setLRUKey(++_lastLRUKey);
+    resource->_unusedSince = usecTimestampNow();
 
     {
         QWriteLocker locker(&_unusedResourcesLock);
@@ -428,6 +574,8 @@ void ResourceCache::addUnusedResource(const QSharedPointer<Resource>& resource)
     }
 
     resetUnusedResourceCounter();
+
+    enforceResourceMemoryBudget();
 }
 
 void ResourceCache::removeUnusedResource(const QSharedPointer<Resource>& resource) {
@@ -460,6 +608,49 @@ void ResourceCache::reserveUnusedResource(qint64 resourceSize) {
     }
 }
 
+int ResourceCache::findEvictionCandidate(quint64 now, float& score) {
+    // Only look at the oldest few, the eviction order is mostly the LRU order with the reload cost breaking the ties
+    const int MAX_EVICTION_CANDIDATES = 8;
+    // An extra second to load costs as much as an extra second unused
+    const float RELOAD_COST_WEIGHT = 1.0f;
+
+    QReadLocker locker(&_unusedResourcesLock);
+    int candidateKey = 0;
+    int numCandidates = 0;
+    for (auto it = _unusedResources.cbegin(); it != _unusedResources.cend() && numCandidates < MAX_EVICTION_CANDIDATES; ++it) {
+        const auto& resource = it.value();
+        float unusedSeconds = (float)(now > resource->_unusedSince ? now - resource->_unusedSince : 0) / USECS_PER_SECOND;
+        float loadSeconds = (float)resource->getLoadDuration() / USECS_PER_SECOND;
+        // Big resources that are quick to reload and unused for long go first
+        float resourceScore = (float)resource->getBytes() * (1.0f + unusedSeconds) / (1.0f + RELOAD_COST_WEIGHT * loadSeconds);
+        if (candidateKey == 0 || resourceScore > score) {
+            candidateKey = it.key();
+            score = resourceScore;
+        }
+        numCandidates++;
+    }
+    return candidateKey;
+}
+
+qint64 ResourceCache::evictUnusedResource(int lruKey) {
+    QWriteLocker locker(&_unusedResourcesLock);
+    auto it = _unusedResources.find(lruKey);
+    if (it == _unusedResources.end()) {
+        return 0;
+    }
+
+    auto resource = it.value();
+    _unusedResources.erase(it);
+    resource->setCache(nullptr);
+    auto size = resource->getBytes();
+    _unusedResourcesSize -= size;
+
+    locker.unlock();
+    removeResource(resource->getURL(), resource->getExtraHash(), size);
+    resetResourceCounters();
+    return size;
+}
+
 void ResourceCache::clearUnusedResources() {
     // the unused resources may themselves reference resources that will be added to the unused
     // list on destruction, so keep clearing until there are no references left
@@ -516,6 +707,10 @@ void ResourceCache::updateTotalSize(const qint64& deltaSize) {
     assert(_totalResourcesSize < (1024 * BYTES_PER_GIGABYTES));
 
     emit dirty();
+
+    if (deltaSize > 0) {
+        enforceResourceMemoryBudget();
+    }
 }
 
 QList<QSharedPointer<Resource>> ResourceCache::getLoadingRequests() {
@@ -575,7 +770,8 @@ Resource::Resource(const Resource& other) :
     _bytesTotal(other._bytesTotal),
     _bytes(other._bytes),
     _requestID(++requestID),
-    _extraHash(other._extraHash) {
+    _extraHash(other._extraHash),
+    _loadDuration(other._loadDuration) {
     if (!other._loaded) {
         _startedLoading = false;
     }
@@ -718,6 +914,10 @@ void Resource::attemptRequest() {
 
 void Resource::finishedLoading(bool success) {
     if (success) {
+        if (_requestStartTime != 0) {
+            _loadDuration = usecTimestampNow() - _requestStartTime;
+            _requestStartTime = 0;
+        }
         _loadPriorities.clear();
         _loaded = true;
     } else {
@@ -767,6 +967,7 @@ void Resource::makeRequest() {
     connect(_request, &ResourceRequest::finished, this, &Resource::handleReplyFinished);
 
     _bytesReceived = _bytesTotal = _bytes = 0;
+    _requestStartTime = usecTimestampNow();
 
     _request->send();
 }
@@ -40,6 +40,7 @@ class QNetworkReply;
 class QTimer;
 
 class Resource;
+class ResourceCache;
 
 static const qint64 BYTES_PER_MEGABYTES = 1024 * 1024;
 static const qint64 BYTES_PER_GIGABYTES = 1024 * BYTES_PER_MEGABYTES;
@@ -55,6 +56,11 @@ static const qint64 DEFAULT_UNUSED_MAX_SIZE = 1024 * BYTES_PER_MEGABYTES;
 static const qint64 MIN_UNUSED_MAX_SIZE = 0;
 static const qint64 MAX_UNUSED_MAX_SIZE = MAXIMUM_CACHE_SIZE;
 
+// Budget for the resources of all the caches together, in use or not, none by default (0)
+static const qint64 DEFAULT_RESOURCE_MEMORY_BUDGET = 0;
+static const qint64 MIN_RESOURCE_MEMORY_BUDGET = 0;
+static const qint64 MAX_RESOURCE_MEMORY_BUDGET = 4 * MAXIMUM_CACHE_SIZE;
+
 // We need to make sure that these items are available for all instances of
 // ResourceCache derived classes. Since we can't count on the ordering of
 // static members destruction, we need to use this Dependency manager implemented
@@ -77,14 +83,37 @@ public:
     uint32_t getLoadingRequestsCount() const;
     void clear();
 
+    // The memory budget is shared by every cache: when the resources of all the caches go over it, the unused
+    // resources that are the cheapest to reload and have been unused the longest are evicted, whichever cache
+    // holds them. Nothing is evicted when the resources in use alone are over budget, as the unused ones would only
+    // be loaded again, nor when the budget is 0.
+    void addCache(ResourceCache* cache);
+    void removeCache(ResourceCache* cache);
+    void setMemoryBudget(qint64 budget);
+    qint64 getMemoryBudget() const { return _memoryBudget; }
+    qint64 getMemoryUsage() const;
+    void enforceMemoryBudget();
+    QVariantMap getMemoryStats() const;
+
+    // The unused bytes to evict for the usage to fit in the budget, 0 when there is no budget or it can't be met
+    static qint64 getBytesToEvict(qint64 usage, qint64 unusedUsage, qint64 budget);
+
 private:
     ResourceCacheSharedItems() = default;
 
+    QList<QPointer<ResourceCache>> getCaches() const;
+
     mutable Mutex _mutex;
     QList<QWeakPointer<Resource>> _pendingRequests;
     QList<QWeakPointer<Resource>> _loadingRequests;
     const uint32_t DEFAULT_REQUEST_LIMIT = 10;
     uint32_t _requestLimit { DEFAULT_REQUEST_LIMIT };
+
+    QList<QPointer<ResourceCache>> _caches;
+    std::atomic<qint64> _memoryBudget { DEFAULT_RESOURCE_MEMORY_BUDGET };
+    std::atomic<bool> _isEnforcingMemoryBudget { false };
+    std::atomic<size_t> _numEvictions { 0 };
+    std::atomic<qint64> _evictedBytes { 0 };
 };
 
 /// Wrapper to expose resources to JS/QML
@@ -220,6 +249,11 @@ public:
     static uint32_t getPendingRequestCount();
     static uint32_t getLoadingRequestCount();
 
+    static void setMemoryBudget(qint64 budget);
+    static qint64 getMemoryBudget();
+    static qint64 getMemoryUsage();
+    static QVariantMap getMemoryStats();
+
     ResourceCache(QObject* parent = nullptr);
     virtual ~ResourceCache();
     
@@ -275,8 +309,15 @@ protected:
 private:
     friend class Resource;
     friend class ScriptableResourceCache;
+    friend class ResourceCacheSharedItems;
 
     void reserveUnusedResource(qint64 resourceSize);
+
+    // Returns the LRU key of the unused resource this cache would rather give up to the memory budget, with its
+    // eviction score, or 0 if there are no unused resources
+    int findEvictionCandidate(quint64 now, float& score);
+    // Returns the number of bytes freed
+    qint64 evictUnusedResource(int lruKey);
     void removeResource(const QUrl& url, size_t extraHash, qint64 size = 0);
 
     void resetTotalResourceCounter();
@@ -327,6 +368,18 @@ class ScriptableResourceCache : public QObject {
     Q_PROPERTY(size_t numGlobalQueriesPending READ getNumGlobalQueriesPending NOTIFY dirty)
     Q_PROPERTY(size_t numGlobalQueriesLoading READ getNumGlobalQueriesLoading NOTIFY dirty)
 
+    /*@jsdoc
+     * @property {number} globalMemoryUsage - Size in bytes of all resources, in use or cached (across all resource cache
+     *     managers). <em>Read-only.</em>
+     * @property {number} globalMemoryBudget - Size in bytes that the resources of all resource cache managers should fit in.
+     *     When exceeded, the cached resources that are the quickest to load again and have been unused for the longest are
+     *     evicted first, whichever the cache manager, as long as evicting them brings the total under budget.
+     *     <code>0</code> for no budget. Interface starts with its "resourceMemoryBudgetMB" setting, set in the Networking
+     *     preferences and <code>0</code> by default. Changing this property doesn't change that setting.
+     */
+    Q_PROPERTY(qint64 globalMemoryUsage READ getGlobalMemoryUsage NOTIFY dirty)
+    Q_PROPERTY(qint64 globalMemoryBudget READ getGlobalMemoryBudget WRITE setGlobalMemoryBudget NOTIFY dirty)
+
 public:
     ScriptableResourceCache(QSharedPointer<ResourceCache> resourceCache);
 
@@ -403,6 +456,10 @@ private:
 
     size_t getNumGlobalQueriesPending() const { return ResourceCache::getPendingRequestCount(); }
     size_t getNumGlobalQueriesLoading() const { return ResourceCache::getLoadingRequestCount(); }
+
+    qint64 getGlobalMemoryUsage() const { return ResourceCache::getMemoryUsage(); }
+    qint64 getGlobalMemoryBudget() const { return ResourceCache::getMemoryBudget(); }
+    void setGlobalMemoryBudget(qint64 budget) { ResourceCache::setMemoryBudget(budget); }
 };
 
 /// Base class for resources.
@@ -450,6 +507,9 @@ public:
     /// For loaded resources, returns the number of actual bytes (defaults to total bytes if not explicitly set).
     qint64 getBytes() const { return _bytes; }
 
+    /// For loaded resources, returns how long the last load took, from request to processed (in usecs).
+    quint64 getLoadDuration() const { return _loadDuration; }
+
     /// For loading resources, returns the load progress.
     float getProgress() const { return (_bytesTotal <= 0) ? 0.0f : (float)_bytesReceived / _bytesTotal; }
     
@@ -567,6 +627,9 @@ private:
     void setInScript(bool isInScript) { _isInScript = isInScript; }
     
     int _lruKey{ 0 };
+    quint64 _unusedSince { 0 };
+    quint64 _requestStartTime { 0 };
+    quint64 _loadDuration { 0 };
     QTimer* _replyTimer{ nullptr };
     unsigned int _attempts{ 0 };
     static const int MAX_ATTEMPTS = 8;
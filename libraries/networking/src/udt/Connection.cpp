@@ -30,6 +30,11 @@
 using namespace udt;
 using namespace std::chrono;
 
+static const int MTU_PROBE_ATTEMPTS = 2; // probes of a size sent before deciding it doesn't make it through
+static const int MIN_MTU_PROBE_TIMEOUT_MSECS = 250;
+static const int MTU_PROBE_PRECISION = 16; // discovery stops once the largest packet size is known to this many bytes
+static const int TIMEOUTS_BEFORE_MTU_RESET = 3; // send queue timeouts in a row after which discovered sizes are dropped
+
 Connection::Connection(Socket* parentSocket, HifiSockAddr destination, std::unique_ptr<CongestionControl> congestionControl) :
     _parentSocket(parentSocket),
     _destination(destination),
@@ -41,12 +46,16 @@ Connection::Connection(Socket* parentSocket, HifiSockAddr destination, std::uniq
     _congestionControl->init();
 
     // Setup packets
-    static const int ACK_PACKET_PAYLOAD_BYTES = sizeof(SequenceNumber);
+    static const int ACK_PACKET_PAYLOAD_BYTES = sizeof(SequenceNumber) * (1 + 2 * MAX_SACK_RANGES);
     static const int HANDSHAKE_ACK_PAYLOAD_BYTES = sizeof(SequenceNumber);
 
     _ackPacket = ControlPacket::create(ControlPacket::ACK, ACK_PACKET_PAYLOAD_BYTES);
     _handshakeACK = ControlPacket::create(ControlPacket::HandshakeACK, HANDSHAKE_ACK_PAYLOAD_BYTES);
 
+    _mtuProbeTimer = new QTimer(this);
+    _mtuProbeTimer->setSingleShot(true);
+    QObject::connect(_mtuProbeTimer, &QTimer::timeout, this, &Connection::mtuProbeTimedOut);
+
 
     // setup psuedo-random number generation shared by all connections
     static std::random_device rd;
@@ -142,6 +151,14 @@ void Connection::queueTimeout() {
     updateCongestionControlAndSendQueue([this] {
         _congestionControl->onTimeout();
     });
+
+    // the path may have changed under us, in which case the packets sized for it no longer make it through
+    if (++_numTimeoutsWithoutACK >= TIMEOUTS_BEFORE_MTU_RESET && _maxPacketSize != MAX_PACKET_SIZE && !isDiscoveringMTU()) {
+        qCDebug(networking) << "Connection to" << _destination << "keeps timing out, going back to"
+            << MAX_PACKET_SIZE << "byte packets";
+        _maxPacketSize = MAX_PACKET_SIZE;
+        startMTUDiscovery();
+    }
 }
 
 void Connection::sendReliablePacket(std::unique_ptr<Packet> packet) {
@@ -219,10 +236,21 @@ void Connection::sendACK() {
     // pack in the ACK number
     _ackPacket->writePrimitive(nextACKNumber);
 
+    // follow it with the ranges received past the first loss so that the sender doesn't re-send those
+    _lossList.writeReceivedRanges(*_ackPacket, _lastReceivedSequenceNumber, MAX_SACK_RANGES);
+
     // have the socket send off our packet
     _parentSocket->writeBasePacket(*_ackPacket, _destination);
     
     _stats.recordSentACK(_ackPacket->getWireSize());
+
+    _numUnacknowledgedPackets = 0;
+}
+
+void Connection::flushACK() {
+    if (_numUnacknowledgedPackets > 0) {
+        sendACK();
+    }
 }
 
 SequenceNumber Connection::nextACK() const {
@@ -257,6 +285,9 @@ bool Connection::processReceivedSequenceNumber(SequenceNumber sequenceNumber, in
     // mark our last receive time as now (to push the potential expiry farther)
     _lastReceiveTime = p_high_resolution_clock::now();
     
+    // losses are reported right away, as are the packets that fill them
+    bool hadLoss = !_lossList.isEmpty();
+
     // If this is not the next sequence number, report loss
     if (sequenceNumber > _lastReceivedSequenceNumber + 1) {
         if (_lastReceivedSequenceNumber + 1 == sequenceNumber - 1) {
@@ -276,8 +307,18 @@ bool Connection::processReceivedSequenceNumber(SequenceNumber sequenceNumber, in
         wasDuplicate = !_lossList.remove(sequenceNumber);
     }
 
-    // using a congestion control that ACKs every packet (like TCP Vegas)
-    sendACK();
+    // TCP Vegas measures the RTT from ACKs, so while everything arrives in order we only hold an ACK back for a few
+    // packets or a few milliseconds - the socket flushes it once it has read all pending datagrams.
+    // Gaps and duplicates are ACKed immediately, so that the duplicate ACKs and received ranges reach the sender.
+    if (_numUnacknowledgedPackets++ == 0) {
+        _firstUnacknowledgedTime = _lastReceiveTime;
+    }
+
+    if (!_coalesceACKs || hadLoss || !_lossList.isEmpty() || wasDuplicate
+        || _numUnacknowledgedPackets >= ACK_COALESCE_PACKETS
+        || duration_cast<microseconds>(_lastReceiveTime - _firstUnacknowledgedTime).count() >= MAX_ACK_DELAY_USECS) {
+        sendACK();
+    }
     
     if (wasDuplicate) {
         _stats.recordDuplicatePackets(payloadSize, packetSize);
@@ -307,6 +348,12 @@ void Connection::processControl(ControlPacketPointer controlPacket) {
         case ControlPacket::HandshakeACK:
             processHandshakeACK(move(controlPacket));
             break;
+        case ControlPacket::MTUProbe:
+            processMTUProbe(move(controlPacket));
+            break;
+        case ControlPacket::MTUProbeACK:
+            processMTUProbeACK(move(controlPacket));
+            break;
         case ControlPacket::HandshakeRequest:
             if (_hasReceivedHandshakeACK) {
                 // We're already in a state where we've received a handshake ack, so we are likely in a state
@@ -343,16 +390,43 @@ void Connection::processACK(ControlPacketPointer controlPacket) {
     if (ack > _lastReceivedACK) {
         // this is not a repeated ACK, so update our member and tell the send queue
         _lastReceivedACK = ack;
+        _numTimeoutsWithoutACK = 0;
 
         // ACK the send queue so it knows what was received
         getSendQueue().ack(ack);
     }
 
+    // read the ranges received past the ACK, if the receiver sent any
+    std::vector<std::pair<SequenceNumber, SequenceNumber>> receivedRanges;
+    while (controlPacket->bytesLeftToRead() >= (qint64)(2 * sizeof(SequenceNumber))) {
+        SequenceNumber start, end;
+        controlPacket->readPrimitive(&start);
+        controlPacket->readPrimitive(&end);
+
+        if (start <= ack || end < start || end > getSendQueue().getCurrentSequenceNumber()
+            || (!receivedRanges.empty() && start <= receivedRanges.back().second + 1)) {
+            // ranges must be past the ACK, in order and not overlapping
+            break;
+        }
+
+        getSendQueue().selectiveAck(start, end);
+        receivedRanges.emplace_back(start, end);
+    }
+
     // give this ACK to the congestion control and update the send queue parameters
-    updateCongestionControlAndSendQueue([this, ack, &controlPacket] {
+    updateCongestionControlAndSendQueue([this, ack, &controlPacket, &receivedRanges] {
         if (_congestionControl->onACK(ack, controlPacket->getReceiveTime())) {
             // the congestion control has told us it needs a fast re-transmit of ack + 1, add that now
-            _sendQueue->fastRetransmit(ack + 1);
+            // along with every other hole the received ranges tell us about
+            SequenceNumber holeStart = ack + 1;
+            for (const auto& range : receivedRanges) {
+                _sendQueue->fastRetransmit(holeStart, range.first - 1);
+                holeStart = range.second + 1;
+            }
+
+            if (receivedRanges.empty()) {
+                _sendQueue->fastRetransmit(ack + 1, ack + 1);
+            }
         }
     });
     
@@ -400,18 +474,140 @@ void Connection::processHandshakeACK(ControlPacketPointer controlPacket) {
             // hand off this handshake ACK to the send queue so it knows it can start sending
             getSendQueue().handshakeACK();
 
+            // the first time we hear from the peer, find out how large our packets to it can be
+            if (!_hasReceivedHandshakeACK && _largestConfirmedPacketSize == 0 && !isDiscoveringMTU()) {
+                startMTUDiscovery();
+            }
+
             // indicate that handshake ACK was received
             _hasReceivedHandshakeACK = true;
         }
     }
 }
 
+void Connection::startMTUDiscovery() {
+    if (!Socket::canProbeMTU()) {
+        // without a way to send probes unfragmented we can't tell anything from their answers
+        return;
+    }
+
+    _largestConfirmedPacketSize = 0;
+    _smallestFailedPacketSize = 0;
+    _numMTUProbeAttempts = 0;
+    _mtuProbeSize = nextMTUProbeSize();
+    sendNextMTUProbe();
+}
+
+int Connection::nextMTUProbeSize() const {
+    if (_largestConfirmedPacketSize == 0) {
+        // start with the default size, and if that doesn't make it try the smallest one to tell a small path MTU
+        // apart from a peer that doesn't answer probes
+        if (_smallestFailedPacketSize == 0) {
+            return MAX_PACKET_SIZE;
+        } else if (_smallestFailedPacketSize > MIN_PROBED_PACKET_SIZE) {
+            return MIN_PROBED_PACKET_SIZE;
+        } else {
+            return 0;
+        }
+    }
+
+    // binary search between the largest size confirmed and the smallest that failed
+    int upperBound = _smallestFailedPacketSize > 0 ? _smallestFailedPacketSize : MAX_PROBED_PACKET_SIZE + 1;
+    if (upperBound - _largestConfirmedPacketSize <= MTU_PROBE_PRECISION) {
+        return 0;
+    }
+    return (_largestConfirmedPacketSize + upperBound) / 2;
+}
+
+void Connection::sendNextMTUProbe() {
+    int probeSize = _mtuProbeSize;
+    if (probeSize == 0) {
+        qCDebug(networking) << "Packets to" << _destination << "are" << _maxPacketSize << "bytes";
+        return;
+    }
+
+    ++_numMTUProbeAttempts;
+
+    // the probe is padded to the size being tested and carries that size, which the peer echoes back
+    auto probe = ControlPacket::create(ControlPacket::MTUProbe, probeSize - ControlPacket::localHeaderSize());
+    probe->writePrimitive((int32_t)probeSize);
+    probe->setPayloadSize(probe->getPayloadCapacity());
+
+    if (_parentSocket->writeMTUProbe(*probe, _destination) < 0) {
+        // the probe couldn't even leave (e.g. larger than the local interface MTU), no point in waiting
+        QMetaObject::invokeMethod(this, "mtuProbeTimedOut", Qt::QueuedConnection);
+        _numMTUProbeAttempts = MTU_PROBE_ATTEMPTS;
+        return;
+    }
+
+    int timeoutMsecs = std::max(MIN_MTU_PROBE_TIMEOUT_MSECS, (int)(2 * _congestionControl->estimatedTimeout() / USECS_PER_MSEC));
+    _mtuProbeTimer->start(timeoutMsecs);
+}
+
+void Connection::mtuProbeTimedOut() {
+    if (!isDiscoveringMTU()) {
+        return;
+    }
+
+    if (_numMTUProbeAttempts < MTU_PROBE_ATTEMPTS) {
+        // the probe or its answer may just have been lost, try it again
+        sendNextMTUProbe();
+        return;
+    }
+
+    _smallestFailedPacketSize = _mtuProbeSize;
+    _numMTUProbeAttempts = 0;
+    _mtuProbeSize = nextMTUProbeSize();
+    sendNextMTUProbe();
+}
+
+void Connection::processMTUProbe(ControlPacketPointer controlPacket) {
+    int32_t probeSize;
+    if (controlPacket->bytesLeftToRead() < (qint64)sizeof(probeSize)) {
+        // too short to even hold the probe size
+        return;
+    }
+    controlPacket->readPrimitive(&probeSize);
+
+    if (probeSize != controlPacket->getDataSize()) {
+        // this probe didn't arrive whole
+        return;
+    }
+
+    auto probeACK = ControlPacket::create(ControlPacket::MTUProbeACK, sizeof(probeSize));
+    probeACK->writePrimitive(probeSize);
+    _parentSocket->writeBasePacket(*probeACK, _destination);
+}
+
+void Connection::processMTUProbeACK(ControlPacketPointer controlPacket) {
+    int32_t probeSize;
+    if (controlPacket->bytesLeftToRead() < (qint64)sizeof(probeSize)) {
+        return;
+    }
+    controlPacket->readPrimitive(&probeSize);
+
+    if (!isDiscoveringMTU() || probeSize != _mtuProbeSize) {
+        // an answer to a probe we already gave up on
+        return;
+    }
+
+    _mtuProbeTimer->stop();
+
+    _largestConfirmedPacketSize = probeSize;
+    _maxPacketSize = probeSize;
+
+    _numMTUProbeAttempts = 0;
+    _mtuProbeSize = nextMTUProbeSize();
+    sendNextMTUProbe();
+}
+
 void Connection::resetReceiveState() {
     
     // reset all SequenceNumber member variables back to default
     SequenceNumber defaultSequenceNumber;
     
     _lastReceivedSequenceNumber = defaultSequenceNumber;
+    _numUnacknowledgedPackets = 0;
     
     // clear the loss list
     _lossList.clear();
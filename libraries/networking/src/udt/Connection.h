@@ -12,10 +12,12 @@
 #ifndef hifi_Connection_h
 #define hifi_Connection_h
 
+#include <atomic>
 #include <list>
 #include <memory>
 
 #include <QtCore/QObject>
+#include <QtCore/QTimer>
 
 #include <PortableHighResolutionClock.h>
 
@@ -72,6 +74,15 @@ public:
 
     void setMaxBandwidth(int maxBandwidth);
 
+    // when enabled, in-order reliable packets are acknowledged a few at a time instead of one ACK each
+    void setCoalesceACKs(bool coalesceACKs) { _coalesceACKs = coalesceACKs; }
+    bool hasPendingACK() const { return _numUnacknowledgedPackets > 0; }
+    void flushACK(); // sends the coalesced ACK for packets received so far, if any
+
+    // largest packet size known to reach the destination without fragmentation, MAX_PACKET_SIZE until discovered
+    int getMaxPacketSize() const { return _maxPacketSize; }
+    bool isDiscoveringMTU() const { return _mtuProbeSize > 0; }
+
     void sendHandshakeRequest();
     bool hasReceivedHandshake() const { return _hasReceivedHandshake; }
     
@@ -90,6 +101,8 @@ private slots:
 
     void queueInactive();
     void queueTimeout();
+
+    void mtuProbeTimedOut();
     
 private:
     void sendACK();
@@ -97,6 +110,14 @@ private:
     void processACK(ControlPacketPointer controlPacket);
     void processHandshake(ControlPacketPointer controlPacket);
     void processHandshakeACK(ControlPacketPointer controlPacket);
+    void processMTUProbe(ControlPacketPointer controlPacket);
+    void processMTUProbeACK(ControlPacketPointer controlPacket);
+
+    // Path MTU discovery: probes are sent with fragmentation disallowed and the peer echoes the size of those that
+    // make it through. Peers that don't answer probes keep the default MAX_PACKET_SIZE.
+    void startMTUDiscovery();
+    void sendNextMTUProbe();
+    int nextMTUProbeSize() const;
     
     void resetReceiveState();
     
@@ -122,6 +143,18 @@ private:
     LossList _lossList; // List of all missing packets
     SequenceNumber _lastReceivedSequenceNumber; // The largest sequence number received from the peer
     SequenceNumber _lastReceivedACK; // The last ACK received
+
+    std::atomic<bool> _coalesceACKs { true };
+    int _numUnacknowledgedPackets { 0 }; // Reliable packets received since the last ACK we sent
+    p_high_resolution_clock::time_point _firstUnacknowledgedTime; // When the oldest of those was received
+
+    std::atomic<int> _maxPacketSize { MAX_PACKET_SIZE };
+    std::atomic<int> _mtuProbeSize { 0 }; // Size of the probe waiting for an answer, 0 if not discovering
+    int _numMTUProbeAttempts { 0 }; // Number of times the current probe size was sent
+    int _largestConfirmedPacketSize { 0 }; // Largest probe the peer answered
+    int _smallestFailedPacketSize { 0 }; // Smallest probe that never got an answer
+    QTimer* _mtuProbeTimer { nullptr };
+    int _numTimeoutsWithoutACK { 0 }; // Send queue timeouts since the last ACK that moved forward
     
     Socket* _parentSocket { nullptr };
     HifiSockAddr _destination;
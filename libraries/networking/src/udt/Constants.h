@@ -21,12 +21,18 @@ namespace udt {
     static const int UDP_IPV4_HEADER_SIZE = 28;
     static const int MAX_PACKET_SIZE_WITH_UDP_HEADER = 1492;
     static const int MAX_PACKET_SIZE = MAX_PACKET_SIZE_WITH_UDP_HEADER - UDP_IPV4_HEADER_SIZE;
+    // path MTU discovery looks for the largest packet size between these, for packet lists sent as messages
+    static const int MIN_PROBED_PACKET_SIZE = 576 - UDP_IPV4_HEADER_SIZE; // smallest datagram IPv4 hosts must accept
+    static const int MAX_PROBED_PACKET_SIZE = 9000 - UDP_IPV4_HEADER_SIZE; // jumbo Ethernet frames
     static const int MAX_PACKETS_IN_FLIGHT = 25600;
     static const int CONNECTION_RECEIVE_BUFFER_SIZE_PACKETS = 8192;
     static const int CONNECTION_SEND_BUFFER_SIZE_PACKETS = 8192;
     static const int UDP_SEND_BUFFER_SIZE_BYTES = 1048576;
     static const int UDP_RECEIVE_BUFFER_SIZE_BYTES = 1048576;
     static const int DEFAULT_SYN_INTERVAL_USECS = 10 * 1000;
+    static const int ACK_COALESCE_PACKETS = 8; // reliable packets received in a row before a coalesced ACK goes out
+    static const int MAX_ACK_DELAY_USECS = 5 * 1000; // longest a received reliable packet waits for a coalesced ACK
+    static const int MAX_SACK_RANGES = 16; // received sequence number ranges carried by an ACK past the cumulative ACK
 
     
     // Header constants
@@ -30,7 +30,9 @@ public:
         ACK,
         Handshake,
         HandshakeACK,
-        HandshakeRequest
+        HandshakeRequest,
+        MTUProbe,
+        MTUProbeACK
     };
     
     static std::unique_ptr<ControlPacket> create(Type type, qint64 size = -1);
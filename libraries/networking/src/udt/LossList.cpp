@@ -182,3 +182,28 @@ void LossList::write(ControlPacket& packet, int maxPairs) {
         }
     }
 }
+
+void LossList::writeReceivedRanges(ControlPacket& packet, SequenceNumber lastReceived, int maxPairs) {
+    int writtenPairs = 0;
+
+    for (auto it = _lossList.cbegin(); it != _lossList.cend(); ++it) {
+        auto next = std::next(it);
+        SequenceNumber start = it->second + 1;
+        SequenceNumber end = next != _lossList.cend() ? next->first - 1 : lastReceived;
+
+        if (end < start) {
+            // nothing was received past the last loss
+            break;
+        }
+
+        packet.writePrimitive(start);
+        packet.writePrimitive(end);
+
+        ++writtenPairs;
+
+        // check if we've written the maximum number we were told to write
+        if (maxPairs != -1 && writtenPairs >= maxPairs) {
+            break;
+        }
+    }
+}
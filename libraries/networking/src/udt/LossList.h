@@ -42,6 +42,9 @@ public:
     SequenceNumber popFirstSequenceNumber();
     
     void write(ControlPacket& packet, int maxPairs = -1);
+
+    // writes the ranges between the losses and up to lastReceived, i.e. what was received past the first loss
+    void writeReceivedRanges(ControlPacket& packet, SequenceNumber lastReceived, int maxPairs = -1);
     
 private:
     std::list<std::pair<SequenceNumber, SequenceNumber>> _lossList;
@@ -27,7 +27,7 @@ PacketVersion versionForPacketType(PacketType packetType) {
         case PacketType::DomainConnectRequestPending: // keeping the old version to maintain the protocol hash
             return 17;
         case PacketType::DomainList:
-            return static_cast<PacketVersion>(DomainListVersion::HasConnectReason);
+            return static_cast<PacketVersion>(DomainListVersion::HasSessionTicket);
         case PacketType::EntityAdd:
         case PacketType::EntityClone:
         case PacketType::EntityEdit:
@@ -63,8 +63,9 @@ PacketVersion versionForPacketType(PacketType packetType) {
         case PacketType::AssetMappingOperationReply:
         case PacketType::AssetGetInfo:
         case PacketType::AssetGet:
+            return static_cast<PacketVersion>(AssetServerPacketVersion::MappingChanges);
         case PacketType::AssetUpload:
-            return static_cast<PacketVersion>(AssetServerPacketVersion::BakingTextureMeta);
+            return static_cast<PacketVersion>(AssetServerPacketVersion::ResumableUploads);
         case PacketType::NodeIgnoreRequest:
             return 18; // Introduction of node ignore request (which replaced an unused packet tpye)
 
@@ -72,7 +73,7 @@ PacketVersion versionForPacketType(PacketType packetType) {
             return static_cast<PacketVersion>(DomainConnectionDeniedVersion::IncludesExtraInfo);
 
         case PacketType::DomainConnectRequest:
-            return static_cast<PacketVersion>(DomainConnectRequestVersion::HasCompressedSystemInfo);
+            return static_cast<PacketVersion>(DomainConnectRequestVersion::HasSessionTicket);
 
         case PacketType::DomainServerAddedNode:
             return static_cast<PacketVersion>(DomainServerAddedNodeVersion::PermissionsGrid);
@@ -104,6 +105,41 @@ PacketVersion versionForPacketType(PacketType packetType) {
     }
 }
 
+PacketPriority priorityForPacketType(PacketType packetType) {
+    switch (packetType) {
+        // connection and session management should never wait behind other traffic
+        case PacketType::DomainList:
+        case PacketType::DomainConnectionDenied:
+        case PacketType::DomainServerAddedNode:
+        case PacketType::DomainServerRemovedNode:
+        case PacketType::DomainServerConnectionToken:
+        case PacketType::DomainDisconnectRequest:
+        case PacketType::StopNode:
+        case PacketType::KillAvatar:
+        case PacketType::NodeKickRequest:
+        case PacketType::NodeMuteRequest:
+        case PacketType::NodeIgnoreRequest:
+        case PacketType::MessagesSubscribe:
+        case PacketType::MessagesUnsubscribe:
+            return PacketPriority::Control;
+
+        // large transfers that can tolerate latency
+        case PacketType::AssetGetReply:
+        case PacketType::AssetUpload:
+        case PacketType::AvatarIdentity:
+        case PacketType::BulkAvatarTraits:
+        case PacketType::OctreeDataFileReply:
+        case PacketType::OctreeDataPersist:
+        case PacketType::OctreeFileReplacement:
+        case PacketType::DomainContentReplacementFromUrl:
+        case PacketType::EntityServerScriptLog:
+            return PacketPriority::Bulk;
+
+        default:
+            return PacketPriority::Interactive;
+    }
+}
+
 uint qHash(const PacketType& key, uint seed) {
     // seems odd that Qt couldn't figure out this cast itself, but this fixes a compile error after switch
     // to strongly typed enum for PacketType
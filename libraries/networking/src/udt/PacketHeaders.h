@@ -137,6 +137,7 @@ public:
         BulkAvatarTraitsAck,
         StopInjector,
         AvatarZonePresence,
+        EntityCacheManifest,
         NUM_PACKET_TYPE
     };
 
@@ -217,6 +218,17 @@ const int NUM_BYTES_MD5_HASH = 16;
 typedef uint8_t PacketVersion;
 
 PacketVersion versionForPacketType(PacketType packetType);
+
+// Send scheduling class for reliable packet lists, in order of precedence.
+// Each class gets a weighted share of the reliable send budget (see udt::PacketQueue).
+enum class PacketPriority : uint8_t {
+    Control = 0,
+    Interactive,
+    Bulk,
+    NUM_PRIORITIES
+};
+
+PacketPriority priorityForPacketType(PacketType packetType);
 QByteArray protocolVersionsSignature(); /// returns a unique signature for all the current protocols
 QString protocolVersionsSignatureBase64();
 
@@ -311,7 +323,9 @@ enum class AssetServerPacketVersion: PacketVersion {
     VegasCongestionControl = 19,
     RangeRequestSupport,
     RedirectedMappings,
-    BakingTextureMeta
+    BakingTextureMeta,
+    MappingChanges,
+    ResumableUploads
 };
 
 enum class AvatarMixerPacketVersion : PacketVersion {
@@ -365,7 +379,8 @@ enum class DomainConnectRequestVersion : PacketVersion {
     HasTimestamp,
     HasReason,
     HasSystemInfo,
-    HasCompressedSystemInfo
+    HasCompressedSystemInfo,
+    HasSessionTicket
 };
 
 enum class DomainConnectionDeniedVersion : PacketVersion {
@@ -386,7 +401,8 @@ enum class DomainListVersion : PacketVersion {
     GetMachineFingerprintFromUUIDSupport,
     AuthenticationOptional,
     HasTimestamp,
-    HasConnectReason
+    HasConnectReason,
+    HasSessionTicket
 };
 
 enum class AudioVersion : PacketVersion {
@@ -39,6 +39,7 @@ PacketList::PacketList(PacketType packetType, QByteArray extendedHeader, bool is
     _packetType(packetType),
     _isOrdered(isOrdered),
     _isReliable(isReliable),
+    _priority(priorityForPacketType(packetType)),
     _extendedHeader(extendedHeader)
 {
     Q_ASSERT_X(!(!_isReliable && _isOrdered), "PacketList", "Unreliable ordered PacketLists are not currently supported");
@@ -48,7 +49,9 @@ PacketList::PacketList(PacketList&& other) :
     _packetType(other._packetType),
     _packets(std::move(other._packets)),
     _isOrdered(other._isOrdered),
+    _packetSize(other._packetSize),
     _isReliable(other._isReliable),
+    _priority(other._priority),
     _extendedHeader(std::move(other._extendedHeader))
 {
 }
@@ -95,7 +98,10 @@ std::unique_ptr<Packet> PacketList::createPacket() {
     // use the static create method to create a new packet
     // If this packet list is supposed to be ordered then we consider this to be part of a message
     bool isPartOfMessage = _isOrdered;
-    return Packet::create(-1, _isReliable, isPartOfMessage);
+
+    // the size given to Packet::create doesn't count the base packet header
+    qint64 size = (_packetSize == -1) ? -1 : _packetSize - Packet::localHeaderSize();
+    return Packet::create(size, _isReliable, isPartOfMessage);
 }
 
 std::unique_ptr<Packet> PacketList::createPacketWithExtendedHeader() {
@@ -141,6 +147,29 @@ QByteArray PacketList::getMessage() const {
     return data;
 }
 
+bool PacketList::resegment(int packetSize) {
+    if (!_isOrdered || !_extendedHeader.isEmpty()) {
+        // the receiver may rely on where the packets are cut
+        return false;
+    }
+
+    closeCurrentPacket();
+
+    if (packetSize == getPacketSize() || _packets.empty()) {
+        return true;
+    }
+
+    QByteArray message = getMessage();
+
+    _packets.clear();
+    _packetSize = packetSize;
+
+    writeData(message.constData(), message.size());
+    closeCurrentPacket(true);
+
+    return true;
+}
+
 void PacketList::preparePackets(MessageNumber messageNumber) {
     Q_ASSERT(_packets.size() > 0);
     
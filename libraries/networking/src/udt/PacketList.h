@@ -37,6 +37,9 @@ public:
     PacketType getType() const { return _packetType; }
     bool isReliable() const { return _isReliable; }
     bool isOrdered() const { return _isOrdered; }
+
+    PacketPriority getPriority() const { return _priority; }
+    void setPriority(PacketPriority priority) { _priority = priority; }
     
     size_t getNumPackets() const { return _packets.size() + (_currentPacket ? 1 : 0); }
     size_t getDataSize() const;
@@ -50,6 +53,12 @@ public:
 
     virtual qint64 getMaxSegmentSize() const { return Packet::maxPayloadSize(_isOrdered); }
 
+    // Re-cuts the packets of an ordered list, which its receiver only sees as a whole message, into packets of up
+    // to packetSize bytes (as discovered for the path to the destination).
+    // Returns false if the list can't be re-cut, i.e. if it is unordered or has an extended header.
+    bool resegment(int packetSize);
+    int getPacketSize() const { return _packetSize == -1 ? MAX_PACKET_SIZE : _packetSize; }
+
     HifiSockAddr getSenderSockAddr() const;
     
     void closeCurrentPacket(bool shouldSendEmpty = false);
@@ -77,6 +86,7 @@ protected:
     std::list<std::unique_ptr<Packet>> _packets;
 
     bool _isOrdered = false;
+    int _packetSize = -1; // size of the packets created, -1 for the default MAX_PACKET_SIZE
     
 private:
     friend class ::LimitedNodeList;
@@ -96,6 +106,7 @@ private:
     
     Packet::MessageNumber _messageNumber;
     bool _isReliable = false;
+    PacketPriority _priority;
     
     std::unique_ptr<Packet> _currentPacket;
     
@@ -11,13 +11,29 @@
 
 #include "PacketQueue.h"
 
+#include <algorithm>
+
 #include "PacketList.h"
 
 using namespace udt;
 
+static const int DEFAULT_PRIORITY_WEIGHTS[(int)PacketPriority::NUM_PRIORITIES] = {
+    8, // Control
+    4, // Interactive
+    1  // Bulk
+};
+
 PacketQueue::PacketQueue(MessageNumber messageNumber) : _currentMessageNumber(messageNumber) {
-    _channels.emplace_front(new std::list<PacketPointer>());
-    _currentChannel = _channels.begin();
+    for (int i = 0; i < NUM_PRIORITIES; ++i) {
+        auto& priorityClass = _priorityClasses[i];
+        priorityClass.weight = DEFAULT_PRIORITY_WEIGHTS[i];
+        priorityClass.credits = priorityClass.weight;
+        priorityClass.currentChannel = priorityClass.channels.end();
+    }
+
+    auto& controlClass = _priorityClasses[(int)PacketPriority::Control];
+    controlClass.channels.emplace_front(new std::list<PacketPointer>());
+    controlClass.currentChannel = controlClass.channels.begin();
 }
 
 MessageNumber PacketQueue::getNextMessageNumber() {
@@ -26,11 +42,55 @@ MessageNumber PacketQueue::getNextMessageNumber() {
     return _currentMessageNumber;
 }
 
+void PacketQueue::setPriorityWeight(PacketPriority priority, int weight) {
+    LockGuard locker(_packetsLock);
+    auto& priorityClass = _priorityClasses[(int)priority];
+    priorityClass.weight = std::max(weight, 1);
+    priorityClass.credits = std::min(priorityClass.credits, priorityClass.weight);
+}
+
+int PacketQueue::getPriorityWeight(PacketPriority priority) const {
+    LockGuard locker(_packetsLock);
+    return _priorityClasses[(int)priority].weight;
+}
+
+bool PacketQueue::isEmpty(const PriorityClass& priorityClass) const {
+    // Only the main channel can be left empty in the list, all others are removed once drained
+    return priorityClass.channels.empty() ||
+        (priorityClass.channels.size() == 1 && priorityClass.channels.front()->empty());
+}
+
 bool PacketQueue::isEmpty() const {
     LockGuard locker(_packetsLock);
 
-    // Only the main channel and it is empty
-    return _channels.size() == 1 && _channels.front()->empty();
+    for (const auto& priorityClass : _priorityClasses) {
+        if (!isEmpty(priorityClass)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+PacketQueue::PriorityClass& PacketQueue::nextPriorityClass() {
+    // Weighted round-robin: classes are considered in order of precedence, and each one can send up to its
+    // weight in packets per round. Since this is re-evaluated for every packet, a higher priority list queued
+    // behind a bulk transfer gets sent at the next packet boundary.
+    for (int pass = 0; pass < 2; ++pass) {
+        for (auto& priorityClass : _priorityClasses) {
+            if (priorityClass.credits > 0 && !isEmpty(priorityClass)) {
+                --priorityClass.credits;
+                return priorityClass;
+            }
+        }
+
+        // every class with data has used its share, start a new round
+        for (auto& priorityClass : _priorityClasses) {
+            priorityClass.credits = priorityClass.weight;
+        }
+    }
+
+    Q_ASSERT(false);
+    return _priorityClasses.front();
 }
 
 PacketQueue::PacketPointer PacketQueue::takePacket() {
@@ -40,15 +100,28 @@ PacketQueue::PacketPointer PacketQueue::takePacket() {
         return PacketPointer();
     }
 
-    // handle the case where we are looking at the first channel and it is empty
-    if (_currentChannel == _channels.begin() && (*_currentChannel)->empty()) {
-        ++_currentChannel;
+    auto& priorityClass = nextPriorityClass();
+    bool hasMainChannel = &priorityClass == &_priorityClasses[(int)PacketPriority::Control];
+    return takePacket(priorityClass, hasMainChannel);
+}
+
+PacketQueue::PacketPointer PacketQueue::takePacket(PriorityClass& priorityClass, bool hasMainChannel) {
+    auto& channels = priorityClass.channels;
+    auto& currentChannel = priorityClass.currentChannel;
+
+    if (currentChannel == channels.end()) {
+        currentChannel = channels.begin();
+    }
+
+    // handle the case where we are looking at the main channel and it is empty
+    if (hasMainChannel && currentChannel == channels.begin() && (*currentChannel)->empty()) {
+        ++currentChannel;
     }
 
     // at this point the current channel should always not be at the end and should also not be empty
-    Q_ASSERT(_currentChannel != _channels.end());
+    Q_ASSERT(currentChannel != channels.end());
 
-    auto& channel = *_currentChannel;
+    auto& channel = *currentChannel;
 
     Q_ASSERT(!channel->empty());
 
@@ -57,23 +130,23 @@ PacketQueue::PacketPointer PacketQueue::takePacket() {
     channel->pop_front();
 
     // Remove now empty channel (Don't remove the main channel)
-    if (channel->empty() && _currentChannel != _channels.begin()) {
+    if (channel->empty() && !(hasMainChannel && currentChannel == channels.begin())) {
         // erase the current channel and slide the iterator to the next channel
-        _currentChannel = _channels.erase(_currentChannel);
+        currentChannel = channels.erase(currentChannel);
     } else {
-        ++_currentChannel;
+        ++currentChannel;
     }
 
     // push forward our number of channels taken from
-    ++_channelsVisitedCount;
+    ++priorityClass.channelsVisitedCount;
 
-    // check if we need to restart back at the front channel (main)
+    // check if we need to restart back at the front channel
     // to respect our capped number of channels considered concurrently
-    static const int MAX_CHANNELS_SENT_CONCURRENTLY = 16;
+    static const unsigned int MAX_CHANNELS_SENT_CONCURRENTLY = 16;
 
-    if (_currentChannel == _channels.end() || _channelsVisitedCount >= MAX_CHANNELS_SENT_CONCURRENTLY) {
-        _channelsVisitedCount = 0;
-        _currentChannel = _channels.begin();
+    if (currentChannel == channels.end() || priorityClass.channelsVisitedCount >= MAX_CHANNELS_SENT_CONCURRENTLY) {
+        priorityClass.channelsVisitedCount = 0;
+        currentChannel = channels.begin();
     }
 
     return packet;
@@ -81,7 +154,7 @@ PacketQueue::PacketPointer PacketQueue::takePacket() {
 
 void PacketQueue::queuePacket(PacketPointer packet) {
     LockGuard locker(_packetsLock);
-    _channels.front()->push_back(std::move(packet));
+    _priorityClasses[(int)PacketPriority::Control].channels.front()->push_back(std::move(packet));
 }
 
 void PacketQueue::queuePacketList(PacketListPointer packetList) {
@@ -90,6 +163,7 @@ void PacketQueue::queuePacketList(PacketListPointer packetList) {
     }
 
     LockGuard locker(_packetsLock);
-    _channels.emplace_back(new std::list<PacketPointer>());
-    _channels.back()->swap(packetList->_packets);
+    auto& priorityClass = _priorityClasses[(int)packetList->getPriority()];
+    priorityClass.channels.emplace_back(new std::list<PacketPointer>());
+    priorityClass.channels.back()->swap(packetList->_packets);
 }
@@ -12,12 +12,14 @@
 #ifndef hifi_PacketQueue_h
 #define hifi_PacketQueue_h
 
+#include <array>
 #include <list>
 #include <vector>
 #include <memory>
 #include <mutex>
 
 #include "Packet.h"
+#include "PacketHeaders.h"
 
 namespace udt {
     
@@ -33,6 +35,15 @@ class PacketQueue {
     using RawChannel = std::list<PacketPointer>;
     using Channel = std::unique_ptr<RawChannel>;
     using Channels = std::list<Channel>;
+
+    // All the channels queued at a given priority, visited round-robin
+    struct PriorityClass {
+        Channels channels;
+        Channels::iterator currentChannel;
+        unsigned int channelsVisitedCount { 0 };
+        int credits { 0 }; // packets this class may still send in the current scheduling round
+        int weight { 1 };
+    };
     
 public:
     PacketQueue(MessageNumber messageNumber = 0);
@@ -44,18 +55,28 @@ public:
     
     Mutex& getLock() { return _packetsLock; }
 
+    // number of packets a priority class may send per scheduling round when every class has data queued
+    void setPriorityWeight(PacketPriority priority, int weight);
+    int getPriorityWeight(PacketPriority priority) const;
+
     MessageNumber getCurrentMessageNumber() const { return _currentMessageNumber; }
     
 private:
+    static const int NUM_PRIORITIES = (int)PacketPriority::NUM_PRIORITIES;
+
     MessageNumber getNextMessageNumber();
 
+    bool isEmpty(const PriorityClass& priorityClass) const;
+    PriorityClass& nextPriorityClass();
+    PacketPointer takePacket(PriorityClass& priorityClass, bool hasMainChannel);
+
     MessageNumber _currentMessageNumber { 0 };
     
     mutable Mutex _packetsLock; // Protects the packets to be sent.
-    Channels _channels; // One channel per packet list + Main channel
 
-    Channels::iterator _currentChannel;
-    unsigned int _channelsVisitedCount { 0 };
+    // One channel per packet list, grouped by priority
+    // The main channel always sits at the front of the control class
+    std::array<PriorityClass, NUM_PRIORITIES> _priorityClasses;
 };
 
 }
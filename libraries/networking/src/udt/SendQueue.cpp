@@ -171,10 +171,25 @@ void SendQueue::ack(SequenceNumber ack) {
     _emptyCondition.notify_one();
 }
 
-void SendQueue::fastRetransmit(udt::SequenceNumber ack) {
+void SendQueue::selectiveAck(SequenceNumber start, SequenceNumber end) {
+    {
+        // the receiver has these, there is no need to ever re-send them
+        QWriteLocker locker(&_sentLock);
+        for (auto seq = start; seq <= end; ++seq) {
+            _sentPackets.erase(seq);
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> nakLocker(_naksLock);
+        _naks.remove(start, end);
+    }
+}
+
+void SendQueue::fastRetransmit(udt::SequenceNumber start, udt::SequenceNumber end) {
     {
         std::lock_guard<std::mutex> nakLocker(_naksLock);
-        _naks.insert(ack, ack);
+        _naks.insert(start, end);
     }
 
     // call notify_one on the condition_variable_any in case the send thread is sleeping waiting for losses to re-send
@@ -73,7 +73,8 @@ public slots:
     void stop();
     
     void ack(SequenceNumber ack);
-    void fastRetransmit(SequenceNumber ack);
+    void selectiveAck(SequenceNumber start, SequenceNumber end); // the receiver has these, past the cumulative ACK
+    void fastRetransmit(SequenceNumber start, SequenceNumber end);
     void handshakeACK();
     void updateDestinationAddress(HifiSockAddr newAddress);
 
@@ -243,6 +243,11 @@ qint64 Socket::writeDatagram(const QByteArray& datagram, const HifiSockAddr& soc
         qCDebug(networking) << "Attempt to writeDatagram when in unbound state to" << sockAddr;
         return -1;
     }
+    int emulatedMTU = _emulatedMTU;
+    if (emulatedMTU > 0 && datagram.size() > emulatedMTU) {
+        ++_numEmulatedFragmentedDatagrams;
+    }
+
     qint64 bytesWritten = _udpSocket.writeDatagram(datagram, sockAddr.getAddress(), sockAddr.getPort());
     int pending = _udpSocket.bytesToWrite();
     if (bytesWritten < 0 || pending) {
@@ -270,6 +275,69 @@ qint64 Socket::writeDatagram(const QByteArray& datagram, const HifiSockAddr& soc
     return bytesWritten;
 }
 
+bool Socket::canProbeMTU() {
+#if defined(Q_OS_LINUX) || defined(Q_OS_WIN)
+    return true;
+#else
+    return false;
+#endif
+}
+
+qint64 Socket::writeMTUProbe(const BasePacket& packet, const HifiSockAddr& sockAddr) {
+    int emulatedMTU = _emulatedMTU;
+    if (emulatedMTU > 0 && packet.getDataSize() > emulatedMTU) {
+        // lost on the emulated path
+        return packet.getDataSize();
+    }
+
+    if (_udpSocket.state() != QAbstractSocket::BoundState) {
+        return -1;
+    }
+
+#if defined(Q_OS_LINUX) || defined(Q_OS_WIN)
+    // The socket option applies to the whole socket, so datagrams that other threads send to other peers while it is
+    // set go out with DF as well, and one larger than the path to its peer is dropped instead of fragmented. The window
+    // is two system calls long and reliable packets are resent, which is why we put up with it. A dedicated socket isn't
+    // an option: the probe has to come from the port the peer (and any NAT in between) knows the connection by.
+    // The lock only keeps two probes from restoring each other's value.
+    Lock probeLock(_mtuProbeMutex);
+    auto sd = _udpSocket.socketDescriptor();
+
+#if defined(Q_OS_LINUX)
+    int previousValue = IP_PMTUDISC_DONT;
+    socklen_t valueSize = sizeof(previousValue);
+    getsockopt(sd, IPPROTO_IP, IP_MTU_DISCOVER, &previousValue, &valueSize);
+
+    // set the DF bit but ignore the kernel's own path MTU estimate, which is what we're checking
+    int val = IP_PMTUDISC_PROBE;
+    setsockopt(sd, IPPROTO_IP, IP_MTU_DISCOVER, &val, sizeof(val));
+    auto bytesWritten = _udpSocket.writeDatagram(packet.getData(), packet.getDataSize(),
+                                                 sockAddr.getAddress(), sockAddr.getPort());
+    setsockopt(sd, IPPROTO_IP, IP_MTU_DISCOVER, &previousValue, sizeof(previousValue));
+#else
+    DWORD previousValue = 0;
+    int valueSize = sizeof(previousValue);
+    getsockopt(sd, IPPROTO_IP, IP_DONTFRAGMENT, (char*)&previousValue, &valueSize);
+
+    DWORD val = 1; // true
+    setsockopt(sd, IPPROTO_IP, IP_DONTFRAGMENT, (const char*)&val, sizeof(val));
+    auto bytesWritten = _udpSocket.writeDatagram(packet.getData(), packet.getDataSize(),
+                                                 sockAddr.getAddress(), sockAddr.getPort());
+    setsockopt(sd, IPPROTO_IP, IP_DONTFRAGMENT, (const char*)&previousValue, sizeof(previousValue));
+#endif
+
+    return bytesWritten;
+#else
+    return -1;
+#endif
+}
+
+int Socket::getMaxPacketSize(const HifiSockAddr& sockAddr) {
+    Lock connectionsLock(_connectionsHashMutex);
+    auto it = _connectionsHash.find(sockAddr);
+    return it != _connectionsHash.end() ? it->second->getMaxPacketSize() : MAX_PACKET_SIZE;
+}
+
 Connection* Socket::findOrCreateConnection(const HifiSockAddr& sockAddr, bool filterCreate) {
     Lock connectionsLock(_connectionsHashMutex);
     auto it = _connectionsHash.find(sockAddr);
@@ -288,6 +356,7 @@ Connection* Socket::findOrCreateConnection(const HifiSockAddr& sockAddr, bool fi
             auto congestionControl = _ccFactory->create();
             congestionControl->setMaxBandwidth(_maxBandwidth);
             auto connection = std::unique_ptr<Connection>(new Connection(this, sockAddr, std::move(congestionControl)));
+            connection->setCoalesceACKs(_coalesceACKs);
             if (QThread::currentThread() != thread()) {
                 qCDebug(networking) << "Moving new Connection to NodeList thread";
                 connection->moveToThread(thread());
@@ -371,6 +440,9 @@ void Socket::readPendingDatagrams() {
     const auto abortTime = system_clock::now() + MAX_PROCESS_TIME;
     int packetSizeWithHeader = -1;
 
+    // connections holding back an ACK, flushed once we're done reading
+    std::vector<HifiSockAddr> pendingACKSockAddrs;
+
     while (_udpSocket.hasPendingDatagrams() &&
            (packetSizeWithHeader = _udpSocket.pendingDatagramSize()) != -1) {
         if (system_clock::now() > abortTime) {
@@ -463,6 +535,11 @@ void Socket::readPendingDatagrams() {
 #endif
                         continue;
                     }
+
+                    if (connection->hasPendingACK() &&
+                        std::find(pendingACKSockAddrs.begin(), pendingACKSockAddrs.end(), senderSockAddr) == pendingACKSockAddrs.end()) {
+                        pendingACKSockAddrs.push_back(senderSockAddr);
+                    }
                 } else if (connection) {
                     connection->recordReceivedUnreliablePackets(packet->getWireSize(),
                                                                 packet->getPayloadSize());
@@ -480,6 +557,17 @@ void Socket::readPendingDatagrams() {
             }
         }
     }
+
+    if (!pendingACKSockAddrs.empty()) {
+        // the connections may have gone away while we were handling packets, look them up again
+        Lock connectionsLock(_connectionsHashMutex);
+        for (const auto& sockAddr : pendingACKSockAddrs) {
+            auto it = _connectionsHash.find(sockAddr);
+            if (it != _connectionsHash.end()) {
+                it->second->flushACK();
+            }
+        }
+    }
 }
 
 void Socket::connectToSendSignal(const HifiSockAddr& destinationAddr, QObject* receiver, const char* slot) {
@@ -507,6 +595,14 @@ void Socket::setConnectionMaxBandwidth(int maxBandwidth) {
     }
 }
 
+void Socket::setCoalesceACKs(bool coalesceACKs) {
+    _coalesceACKs = coalesceACKs;
+    Lock connectionsLock(_connectionsHashMutex);
+    for (auto& pair : _connectionsHash) {
+        pair.second->setCoalesceACKs(_coalesceACKs);
+    }
+}
+
 ConnectionStats::Stats Socket::sampleStatsForConnection(const HifiSockAddr& destination) {
     auto it = _connectionsHash.find(destination);
     if (it != _connectionsHash.end()) {
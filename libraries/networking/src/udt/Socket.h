@@ -66,6 +66,14 @@ public:
     qint64 writePacketList(std::unique_ptr<PacketList> packetList, const HifiSockAddr& sockAddr);
     qint64 writeDatagram(const char* data, qint64 size, const HifiSockAddr& sockAddr);
     qint64 writeDatagram(const QByteArray& datagram, const HifiSockAddr& sockAddr);
+
+    // Sends a path MTU probe with fragmentation disallowed, which the rest of our traffic allows (see bind).
+    // Fragmentation is disallowed for the whole socket while the probe is sent, including for other threads' datagrams.
+    qint64 writeMTUProbe(const BasePacket& packet, const HifiSockAddr& sockAddr);
+    static bool canProbeMTU();
+
+    // Largest packet size discovered for the connection to sockAddr, MAX_PACKET_SIZE if unknown
+    int getMaxPacketSize(const HifiSockAddr& sockAddr);
     
     void bind(const QHostAddress& address, quint16 port = 0);
     void rebind(quint16 port);
@@ -83,6 +91,7 @@ public:
     
     void setCongestionControlFactory(std::unique_ptr<CongestionControlVirtualFactory> ccFactory);
     void setConnectionMaxBandwidth(int maxBandwidth);
+    void setCoalesceACKs(bool coalesceACKs); // see Connection::setCoalesceACKs
 
     void messageReceived(std::unique_ptr<Packet> packet);
     void messageFailed(Connection* connection, Packet::MessageNumber messageNumber);
@@ -116,6 +125,11 @@ private:
     ConnectionStats::Stats sampleStatsForConnection(const HifiSockAddr& destination);
     
     std::vector<HifiSockAddr> getConnectionSockAddrs();
+
+    // emulates a path with the given MTU (UDP payload bytes): larger MTU probes are dropped and larger datagrams are
+    // counted as fragmented
+    void setEmulatedMTU(int emulatedMTU) { _emulatedMTU = emulatedMTU; }
+    int getNumEmulatedFragmentedDatagrams() const { return _numEmulatedFragmentedDatagrams; }
     void connectToSendSignal(const HifiSockAddr& destinationAddr, QObject* receiver, const char* slot);
     
     Q_INVOKABLE void writeReliablePacket(Packet* packet, const HifiSockAddr& sockAddr);
@@ -130,6 +144,7 @@ private:
 
     Mutex _unreliableSequenceNumbersMutex;
     Mutex _connectionsHashMutex;
+    Mutex _mtuProbeMutex;
 
     std::unordered_map<HifiSockAddr, BasePacketHandler> _unfilteredHandlers;
     std::unordered_map<HifiSockAddr, SequenceNumber> _unreliableSequenceNumbers;
@@ -138,6 +153,10 @@ private:
     QTimer* _readyReadBackupTimer { nullptr };
 
     int _maxBandwidth { -1 };
+    bool _coalesceACKs { true };
+
+    std::atomic<int> _emulatedMTU { 0 };
+    std::atomic<int> _numEmulatedFragmentedDatagrams { 0 };
 
     std::unique_ptr<CongestionControlVirtualFactory> _ccFactory { new CongestionControlFactory<TCPVegasCC>() };
 
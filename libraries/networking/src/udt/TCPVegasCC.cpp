@@ -86,6 +86,11 @@ bool TCPVegasCC::onACK(SequenceNumber ack, p_high_resolution_clock::time_point r
 
     bool wasDuplicateACK = (ack == previousAck);
 
+    // a single ACK may cover several packets if the receiver coalesces them, count packets rather than ACKs
+    if (ack > previousAck) {
+        _numACKedPackets += seqlen(previousAck, ack) - 1;
+    }
+
     auto it = std::find_if(_sentPacketDatas.begin(), _sentPacketDatas.end(), [ack](SentPacketData& packetTime){
         return packetTime.sequenceNumber == ack;
     });
@@ -245,8 +250,9 @@ void TCPVegasCC::performCongestionAvoidance(udt::SequenceNumber ack) {
     // reset our state for the next RTT
     _currentMinRTT = std::numeric_limits<int>::max();
 
-    // reset our count of collected RTT samples
+    // reset our count of collected RTT samples and ACKed packets
     _numRTTs = 0;
+    _numACKedPackets = 0;
 }
 
 
@@ -267,29 +273,29 @@ void TCPVegasCC::performRenoCongestionAvoidance(SequenceNumber ack) {
         return;
     }
 
-    int numRTTCollected = _numRTTs;
+    int numACKedPackets = _numACKedPackets;
 
     if (_slowStart) {
         // while in slow start we grow the congestion window by the number of ACKed packets
         // allowing it to grow as high as the slow start threshold
-        int congestionWindow = _congestionWindowSize + numRTTCollected;
+        int congestionWindow = _congestionWindowSize + numACKedPackets;
 
         if (congestionWindow > udt::MAX_PACKETS_IN_FLIGHT) {
             // we're done with slow start, set the congestion window to the slow start threshold
             _congestionWindowSize = udt::MAX_PACKETS_IN_FLIGHT;
 
-            // figure out how many left over ACKs we should apply using the regular reno congestion avoidance
-            numRTTCollected = congestionWindow - udt::MAX_PACKETS_IN_FLIGHT;
+            // figure out how many left over ACKed packets we should apply using the regular reno congestion avoidance
+            numACKedPackets = congestionWindow - udt::MAX_PACKETS_IN_FLIGHT;
         } else {
             _congestionWindowSize = congestionWindow;
-            numRTTCollected = 0;
+            numACKedPackets = 0;
         }
     }
 
     // grab the size of the window prior to reno additive increase
     int preAIWindowSize = _congestionWindowSize;
 
-    if (numRTTCollected > 0) {
+    if (numACKedPackets > 0) {
         // Once we are out of slow start, we use additive increase to grow the window slowly.
         // We grow the congestion window by a single packet everytime the entire congestion window is sent.
 
@@ -299,8 +305,8 @@ void TCPVegasCC::performRenoCongestionAvoidance(SequenceNumber ack) {
             ++_congestionWindowSize;
         }
 
-        // increase the window size by (1 / window size) for every ACK received
-        _ackAICount += numRTTCollected;
+        // increase the window size by (1 / window size) for every packet ACKed
+        _ackAICount += numACKedPackets;
         if (_ackAICount >= preAIWindowSize) {
             // when _ackAICount % preAIWindowSize == 0 then _ackAICount is 0
             // when _ackAICount % preAIWindowSize != 0 then _ackAICount is _ackAICount - (_ackAICount % preAIWindowSize)
@@ -71,7 +71,8 @@ private:
 
     int _numRTTs { 0 }; // Number of RTTs calculated during the last RTT (since last performed congestion avoidance)
 
-    int _ackAICount { 0 }; // Counter for number of ACKs received for Reno additive increase
+    int _numACKedPackets { 0 }; // Number of packets newly covered by ACKs since the last congestion avoidance
+    int _ackAICount { 0 }; // Counter for number of ACKed packets for Reno additive increase
     int _duplicateACKCount { 0 }; // Counter for duplicate ACKs received
 
     int _slowStartOddAdjust { 0 }; // Marker for every window adjustment every other RTT in slow-start
@@ -109,6 +109,7 @@ public:
     SharedNodePointer sourceNode;
     int elementsPerPacket = 0;
     int entitiesPerPacket = 0;
+    quint64 packetSentTime = 0; // in the sender's time frame
 
     ReadBitstreamToTreeParams(
         bool includeExistsBits = WANT_EXISTS_BITS,
@@ -16,6 +16,12 @@ class Encoder {
 public:
     virtual ~Encoder() { }
     virtual void encode(const QByteArray& decodedBuffer, QByteArray& encodedBuffer) = 0;
+
+    // tuning to the link the encoded stream is sent over, ignored by codecs that can't adapt
+    virtual void setBitrate(int bitrate) { }
+    virtual void setComplexity(int complexity) { }
+    virtual void setInbandFEC(int inbandFEC) { }
+    virtual void setExpectedPacketLossPercentage(int percentage) { }
 };
 
 class Decoder {
@@ -24,6 +30,9 @@ public:
     virtual void decode(const QByteArray& encodedBuffer, QByteArray& decodedBuffer) = 0;
 
     virtual void lostFrame(QByteArray& decodedBuffer) = 0;
+
+    // Rebuilds the frame lost right before nextEncodedBuffer, from the redundancy the encoder put in it if any
+    virtual void recoverFrame(const QByteArray& nextEncodedBuffer, QByteArray& decodedBuffer) { lostFrame(decodedBuffer); }
 };
 
 class CodecPlugin : public Plugin {
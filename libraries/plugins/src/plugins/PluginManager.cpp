@@ -11,8 +11,11 @@
 
 #include <QtCore/QCoreApplication>
 #include <QtCore/QDir>
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QDebug>
+#include <QtCore/QJsonArray>
 #include <QtCore/QPluginLoader>
+#include <QtGui/QGuiApplication>
 #include <shared/QtHelpers.h>
 
 //#define HIFI_PLUGINMANAGER_DEBUG
@@ -21,6 +24,7 @@
 #endif
 
 #include <DependencyManager.h>
+#include <SharedUtil.h>
 #include <UserActivityLogger.h>
 #include <QThreadPool>
 
@@ -68,6 +72,44 @@ int getPluginInterfaceVersionFromMetaData(const QJsonObject& object) {
     return object[METADATA_KEY][NAME_KEY].toInt(0);
 }
 
+// The kind of provider of an interface is the last part of its IID, e.g. "codec" for CodecProvider
+QString getProviderKind(const QString& iid) {
+    return iid.section('.', -1);
+}
+
+// The kinds of providers a plugin declares in its metadata, or the kind of the interface it was built for, if it is
+// one of the providers and doesn't declare them.
+QStringList getPluginProvidersFromMetaData(const QJsonObject& object) {
+    static const char* METADATA_KEY = "MetaData";
+    static const char* PROVIDERS_KEY = "providers";
+    QJsonValue providersValue = object[METADATA_KEY][PROVIDERS_KEY];
+    if (providersValue.isArray()) {
+        QStringList providers;
+        for (const auto& provider : providersValue.toArray()) {
+            providers << provider.toString();
+        }
+        return providers;
+    }
+
+    static const QStringList PROVIDER_IIDS {
+        DisplayProvider_iid, InputProvider_iid, CodecProvider_iid, SteamClientProvider_iid, OculusPlatformProvider_iid
+    };
+    auto iid = getPluginIIDFromMetaData(object);
+    if (PROVIDER_IIDS.contains(iid)) {
+        return { getProviderKind(iid) };
+    }
+    return {};
+}
+
+// Plugins that declare no capabilities predate them, and are loaded anywhere as they always were
+bool isPluginHeadlessFromMetaData(const QJsonObject& object) {
+    static const char* METADATA_KEY = "MetaData";
+    static const char* CAPABILITIES_KEY = "capabilities";
+    static const QString HEADLESS_CAPABILITY = "headless";
+    QJsonValue capabilitiesValue = object[METADATA_KEY][CAPABILITIES_KEY];
+    return !capabilitiesValue.isArray() || capabilitiesValue.toArray().contains(HEADLESS_CAPABILITY);
+}
+
 
 QStringList preferredDisplayPlugins;
 QStringList disabledDisplays;
@@ -75,25 +117,71 @@ QStringList disabledInputs;
 
 bool isDisabled(QJsonObject metaData) {
     auto name = getPluginNameFromMetaData(metaData);
-    auto iid = getPluginIIDFromMetaData(metaData);
+    auto providers = getPluginProvidersFromMetaData(metaData);
 
-    if (iid == DisplayProvider_iid) {
-        return disabledDisplays.contains(name);
-    } else if (iid == InputProvider_iid) {
-        return disabledInputs.contains(name);
+    if (providers.contains(getProviderKind(DisplayProvider_iid)) && disabledDisplays.contains(name)) {
+        return true;
+    } else if (providers.contains(getProviderKind(InputProvider_iid)) && disabledInputs.contains(name)) {
+        return true;
     }
 
     return false;
 }
 
 int PluginManager::instantiate() {
-    auto loaders = getLoadedPlugins();
+    auto loaders = loadPlugins(nullptr);
     return std::count_if(loaders.begin(), loaders.end(), [](const auto& loader) { return (bool)loader->instance(); });
 }
 
- auto PluginManager::getLoadedPlugins() const -> const LoaderList& {
+auto PluginManager::loadPlugins(const char* providerIID) const -> LoaderList {
+    QString kind = providerIID ? getProviderKind(providerIID) : QString();
+    LoaderList loaders;
+    const auto& libraries = getPluginLibraries();
+    int numLoaded = 0;
+    qint64 totalLoadTime = 0;
+    MemoryInfo memoryBefore;
+    bool hasMemoryInfo = getMemoryInfo(memoryBefore);
+    for (const auto& library : libraries) {
+        if (providerIID ? !library.providers.contains(kind) : !library.providers.isEmpty()) {
+            continue;
+        }
+
+        auto& loader = library.loader;
+        QElapsedTimer loadTimer;
+        loadTimer.start();
+        if (loader->isLoaded()) {
+            loaders.push_back(loader);
+        } else if (loader->load()) {
+            qCDebug(plugins) << "Plugin" << qPrintable(loader->fileName()) << "loaded successfully in"
+                             << loadTimer.elapsed() << "ms";
+            ++numLoaded;
+            totalLoadTime += loadTimer.elapsed();
+            loaders.push_back(loader);
+        } else {
+            qCDebug(plugins) << "Plugin" << qPrintable(loader->fileName()) << "failed to load:";
+            qCDebug(plugins) << " " << qPrintable(loader->errorString());
+        }
+    }
+
+    // what this request cost, to compare with how many libraries the plugins directory holds
+    if (numLoaded > 0) {
+        MemoryInfo memoryAfter;
+        if (hasMemoryInfo && getMemoryInfo(memoryAfter)) {
+            qCInfo(plugins) << "Loaded" << numLoaded << "of" << libraries.size() << "plugin libraries for"
+                            << (providerIID ? kind : QString("startup")) << "in" << totalLoadTime << "ms, using"
+                            << (qint64)(memoryAfter.processUsedMemoryBytes - memoryBefore.processUsedMemoryBytes) / 1024
+                            << "KB";
+        } else {
+            qCInfo(plugins) << "Loaded" << numLoaded << "of" << libraries.size() << "plugin libraries for"
+                            << (providerIID ? kind : QString("startup")) << "in" << totalLoadTime << "ms";
+        }
+    }
+    return loaders;
+}
+
+auto PluginManager::getPluginLibraries() const -> const QList<PluginLibrary>& {
     static std::once_flag once;
-    static LoaderList loadedPlugins;
+    static QList<PluginLibrary> pluginLibraries;
     std::call_once(once, [&] {
 #if defined(Q_OS_ANDROID)
         QString pluginPath = QCoreApplication::applicationDirPath() + "/";
@@ -113,6 +201,9 @@ int PluginManager::instantiate() {
 #endif
             auto candidates = pluginDir.entryList();
 
+            // servers and other processes without a GUI skip the libraries that declare they need one
+            bool isHeadless = !qobject_cast<QGuiApplication*>(QCoreApplication::instance());
+
             if (_enableScriptingPlugins.get()) {
                 QDir scriptingPluginDir{ pluginDir };
                 scriptingPluginDir.cd("scripting");
@@ -141,6 +232,11 @@ int PluginManager::instantiate() {
                     continue;
                 }
 
+                if (isHeadless && !isPluginHeadlessFromMetaData(pluginMetaData)) {
+                    qCDebug(plugins) << "Plugin" << qPrintable(plugin) << "needs a display, not loading it headless";
+                    continue;
+                }
+
                 if (getPluginInterfaceVersionFromMetaData(pluginMetaData) != HIFI_PLUGIN_INTERFACE_VERSION) {
                     qCWarning(plugins) << "Plugin" << qPrintable(plugin) << "interface version doesn't match, not loading:"
                                        << getPluginInterfaceVersionFromMetaData(pluginMetaData)
@@ -148,19 +244,14 @@ int PluginManager::instantiate() {
                     continue;
                 }
 
-                if (loader->load()) {
-                    qCDebug(plugins) << "Plugin" << qPrintable(plugin) << "loaded successfully";
-                    loadedPlugins.push_back(loader);
-                } else {
-                    qCDebug(plugins) << "Plugin" << qPrintable(plugin) << "failed to load:";
-                    qCDebug(plugins) << " " << qPrintable(loader->errorString());
-                }
+                // reading the metadata doesn't load the library, which is left to the first request for what it provides
+                pluginLibraries.push_back({ loader, getPluginProvidersFromMetaData(pluginMetaData) });
             }
         } else {
             qWarning() << "pluginPath does not exit..." << pluginDir;
         }
     });
-    return loadedPlugins;
+    return pluginLibraries;
 }
 
 const CodecPluginList& PluginManager::getCodecPlugins() {
@@ -170,7 +261,7 @@ const CodecPluginList& PluginManager::getCodecPlugins() {
         codecPlugins = _codecPluginProvider();
 
         // Now grab the dynamic plugins
-        for (auto loader : getLoadedPlugins()) {
+        for (auto loader : loadPlugins(CodecProvider_iid)) {
             CodecProvider* codecProvider = qobject_cast<CodecProvider*>(loader->instance());
             if (codecProvider) {
                 for (auto codecPlugin : codecProvider->getCodecPlugins()) {
@@ -196,7 +287,7 @@ const SteamClientPluginPointer PluginManager::getSteamClientPlugin() {
     static std::once_flag once;
     std::call_once(once, [&] {
         // Now grab the dynamic plugins
-        for (auto loader : getLoadedPlugins()) {
+        for (auto loader : loadPlugins(SteamClientProvider_iid)) {
             SteamClientProvider* steamClientProvider = qobject_cast<SteamClientProvider*>(loader->instance());
             if (steamClientProvider) {
                 steamClientPlugin = steamClientProvider->getSteamClientPlugin();
@@ -212,7 +303,7 @@ const OculusPlatformPluginPointer PluginManager::getOculusPlatformPlugin() {
     static std::once_flag once;
     std::call_once(once, [&] {
         // Now grab the dynamic plugins
-        for (auto loader : getLoadedPlugins()) {
+        for (auto loader : loadPlugins(OculusPlatformProvider_iid)) {
             OculusPlatformProvider* oculusPlatformProvider = qobject_cast<OculusPlatformProvider*>(loader->instance());
             if (oculusPlatformProvider) {
                 oculusPlatformPlugin = oculusPlatformProvider->getOculusPlatformPlugin();
@@ -244,7 +335,7 @@ DisplayPluginList PluginManager::getAllDisplayPlugins() {
 
 
         // Now grab the dynamic plugins
-        for (auto loader : getLoadedPlugins()) {
+        for (auto loader : loadPlugins(DisplayProvider_iid)) {
             DisplayProvider* displayProvider = qobject_cast<DisplayProvider*>(loader->instance());
             if (displayProvider) {
                 for (auto displayPlugin : displayProvider->getDisplayPlugins()) {
@@ -289,7 +380,7 @@ const InputPluginList& PluginManager::getInputPlugins() {
         _inputPlugins = _inputPluginProvider();
 
         // Now grab the dynamic plugins
-        for (auto loader : getLoadedPlugins()) {
+        for (auto loader : loadPlugins(InputProvider_iid)) {
             InputProvider* inputProvider = qobject_cast<InputProvider*>(loader->instance());
             if (inputProvider) {
                 for (auto inputPlugin : inputProvider->getInputPlugins()) {
@@ -374,9 +465,12 @@ void PluginManager::shutdown() {
         }
     }
 
-    auto loadedPlugins = getLoadedPlugins();
-    // Now grab the dynamic plugins
-    for (auto loader : getLoadedPlugins()) {
+    // Now grab the dynamic plugins that were loaded
+    for (const auto& library : getPluginLibraries()) {
+        auto& loader = library.loader;
+        if (!loader->isLoaded()) {
+            continue;
+        }
         InputProvider* inputProvider = qobject_cast<InputProvider*>(loader->instance());
         if (inputProvider) {
             inputProvider->destroyInputPlugins();
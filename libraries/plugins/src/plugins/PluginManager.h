@@ -39,6 +39,8 @@ public:
     void saveSettings();
     void setContainer(PluginContainer* container) { _container = container; }
 
+    // Instantiates the plugins that don't provide anything, such as the scripting ones. The others are only loaded
+    // once what they provide is asked for.
     int instantiate();
     void shutdown();
 
@@ -71,7 +73,17 @@ private:
     using Loader = QSharedPointer<QPluginLoader>;
     using LoaderList = QList<Loader>;
 
-    const LoaderList& getLoadedPlugins() const;
+    // A library in the plugins directory, with the kinds of providers it declares in its metadata. It is only loaded
+    // when a provider of one of those kinds is asked for.
+    struct PluginLibrary {
+        Loader loader;
+        QStringList providers;
+    };
+
+    const QList<PluginLibrary>& getPluginLibraries() const;
+
+    // Loads the libraries providing the interface, or those providing none when it is null
+    LoaderList loadPlugins(const char* providerIID) const;
     Setting::Handle<bool> _enableScriptingPlugins {
         "private/enableScriptingPlugins", (bool)qgetenv("enableScriptingPlugins").toInt()
     };
@@ -149,7 +149,7 @@ Transform PickManager::getResultTransform(unsigned int uid) const {
 }
 
 void PickManager::update() {
-    uint64_t expiry = usecTimestampNow() + _perFrameTimeBudget;
+    uint64_t expiry = usecTimestampNow() + (_perFrameTimeBudget >> _perFrameTimeBudgetLevel);
     std::unordered_map<PickQuery::PickType, std::unordered_map<unsigned int, std::shared_ptr<PickQuery>>> cachedPicks;
     withReadLock([&] {
         cachedPicks = _picks;
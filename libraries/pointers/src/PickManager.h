@@ -64,6 +64,9 @@ public:
 
     unsigned int getPerFrameTimeBudget() const { return _perFrameTimeBudget; }
     void setPerFrameTimeBudget(unsigned int numUsecs) { _perFrameTimeBudget = numUsecs; }
+    // Halves the per frame time budget that many times while the frame is over budget, without changing what
+    // getPerFrameTimeBudget() returns
+    void setPerFrameTimeBudgetLevel(int level) { _perFrameTimeBudgetLevel = level; }
 
     bool getForceCoarsePicking() { return _forceCoarsePicking; }
 
@@ -94,6 +97,7 @@ protected:
 
     static const unsigned int DEFAULT_PER_FRAME_TIME_BUDGET = 3 * USECS_PER_MSEC;
     unsigned int _perFrameTimeBudget { DEFAULT_PER_FRAME_TIME_BUDGET };
+    int _perFrameTimeBudgetLevel { 0 };
 };
 
 #endif // hifi_PickManager_h
@@ -12,6 +12,7 @@
 #include "MeshPartPayload.h"
 
 #include <BillboardMode.h>
+#include <NumericalConstants.h>
 #include <PerfStat.h>
 #include <DualQuaternion.h>
 #include <graphics/ShaderConstants.h>
@@ -25,6 +26,10 @@
 using namespace render;
 
 bool ModelMeshPartPayload::enableMaterialProceduralShaders = false;
+float ModelMeshPartPayload::meshLODPixelError = 1.0f;
+
+// Coarser levels of detail are only picked once their error is this fraction of the threshold, to avoid popping
+static const float MESH_LOD_HYSTERESIS = 0.75f;
 
 ModelMeshPartPayload::ModelMeshPartPayload(ModelPointer model, int meshIndex, int partIndex, int shapeIndex,
                                            const Transform& transform, const uint64_t& created) :
@@ -84,6 +89,8 @@ void ModelMeshPartPayload::initCache(const ModelPointer& model, int shapeID) {
 
 void ModelMeshPartPayload::updateMeshPart(const std::shared_ptr<const graphics::Mesh>& drawMesh, int partIndex) {
     _drawMesh = drawMesh;
+    _partIndex = partIndex;
+    _lodLevel = 0;
     if (_drawMesh) {
         auto vertexFormat = _drawMesh->getVertexFormat();
         _drawPart = _drawMesh->getPartBuffer().get<graphics::Mesh::Part>(partIndex);
@@ -91,6 +98,42 @@ void ModelMeshPartPayload::updateMeshPart(const std::shared_ptr<const graphics::
     }
 }
 
+int ModelMeshPartPayload::evalLODLevel(RenderArgs* args) const {
+    int numLODs = _drawMesh ? _drawMesh->getNumLODs() : 1;
+    if (numLODs <= 1 || meshLODPixelError <= 0.0f) {
+        return 0;
+    }
+
+    const ViewFrustum& viewFrustum = args->getViewFrustum();
+    auto bound = getBound(args);
+    float distance = glm::distance(viewFrustum.getPosition(), bound.calcCenter()) - 0.5f * glm::length(bound.getDimensions());
+    if (distance <= EPSILON) {
+        return 0;
+    }
+
+    // convert a geometric error in mesh units into pixels at the nearest point of the bound
+    glm::vec3 scale = glm::abs(_parentTransform.getScale());
+    float maxScale = glm::max(scale.x, glm::max(scale.y, scale.z));
+    float viewHeight = 2.0f * tanf(0.5f * glm::radians(viewFrustum.getFieldOfView())) * distance;
+    float errorToPixels = maxScale * (float)args->_viewport.w / viewHeight;
+
+    int lodLevel = glm::min(_lodLevel, numLODs - 1);
+    while (lodLevel > 0 && _drawMesh->getLODError(lodLevel) * errorToPixels > meshLODPixelError) {
+        lodLevel--;
+    }
+    while (lodLevel + 1 < numLODs && _drawMesh->getLODError(lodLevel + 1) * errorToPixels < MESH_LOD_HYSTERESIS * meshLODPixelError) {
+        lodLevel++;
+    }
+    return lodLevel;
+}
+
+void ModelMeshPartPayload::setLODLevel(int lodLevel) {
+    if (lodLevel != _lodLevel && _drawMesh) {
+        _lodLevel = lodLevel;
+        _drawPart = _drawMesh->getLODPart(_lodLevel, _partIndex);
+    }
+}
+
 void ModelMeshPartPayload::updateClusterBuffer(const std::vector<glm::mat4>& clusterMatrices) {
     // reset cluster buffer if we change the cluster buffer type
     if (_clusterBufferType != ClusterBufferType::Matrices) {
@@ -180,7 +223,8 @@ void ModelMeshPartPayload::updateTransformForSkinnedMesh(const Transform& modelT
 }
 
 void ModelMeshPartPayload::bindMesh(gpu::Batch& batch) {
-    batch.setIndexBuffer(gpu::UINT32, (_drawMesh->getIndexBuffer()._buffer), 0);
+    const auto& indexBuffer = _lodLevel > 0 ? _drawMesh->getLODIndexBuffer() : _drawMesh->getIndexBuffer();
+    batch.setIndexBuffer(gpu::UINT32, indexBuffer._buffer, 0);
     batch.setInputFormat((_drawMesh->getVertexFormat()));
     if (_meshBlendshapeBuffer) {
         batch.setResourceBuffer(0, _meshBlendshapeBuffer);
@@ -326,6 +370,11 @@ void ModelMeshPartPayload::render(RenderArgs* args) {
     Transform modelTransform = transform.worldTransform(_localTransform);
     bindTransform(batch, modelTransform, args->_renderMode);
 
+    // Pick the level of detail from the main view, shadows and secondary views reuse it
+    if (args->_renderMode == RenderArgs::RenderMode::DEFAULT_RENDER_MODE) {
+        setLODLevel(evalLODLevel(args));
+    }
+
     //Bind the index buffer and vertex buffer and Blend shapes if needed
     bindMesh(batch);
 
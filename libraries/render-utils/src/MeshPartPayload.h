@@ -67,12 +67,19 @@ public:
 
     static bool enableMaterialProceduralShaders;
 
+    // maximum screen space error, in pixels, of the simplified mesh levels of detail drawn
+    static float meshLODPixelError;
+
 private:
     void initCache(const ModelPointer& model, int shapeID);
+    int evalLODLevel(RenderArgs* args) const;
+    void setLODLevel(int lodLevel);
 
     int _meshIndex;
+    int _partIndex { 0 };
     std::shared_ptr<const graphics::Mesh> _drawMesh;
-    graphics::Mesh::Part _drawPart;
+    graphics::Mesh::Part _drawPart; // the part of the current level of detail
+    int _lodLevel { 0 };
     graphics::MultiMaterial _drawMaterials;
 
     gpu::BufferPointer _clusterBuffer;
@@ -78,14 +78,11 @@ void RenderShadowTask::build(JobModel& task, const render::Varying& input, rende
     const auto sortedPipelines = task.addJob<PipelineSortShapes>("PipelineSortShadow", culledShadowItems);
     const auto sortedShapes = task.addJob<DepthSortShapes>("DepthSortShadow", sortedPipelines, true);
 
-    render::Varying cascadeFrustums[SHADOW_CASCADE_MAX_COUNT] = {
-        ViewFrustumPointer()
-#if SHADOW_CASCADE_MAX_COUNT>1
-        ,ViewFrustumPointer(),
-        ViewFrustumPointer(),
-        ViewFrustumPointer()
-#endif
-    };
+    // Cull all the cascades at once
+    const auto cullInputs = CullShadowCascades::Inputs(sortedShapes, shadowFrame, currentKeyLight).asVarying();
+    const auto culledShadowCascades = task.addJob<CullShadowCascades>("CullShadowCascades", cullInputs, shadowCasterReceiverFilter);
+    const auto cascadeShapes = culledShadowCascades.getN<CullShadowCascades::Outputs>(0);
+    const auto cascadeBoxes = culledShadowCascades.getN<CullShadowCascades::Outputs>(1);
 
     CascadeBoxes cascadeSceneBBoxes;
 
@@ -94,25 +91,16 @@ void RenderShadowTask::build(JobModel& task, const render::Varying& input, rende
         sprintf(jobName, "ShadowCascadeSetup%d", i);
         const auto cascadeSetupOutput = task.addJob<RenderShadowCascadeSetup>(jobName, shadowFrame, i, shadowCasterReceiverFilter);
         const auto shadowFilter = cascadeSetupOutput.getN<RenderShadowCascadeSetup::Outputs>(0);
-        auto antiFrustum = render::Varying(ViewFrustumPointer());
-        cascadeFrustums[i] = cascadeSetupOutput.getN<RenderShadowCascadeSetup::Outputs>(1);
-        if (i > 1) {
-            antiFrustum = cascadeFrustums[i - 2];
-        }
-
-        const auto cullInputs = CullShadowBounds::Inputs(sortedShapes, shadowFilter, antiFrustum, currentKeyLight, cascadeSetupOutput.getN<RenderShadowCascadeSetup::Outputs>(2)).asVarying();
-        sprintf(jobName, "CullShadowCascade%d", i);
-        const auto culledShadowItemsAndBounds = task.addJob<CullShadowBounds>(jobName, cullInputs);
 
         // GPU jobs: Render to shadow map
         sprintf(jobName, "RenderShadowMap%d", i);
-        const auto shadowInputs = RenderShadowMap::Inputs(culledShadowItemsAndBounds.getN<CullShadowBounds::Outputs>(0),
-            culledShadowItemsAndBounds.getN<CullShadowBounds::Outputs>(1), shadowFrame).asVarying();
+        const auto shadowInputs = RenderShadowMap::Inputs(cascadeShapes.getN<CullShadowCascades::CascadeShapes>(i),
+            cascadeBoxes.getN<CascadeBoxes>(i), shadowFrame).asVarying();
         task.addJob<RenderShadowMap>(jobName, shadowInputs, shapePlumber, i);
         sprintf(jobName, "ShadowCascadeTeardown%d", i);
         task.addJob<RenderShadowCascadeTeardown>(jobName, shadowFilter);
 
-        cascadeSceneBBoxes[i] = culledShadowItemsAndBounds.getN<CullShadowBounds::Outputs>(1);
+        cascadeSceneBBoxes[i] = cascadeBoxes.getN<CascadeBoxes>(i);
     }
     task.addJob<RenderShadowTeardown>("ShadowTeardown", setupOutput);
 
@@ -471,6 +459,16 @@ void RenderShadowSetup::run(const render::RenderContextPointer& renderContext, c
     output.edit1() = queryResolution;
 }
 
+static float computeCascadeMinSquareSize(const LightStage::Shadow::Cascade& cascade) {
+    const auto& cascadeFrustum = cascade.getFrustum();
+    auto texelSize = glm::min(cascadeFrustum->getHeight(), cascadeFrustum->getWidth()) / cascade.framebuffer->getSize().x;
+    // Set the cull threshold to 24 shadow texels. This is totally arbitrary
+    const auto minTexelCount = 24.0f;
+    // TODO : maybe adapt that with LOD management system?
+    texelSize *= minTexelCount;
+    return texelSize * texelSize;
+}
+
 void RenderShadowCascadeSetup::run(const render::RenderContextPointer& renderContext, const Inputs& input, Outputs& output) {
     const auto shadowFrame = input;
 
@@ -488,12 +486,7 @@ void RenderShadowCascadeSetup::run(const render::RenderContextPointer& renderCon
             auto& cascade = globalShadow->getCascade(_cascadeIndex);
             auto& cascadeFrustum = cascade.getFrustum();
             args->pushViewFrustum(*cascadeFrustum);
-            auto texelSize = glm::min(cascadeFrustum->getHeight(), cascadeFrustum->getWidth()) / cascade.framebuffer->getSize().x;
-            // Set the cull threshold to 24 shadow texels. This is totally arbitrary
-            const auto minTexelCount = 24.0f;
-            // TODO : maybe adapt that with LOD management system?
-            texelSize *= minTexelCount;
-            cullFunctor._minSquareSize = texelSize * texelSize;
+            cullFunctor._minSquareSize = computeCascadeMinSquareSize(cascade);
 
             output.edit1() = cascadeFrustum;
 
@@ -548,85 +541,97 @@ static AABox& merge(AABox& box, const AABox& otherBox, const glm::vec3& dir) {
     return box;
 }
 
-void CullShadowBounds::run(const render::RenderContextPointer& renderContext, const Inputs& inputs, Outputs& outputs) {
+void CullShadowCascades::run(const render::RenderContextPointer& renderContext, const Inputs& inputs, Outputs& outputs) {
     assert(renderContext->args);
-    assert(renderContext->args->hasViewFrustum());
     RenderArgs* args = renderContext->args;
 
     const auto& inShapes = inputs.get0();
-    const auto& filter = inputs.get1();
-    ViewFrustumPointer antiFrustum;
-    auto& outShapes = outputs.edit0();
-    auto& outBounds = outputs.edit1();
+    const auto& shadowFrame = inputs.get1();
+    const auto& currentKeyLight = inputs.get2();
+
+    // Edit the outputs in place, the cascades are linked to their elements
+    auto& outCascadeShapes = outputs.edit0();
+    auto& outCascadeBounds = outputs.edit1();
+    for (int i = 0; i < SHADOW_CASCADE_MAX_COUNT; i++) {
+        outCascadeShapes[i].edit<ShapeBounds>().clear();
+        outCascadeBounds[i].edit<AABox>() = AABox();
+    }
+
+    LightStage::ShadowPointer globalShadow;
+    if (shadowFrame && !shadowFrame->_objects.empty()) {
+        globalShadow = shadowFrame->_objects[0];
+    }
+    if (_filter.selectsNothing() || !currentKeyLight || !globalShadow) {
+        _culls.clear();
+        return;
+    }
 
-    if (!inputs[3].isNull()) {
-        antiFrustum = inputs.get2();
+    MultiViewCull::Views views;
+    int numViews = 0;
+    const int cascadeCount = (int)glm::min(globalShadow->getCascadeCount(), (unsigned int)SHADOW_CASCADE_MAX_COUNT);
+    for (int i = 0; i < cascadeCount; i++) {
+        const auto& cascade = globalShadow->getCascade(i);
+        views[i].frustum = cascade.getFrustum();
+        views[i].minSquareSize = computeCascadeMinSquareSize(cascade);
+        // Items entirely covered by the cascade before the previous one are already shadowed there
+        if (i > 1) {
+            views[i].antiFrustum = views[i - 2].frustum;
+        }
+        numViews++;
     }
-    outShapes.clear();
-    outBounds = AABox();
-
-    const auto currentKeyLight = inputs.get3();
-    auto cullFunctor = inputs.get4();
-
-    render::CullFunctor shadowCullFunctor = [cullFunctor](const RenderArgs* args, const AABox& bounds) {
-        return cullFunctor(args, bounds);
-    };
-
-    if (!filter.selectsNothing() && currentKeyLight) {
-        auto& details = args->_details.edit(RenderDetails::SHADOW);
-        render::CullTest test(shadowCullFunctor, args, details, antiFrustum);
-        auto scene = args->_scene;
-        auto lightStage = renderContext->_scene->getStage<LightStage>();
-        assert(lightStage);
-        const auto globalLightDir = currentKeyLight->getDirection();
-        auto castersFilter = render::ItemFilter::Builder(filter).withShadowCaster().build();
-
-        for (auto& inItems : inShapes) {
-            auto key = inItems.first;
-            auto outItems = outShapes.find(key);
-            if (outItems == outShapes.end()) {
-                outItems = outShapes.insert(std::make_pair(key, ItemBounds{})).first;
-                outItems->second.reserve(inItems.second.size());
+
+    auto& details = args->_details.edit(RenderDetails::SHADOW);
+    auto& scene = args->_scene;
+    const auto globalLightDir = currentKeyLight->getDirection();
+    auto castersFilter = render::ItemFilter::Builder(_filter).withShadowCaster().build();
+
+    for (auto& inItems : inShapes) {
+        const auto& key = inItems.first;
+        const auto& masks = _culls[key].run(views, inItems.second);
+
+        std::array<ItemBounds*, SHADOW_CASCADE_MAX_COUNT> outItems;
+        for (int i = 0; i < numViews; i++) {
+            auto& outShapes = outCascadeShapes[i].edit<ShapeBounds>();
+            outItems[i] = &outShapes.emplace(key, ItemBounds{}).first->second;
+        }
+
+        details._considered += (int)inItems.second.size() * numViews;
+
+        for (size_t j = 0; j < masks.size(); j++) {
+            const auto mask = masks[j];
+            if (!mask) {
+                continue;
             }
 
-            details._considered += (int)inItems.second.size();
-
-            if (antiFrustum == nullptr) {
-                for (auto& item : inItems.second) {
-                    if (test.solidAngleTest(item.bound) && test.frustumTest(item.bound)) {
-                        const auto shapeKey = scene->getItem(item.id).getKey();
-                        if (castersFilter.test(shapeKey)) {
-                            outItems->second.emplace_back(item);
-                            outBounds += item.bound;
-                        } else {
-                            // Receivers are not rendered but they still increase the bounds of the shadow scene
-                            // although only in the direction of the light direction so as to have a correct far
-                            // distance without decreasing the near distance.
-                            merge(outBounds, item.bound, globalLightDir);
-                        }
-                    }
-                }
-            } else {
-                for (auto& item : inItems.second) {
-                    if (test.solidAngleTest(item.bound) && test.frustumTest(item.bound) && test.antiFrustumTest(item.bound)) {
-                        const auto shapeKey = scene->getItem(item.id).getKey();
-                        if (castersFilter.test(shapeKey)) {
-                            outItems->second.emplace_back(item);
-                            outBounds += item.bound;
-                        } else {
-                            // Receivers are not rendered but they still increase the bounds of the shadow scene
-                            // although only in the direction of the light direction so as to have a correct far
-                            // distance without decreasing the near distance.
-                            merge(outBounds, item.bound, globalLightDir);
-                        }
+            const auto& item = inItems.second[j];
+            const bool isCaster = castersFilter.test(scene->getItem(item.id).getKey());
+            for (int i = 0; i < numViews; i++) {
+                if (mask & (1 << i)) {
+                    auto& outBounds = outCascadeBounds[i].edit<AABox>();
+                    if (isCaster) {
+                        outItems[i]->emplace_back(item);
+                        outBounds += item.bound;
+                    } else {
+                        // Receivers are not rendered but they still increase the bounds of the shadow scene
+                        // although only in the direction of the light direction so as to have a correct far
+                        // distance without decreasing the near distance.
+                        merge(outBounds, item.bound, globalLightDir);
                     }
                 }
             }
-            details._rendered += (int)outItems->second.size();
         }
 
-        for (auto& items : outShapes) {
-            items.second.shrink_to_fit();
+        for (int i = 0; i < numViews; i++) {
+            details._rendered += (int)outItems[i]->size();
+        }
+    }
+
+    // Forget the shapes that aren't in the selection anymore
+    for (auto it = _culls.begin(); it != _culls.end();) {
+        if (inShapes.find(it->first) == inShapes.end()) {
+            it = _culls.erase(it);
+        } else {
+            ++it;
         }
     }
 }
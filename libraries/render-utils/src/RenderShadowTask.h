@@ -16,6 +16,7 @@
 #include <gpu/Pipeline.h>
 
 #include <render/CullTask.h>
+#include <render/MultiViewCull.h>
 
 #include "Shadows_shared.slh"
 
@@ -173,13 +174,24 @@ public:
     void run(const render::RenderContextPointer& renderContext, const Input& input);
 };
 
-class CullShadowBounds {
+// Culls the shadow casters and receivers of all the cascades in a single pass over the sorted shapes.
+// Each item is tested against every cascade at once, and the results for items that didn't move are kept from
+// one frame to the next for the cascades whose frustum didn't change either, so a still light and camera over a
+// static scene don't cost any frustum test.
+class CullShadowCascades {
 public:
-    using Inputs = render::VaryingSet5<render::ShapeBounds, render::ItemFilter, ViewFrustumPointer, graphics::LightPointer, RenderShadowTask::CullFunctor>;
-    using Outputs = render::VaryingSet2<render::ShapeBounds, AABox>;
-    using JobModel = render::Job::ModelIO<CullShadowBounds, Inputs, Outputs>;
+    using CascadeShapes = render::VaryingArray<render::ShapeBounds, SHADOW_CASCADE_MAX_COUNT>;
+    using Inputs = render::VaryingSet3<render::ShapeBounds, LightStage::ShadowFramePointer, graphics::LightPointer>;
+    using Outputs = render::VaryingSet2<CascadeShapes, RenderShadowTask::CascadeBoxes>;
+    using JobModel = render::Job::ModelIO<CullShadowCascades, Inputs, Outputs>;
+
+    CullShadowCascades(render::ItemFilter filter) : _filter(filter) {}
 
     void run(const render::RenderContextPointer& renderContext, const Inputs& inputs, Outputs& outputs);
+
+private:
+    render::ItemFilter _filter;
+    std::unordered_map<render::ShapeKey, render::MultiViewCull, render::ShapeKey::Hash, render::ShapeKey::KeyEqual> _culls;
 };
 
 #endif // hifi_RenderShadowTask_h
@@ -0,0 +1,97 @@
+//
+//  MultiViewCull.cpp
+//  render/src/render
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "MultiViewCull.h"
+
+using namespace render;
+
+MultiViewCull::ViewState::ViewState(const View& view) :
+    minSquareSize(view.minSquareSize),
+    enabled(view.frustum != nullptr),
+    hasAntiFrustum(view.antiFrustum != nullptr)
+{
+    if (enabled) {
+        this->view = view.frustum->getView();
+        projection = view.frustum->getProjection();
+    }
+    if (hasAntiFrustum) {
+        antiView = view.antiFrustum->getView();
+        antiProjection = view.antiFrustum->getProjection();
+    }
+}
+
+bool MultiViewCull::ViewState::operator==(const ViewState& other) const {
+    if (enabled != other.enabled || hasAntiFrustum != other.hasAntiFrustum || minSquareSize != other.minSquareSize) {
+        return false;
+    }
+    if (enabled && (view != other.view || projection != other.projection)) {
+        return false;
+    }
+    return !hasAntiFrustum || (antiView == other.antiView && antiProjection == other.antiProjection);
+}
+
+void MultiViewCull::reset() {
+    _viewStates = std::array<ViewState, MAX_VIEW_COUNT>();
+    _items.clear();
+    _masks.clear();
+    _numTests = 0;
+}
+
+const std::vector<MultiViewCull::ViewMask>& MultiViewCull::run(const Views& views, const ItemBounds& items) {
+    // Views that changed since the last run have to be tested again for every item
+    ViewMask keptViews = 0;
+    ViewMask enabledViews = 0;
+    for (int i = 0; i < MAX_VIEW_COUNT; i++) {
+        ViewState state(views[i]);
+        if (state == _viewStates[i]) {
+            keptViews |= (1 << i);
+        } else {
+            _viewStates[i] = state;
+        }
+        if (state.enabled) {
+            enabledViews |= (1 << i);
+        }
+    }
+
+    _numTests = 0;
+    const auto numItems = items.size();
+    const auto numKnownItems = std::min(numItems, _items.size());
+    _items.resize(numItems);
+    _masks.resize(numItems);
+
+    for (size_t i = 0; i < numItems; i++) {
+        const auto& item = items[i];
+        ViewMask mask = 0;
+        ViewMask viewsToTest = enabledViews;
+        if (i < numKnownItems && _items[i].id == item.id && _items[i].bound == item.bound) {
+            mask = _masks[i] & keptViews;
+            viewsToTest &= ~keptViews;
+        } else {
+            _items[i] = item;
+        }
+
+        if (viewsToTest) {
+            const auto squareSize = glm::dot(item.bound.getDimensions(), item.bound.getDimensions());
+            for (int j = 0; j < MAX_VIEW_COUNT; j++) {
+                if (viewsToTest & (1 << j)) {
+                    const auto& view = views[j];
+                    _numTests++;
+                    if (squareSize > view.minSquareSize && view.frustum->boxIntersectsFrustum(item.bound) &&
+                        !(view.antiFrustum && view.antiFrustum->boxInsideFrustum(item.bound))) {
+                        mask |= (1 << j);
+                    }
+                }
+            }
+        }
+        _masks[i] = mask;
+    }
+
+    return _masks;
+}
@@ -0,0 +1,72 @@
+//
+//  MultiViewCull.h
+//  render/src/render
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_render_MultiViewCull_h
+#define hifi_render_MultiViewCull_h
+
+#include <array>
+#include <vector>
+
+#include <ViewFrustum.h>
+
+#include "Item.h"
+
+namespace render {
+
+    // Culls a list of items against several views in a single pass over the list, giving each item a mask with
+    // one bit per view it is visible in.
+    //
+    // The masks are kept from one run to the next: an item found at the same place in the list with the same bound
+    // keeps the bits of the views that didn't change, and is only tested again against the views that did. Static
+    // items in a list fed the same way every frame are therefore not tested at all while the views hold still.
+    class MultiViewCull {
+    public:
+        static const int MAX_VIEW_COUNT = 8;
+        using ViewMask = uint8_t;
+
+        struct View {
+            ViewFrustumPointer frustum; // no frustum disables the view
+            ViewFrustumPointer antiFrustum; // items entirely inside the anti frustum are culled
+            float minSquareSize { 0.0f }; // items with a squared bound diagonal below this are culled
+        };
+        using Views = std::array<View, MAX_VIEW_COUNT>;
+
+        // Returns the visibility mask of each of the items, in order
+        const std::vector<ViewMask>& run(const Views& views, const ItemBounds& items);
+
+        void reset();
+
+        // Number of item against view tests performed by the last run
+        int getNumTests() const { return _numTests; }
+
+    private:
+        struct ViewState {
+            glm::mat4 view;
+            glm::mat4 projection;
+            glm::mat4 antiView;
+            glm::mat4 antiProjection;
+            float minSquareSize { 0.0f };
+            bool enabled { false };
+            bool hasAntiFrustum { false };
+
+            ViewState() {}
+            ViewState(const View& view);
+            bool operator==(const ViewState& other) const;
+        };
+
+        std::array<ViewState, MAX_VIEW_COUNT> _viewStates;
+        std::vector<ItemBound> _items;
+        std::vector<ViewMask> _masks;
+        int _numTests { 0 };
+    };
+
+}
+
+#endif // hifi_render_MultiViewCull_h
@@ -33,6 +33,11 @@ using namespace recording;
 
 static const QString HFR_EXTENSION = "hfr";
 
+// Keys of the player calls from script threads that replace each other
+static const char PLAYER_VOLUME_COMMAND[] = "playerVolume";
+static const char PLAYER_TIME_COMMAND[] = "playerTime";
+static const char PLAYER_LOOP_COMMAND[] = "playerLoop";
+
 RecordingScriptingInterface::RecordingScriptingInterface() {
     _player = DependencyManager::get<Deck>();
     _recorder = DependencyManager::get<Recorder>();
@@ -54,6 +59,13 @@ float RecordingScriptingInterface::playerLength() const {
     return _player->length();
 }
 
+void RecordingScriptingInterface::postScriptCommand(const char* key, hifi::FrameCommandQueue::Command command) {
+    if (_scriptCommands.post(key, std::move(command))) {
+        // applied on the next pass of our event loop, before any blocking call the script makes after them
+        QMetaObject::invokeMethod(this, [this] { _scriptCommands.apply(); }, Qt::QueuedConnection);
+    }
+}
+
 void RecordingScriptingInterface::playClip(NetworkClipLoaderPointer clipLoader, const QString& url, QScriptValue callback) {
     _player->queueClip(clipLoader->getClip());
 
@@ -114,7 +126,7 @@ void RecordingScriptingInterface::loadRecording(const QString& url, QScriptValue
 
 void RecordingScriptingInterface::startPlaying() {
     if (QThread::currentThread() != thread()) {
-        BLOCKING_INVOKE_METHOD(this, "startPlaying");
+        postScriptCommand(nullptr, [this] { startPlaying(); });
         return;
     }
 
@@ -123,7 +135,7 @@ void RecordingScriptingInterface::startPlaying() {
 
 void RecordingScriptingInterface::setPlayerVolume(float volume) {
     if (QThread::currentThread() != thread()) {
-        BLOCKING_INVOKE_METHOD(this, "setPlayerVolume", Q_ARG(float, volume));
+        postScriptCommand(PLAYER_VOLUME_COMMAND, [=] { setPlayerVolume(volume); });
         return;
     }
 
@@ -136,7 +148,7 @@ void RecordingScriptingInterface::setPlayerAudioOffset(float audioOffset) {
 
 void RecordingScriptingInterface::setPlayerTime(float time) {
     if (QThread::currentThread() != thread()) {
-        BLOCKING_INVOKE_METHOD(this, "setPlayerTime", Q_ARG(float, time));
+        postScriptCommand(PLAYER_TIME_COMMAND, [=] { setPlayerTime(time); });
         return;
     }
     _player->seek(time);
@@ -148,7 +160,7 @@ void RecordingScriptingInterface::setPlayFromCurrentLocation(bool playFromCurren
 
 void RecordingScriptingInterface::setPlayerLoop(bool loop) {
     if (QThread::currentThread() != thread()) {
-        BLOCKING_INVOKE_METHOD(this, "setPlayerLoop", Q_ARG(bool, loop));
+        postScriptCommand(PLAYER_LOOP_COMMAND, [=] { setPlayerLoop(loop); });
         return;
     }
 
@@ -173,7 +185,7 @@ void RecordingScriptingInterface::setPlayerUseSkeletonModel(bool useSkeletonMode
 
 void RecordingScriptingInterface::pausePlayer() {
     if (QThread::currentThread() != thread()) {
-        BLOCKING_INVOKE_METHOD(this, "pausePlayer");
+        postScriptCommand(nullptr, [this] { pausePlayer(); });
         return;
     }
     _player->pause();
@@ -181,7 +193,7 @@ void RecordingScriptingInterface::pausePlayer() {
 
 void RecordingScriptingInterface::stopPlaying() {
     if (QThread::currentThread() != thread()) {
-        BLOCKING_INVOKE_METHOD(this, "stopPlaying");
+        postScriptCommand(nullptr, [this] { stopPlaying(); });
         return;
     }
     _player->stop();
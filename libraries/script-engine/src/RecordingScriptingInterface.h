@@ -19,6 +19,7 @@
 #include <recording/ClipCache.h>
 #include <recording/Forward.h>
 #include <recording/Frame.h>
+#include <shared/FrameCommands.h>
 
 class QScriptEngine;
 class QScriptValue;
@@ -366,6 +367,10 @@ protected:
 
 private:
     void playClip(recording::NetworkClipLoaderPointer clipLoader, const QString& url, QScriptValue callback);
+    void postScriptCommand(const char* key, hifi::FrameCommandQueue::Command command);
+
+    // Player calls from script threads, which don't wait for them
+    hifi::FrameCommandQueue _scriptCommands;
 };
 
 #endif // hifi_RecordingScriptingInterface_h
@@ -0,0 +1,145 @@
+//
+//  FrameBudgetGovernor.cpp
+//  libraries/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "FrameBudgetGovernor.h"
+
+#include <algorithm>
+
+#include "SharedLogging.h"
+
+// the smoothed costs follow about a third of a second of frames
+static const float COST_BLEND = 0.1f;
+
+int FrameBudgetGovernor::addSubsystem(const QString& name, int numLevels, float impact, SetLevel setLevel) {
+    Subsystem subsystem;
+    subsystem.name = name;
+    subsystem.numLevels = std::max(numLevels, 1);
+    subsystem.impact = std::max(impact, 0.001f);
+    subsystem.setLevel = setLevel;
+    _subsystems.push_back(subsystem);
+    return (int)_subsystems.size() - 1;
+}
+
+void FrameBudgetGovernor::addCost(int subsystem, float msecs) {
+    if (subsystem >= 0 && subsystem < (int)_subsystems.size()) {
+        _subsystems[subsystem].frameCost += msecs;
+    }
+}
+
+void FrameBudgetGovernor::endFrame(float frameTime, float budget) {
+    // the first frame starts the averages
+    float blend = _measured ? COST_BLEND : 1.0f;
+    _measured = true;
+    for (auto& subsystem : _subsystems) {
+        subsystem.smoothCost = (1.0f - blend) * subsystem.smoothCost + blend * subsystem.frameCost;
+        subsystem.frameCost = 0.0f;
+    }
+    _smoothFrameTime = (1.0f - blend) * _smoothFrameTime + blend * std::max(frameTime, 0.0f);
+
+    if (!_enabled || budget <= 0.0f) {
+        return;
+    }
+
+    if (_framesSinceChange < SETTLE_FRAMES) {
+        ++_framesSinceChange;
+        _framesOver = 0;
+        _framesUnder = 0;
+        return;
+    }
+
+    if (_smoothFrameTime > budget) {
+        _framesUnder = 0;
+        if (++_framesOver >= DEGRADE_FRAMES && degrade()) {
+            _framesOver = 0;
+            _framesSinceChange = 0;
+        }
+    } else if (_smoothFrameTime < RESTORE_RATIO * budget) {
+        _framesOver = 0;
+        if (++_framesUnder >= RESTORE_FRAMES && restore(budget)) {
+            _framesUnder = 0;
+            _framesSinceChange = 0;
+        }
+    } else {
+        _framesOver = 0;
+        _framesUnder = 0;
+    }
+}
+
+void FrameBudgetGovernor::setEnabled(bool enabled) {
+    if (_enabled == enabled) {
+        return;
+    }
+    _enabled = enabled;
+    if (!_enabled) {
+        for (auto& subsystem : _subsystems) {
+            setLevel(subsystem, 0);
+        }
+        _degradations.clear();
+    }
+    _framesOver = 0;
+    _framesUnder = 0;
+    _framesSinceChange = SETTLE_FRAMES;
+}
+
+void FrameBudgetGovernor::setLevel(Subsystem& subsystem, int level) {
+    if (subsystem.level != level) {
+        subsystem.level = level;
+        if (subsystem.setLevel) {
+            subsystem.setLevel(level);
+        }
+    }
+}
+
+bool FrameBudgetGovernor::degrade() {
+    // the subsystem with the most time to give back for what it brings, among those that can still do less
+    int best = INVALID_SUBSYSTEM;
+    float bestValue = 0.0f;
+    for (int i = 0; i < (int)_subsystems.size(); i++) {
+        const auto& subsystem = _subsystems[i];
+        if (subsystem.level + 1 >= subsystem.numLevels) {
+            continue;
+        }
+        float value = subsystem.smoothCost / subsystem.impact;
+        if (value > bestValue) {
+            best = i;
+            bestValue = value;
+        }
+    }
+    if (best == INVALID_SUBSYSTEM) {
+        return false;
+    }
+
+    auto& subsystem = _subsystems[best];
+    _degradations.push_back({ best, subsystem.smoothCost });
+    setLevel(subsystem, subsystem.level + 1);
+    qCDebug(shared) << "FrameBudgetGovernor: frame time" << _smoothFrameTime << "ms over budget, lowered"
+                    << subsystem.name << "to level" << subsystem.level;
+    return true;
+}
+
+bool FrameBudgetGovernor::restore(float budget) {
+    if (_degradations.empty()) {
+        return false;
+    }
+
+    // only once what it cost before it was lowered would still fit
+    const auto& degradation = _degradations.back();
+    auto& subsystem = _subsystems[degradation.subsystem];
+    float expectedFrameTime = _smoothFrameTime + std::max(degradation.costBefore - subsystem.smoothCost, 0.0f);
+    if (expectedFrameTime >= RESTORED_RATIO * budget) {
+        return false;
+    }
+
+    _degradations.pop_back();
+    setLevel(subsystem, subsystem.level - 1);
+    qCDebug(shared) << "FrameBudgetGovernor: frame time" << _smoothFrameTime << "ms under budget, raised"
+                    << subsystem.name << "to level" << subsystem.level;
+    return true;
+}
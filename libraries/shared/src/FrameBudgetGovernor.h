@@ -0,0 +1,109 @@
+//
+//  FrameBudgetGovernor.h
+//  libraries/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+#ifndef hifi_FrameBudgetGovernor_h
+#define hifi_FrameBudgetGovernor_h
+
+#include <functional>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SharedUtil.h"
+
+// Keeps the CPU time of a frame within its budget by lowering the quality of the subsystems that can do less work,
+// one level at a time, and raising it again once there is room for it.
+//
+// Each frame the cost of every subsystem is measured, and the frame time is compared to the budget once it is done.
+// When the frame stays over budget, the subsystem that costs the most for the quality it brings is lowered a level.
+// Levels are raised in the reverse order they were lowered, once the frame stays far enough under budget to take
+// back what the subsystem cost before it was lowered, so that the governor settles instead of going back and forth.
+class FrameBudgetGovernor {
+public:
+    using SetLevel = std::function<void(int level)>;
+
+    static const int INVALID_SUBSYSTEM { -1 };
+
+    // A frame has to be over budget for this many frames in a row before a subsystem is lowered
+    static const int DEGRADE_FRAMES { 10 };
+    // and under the restore threshold for this many before one is raised again
+    static const int RESTORE_FRAMES { 60 };
+    // Frames to wait after a change, for the smoothed costs to follow it
+    static const int SETTLE_FRAMES { 30 };
+    // The fraction of the budget a frame has to stay under for a subsystem to be raised
+    static constexpr float RESTORE_RATIO { 0.8f };
+    // and the one it is expected to stay under once the subsystem costs what it did before it was lowered
+    static constexpr float RESTORED_RATIO { 0.9f };
+
+    // Level 0 is the full quality of the subsystem, and each of the numLevels - 1 above it does less work. The larger
+    // the impact, the more noticeable it is when the subsystem is lowered, and the later it is. setLevel is called
+    // whenever the level changes.
+    int addSubsystem(const QString& name, int numLevels, float impact, SetLevel setLevel);
+
+    void addCost(int subsystem, float msecs);
+
+    // Measures the time spent in a subsystem until the end of the scope
+    class Scope {
+    public:
+        Scope(FrameBudgetGovernor& governor, int subsystem) :
+            _governor(governor), _subsystem(subsystem), _start(usecTimestampNow()) {}
+        ~Scope() { _governor.addCost(_subsystem, (float)(usecTimestampNow() - _start) / USECS_PER_MSEC); }
+
+    private:
+        FrameBudgetGovernor& _governor;
+        int _subsystem;
+        quint64 _start;
+    };
+
+    // Called once a frame, with the CPU time of the frame and its budget
+    void endFrame(float frameTime, float budget);
+
+    // When disabled every subsystem is back to full quality, and the governor only keeps measuring them
+    void setEnabled(bool enabled);
+    bool isEnabled() const { return _enabled; }
+
+    int getNumSubsystems() const { return (int)_subsystems.size(); }
+    const QString& getName(int subsystem) const { return _subsystems[subsystem].name; }
+    int getLevel(int subsystem) const { return _subsystems[subsystem].level; }
+    float getCost(int subsystem) const { return _subsystems[subsystem].smoothCost; }
+    float getSmoothFrameTime() const { return _smoothFrameTime; }
+
+private:
+    struct Subsystem {
+        QString name;
+        int numLevels;
+        float impact;
+        SetLevel setLevel;
+        int level { 0 };
+        float frameCost { 0.0f };
+        float smoothCost { 0.0f };
+    };
+
+    struct Degradation {
+        int subsystem;
+        float costBefore;
+    };
+
+    void setLevel(Subsystem& subsystem, int level);
+    bool degrade();
+    bool restore(float budget);
+
+    std::vector<Subsystem> _subsystems;
+    std::vector<Degradation> _degradations;
+    float _smoothFrameTime { 0.0f };
+    int _framesOver { 0 };
+    int _framesUnder { 0 };
+    int _framesSinceChange { SETTLE_FRAMES };
+    bool _measured { false };
+    bool _enabled { true };
+};
+
+#endif // hifi_FrameBudgetGovernor_h
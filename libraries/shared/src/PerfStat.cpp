@@ -13,10 +13,13 @@
 
 #include <cstdio>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include <QDebug>
-#include <QThread>
+#include <QHash>
 
 #include "NumericalConstants.h"
 #include "SharedLogging.h"
@@ -79,33 +82,63 @@ void PerformanceTimerRecord::tallyResult(const quint64& now) {
 // PerformanceTimer
 // ----------------------------------------------------------------------------
 
+namespace {
+
+// The timers of one thread. Only that thread touches its path, and its records are only contended while they are
+// gathered by tallyAllTimerRecords, so a timer never waits on the timers of other threads.
+struct ThreadTimers {
+    QByteArray path;
+    std::mutex mutex;
+    QHash<QByteArray, quint64> elapsedUsecs;
+    std::atomic<bool> exited { false };
+};
+
+std::mutex threadTimersMutex;
+std::vector<std::shared_ptr<ThreadTimers>> threadTimers;
+
+struct ThreadTimersHolder {
+    std::shared_ptr<ThreadTimers> timers;
+
+    ~ThreadTimersHolder() {
+        if (timers) {
+            timers->exited = true;
+        }
+    }
+};
+
+thread_local ThreadTimersHolder threadTimersHolder;
+
+ThreadTimers& getThreadTimers() {
+    if (!threadTimersHolder.timers) {
+        threadTimersHolder.timers = std::make_shared<ThreadTimers>();
+        std::lock_guard<std::mutex> guard(threadTimersMutex);
+        threadTimers.push_back(threadTimersHolder.timers);
+    }
+    return *threadTimersHolder.timers;
+}
+
+}  // namespace
+
 std::atomic<bool> PerformanceTimer::_isActive(false);
 std::mutex PerformanceTimer::_mutex;
-QHash<QThread*, QString> PerformanceTimer::_fullNames;
 QMap<QString, PerformanceTimerRecord> PerformanceTimer::_records;
 
-PerformanceTimer::PerformanceTimer(const QString& name) {
-    if (_isActive) {
-        _name = name;
-        {
-            std::lock_guard<std::mutex> guard(_mutex);
-            QString& fullName = _fullNames[QThread::currentThread()];
-            fullName.append("/");
-            fullName.append(_name);
-        }
-        _start = usecTimestampNow();
-    }
+void PerformanceTimer::start(const char* name, size_t nameLength) {
+    ThreadTimers& timers = getThreadTimers();
+    _pathLength = timers.path.size();
+    timers.path.append('/');
+    timers.path.append(name, (int)nameLength);
+    _start = usecTimestampNow();
 }
 
-PerformanceTimer::~PerformanceTimer() {
-    if (_isActive && _start != 0) {
-        quint64 elapsedUsec = (usecTimestampNow() - _start);
-        std::lock_guard<std::mutex> guard(_mutex);
-        QString& fullName = _fullNames[QThread::currentThread()];
-        PerformanceTimerRecord& namedRecord = _records[fullName];
-        namedRecord.accumulateResult(elapsedUsec);
-        fullName.resize(fullName.size() - (_name.size() + 1));
+void PerformanceTimer::stop() {
+    quint64 elapsedUsec = (usecTimestampNow() - _start);
+    ThreadTimers& timers = getThreadTimers();
+    if (_isActive) {
+        std::lock_guard<std::mutex> guard(timers.mutex);
+        timers.elapsedUsecs[timers.path] += elapsedUsec;
     }
+    timers.path.resize(_pathLength);
 }
 
 // static
@@ -115,15 +148,14 @@ bool PerformanceTimer::isActive() {
 
 // static
 QString PerformanceTimer::getContextName() {
-    std::lock_guard<std::mutex> guard(_mutex);
-    return _fullNames[QThread::currentThread()];
+    return QString::fromUtf8(getThreadTimers().path);
 }
 
 // static
 void PerformanceTimer::addTimerRecord(const QString& fullName, quint64 elapsedUsec) {
-    std::lock_guard<std::mutex> guard(_mutex);
-    PerformanceTimerRecord& namedRecord = _records[fullName];
-    namedRecord.accumulateResult(elapsedUsec);
+    ThreadTimers& timers = getThreadTimers();
+    std::lock_guard<std::mutex> guard(timers.mutex);
+    timers.elapsedUsecs[fullName.toUtf8()] += elapsedUsec;
 }
 
 // static
@@ -132,8 +164,12 @@ void PerformanceTimer::setActive(bool active) {
         _isActive.store(active);
         if (!active) {
             std::lock_guard<std::mutex> guard(_mutex);
-            _fullNames.clear();
             _records.clear();
+            std::lock_guard<std::mutex> timersGuard(threadTimersMutex);
+            for (auto& timers : threadTimers) {
+                std::lock_guard<std::mutex> threadGuard(timers->mutex);
+                timers->elapsedUsecs.clear();
+            }
         }
 
         qCDebug(shared) << "PerformanceTimer has been turned" << ((active) ? "on" : "off");
@@ -149,6 +185,27 @@ QMap<QString, PerformanceTimerRecord> PerformanceTimer::getAllTimerRecords() {
 // static
 void PerformanceTimer::tallyAllTimerRecords() {
     std::lock_guard<std::mutex> guard(_mutex);
+    {
+        // gather what each thread timed since the last tally
+        std::lock_guard<std::mutex> timersGuard(threadTimersMutex);
+        for (auto timersItr = threadTimers.begin(); timersItr != threadTimers.end();) {
+            ThreadTimers& timers = **timersItr;
+            bool exited = timers.exited;
+            {
+                std::lock_guard<std::mutex> threadGuard(timers.mutex);
+                for (auto elapsedItr = timers.elapsedUsecs.cbegin(); elapsedItr != timers.elapsedUsecs.cend(); ++elapsedItr) {
+                    _records[QString::fromUtf8(elapsedItr.key())].accumulateResult(elapsedItr.value());
+                }
+                timers.elapsedUsecs.clear();
+            }
+            if (exited) {
+                timersItr = threadTimers.erase(timersItr);
+            } else {
+                ++timersItr;
+            }
+        }
+    }
+
     QMap<QString, PerformanceTimerRecord>::iterator recordsItr = _records.begin();
     QMap<QString, PerformanceTimerRecord>::const_iterator recordsEnd = _records.end();
     quint64 now = usecTimestampNow();
@@ -16,6 +16,7 @@
 #define hifi_PerfStat_h
 
 #include <stdint.h>
+#include "Profile.h"
 #include "SharedUtil.h"
 #include "SimpleMovingAverage.h"
 
@@ -73,11 +74,29 @@ private:
     SimpleMovingAverage _movingAverage;
 };
 
+// Times a scope under the path of the timers it is nested in on its thread, and records it as a trace.timer event
+// when the TraceRecorder is recording. The name is a string literal, or is copied when it is built at runtime.
 class PerformanceTimer {
 public:
 
-    PerformanceTimer(const QString& name);
-    ~PerformanceTimer();
+    template <size_t N>
+    PerformanceTimer(const char (&name)[N]) : _trace(trace_timer(), name) {
+        if (_isActive) {
+            start(name, N - 1);
+        }
+    }
+
+    PerformanceTimer(const std::string& name) : _trace(trace_timer(), name) {
+        if (_isActive) {
+            start(name.c_str(), name.size());
+        }
+    }
+
+    ~PerformanceTimer() {
+        if (_start != 0) {
+            stop();
+        }
+    }
 
     static bool isActive();
     static void setActive(bool active);
@@ -89,12 +108,15 @@ public:
     static void dumpAllTimerRecords();
 
 private:
+    void start(const char* name, size_t nameLength);
+    void stop();
+
+    tracing::ScopedTrace _trace;
     quint64 _start = 0;
-    QString _name;
+    int _pathLength = 0; // of the path of this thread before this timer
     static std::atomic<bool> _isActive;
 
-    static std::mutex _mutex;  // used to guard multi-threaded access to _fullNames and _records
-    static QHash<QThread*, QString> _fullNames;
+    static std::mutex _mutex;  // used to guard multi-threaded access to _records
     static QMap<QString, PerformanceTimerRecord> _records;
 };
 
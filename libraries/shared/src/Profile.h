@@ -11,6 +11,7 @@
 #define HIFI_PROFILE_
 
 #include "Trace.h"
+#include "TraceRecorder.h"
 #include "SharedUtil.h"
 
 // When profiling something that may happen many times per frame, use a xxx_detail category so that they may easily be filtered out of trace results
@@ -34,6 +35,7 @@ Q_DECLARE_LOGGING_CATEGORY(trace_simulation_animation_detail)
 Q_DECLARE_LOGGING_CATEGORY(trace_simulation_physics)
 Q_DECLARE_LOGGING_CATEGORY(trace_simulation_physics_detail)
 Q_DECLARE_LOGGING_CATEGORY(trace_startup)
+Q_DECLARE_LOGGING_CATEGORY(trace_timer)
 Q_DECLARE_LOGGING_CATEGORY(trace_workload)
 Q_DECLARE_LOGGING_CATEGORY(trace_baker)
 
@@ -122,6 +124,13 @@ inline void metadata(const QString& metadataType, const QVariantMap& args) {
 #define PROFILE_INSTANT(category, name, ...) instant(trace_##category(), name, ##__VA_ARGS__);
 #define PROFILE_SET_THREAD_NAME(threadName) metadata("thread_name", { { "name", threadName } });
 
+// Recorded into the per-thread rings of the TraceRecorder, cheap enough to be left in hot paths on servers. The name
+// has to be a string literal.
+#define TRACE_SCOPE_NAME_CONCAT(prefix, line) prefix##line
+#define TRACE_SCOPE_NAME(line) TRACE_SCOPE_NAME_CONCAT(traceScope, line)
+#define TRACE_SCOPE(category, name) tracing::ScopedTrace TRACE_SCOPE_NAME(__LINE__)(trace_##category(), "" name);
+#define TRACE_COUNTER(category, name, value) { if (tracing::TraceRecorder::isRecording() && trace_##category().isDebugEnabled()) { tracing::TraceRecorder::record(trace_##category(), "" name, tracing::Counter, tracing::Tracer::now(), (int32_t)(value)); } }
+
 #define SAMPLE_PROFILE_RANGE(chance, category, name, ...) if (randFloat() <= chance) { PROFILE_RANGE(category, name); }
 #define SAMPLE_PROFILE_RANGE_EX(chance, category, name, ...) if (randFloat() <= chance) { PROFILE_RANGE_EX(category, name, argbColor, payload, ##__VA_ARGS__); }
 #define SAMPLE_PROFILE_COUNTER(chance, category, name, ...) if (randFloat() <= chance) { PROFILE_COUNTER(category, name, ##__VA_ARGS__); }
@@ -10,6 +10,15 @@
 
 #include <chrono>
 
+#ifndef Q_OS_WIN
+#include <cerrno>
+#include <csignal>
+#include <mutex>
+#include <thread>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 #include <QtCore/QDebug>
 #include <QtCore/QCoreApplication>
 #include <QtCore/QThread>
@@ -31,6 +40,7 @@
 #include "Gzip.h"
 #include "PortableHighResolutionClock.h"
 #include "SharedLogging.h"
+#include "TraceRecorder.h"
 #include "shared/FileUtils.h"
 #include "shared/GlobalAppProperties.h"
 
@@ -40,6 +50,69 @@ bool tracing::enabled() {
     return DependencyManager::get<Tracer>()->isEnabled();
 }
 
+#ifndef Q_OS_WIN
+// The signal handler only writes to this pipe, which is async-signal-safe; the dump happens on a watcher thread
+static int dumpSignalPipe[2] = { -1, -1 };
+
+static void dumpSignalHandler(int param) {
+    int savedErrno = errno;
+    char byte = 0;
+    auto result = write(dumpSignalPipe[1], &byte, 1);
+    Q_UNUSED(result);
+    errno = savedErrno;
+}
+
+static void installDumpSignalHandler() {
+    static std::once_flag once;
+    std::call_once(once, [] {
+        if (pipe(dumpSignalPipe) != 0) {
+            qCWarning(shared) << "Unable to create the pipe for dump_on_sigusr1";
+            return;
+        }
+        // Never block the signal handler; a request that doesn't fit in the pipe is already pending anyway
+        fcntl(dumpSignalPipe[1], F_SETFL, fcntl(dumpSignalPipe[1], F_GETFL) | O_NONBLOCK);
+        std::thread([] {
+            char byte;
+            while (true) {
+                auto result = read(dumpSignalPipe[0], &byte, 1);
+                if (result < 0 && errno == EINTR) {
+                    continue;
+                } else if (result != 1) {
+                    break;
+                }
+                if (DependencyManager::isSet<Tracer>()) {
+                    DependencyManager::get<Tracer>()->dumpRecent("traces/{DATE}_{TIME}-" +
+                        QString::number(QCoreApplication::applicationPid()) + ".json.gz");
+                }
+            }
+        }).detach();
+        signal(SIGUSR1, dumpSignalHandler);
+    });
+}
+#endif
+
+Tracer::Tracer() {
+    QString traceOptions = qgetenv("VIRCADIA_TRACE_OPTIONS").toLower();
+
+    for (auto option : traceOptions.split(",")) {
+        option = option.trimmed();
+        if (option.startsWith("sample_interval=")) {
+            _sampleInterval = option.mid(option.indexOf('=') + 1).toUInt();
+        } else if (option == "dump_on_sigusr1") {
+#ifndef Q_OS_WIN
+            installDumpSignalHandler();
+#endif
+        } else if (option != "") {
+            qCWarning(shared) << "Unrecognized option in VIRCADIA_TRACE_OPTIONS:" << option;
+        }
+    }
+
+    if (_sampleInterval != 0) {
+        qCDebug(shared) << "Recording one in" << _sampleInterval << "traced scopes";
+    }
+    TraceRecorder::setSampleInterval(_sampleInterval);
+}
+
 void Tracer::startTracing() {
     std::lock_guard<std::mutex> guard(_eventsMutex);
     if (_enabled) {
@@ -48,6 +121,9 @@ void Tracer::startTracing() {
     }
 
     _events.clear();
+    _startTime = now();
+    _stopTime = 0;
+    TraceRecorder::setSampleInterval(1);
     _enabled = true;
 }
 
@@ -58,6 +134,8 @@ void Tracer::stopTracing() {
         return;
     }
     _enabled = false;
+    _stopTime = now();
+    TraceRecorder::setSampleInterval(_sampleInterval);
 }
 
 void TraceEvent::writeJson(QTextStream& out) const {
@@ -119,8 +197,36 @@ void Tracer::serialize(const QString& filename) {
         for (auto& event : _metadataEvents) {
             currentEvents.push_back(event);
         }
+        // the scopes recorded while tracing, as far as the rings of their threads go back
+        if (_startTime != 0) {
+            currentEvents.splice(currentEvents.end(), TraceRecorder::collect(_startTime, _stopTime != 0 ? _stopTime : now()));
+            _startTime = 0;
+        }
     }
 
+    writeEvents(fullPath, currentEvents);
+}
+
+void Tracer::dumpRecent(const QString& filename) {
+    QString fullPath = FileUtils::replaceDateTimeTokens(filename);
+    fullPath = FileUtils::computeDocumentPath(fullPath);
+    if (!FileUtils::canCreateFile(fullPath)) {
+        return;
+    }
+
+    std::list<TraceEvent> recentEvents = TraceRecorder::collect();
+    {
+        std::lock_guard<std::mutex> guard(_eventsMutex);
+        for (auto& event : _metadataEvents) {
+            recentEvents.push_back(event);
+        }
+    }
+
+    writeEvents(fullPath, recentEvents);
+    qCDebug(shared) << "Dumped" << recentEvents.size() << "recent trace events to" << fullPath;
+}
+
+void Tracer::writeEvents(const QString& fullPath, const std::list<TraceEvent>& currentEvents) {
     // If we can't open a temp file for writing, fail early
     QByteArray data;
     {
@@ -185,6 +291,10 @@ void Tracer::traceEvent(const QLoggingCategory& category,
     qint64 timestamp, qint64 processID, qint64 threadID,
     const QString& id,
     const QVariantMap& args, const QVariantMap& extra) {
+    if (!_enabled && type != Metadata) {
+        return;
+    }
+
     std::lock_guard<std::mutex> guard(_eventsMutex);
 
     // We always want to store metadata events even if tracing is not enabled so that when
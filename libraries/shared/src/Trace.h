@@ -10,7 +10,9 @@
 #ifndef hifi_Trace_h
 #define hifi_Trace_h
 
+#include <atomic>
 #include <cstdint>
+#include <list>
 #include <mutex>
 
 #include <QtCore/QString>
@@ -76,8 +78,13 @@ struct TraceEvent {
     void writeJson(QTextStream& out) const;
 };
 
+// Set VIRCADIA_TRACE_OPTIONS to keep recording a sample of the TRACE_SCOPE and PerformanceTimer scopes all the time,
+// e.g. "sample_interval=64" for one in 64 of them on each thread, and "dump_on_sigusr1" to have the recent events
+// dumped to traces/ in the documents directory when the process gets SIGUSR1.
 class Tracer : public Dependency {
 public:
+    Tracer();
+
     static int64_t now();
     void traceEvent(const QLoggingCategory& category, 
         const QString& name, EventType type,
@@ -93,7 +100,9 @@ public:
     void startTracing();
     void stopTracing();
     void serialize(const QString& file);
-    bool isEnabled() const { return _enabled; }
+    // Writes the events recorded in the last moments, without stopping or clearing a trace
+    void dumpRecent(const QString& file);
+    bool isEnabled() const { return _enabled.load(std::memory_order_relaxed); }
 
 private:
     void traceEvent(const QLoggingCategory& category, 
@@ -102,7 +111,12 @@ private:
         const QString& id = "",
         const QVariantMap& args = QVariantMap(), const QVariantMap& extra = QVariantMap());
 
-    bool _enabled { false };
+    void writeEvents(const QString& fullPath, const std::list<TraceEvent>& events);
+
+    std::atomic<bool> _enabled { false };
+    uint32_t _sampleInterval { 0 };
+    int64_t _startTime { 0 };
+    int64_t _stopTime { 0 };
     std::list<TraceEvent> _events;
     std::list<TraceEvent> _metadataEvents;
     std::mutex _eventsMutex;
@@ -0,0 +1,179 @@
+//
+//  TraceRecorder.cpp
+//  libraries/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "TraceRecorder.h"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QHash>
+#include <QtCore/QThread>
+
+using namespace tracing;
+
+namespace {
+
+const uint64_t RING_MASK = TraceRecorder::RING_CAPACITY - 1;
+static_assert((TraceRecorder::RING_CAPACITY & RING_MASK) == 0, "RING_CAPACITY must be a power of two");
+
+// The events of one thread. Only that thread writes to it, publishing each event by moving the head past it. Each slot
+// holds the sequence number of its event, which the writer clears before overwriting the slot, so that readers can
+// tell the events they copied while they were being overwritten, whatever the memory ordering of the CPU.
+class ThreadRing {
+public:
+    ThreadRing() : _slots(TraceRecorder::RING_CAPACITY) {}
+
+    void push(const BinaryTraceEvent& event) {
+        uint64_t head = _head.load(std::memory_order_relaxed);
+        Slot& slot = _slots[head & RING_MASK];
+        slot.sequence.store(WRITING, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.event = event;
+        slot.sequence.store(head, std::memory_order_release);
+        _head.store(head + 1, std::memory_order_release);
+    }
+
+    void read(std::vector<BinaryTraceEvent>& events, int64_t since, int64_t until) const {
+        uint64_t end = _head.load(std::memory_order_acquire);
+        uint64_t begin = std::max(_begin.load(std::memory_order_relaxed),
+                                  end > TraceRecorder::RING_CAPACITY ? end - TraceRecorder::RING_CAPACITY : 0);
+        for (uint64_t i = begin; i < end; ++i) {
+            const Slot& slot = _slots[i & RING_MASK];
+            if (slot.sequence.load(std::memory_order_acquire) != i) {
+                continue;
+            }
+            BinaryTraceEvent event = slot.event;
+            // the writer may have started overwriting the slot while it was copied
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) != i) {
+                continue;
+            }
+            if (event.timestamp >= since && event.timestamp <= until) {
+                events.push_back(event);
+            }
+        }
+    }
+
+    void clear() { _begin.store(_head.load(std::memory_order_acquire), std::memory_order_relaxed); }
+
+    int64_t threadID { 0 };
+    std::atomic<bool> exited { false };
+
+private:
+    static constexpr uint64_t WRITING { std::numeric_limits<uint64_t>::max() };
+
+    struct Slot {
+        std::atomic<uint64_t> sequence { WRITING };
+        BinaryTraceEvent event;
+    };
+
+    std::vector<Slot> _slots;
+    std::atomic<uint64_t> _head { 0 };
+    std::atomic<uint64_t> _begin { 0 };
+};
+
+// Rings are only added under this mutex, the first time a thread records. The ring of a thread that exited is kept,
+// and so are its events, until another thread takes it over.
+std::mutex ringsMutex;
+std::vector<std::shared_ptr<ThreadRing>> rings;
+
+struct ThreadState {
+    std::shared_ptr<ThreadRing> ring;
+    uint32_t numScopes { 0 };
+
+    ~ThreadState() {
+        if (ring) {
+            ring->exited.store(true, std::memory_order_release);
+        }
+    }
+};
+
+thread_local ThreadState threadState;
+
+ThreadRing& getThreadRing() {
+    if (!threadState.ring) {
+        std::lock_guard<std::mutex> guard(ringsMutex);
+        auto exited = std::find_if(rings.begin(), rings.end(), [](const std::shared_ptr<ThreadRing>& ring) {
+            return ring->exited.load(std::memory_order_acquire);
+        });
+        if (exited != rings.end()) {
+            threadState.ring = *exited;
+            threadState.ring->clear();
+            threadState.ring->exited.store(false, std::memory_order_relaxed);
+        } else {
+            threadState.ring = std::make_shared<ThreadRing>();
+            rings.push_back(threadState.ring);
+        }
+        threadState.ring->threadID = int64_t(QThread::currentThreadId());
+    }
+    return *threadState.ring;
+}
+
+}  // namespace
+
+std::atomic<uint32_t> TraceRecorder::_sampleInterval { 0 };
+
+bool TraceRecorder::sampleScope() {
+    uint32_t sampleInterval = getSampleInterval();
+    return sampleInterval == 1 || (sampleInterval != 0 && ++threadState.numScopes % sampleInterval == 0);
+}
+
+void TraceRecorder::record(const QLoggingCategory& category, const char* name, EventType type, int64_t timestamp,
+                           int32_t value) {
+    getThreadRing().push({ timestamp, name, &category, value, type });
+}
+
+const char* TraceRecorder::internName(const std::string& name) {
+    // the elements of an unordered_set stay where they are as it grows
+    static std::mutex namesMutex;
+    static std::unordered_set<std::string> names;
+    std::lock_guard<std::mutex> guard(namesMutex);
+    return names.insert(name).first->c_str();
+}
+
+std::list<TraceEvent> TraceRecorder::collect(int64_t since, int64_t until) {
+    std::list<TraceEvent> result;
+    auto processID = QCoreApplication::applicationPid();
+    QHash<const char*, QString> names;
+    std::vector<BinaryTraceEvent> events;
+
+    std::lock_guard<std::mutex> guard(ringsMutex);
+    for (const auto& ring : rings) {
+        events.clear();
+        ring->read(events, since, until);
+        for (const auto& event : events) {
+            auto name = names.find(event.name);
+            if (name == names.end()) {
+                name = names.insert(event.name, QString::fromUtf8(event.name));
+            }
+
+            QVariantMap args;
+            QVariantMap extra;
+            if (event.type == Complete) {
+                extra["dur"] = event.value;
+            } else if (event.type == Counter) {
+                args[name.value()] = event.value;
+            }
+            result.push_back({ "", name.value(), event.type, event.timestamp, processID, ring->threadID,
+                               *event.category, args, extra });
+        }
+    }
+    return result;
+}
+
+void TraceRecorder::clear() {
+    std::lock_guard<std::mutex> guard(ringsMutex);
+    for (const auto& ring : rings) {
+        ring->clear();
+    }
+}
@@ -0,0 +1,103 @@
+//
+//  TraceRecorder.h
+//  libraries/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+#ifndef hifi_TraceRecorder_h
+#define hifi_TraceRecorder_h
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <QtCore/QLoggingCategory>
+
+#include "Trace.h"
+
+namespace tracing {
+
+// A trace event as it is kept in the per-thread rings. The name is a string literal, so it is known by its address
+// and only turned into a QString when the events are dumped.
+struct BinaryTraceEvent {
+    int64_t timestamp;
+    const char* name;
+    const QLoggingCategory* category;
+    int32_t value; // the duration of a Complete event, in usecs, or the value of a Counter
+    EventType type;
+};
+
+// Records trace events into a lock-free ring per thread, the newest RING_CAPACITY of them, without allocating or
+// taking a lock on the recording thread. Meant to be left on in production at a low sample rate, from which the
+// recent events can be dumped at any time, and turned up to every event while the Tracer is tracing.
+class TraceRecorder {
+public:
+    static const uint32_t RING_CAPACITY = 8192; // 256 KiB per thread
+
+    // One in sampleInterval of the scopes on each thread are recorded, none when 0
+    static void setSampleInterval(uint32_t sampleInterval) { _sampleInterval.store(sampleInterval); }
+    static uint32_t getSampleInterval() { return _sampleInterval.load(std::memory_order_relaxed); }
+    static bool isRecording() { return _sampleInterval.load(std::memory_order_relaxed) != 0; }
+
+    // Whether the scope being entered on this thread is one of those sampled
+    static bool sampleScope();
+
+    static void record(const QLoggingCategory& category, const char* name, EventType type, int64_t timestamp,
+                       int32_t value = 0);
+
+    // A copy of a name built at runtime, kept for the whole process so that events can point to it
+    static const char* internName(const std::string& name);
+
+    // The events of every thread between the given timestamps, oldest first for each thread
+    static std::list<TraceEvent> collect(int64_t since = 0, int64_t until = std::numeric_limits<int64_t>::max());
+
+    // Drops the recorded events of every thread
+    static void clear();
+
+private:
+    static std::atomic<uint32_t> _sampleInterval;
+};
+
+// Records the time spent in a scope as a Complete event. The name is a string literal, or is interned when the scope
+// is recorded.
+class ScopedTrace {
+public:
+    template <size_t N>
+    ScopedTrace(const QLoggingCategory& category, const char (&name)[N]) : _category(category), _name(name) {
+        if (TraceRecorder::isRecording() && category.isDebugEnabled() && TraceRecorder::sampleScope()) {
+            _start = Tracer::now();
+        }
+    }
+
+    ScopedTrace(const QLoggingCategory& category, const std::string& name) : _category(category) {
+        if (TraceRecorder::isRecording() && category.isDebugEnabled() && TraceRecorder::sampleScope()) {
+            _name = TraceRecorder::internName(name);
+            _start = Tracer::now();
+        }
+    }
+
+    ~ScopedTrace() {
+        if (_start != 0) {
+            int64_t duration = std::min<int64_t>(Tracer::now() - _start, std::numeric_limits<int32_t>::max());
+            TraceRecorder::record(_category, _name, Complete, _start, (int32_t)duration);
+        }
+    }
+
+private:
+    const QLoggingCategory& _category;
+    const char* _name { nullptr };
+    int64_t _start { 0 };
+};
+
+}
+
+#endif // hifi_TraceRecorder_h
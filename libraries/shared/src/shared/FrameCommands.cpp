@@ -0,0 +1,45 @@
+//
+//  FrameCommands.cpp
+//  libraries/shared/src/shared
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "FrameCommands.h"
+
+#include <algorithm>
+
+using namespace hifi;
+
+bool FrameCommandQueue::post(const char* key, Command command) {
+    std::lock_guard<std::mutex> guard(_mutex);
+    bool wasEmpty = _commands.empty();
+    if (key) {
+        auto queued = std::find_if(_commands.begin(), _commands.end(), [key](const KeyedCommand& keyedCommand) {
+            return keyedCommand.key == key;
+        });
+        if (queued != _commands.end()) {
+            _commands.erase(queued);
+        }
+    }
+    _commands.push_back({ key, std::move(command) });
+    return wasEmpty;
+}
+
+void FrameCommandQueue::apply() {
+    {
+        std::lock_guard<std::mutex> guard(_mutex);
+        if (_commands.empty()) {
+            return;
+        }
+        _applying.swap(_commands);
+    }
+    // a command may post others, which are applied on the next frame
+    for (auto& keyedCommand : _applying) {
+        keyedCommand.command();
+    }
+    _applying.clear();
+}
@@ -0,0 +1,94 @@
+//
+//  FrameCommands.h
+//  libraries/shared/src/shared
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+#ifndef hifi_Shared_FrameCommands_h
+#define hifi_Shared_FrameCommands_h
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace hifi {
+
+// Commands posted by script threads to an object that lives on the main thread, without waiting for it. They are
+// applied when the object calls apply() from its per-frame update, in the order they were posted. A command posted
+// with a key replaces the one still queued under the same key, and is then applied after every command posted before
+// it, so that a script setting the same property every update applies it once per frame with the latest value.
+class FrameCommandQueue {
+public:
+    using Command = std::function<void()>;
+
+    // Keys are compared by address, so the commands that replace each other have to be posted with the same constant.
+    // Returns whether nothing was queued before, for an object without a per-frame update to know when to schedule
+    // apply() on its thread.
+    bool post(const char* key, Command command);
+    bool post(Command command) { return post(nullptr, std::move(command)); }
+
+    // Runs the commands posted since the last time, on the calling thread
+    void apply();
+
+private:
+    struct KeyedCommand {
+        const char* key;
+        Command command;
+    };
+
+    std::mutex _mutex;
+    std::vector<KeyedCommand> _commands;
+    std::vector<KeyedCommand> _applying;
+};
+
+// A value computed on the main thread for script threads to read without waiting for it. Each value is stamped with
+// the frame it was published on, and a script thread only gets the one published by the current frame. Otherwise it
+// has to ask the main thread, and has the next frames publish the value again, so that a value is only computed on
+// the frames after it was asked for and a getter called rarely never gets one from an old frame.
+template <typename T>
+class FrameSnapshot {
+public:
+    // Whether a value was published by the current frame
+    bool get(T& value) {
+        _requested = true;
+        std::lock_guard<std::mutex> guard(_mutex);
+        if (_published && _publishedFrame == _frame.load()) {
+            value = _value;
+            return true;
+        }
+        return false;
+    }
+
+    // Called once a frame by the thread of the owner, which publishes compute() if a script thread asked for the value
+    // since the last frame
+    template <typename F>
+    void update(F compute) {
+        uint64_t frame = ++_frame;
+        if (_requested.exchange(false)) {
+            T value = compute();
+            std::lock_guard<std::mutex> guard(_mutex);
+            _value = std::move(value);
+            _publishedFrame = frame;
+            _published = true;
+        }
+    }
+
+private:
+    std::atomic<bool> _requested { false };
+    std::atomic<uint64_t> _frame { 0 };
+    std::mutex _mutex;
+    T _value;
+    uint64_t _publishedFrame { 0 };
+    bool _published { false };
+};
+
+}  // namespace hifi
+
+#endif // hifi_Shared_FrameCommands_h
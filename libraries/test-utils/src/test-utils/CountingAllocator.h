@@ -0,0 +1,41 @@
+//
+//  CountingAllocator.h
+//  libraries/test-utils/src/test-utils
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_CountingAllocator_h
+#define hifi_CountingAllocator_h
+
+#include <cstddef>
+#include <memory>
+
+// The number of bytes currently held by all CountingAllocators
+inline size_t& countedAllocatedBytes() {
+    static size_t allocatedBytes = 0;
+    return allocatedBytes;
+}
+
+// Lets a test measure the heap used by a standard container, e.g. to compare it with a replacement's getMemoryUsage()
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+    CountingAllocator() = default;
+    template <typename U> CountingAllocator(const CountingAllocator<U>&) {}
+    T* allocate(size_t n) {
+        countedAllocatedBytes() += n * sizeof(T);
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T* p, size_t n) {
+        countedAllocatedBytes() -= n * sizeof(T);
+        std::allocator<T>().deallocate(p, n);
+    }
+    template <typename U> bool operator==(const CountingAllocator<U>&) const { return true; }
+    template <typename U> bool operator!=(const CountingAllocator<U>&) const { return false; }
+};
+
+#endif // hifi_CountingAllocator_h
@@ -24,10 +24,10 @@ public:
 
 
     int getComplexity() const;
-    void setComplexity(int complexity);
+    void setComplexity(int complexity) override;
 
     int getBitrate() const;
-    void setBitrate(int bitrate);
+    void setBitrate(int bitrate) override;
 
     int getVBR() const;
     void setVBR(int vbr);
@@ -50,10 +50,10 @@ public:
     int getLookahead() const;
 
     int getInbandFEC() const;
-    void setInbandFEC(int inBandFEC);
+    void setInbandFEC(int inBandFEC) override;
 
     int getExpectedPacketLossPercentage() const;
-    void setExpectedPacketLossPercentage(int percentage);
+    void setExpectedPacketLossPercentage(int percentage) override;
 
     int getDTX() const;
     void setDTX(int dtx);
@@ -15,6 +15,8 @@
 #include <AnimVariant.h>
 #include <AnimExpression.h>
 #include <AnimUtil.h>
+#include <AnimationCache.h>
+#include <NumericalConstants.h>
 #include <ExternalResource.h>
 #include <NodeList.h>
 #include <AddressManager.h>
@@ -147,6 +149,57 @@ void AnimTests::testClipEvaulateWithVars() {
     QVERIFY(clip._loopFlag == loopFlag2);
 }
 
+// A one joint model, and an animation of it already downloaded, turning the joint by angle around z
+static HFMModel::Pointer makeClipModel(float angle) {
+    auto hfmModel = std::make_shared<HFMModel>();
+    HFMJoint joint;
+    joint.parentIndex = -1;
+    joint.name = "Root";
+    hfmModel->joints.push_back(joint);
+    hfmModel->jointIndices["Root"] = 1;
+
+    HFMAnimationFrame frame;
+    frame.rotations.push_back(glm::angleAxis(angle, glm::vec3(0.0f, 0.0f, 1.0f)));
+    frame.translations.push_back(glm::vec3());
+    hfmModel->animationFrames.push_back(frame);
+    return hfmModel;
+}
+
+static AnimationPointer makeLoadedAnimation(const QString& url, float angle) {
+    AnimationPointer animation { new Animation(QUrl(url)) };
+    QMetaObject::invokeMethod(animation.data(), "animationParseSuccess", Qt::DirectConnection,
+                              Q_ARG(HFMModel::Pointer, makeClipModel(angle)));
+    return animation;
+}
+
+void AnimTests::testClipOverride() {
+    AnimContext context(false, false, false, glm::mat4(), glm::mat4(), 0);
+    QString url = "file:///clip-override-idle.fbx";
+    QString overrideURL = "file:///clip-override-wave.fbx";
+    auto vars = AnimVariantMap();
+    AnimVariantMap triggers;
+
+    AnimClip clip("overriddenClip", url, 0.0f, 0.0f, 1.0f, true, false);
+    clip.setSkeleton(std::make_shared<AnimSkeleton>(*makeClipModel(0.0f)));
+    clip._networkAnim = makeLoadedAnimation(url, 0.0f);
+    clip.evaluate(vars, context, 0.0f, triggers);
+    auto frames = clip._anim;
+    QVERIFY(frames && frames->size() == 1);
+
+    // as Rig::overrideAnimation does, on a clip that already has its frames
+    clip.loadURL(overrideURL);
+    clip._networkAnim = makeLoadedAnimation(overrideURL, PI / 2.0f);
+    clip.evaluate(vars, context, 0.0f, triggers);
+    QVERIFY(clip._anim && clip._anim != frames);
+    QVERIFY(glm::abs(glm::dot((*clip._anim)[0][0].rot(), (*frames)[0][0].rot())) < 1.0f - TEST_EPSILON);
+
+    // and the frames of the first url are still shared under its own key
+    AnimClip otherClip("otherClip", url, 0.0f, 0.0f, 1.0f, true, false);
+    otherClip.setSkeleton(clip.getSkeleton());
+    otherClip.evaluate(vars, context, 0.0f, triggers);
+    QVERIFY(otherClip._anim == frames);
+}
+
 void AnimTests::testLoader() {
     auto url = QUrl("https://gist.githubusercontent.com/hyperlogic/756e6b7018c96c9778dba4ffb959c3c7/raw/4b37f10c9d2636608916208ba7b415c1a3f842ff/test.json");
     // NOTE: This will warn about missing "test01.fbx", "test02.fbx", etc. if the resource loading code doesn't handle relative pathnames!
@@ -211,6 +264,54 @@ void AnimTests::testLoader() {
     QVERIFY(test02->_loopFlag == true);
 }
 
+void AnimTests::testGraphTemplate() {
+    auto url = QUrl("file:///avatar-animation.json");
+    QByteArray contents = R"({
+        "version": "1.1",
+        "root": {
+            "id": "blend",
+            "type": "blendLinear",
+            "data": { "alpha": 0.5, "alphaVar": "blendAlpha" },
+            "children": [
+                {
+                    "id": "idle",
+                    "type": "clip",
+                    "data": { "url": "idle.fbx", "startFrame": 1.0, "endFrame": 20.0, "timeScale": 1.0, "loopFlag": true },
+                    "children": []
+                }
+            ]
+        }
+    })";
+
+    // the tree built to validate the graph goes to its first user
+    AnimNode::Pointer node;
+    auto graphTemplate = AnimGraphTemplate::create(contents, url, node);
+    QVERIFY((bool)graphTemplate);
+    QVERIFY(graphTemplate->getURL() == url);
+
+    // every instance has its own nodes, to run the graph with its own state
+    auto otherNode = graphTemplate->instantiate();
+    QVERIFY(node && otherNode);
+    QVERIFY(node != otherNode);
+    QVERIFY(node->getID() == "blend");
+    QVERIFY(otherNode->getID() == "blend");
+    QVERIFY(node->getChildCount() == 1);
+    QVERIFY(otherNode->getChildCount() == 1);
+    QVERIFY(node->getChild(0) != otherNode->getChild(0));
+
+    auto clip = std::static_pointer_cast<AnimClip>(node->getChild(0));
+    QVERIFY(clip->_url == url.resolved(QUrl("idle.fbx")).toString());
+    clip->setStartFrame(5.0f);
+    auto otherClip = std::static_pointer_cast<AnimClip>(otherNode->getChild(0));
+    QVERIFY(otherClip->_startFrame == 1.0f);
+
+    // which are validated once, when the template is created
+    QVERIFY(!AnimGraphTemplate::create("{ \"version\": \"1.1\" }", url, node));
+    QVERIFY(!node);
+    QVERIFY(!AnimGraphTemplate::create(QByteArray(contents).replace("\"clip\"", "\"unknown\""), url, node));
+    QVERIFY(!node);
+}
+
 void AnimTests::testVariant() {
     auto defaultVar = AnimVariant();
     auto boolVarTrue = AnimVariant(true);
@@ -260,6 +361,42 @@ void AnimTests::testVariant() {
     QVERIFY(q.z == 4.0f);
 }
 
+void AnimTests::testVariantMap() {
+    AnimVarKey speedKey("testVariantMapSpeed");
+    AnimVarKey flagKey("testVariantMapFlag");
+    QVERIFY(speedKey.isValid());
+    QVERIFY(speedKey.getSlot() != flagKey.getSlot());
+    QVERIFY(AnimVarKey("testVariantMapSpeed").getSlot() == speedKey.getSlot());
+    QVERIFY(!AnimVarKey("").isValid());
+
+    // looking up a name that was never set doesn't intern it
+    AnimVariantMap vars;
+    QVERIFY(vars.lookup("testVariantMapMissing", 2.0f) == 2.0f);
+    QVERIFY(AnimVarKey::findSlot("testVariantMapMissing") == AnimVarKey::INVALID_SLOT);
+
+    // keys and names address the same values
+    vars.set(speedKey, 1.5f);
+    vars.set("testVariantMapFlag", true);
+    QVERIFY(vars.lookup("testVariantMapSpeed", 0.0f) == 1.5f);
+    QVERIFY(vars.lookup(flagKey, false) == true);
+    QVERIFY(vars.hasKey(flagKey));
+    QVERIFY(!vars.hasKey(AnimVarKey()));
+
+    AnimVariantMap copy;
+    copy.set("testVariantMapOther", 3);
+    copy.copyVariantsFrom(vars);
+    QVERIFY(copy.lookup(speedKey, 0.0f) == 1.5f);
+    QVERIFY(copy.lookup("testVariantMapOther", 0) == 3);
+
+    vars.unset("testVariantMapFlag");
+    QVERIFY(!vars.hasKey(flagKey));
+    QVERIFY(vars.lookup(flagKey, false) == false);
+
+    auto debugMap = copy.toDebugMap();
+    QVERIFY(debugMap.size() == 3);
+    QVERIFY(debugMap["testVariantMapSpeed"] == "1.500");
+}
+
 void AnimTests::testAccumulateTime() {
 
     float startFrame = 0.0f;
@@ -556,7 +693,7 @@ void AnimTests::testExpressionParser() {
     QVERIFY(e._opCodes.size() == 1);
     if (e._opCodes.size() == 1) {
         QVERIFY(e._opCodes[0].type == AnimExpression::OpCode::Identifier);
-        QVERIFY(e._opCodes[0].strVal == "twenty");
+        QVERIFY(e._opCodes[0].key.getName() == "twenty");
     }
 
     e = AnimExpression("true || false");
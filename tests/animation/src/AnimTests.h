@@ -23,8 +23,11 @@ private slots:
     void testClipInternalState();
     void testClipEvaulate();
     void testClipEvaulateWithVars();
+    void testClipOverride();
     void testLoader();
+    void testGraphTemplate();
     void testVariant();
+    void testVariantMap();
     void testAccumulateTime();
     void testAnimPose();
     void testExpressionTokenizer();
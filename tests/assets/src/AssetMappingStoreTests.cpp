@@ -0,0 +1,148 @@
+//
+//  AssetMappingStoreTests.cpp
+//  tests/assets/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AssetMappingStoreTests.h"
+
+#include <QtCore/QTemporaryDir>
+
+#include <AssetMappingStore.h>
+
+QTEST_MAIN(AssetMappingStoreTests)
+
+static const QString MAP_FILE_NAME = "map.json";
+static const QString JOURNAL_FILE_NAME = "map.journal";
+
+static AssetUtils::AssetHash makeHash(char digit) {
+    return AssetUtils::AssetHash((int)AssetUtils::SHA256_HASH_HEX_LENGTH, QChar(digit));
+}
+
+static void setMapping(AssetMappingStore& store, const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& hash) {
+    store.beginTransaction();
+    store.set(path, hash);
+    QVERIFY(store.commitTransaction());
+}
+
+// The files of the store as they would be found if the server stopped now, without its destructor running
+static void copyStoreFiles(const QDir& from, const QDir& to) {
+    for (const auto& fileName : { MAP_FILE_NAME, JOURNAL_FILE_NAME }) {
+        QFile::remove(to.absoluteFilePath(fileName));
+        if (from.exists(fileName)) {
+            QVERIFY(QFile::copy(from.absoluteFilePath(fileName), to.absoluteFilePath(fileName)));
+        }
+    }
+}
+
+static void appendToJournal(const QDir& directory, const QByteArray& data) {
+    QFile journal { directory.absoluteFilePath(JOURNAL_FILE_NAME) };
+    QVERIFY(journal.open(QIODevice::WriteOnly | QIODevice::Append));
+    QCOMPARE(journal.write(data), (qint64)data.size());
+}
+
+void AssetMappingStoreTests::testReplayAfterCrash() {
+    QTemporaryDir runningDirectory;
+    QTemporaryDir crashedDirectory;
+    QVERIFY(runningDirectory.isValid() && crashedDirectory.isValid());
+
+    {
+        AssetMappingStore store;
+        QVERIFY(store.load(runningDirectory.path()));
+        setMapping(store, "/a.fbx", makeHash('a'));
+        setMapping(store, "/b.fbx", makeHash('b'));
+        store.beginTransaction();
+        QVERIFY(store.remove("/a.fbx"));
+        QVERIFY(store.commitTransaction());
+        copyStoreFiles(runningDirectory.path(), crashedDirectory.path());
+    }
+
+    // only the journal knows about these
+    AssetMappingStore store;
+    QVERIFY(store.load(crashedDirectory.path()));
+    QCOMPARE((int)store.size(), 1);
+    QVERIFY(!store.contains("/a.fbx"));
+    QCOMPARE(store.getHash("/b.fbx"), makeHash('b'));
+}
+
+void AssetMappingStoreTests::testTornJournalTail() {
+    QTemporaryDir directory;
+    QTemporaryDir crashedDirectory;
+    QVERIFY(directory.isValid() && crashedDirectory.isValid());
+
+    appendToJournal(directory.path(), "{\"/a.fbx\":\"" + makeHash('a').toUtf8() + "\"}\n");
+    // the server stopped in the middle of writing the next entry
+    appendToJournal(directory.path(), "{\"/b.fbx\":\"" + makeHash('b').left(10).toUtf8());
+
+    {
+        AssetMappingStore store;
+        QVERIFY(store.load(directory.path()));
+        QCOMPARE((int)store.size(), 1);
+        QCOMPARE(store.getHash("/a.fbx"), makeHash('a'));
+
+        setMapping(store, "/c.fbx", makeHash('c'));
+        copyStoreFiles(directory.path(), crashedDirectory.path());
+    }
+
+    // the entry journaled after the torn one is replayed
+    AssetMappingStore store;
+    QVERIFY(store.load(crashedDirectory.path()));
+    QCOMPARE((int)store.size(), 2);
+    QCOMPARE(store.getHash("/a.fbx"), makeHash('a'));
+    QCOMPARE(store.getHash("/c.fbx"), makeHash('c'));
+}
+
+void AssetMappingStoreTests::testTornJournalWithoutCompleteEntries() {
+    QTemporaryDir directory;
+    QTemporaryDir crashedDirectory;
+    QVERIFY(directory.isValid() && crashedDirectory.isValid());
+
+    // nothing to replay, so nothing checkpoints the journal
+    appendToJournal(directory.path(), "{\"/a.fbx\":\"" + makeHash('a').left(10).toUtf8());
+
+    {
+        AssetMappingStore store;
+        QVERIFY(store.load(directory.path()));
+        QCOMPARE((int)store.size(), 0);
+        QCOMPARE(QFileInfo(QDir(directory.path()).absoluteFilePath(JOURNAL_FILE_NAME)).size(), (qint64)0);
+
+        setMapping(store, "/b.fbx", makeHash('b'));
+        setMapping(store, "/c.fbx", makeHash('c'));
+        copyStoreFiles(directory.path(), crashedDirectory.path());
+    }
+
+    AssetMappingStore store;
+    QVERIFY(store.load(crashedDirectory.path()));
+    QCOMPARE((int)store.size(), 2);
+    QCOMPARE(store.getHash("/b.fbx"), makeHash('b'));
+    QCOMPARE(store.getHash("/c.fbx"), makeHash('c'));
+}
+
+void AssetMappingStoreTests::testCorruptJournalEntry() {
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+
+    appendToJournal(directory.path(), "{\"/a.fbx\":\"" + makeHash('a').toUtf8() + "\"}\n");
+    appendToJournal(directory.path(), "{\"/b.fbx\":\"" + makeHash('b').left(10).toUtf8() + "\n");
+    // acknowledged after the corrupt entry, so they have to survive it
+    appendToJournal(directory.path(), "{\"/c.fbx\":\"" + makeHash('c').toUtf8() + "\"}\n");
+    appendToJournal(directory.path(), "{\"/a.fbx\":null}\n");
+
+    {
+        AssetMappingStore store;
+        QVERIFY(store.load(directory.path()));
+        QCOMPARE((int)store.size(), 1);
+        QVERIFY(!store.contains("/b.fbx"));
+        QCOMPARE(store.getHash("/c.fbx"), makeHash('c'));
+    }
+
+    // and they were checkpointed into the map file
+    AssetMappingStore store;
+    QVERIFY(store.load(directory.path()));
+    QCOMPARE((int)store.size(), 1);
+    QCOMPARE(store.getHash("/c.fbx"), makeHash('c'));
+}
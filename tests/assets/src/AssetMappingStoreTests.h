@@ -0,0 +1,25 @@
+//
+//  AssetMappingStoreTests.h
+//  tests/assets/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AssetMappingStoreTests_h
+#define hifi_AssetMappingStoreTests_h
+
+#include <QtTest/QtTest>
+
+class AssetMappingStoreTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testReplayAfterCrash();
+    void testTornJournalTail();
+    void testTornJournalWithoutCompleteEntries();
+    void testCorruptJournalEntry();
+};
+
+#endif // hifi_AssetMappingStoreTests_h
@@ -0,0 +1,197 @@
+//
+//  PartialUploadsTests.cpp
+//  tests/assets/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PartialUploadsTests.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QTemporaryDir>
+
+#include <PartialUploads.h>
+
+QTEST_MAIN(PartialUploadsTests)
+
+using namespace AssetUtils;
+
+static const uint64_t MAX_TOTAL_SIZE = 1000;
+static const qint64 SECS_PER_DAY = 24 * 60 * 60;
+
+namespace {
+
+// The asset files and partial uploads directories of an asset server
+class UploadDirectories {
+public:
+    UploadDirectories() {
+        QDir root { _root.path() };
+        root.mkpath("files");
+        root.mkpath("uploads");
+        files = QDir(root.filePath("files"));
+        uploads = QDir(root.filePath("uploads"));
+    }
+
+    QDir files;
+    QDir uploads;
+
+private:
+    QTemporaryDir _root;
+};
+
+QByteArray makeData(int size, char seed) {
+    QByteArray data;
+    data.reserve(size);
+    for (int i = 0; i < size; ++i) {
+        data.append((char)(seed + i));
+    }
+    return data;
+}
+
+QByteArray hashOf(const QByteArray& data) {
+    return QCryptographicHash::hash(data, QCryptographicHash::Sha256);
+}
+
+// Makes a partial file look like it wasn't written to in that long
+void backdate(const QDir& uploads, const QByteArray& hash, qint64 secs) {
+    QFile file { uploads.filePath(QString(hash.toHex())) };
+    QVERIFY(file.open(QIODevice::ReadWrite));
+    QVERIFY(file.setFileTime(QDateTime::currentDateTime().addSecs(-secs), QFileDevice::FileModificationTime));
+}
+
+}
+
+void PartialUploadsTests::testResume() {
+    UploadDirectories directories;
+    auto data = makeData(100, 'a');
+    auto hash = hashOf(data);
+    uint64_t offset = 1;
+    uint64_t nextOffset = 0;
+
+    {
+        PartialUploads uploads { directories.files, directories.uploads, MAX_TOTAL_SIZE };
+        QCOMPARE(uploads.begin(hash, data.size(), offset), NoError);
+        QCOMPARE(offset, (uint64_t)0);
+        QCOMPARE(uploads.write(hash, data.size(), 0, data.left(60), nextOffset), NoError);
+        QCOMPARE(nextOffset, (uint64_t)60);
+        QCOMPARE(uploads.getTotalSize(), (uint64_t)60);
+    }
+
+    // after a restart, the upload resumes from what was written and is hashed again from disk
+    PartialUploads uploads { directories.files, directories.uploads, MAX_TOTAL_SIZE };
+    QCOMPARE(uploads.getTotalSize(), (uint64_t)60);
+    QCOMPARE(uploads.begin(hash, data.size(), offset), NoError);
+    QCOMPARE(offset, (uint64_t)60);
+    QCOMPARE(uploads.write(hash, data.size(), 60, data.mid(60), nextOffset), NoError);
+    QCOMPARE(nextOffset, (uint64_t)data.size());
+
+    QFile assetFile { directories.files.filePath(QString(hash.toHex())) };
+    QVERIFY(assetFile.open(QIODevice::ReadOnly));
+    QCOMPARE(assetFile.readAll(), data);
+    QVERIFY(directories.uploads.entryList(QDir::Files).isEmpty());
+    QCOMPARE(uploads.getTotalSize(), (uint64_t)0);
+
+    // uploading it again is answered with the whole file
+    QCOMPARE(uploads.begin(hash, data.size(), offset), NoError);
+    QCOMPARE(offset, (uint64_t)data.size());
+}
+
+void PartialUploadsTests::testOffsetMismatch() {
+    UploadDirectories directories;
+    PartialUploads uploads { directories.files, directories.uploads, MAX_TOTAL_SIZE };
+    auto data = makeData(100, 'b');
+    auto hash = hashOf(data);
+    uint64_t offset = 0;
+    uint64_t nextOffset = 0;
+
+    QCOMPARE(uploads.begin(hash, data.size(), offset), NoError);
+
+    // a chunk past the end of what was written is ignored, and the reply says where to continue from
+    QCOMPARE(uploads.write(hash, data.size(), 50, data.mid(50), nextOffset), NoError);
+    QCOMPARE(nextOffset, (uint64_t)0);
+    QCOMPARE(uploads.write(hash, data.size(), 0, data.left(50), nextOffset), NoError);
+    QCOMPARE(nextOffset, (uint64_t)50);
+
+    // so is a chunk that was already written
+    QCOMPARE(uploads.write(hash, data.size(), 0, data.left(50), nextOffset), NoError);
+    QCOMPARE(nextOffset, (uint64_t)50);
+    QCOMPARE(QFileInfo(directories.uploads.filePath(QString(hash.toHex()))).size(), (qint64)50);
+    QCOMPARE(uploads.getTotalSize(), (uint64_t)50);
+
+    // and one that would go past the end of the file is rejected
+    QCOMPARE(uploads.write(hash, data.size(), 50, makeData(60, 'c'), nextOffset), InvalidByteRange);
+
+    QCOMPARE(uploads.write(hash, data.size(), 50, data.mid(50), nextOffset), NoError);
+    QCOMPARE(nextOffset, (uint64_t)data.size());
+    QVERIFY(directories.files.exists(QString(hash.toHex())));
+}
+
+void PartialUploadsTests::testExpiry() {
+    UploadDirectories directories;
+    PartialUploads uploads { directories.files, directories.uploads, MAX_TOTAL_SIZE };
+    auto staleData = makeData(100, 'd');
+    auto staleHash = hashOf(staleData);
+    auto freshData = makeData(100, 'e');
+    auto freshHash = hashOf(freshData);
+    uint64_t offset = 0;
+    uint64_t nextOffset = 0;
+
+    for (const auto& data : { staleData, freshData }) {
+        QCOMPARE(uploads.begin(hashOf(data), data.size(), offset), NoError);
+        QCOMPARE(uploads.write(hashOf(data), data.size(), 0, data.left(40), nextOffset), NoError);
+    }
+    backdate(directories.uploads, staleHash, 2 * SECS_PER_DAY);
+
+    uploads.removeStale(SECS_PER_DAY);
+    QVERIFY(!directories.uploads.exists(QString(staleHash.toHex())));
+    QVERIFY(directories.uploads.exists(QString(freshHash.toHex())));
+    QCOMPARE(uploads.getTotalSize(), (uint64_t)40);
+
+    // the stale upload starts over, the other one resumes
+    QCOMPARE(uploads.begin(staleHash, staleData.size(), offset), NoError);
+    QCOMPARE(offset, (uint64_t)0);
+    QCOMPARE(uploads.begin(freshHash, freshData.size(), offset), NoError);
+    QCOMPARE(offset, (uint64_t)40);
+}
+
+void PartialUploadsTests::testSizeCap() {
+    UploadDirectories directories;
+    PartialUploads uploads { directories.files, directories.uploads, MAX_TOTAL_SIZE };
+    auto idleData = makeData(600, 'f');
+    auto idleHash = hashOf(idleData);
+    auto activeData = makeData(300, 'g');
+    auto activeHash = hashOf(activeData);
+    auto newData = makeData(500, 'h');
+    auto newHash = hashOf(newData);
+    uint64_t offset = 0;
+    uint64_t nextOffset = 0;
+
+    QCOMPARE(uploads.begin(idleHash, idleData.size(), offset), NoError);
+    QCOMPARE(uploads.write(idleHash, idleData.size(), 0, idleData.left(500), nextOffset), NoError);
+    QCOMPARE(uploads.begin(activeHash, activeData.size(), offset), NoError);
+    QCOMPARE(uploads.write(activeHash, activeData.size(), 0, activeData.left(200), nextOffset), NoError);
+    QCOMPARE(uploads.getTotalSize(), (uint64_t)700);
+
+    // partial files which were written to recently are never removed to make room
+    QCOMPARE(uploads.begin(newHash, newData.size(), offset), FileOperationFailed);
+    QVERIFY(directories.uploads.exists(QString(idleHash.toHex())));
+
+    // and nothing is written past the cap
+    QCOMPARE(uploads.write(newHash, newData.size(), 0, newData.left(400), nextOffset), FileOperationFailed);
+    QCOMPARE(uploads.getTotalSize(), (uint64_t)700);
+
+    // the ones that weren't are, until the new upload fits
+    backdate(directories.uploads, idleHash, SECS_PER_DAY);
+    QCOMPARE(uploads.begin(newHash, newData.size(), offset), NoError);
+    QVERIFY(!directories.uploads.exists(QString(idleHash.toHex())));
+    QVERIFY(directories.uploads.exists(QString(activeHash.toHex())));
+    QCOMPARE(uploads.getTotalSize(), (uint64_t)200);
+
+    QCOMPARE(uploads.write(newHash, newData.size(), 0, newData, nextOffset), NoError);
+    QCOMPARE(nextOffset, (uint64_t)newData.size());
+    QCOMPARE(uploads.write(activeHash, activeData.size(), 200, activeData.mid(200), nextOffset), NoError);
+    QCOMPARE(uploads.getTotalSize(), (uint64_t)0);
+}
@@ -0,0 +1,25 @@
+//
+//  PartialUploadsTests.h
+//  tests/assets/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_PartialUploadsTests_h
+#define hifi_PartialUploadsTests_h
+
+#include <QtTest/QtTest>
+
+class PartialUploadsTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testResume();
+    void testOffsetMismatch();
+    void testExpiry();
+    void testSizeCap();
+};
+
+#endif // hifi_PartialUploadsTests_h
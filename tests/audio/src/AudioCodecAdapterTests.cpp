@@ -0,0 +1,151 @@
+//
+//  AudioCodecAdapterTests.cpp
+//  tests/audio/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioCodecAdapterTests.h"
+
+#include <algorithm>
+
+#include <AudioCodecAdapter.h>
+
+QTEST_MAIN(AudioCodecAdapterTests)
+
+// A link that drops whatever goes over its capacity, plus a fixed share of everything
+struct EmulatedLink {
+    int capacity { 1000000 }; // bits per second
+    float randomLossRate { 0.0f };
+    int jitterMsecs { 5 };
+    int rttMsecs { 50 };
+
+    AudioCodecAdapter::LinkStats transmit(const AudioCodecAdapter::Settings& settings) const {
+        AudioCodecAdapter::LinkStats stats;
+        float overflowLossRate = settings.bitrate > capacity ? 1.0f - (float)capacity / (float)settings.bitrate : 0.0f;
+        stats.lossRate = 1.0f - (1.0f - overflowLossRate) * (1.0f - randomLossRate);
+        // a link over capacity also queues, which starves the receiver
+        stats.starves = overflowLossRate > 0.05f ? 1 : 0;
+        stats.jitterMsecs = jitterMsecs;
+        stats.rttMsecs = rttMsecs;
+        return stats;
+    }
+};
+
+// Runs the adapter over the link for a number of updates (about a second each), returns the average loss rate
+static float run(AudioCodecAdapter& adapter, const EmulatedLink& link, int numUpdates) {
+    float totalLossRate = 0.0f;
+    for (int i = 0; i < numUpdates; i++) {
+        auto stats = link.transmit(adapter.getSettings());
+        totalLossRate += stats.lossRate;
+        adapter.update(stats);
+    }
+    return totalLossRate / numUpdates;
+}
+
+void AudioCodecAdapterTests::testBacksOffOnCongestedLink() {
+    AudioCodecAdapter adapter;
+    QCOMPARE(adapter.getSettings().bitrate, AudioCodecAdapter::DEFAULT_MAX_BITRATE);
+
+    EmulatedLink link;
+    link.capacity = 40000;
+
+    // a few seconds to settle, then the loss stays low
+    run(adapter, link, 10);
+    float lossRate = run(adapter, link, 60);
+    QVERIFY(lossRate < 0.03f);
+    QVERIFY(adapter.getSettings().bitrate < link.capacity * 1.05f);
+    QVERIFY(adapter.getSettings().bitrate >= AudioCodecAdapter::DEFAULT_MIN_BITRATE);
+}
+
+void AudioCodecAdapterTests::testRecoversOnCleanLink() {
+    AudioCodecAdapter adapter;
+
+    EmulatedLink link;
+    link.capacity = 30000;
+    run(adapter, link, 20);
+    QVERIFY(adapter.getSettings().bitrate < AudioCodecAdapter::DEFAULT_MAX_BITRATE / 2);
+
+    // once the link clears up the bitrate grows back to the maximum, and FEC goes away
+    link.capacity = 1000000;
+    const int UPDATES_TO_RECOVER = (AudioCodecAdapter::DEFAULT_MAX_BITRATE - AudioCodecAdapter::DEFAULT_MIN_BITRATE) /
+        AudioCodecAdapter::BITRATE_INCREASE + 5;
+    float lossRate = run(adapter, link, UPDATES_TO_RECOVER);
+    QCOMPARE(lossRate, 0.0f);
+    QCOMPARE(adapter.getSettings().bitrate, AudioCodecAdapter::DEFAULT_MAX_BITRATE);
+    QVERIFY(!adapter.getSettings().inbandFEC);
+    QCOMPARE(adapter.getSettings().expectedLossPercentage, 0);
+}
+
+void AudioCodecAdapterTests::testFECOnLossyLink() {
+    AudioCodecAdapter adapter;
+
+    // losses that aren't caused by our bitrate: protect the stream but don't back off for them
+    EmulatedLink link;
+    link.randomLossRate = 0.02f;
+    run(adapter, link, 10);
+
+    const auto& settings = adapter.getSettings();
+    QVERIFY(settings.inbandFEC);
+    QCOMPARE(settings.expectedLossPercentage, 2);
+    QCOMPARE(settings.bitrate, AudioCodecAdapter::DEFAULT_MAX_BITRATE);
+
+    // a clean link doesn't pay for FEC
+    AudioCodecAdapter cleanAdapter;
+    run(cleanAdapter, EmulatedLink(), 10);
+    QVERIFY(!cleanAdapter.getSettings().inbandFEC);
+}
+
+void AudioCodecAdapterTests::testHoldsOnStrainedLink() {
+    AudioCodecAdapter adapter;
+
+    EmulatedLink link;
+    link.capacity = 30000;
+    run(adapter, link, 20);
+    int congestedBitrate = adapter.getSettings().bitrate;
+
+    // more capacity, but the jitter or round trip says the path is still busy
+    link.capacity = 1000000;
+    link.jitterMsecs = 80;
+    run(adapter, link, 10);
+    QCOMPARE(adapter.getSettings().bitrate, congestedBitrate);
+
+    link.jitterMsecs = 5;
+    link.rttMsecs = 600;
+    run(adapter, link, 10);
+    QCOMPARE(adapter.getSettings().bitrate, congestedBitrate);
+
+    link.rttMsecs = 50;
+    run(adapter, link, 1);
+    QVERIFY(adapter.getSettings().bitrate > congestedBitrate);
+}
+
+void AudioCodecAdapterTests::testBitrateRange() {
+    const int MIN_BITRATE = 32000;
+    const int MAX_BITRATE = 64000;
+
+    AudioCodecAdapter adapter;
+    adapter.setBitrateRange(MIN_BITRATE, MAX_BITRATE);
+    QCOMPARE(adapter.getSettings().bitrate, MAX_BITRATE);
+
+    // never under the minimum, whatever the link
+    EmulatedLink link;
+    link.capacity = 8000;
+    run(adapter, link, 30);
+    QCOMPARE(adapter.getSettings().bitrate, MIN_BITRATE);
+
+    // never over the maximum
+    link.capacity = 1000000;
+    run(adapter, link, 30);
+    QCOMPARE(adapter.getSettings().bitrate, MAX_BITRATE);
+
+    // a fixed bitrate still gets FEC
+    adapter.setBitrateRange(MAX_BITRATE, MAX_BITRATE);
+    link.randomLossRate = 0.1f;
+    run(adapter, link, 10);
+    QCOMPARE(adapter.getSettings().bitrate, MAX_BITRATE);
+    QVERIFY(adapter.getSettings().inbandFEC);
+}
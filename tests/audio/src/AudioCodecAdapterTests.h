@@ -0,0 +1,26 @@
+//
+//  AudioCodecAdapterTests.h
+//  tests/audio/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioCodecAdapterTests_h
+#define hifi_AudioCodecAdapterTests_h
+
+#include <QtTest/QtTest>
+
+class AudioCodecAdapterTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testBacksOffOnCongestedLink();
+    void testRecoversOnCleanLink();
+    void testFECOnLossyLink();
+    void testHoldsOnStrainedLink();
+    void testBitrateRange();
+};
+
+#endif // hifi_AudioCodecAdapterTests_h
@@ -0,0 +1,159 @@
+//
+//  AudioHRTFPoolTests.cpp
+//  tests/audio/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioHRTFPoolTests.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <AudioHRTFPool.h>
+
+QTEST_MAIN(AudioHRTFPoolTests)
+
+static const int HRTF_DATASET_INDEX = 1;
+
+void AudioHRTFPoolTests::testReuse() {
+    AudioHRTFPool pool;
+    QCOMPARE(pool.getNumAllocated(), (size_t)0);
+
+    AudioHRTF* first;
+    {
+        auto hrtf = pool.acquire();
+        first = hrtf.get();
+        QCOMPARE(pool.getNumInUse(), (size_t)1);
+        QCOMPARE(pool.getNumAllocated(), (size_t)AudioHRTFPool::SLAB_SIZE);
+    }
+    QCOMPARE(pool.getNumInUse(), (size_t)0);
+
+    // a released instance is handed out again before anything new is allocated
+    auto hrtf = pool.acquire();
+    QCOMPARE(hrtf.get(), first);
+
+    std::vector<AudioHRTFPool::Pointer> held;
+    for (int i = 0; i < AudioHRTFPool::SLAB_SIZE; i++) {
+        held.push_back(pool.acquire());
+    }
+    QCOMPARE(pool.getNumInUse(), (size_t)AudioHRTFPool::SLAB_SIZE + 1);
+    QCOMPARE(pool.getNumAllocated(), (size_t)2 * AudioHRTFPool::SLAB_SIZE);
+}
+
+void AudioHRTFPoolTests::testTrim() {
+    AudioHRTFPool pool;
+
+    std::vector<AudioHRTFPool::Pointer> held;
+    for (int i = 0; i < 3 * AudioHRTFPool::SLAB_SIZE; i++) {
+        held.push_back(pool.acquire());
+    }
+
+    // keep one instance of the first slab alive
+    held.resize(1);
+
+    // the slabs which were all needed since the last trim are kept
+    pool.trim();
+    QCOMPARE(pool.getNumInUse(), (size_t)1);
+    QCOMPARE(pool.getNumAllocated(), (size_t)3 * AudioHRTFPool::SLAB_SIZE);
+
+    // and given back once they weren't for a whole interval
+    pool.trim();
+    QCOMPARE(pool.getNumInUse(), (size_t)1);
+    QCOMPARE(pool.getNumAllocated(), (size_t)AudioHRTFPool::SLAB_SIZE);
+
+    // a slab that was only partly needed is kept as well
+    for (int i = 0; i < AudioHRTFPool::SLAB_SIZE; i++) {
+        held.push_back(pool.acquire());
+    }
+    held.resize(1);
+    pool.trim();
+    QCOMPARE(pool.getNumAllocated(), (size_t)2 * AudioHRTFPool::SLAB_SIZE);
+    pool.trim();
+    QCOMPARE(pool.getNumAllocated(), (size_t)AudioHRTFPool::SLAB_SIZE);
+
+    held.clear();
+    pool.trim();
+    QCOMPARE(pool.getNumAllocated(), (size_t)AudioHRTFPool::SLAB_SIZE);
+    pool.trim();
+    QCOMPARE(pool.getNumAllocated(), (size_t)0);
+    QCOMPARE(pool.getNumFree(), (size_t)0);
+}
+
+void AudioHRTFPoolTests::testFadeIn() {
+    int16_t input[HRTF_BLOCK];
+    std::fill(std::begin(input), std::end(input), (int16_t)16384);
+
+    AudioHRTFPool pool;
+    float output[2 * HRTF_BLOCK] = {};
+
+    // leave some state behind in an instance, then hand it to a new source
+    {
+        auto hrtf = pool.acquire();
+        hrtf->render(input, output, HRTF_DATASET_INDEX, 0.5f, 2.0f, 1.0f, HRTF_BLOCK);
+    }
+
+    auto hrtf = pool.acquire();
+    std::fill(std::begin(output), std::end(output), 0.0f);
+    hrtf->render(input, output, HRTF_DATASET_INDEX, 0.5f, 2.0f, 1.0f, HRTF_BLOCK);
+
+    // the first block ramps up from silence instead of starting at full gain
+    QVERIFY(std::abs(output[0]) < 1.0e-3f && std::abs(output[1]) < 1.0e-3f);
+    float last = std::abs(output[2 * HRTF_BLOCK - 2]) + std::abs(output[2 * HRTF_BLOCK - 1]);
+    QVERIFY(last > 1.0e-3f);
+}
+
+void AudioHRTFPoolTests::benchmarkManyListeners() {
+    // every listener can hear every other source, but only a few are audible at a time
+    const int NUM_LISTENERS = 512;
+    const int NUM_AUDIBLE = 8;
+
+    size_t perPairBytes = (size_t)NUM_LISTENERS * (NUM_LISTENERS - 1) * sizeof(AudioHRTF);
+
+    std::vector<std::unique_ptr<AudioHRTFPool>> pools;
+    std::vector<std::vector<AudioHRTFPool::Pointer>> audible(NUM_LISTENERS);
+    for (int i = 0; i < NUM_LISTENERS; i++) {
+        pools.emplace_back(new AudioHRTFPool());
+    }
+
+    int16_t input[HRTF_BLOCK];
+    for (int i = 0; i < HRTF_BLOCK; i++) {
+        input[i] = (int16_t)((i * 97) % 32768 - 16384);
+    }
+    float output[2 * HRTF_BLOCK];
+
+    int frame = 0;
+    QBENCHMARK {
+        for (int listener = 0; listener < NUM_LISTENERS; listener++) {
+            auto& streams = audible[listener];
+
+            // one source goes quiet and another one starts talking every frame
+            if (!streams.empty()) {
+                streams.erase(streams.begin() + (frame % streams.size()));
+            }
+            while ((int)streams.size() < NUM_AUDIBLE) {
+                streams.push_back(pools[listener]->acquire());
+            }
+
+            std::fill(std::begin(output), std::end(output), 0.0f);
+            for (size_t i = 0; i < streams.size(); i++) {
+                streams[i]->render(input, output, HRTF_DATASET_INDEX, (float)i, 1.0f + (float)i, 0.5f, HRTF_BLOCK);
+            }
+        }
+        frame++;
+    }
+
+    size_t pooledBytes = 0;
+    for (auto& pool : pools) {
+        pooledBytes += pool->getAllocatedBytes();
+    }
+    qDebug() << "HRTF state for" << NUM_LISTENERS << "listeners: per pair" << perPairBytes / 1024 << "KiB, pooled"
+             << pooledBytes / 1024 << "KiB";
+    QVERIFY(pooledBytes < perPairBytes);
+
+    audible.clear();
+}
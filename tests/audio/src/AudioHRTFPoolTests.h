@@ -0,0 +1,25 @@
+//
+//  AudioHRTFPoolTests.h
+//  tests/audio/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioHRTFPoolTests_h
+#define hifi_AudioHRTFPoolTests_h
+
+#include <QtTest/QtTest>
+
+class AudioHRTFPoolTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testReuse();
+    void testTrim();
+    void testFadeIn();
+    void benchmarkManyListeners();
+};
+
+#endif // hifi_AudioHRTFPoolTests_h
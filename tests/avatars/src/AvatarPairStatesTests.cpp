@@ -0,0 +1,193 @@
+//
+//  AvatarPairStatesTests.cpp
+//  tests/avatars/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AvatarPairStatesTests.h"
+
+#include <chrono>
+#include <unordered_map>
+
+#include <AvatarData.h>
+#include <AvatarPairStates.h>
+#include <GLMHelpers.h>
+#include <JointData.h>
+#include <test-utils/CountingAllocator.h>
+
+QTEST_MAIN(AvatarPairStatesTests)
+
+static const int NUM_JOINTS = 80; // a typical full body avatar
+
+namespace {
+
+// The node keyed maps the avatar mixer used to keep
+template <typename T>
+using CountingMap = std::unordered_map<NetworkLocalID, T, std::hash<NetworkLocalID>, std::equal_to<NetworkLocalID>,
+                                       CountingAllocator<std::pair<const NetworkLocalID, T>>>;
+
+struct NodeKeyedPairStates {
+    CountingMap<uint16_t> lastBroadcastSequenceNumbers;
+    CountingMap<uint64_t> lastBroadcastTimes;
+    CountingMap<uint64_t> lastOtherAvatarEncodeTime;
+    CountingMap<QVector<JointData>> lastOtherAvatarSentJoints;
+    CountingMap<std::chrono::steady_clock::time_point> lastSentTraitsTimestamps;
+};
+
+JointData makeJoint(int i) {
+    JointData joint;
+    joint.rotation = glm::angleAxis(0.01f * i, glm::normalize(glm::vec3(1.0f, 0.5f, 0.25f * i)));
+    joint.translation = glm::vec3(0.0f, 0.001f * i, 0.1f);
+    joint.rotationIsDefaultPose = false;
+    joint.translationIsDefaultPose = false;
+    return joint;
+}
+
+// What the avatar mixer keeps for one receiver that was sent every other avatar
+size_t nodeKeyedBytesPerReceiver(int numUsers) {
+    size_t allocatedBefore = countedAllocatedBytes();
+    size_t jointBytes = 0;
+
+    NodeKeyedPairStates states;
+    for (NetworkLocalID other = 1; other < numUsers; other++) {
+        states.lastBroadcastSequenceNumbers[other] = other;
+        states.lastBroadcastTimes[other] = other;
+        states.lastOtherAvatarEncodeTime[other] = other;
+        states.lastSentTraitsTimestamps[other] = std::chrono::steady_clock::now();
+        auto& joints = states.lastOtherAvatarSentJoints[other];
+        joints.resize(NUM_JOINTS);
+        for (int i = 0; i < NUM_JOINTS; i++) {
+            joints[i] = makeJoint(i);
+        }
+        jointBytes += sizeof(QArrayData) + joints.capacity() * sizeof(JointData);
+    }
+    return sizeof(states) + (countedAllocatedBytes() - allocatedBefore) + jointBytes;
+}
+
+size_t denseBytesPerReceiver(int numUsers) {
+    AvatarPairStates states;
+    uint8_t packedRotation[6];
+    for (NetworkLocalID other = 1; other < numUsers; other++) {
+        auto& state = states.get(other - 1, other);
+        state.lastBroadcastSequenceNumber = other;
+        state.lastBroadcastTime = other;
+        state.lastEncodeTime = other;
+        state.lastSentTraitsTimestamp = std::chrono::steady_clock::now();
+        auto& joints = states.getSentJoints(other - 1, other);
+        joints.resize(NUM_JOINTS);
+        for (int i = 0; i < NUM_JOINTS; i++) {
+            JointData joint = makeJoint(i);
+            packOrientationQuatToSixBytes(packedRotation, joint.rotation);
+            joints.rotationSent(i, joint.rotation, packedRotation);
+            joints.translationSent(i, joint.translation);
+            joints.setRotationIsDefaultPose(i, false);
+            joints.setTranslationIsDefaultPose(i, false);
+        }
+    }
+    return states.getMemoryUsage();
+}
+
+}  // namespace
+
+void AvatarPairStatesTests::testReusedIndex() {
+    AvatarPairStates states;
+    QVERIFY(states.find(3, 10) == nullptr);
+
+    states.get(3, 10).lastBroadcastSequenceNumber = 7;
+    states.getSentJoints(3, 10).resize(NUM_JOINTS);
+    QVERIFY(states.find(3, 10) != nullptr);
+    QCOMPARE(states.find(3, 10)->lastBroadcastSequenceNumber, (uint16_t)7);
+
+    // another avatar was given the index of one that disconnected
+    QVERIFY(states.find(3, 11) == nullptr);
+    QCOMPARE(states.get(3, 11).lastBroadcastSequenceNumber, (uint16_t)0);
+    QCOMPARE(states.getSentJoints(3, 11).size(), 0);
+    QVERIFY(states.find(3, 10) == nullptr);
+}
+
+void AvatarPairStatesTests::testRemove() {
+    AvatarPairStates states;
+    states.get(1, 10).lastEncodeTime = 1;
+    states.get(2, 20).lastEncodeTime = 2;
+
+    states.remove(10);
+    QVERIFY(states.find(1, 10) == nullptr);
+    QVERIFY(states.find(2, 20) != nullptr);
+    QCOMPARE(states.find(2, 20)->lastEncodeTime, (uint64_t)2);
+}
+
+void AvatarPairStatesTests::testPackedRotations() {
+    PackedJointData joints;
+    joints.resize(1);
+
+    glm::quat rotation = glm::angleAxis(0.5f, glm::normalize(glm::vec3(0.2f, 1.0f, -0.3f)));
+    QVERIFY(joints.rotationIsDefaultPose(0));
+    QVERIFY(joints.rotationChanged(0, rotation, true, AVATAR_MIN_ROTATION_DOT));
+
+    uint8_t packedRotation[6];
+    packOrientationQuatToSixBytes(packedRotation, rotation);
+    joints.rotationSent(0, rotation, packedRotation);
+    joints.setRotationIsDefaultPose(0, false);
+
+    QVERIFY(fabsf(glm::dot(joints.getRotation(0), rotation)) > 0.99999f);
+    QVERIFY(!joints.rotationChanged(0, rotation, true, AVATAR_MIN_ROTATION_DOT));
+    QVERIFY(!joints.rotationChanged(0, rotation, false, AVATAR_MIN_ROTATION_DOT));
+
+    glm::quat rotated = glm::angleAxis(glm::radians(1.0f), glm::vec3(0.0f, 1.0f, 0.0f)) * rotation;
+    QVERIFY(joints.rotationChanged(0, rotated, true, AVATAR_MIN_ROTATION_DOT));
+    QVERIFY(joints.rotationChanged(0, rotated, false, AVATAR_MIN_ROTATION_DOT));
+}
+
+void AvatarPairStatesTests::testPackedTranslations() {
+    PackedJointData joints;
+    joints.resize(2);
+
+    glm::vec3 translation(0.1f, 0.5f, -0.2f);
+    QVERIFY(joints.translationChanged(0, translation, true, AVATAR_MIN_TRANSLATION));
+
+    joints.translationSent(0, translation);
+    joints.setTranslationIsDefaultPose(0, false);
+    QVERIFY(glm::distance(joints.getTranslation(0), translation) < AVATAR_MIN_TRANSLATION);
+    QVERIFY(!joints.translationChanged(0, translation, true, AVATAR_MIN_TRANSLATION));
+    QVERIFY(!joints.translationChanged(0, translation, false, AVATAR_MIN_TRANSLATION));
+    QVERIFY(joints.translationChanged(0, translation + glm::vec3(0.001f), true, AVATAR_MIN_TRANSLATION));
+    QVERIFY(joints.translationChanged(0, translation + glm::vec3(0.001f), false, AVATAR_MIN_TRANSLATION));
+
+    // too far from the parent to be kept, so always sent again
+    glm::vec3 farTranslation(10.0f, 0.0f, 0.0f);
+    joints.translationSent(1, farTranslation);
+    joints.setTranslationIsDefaultPose(1, false);
+    QVERIFY(joints.translationChanged(1, farTranslation, true, AVATAR_MIN_TRANSLATION));
+}
+
+void AvatarPairStatesTests::benchmarkManyUsers() {
+    for (int numUsers : { 500, 1000 }) {
+        size_t nodeKeyedBytes = nodeKeyedBytesPerReceiver(numUsers) * numUsers;
+        size_t denseBytes = denseBytesPerReceiver(numUsers) * numUsers;
+        qDebug() << "Avatar mixer pair state for" << numUsers << "users: node keyed maps" << nodeKeyedBytes / (1024 * 1024)
+                 << "MiB, dense tables" << denseBytes / (1024 * 1024) << "MiB";
+        QVERIFY(2 * denseBytes < nodeKeyedBytes);
+    }
+
+    // the per-frame pass over the other avatars, for one receiver
+    const int NUM_USERS = 1000;
+    AvatarPairStates states;
+    for (NetworkLocalID other = 1; other < NUM_USERS; other++) {
+        states.get(other - 1, other).lastBroadcastSequenceNumber = other;
+    }
+
+    uint64_t numHeldBack = 0;
+    QBENCHMARK {
+        for (NetworkLocalID other = 1; other < NUM_USERS; other++) {
+            auto state = states.find(other - 1, other);
+            if (state && state->lastBroadcastSequenceNumber == other) {
+                numHeldBack += state->lastEncodeTime + 1;
+            }
+        }
+    }
+    QVERIFY(numHeldBack > 0);
+}
@@ -0,0 +1,26 @@
+//
+//  AvatarPairStatesTests.h
+//  tests/avatars/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AvatarPairStatesTests_h
+#define hifi_AvatarPairStatesTests_h
+
+#include <QtTest/QtTest>
+
+class AvatarPairStatesTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testReusedIndex();
+    void testRemove();
+    void testPackedRotations();
+    void testPackedTranslations();
+    void benchmarkManyUsers();
+};
+
+#endif // hifi_AvatarPairStatesTests_h
@@ -0,0 +1,226 @@
+//
+//  MeshSimplifierTests.cpp
+//  tests/baking/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "MeshSimplifierTests.h"
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <random>
+#include <set>
+
+#include <model-baker/BuildMeshLODsTask.h>
+#include <model-baker/MeshSimplifier.h>
+
+QTEST_MAIN(MeshSimplifierTests)
+
+static hfm::Mesh createIcosphere(int subdivisions) {
+    const float T = (1.0f + sqrtf(5.0f)) / 2.0f;
+    std::vector<glm::vec3> vertices {
+        { -1, T, 0 }, { 1, T, 0 }, { -1, -T, 0 }, { 1, -T, 0 },
+        { 0, -1, T }, { 0, 1, T }, { 0, -1, -T }, { 0, 1, -T },
+        { T, 0, -1 }, { T, 0, 1 }, { -T, 0, -1 }, { -T, 0, 1 }
+    };
+    std::vector<int> indices {
+        0, 11, 5, 0, 5, 1, 0, 1, 7, 0, 7, 10, 0, 10, 11,
+        1, 5, 9, 5, 11, 4, 11, 10, 2, 10, 7, 6, 7, 1, 8,
+        3, 9, 4, 3, 4, 2, 3, 2, 6, 3, 6, 8, 3, 8, 9,
+        4, 9, 5, 2, 4, 11, 6, 2, 10, 8, 6, 7, 9, 8, 1
+    };
+
+    for (int i = 0; i < subdivisions; i++) {
+        std::map<std::pair<int, int>, int> midpoints;
+        auto midpoint = [&](int a, int b) {
+            auto key = std::make_pair(std::min(a, b), std::max(a, b));
+            auto it = midpoints.find(key);
+            if (it != midpoints.end()) {
+                return it->second;
+            }
+            vertices.push_back(0.5f * (vertices[a] + vertices[b]));
+            midpoints[key] = (int)vertices.size() - 1;
+            return (int)vertices.size() - 1;
+        };
+
+        std::vector<int> subdivided;
+        for (size_t t = 0; t < indices.size(); t += 3) {
+            int a = indices[t], b = indices[t + 1], c = indices[t + 2];
+            int ab = midpoint(a, b), bc = midpoint(b, c), ca = midpoint(c, a);
+            subdivided.insert(subdivided.end(), { a, ab, ca, b, bc, ab, c, ca, bc, ab, bc, ca });
+        }
+        indices.swap(subdivided);
+    }
+
+    hfm::Mesh mesh;
+    for (const auto& vertex : vertices) {
+        mesh.vertices.push_back(glm::normalize(vertex));
+        mesh.normals.push_back(glm::normalize(vertex));
+    }
+    hfm::MeshPart part;
+    part.triangleIndices = QVector<int>::fromStdVector(indices);
+    mesh.parts.push_back(part);
+    return mesh;
+}
+
+// A flat grid in the XY plane, with texture coordinates matching the positions
+static hfm::Mesh createGrid(int size) {
+    hfm::Mesh mesh;
+    for (int y = 0; y <= size; y++) {
+        for (int x = 0; x <= size; x++) {
+            mesh.vertices.push_back(glm::vec3(x, y, 0.0f));
+            mesh.normals.push_back(glm::vec3(0.0f, 0.0f, 1.0f));
+            mesh.texCoords.push_back(glm::vec2(x, y) / (float)size);
+        }
+    }
+
+    hfm::MeshPart part;
+    for (int y = 0; y < size; y++) {
+        for (int x = 0; x < size; x++) {
+            int i = y * (size + 1) + x;
+            part.triangleIndices << i << i + 1 << i + size + 1;
+            part.triangleIndices << i + 1 << i + size + 2 << i + size + 1;
+        }
+    }
+    mesh.parts.push_back(part);
+    return mesh;
+}
+
+static baker::MeshNormals getNormals(const hfm::Mesh& mesh) {
+    return mesh.normals.toStdVector();
+}
+
+void MeshSimplifierTests::sphereLODTest() {
+    auto mesh = createIcosphere(4);
+    const size_t numTriangles = mesh.parts[0].triangleIndices.size() / 3;
+
+    BuildMeshLODsTask::Settings settings;
+    auto lods = BuildMeshLODsTask::buildMeshLODs(mesh, getNormals(mesh), settings);
+    QVERIFY(lods.size() >= 2);
+    QVERIFY((int)lods.size() <= settings.maxLODs);
+
+    const float maxError = settings.maxRelativeError * glm::length(glm::vec3(2.0f));
+    size_t previousTriangles = numTriangles;
+    float previousError = 0.0f;
+    for (const auto& lod : lods) {
+        QCOMPARE(lod.triangleIndicesPerPart.size(), (size_t)1);
+        const auto& indices = lod.triangleIndicesPerPart[0];
+        QCOMPARE(indices.size() % 3, (size_t)0);
+
+        size_t triangles = indices.size() / 3;
+        QVERIFY(triangles > 0);
+        QVERIFY(triangles < previousTriangles);
+        QVERIFY(lod.error >= previousError);
+        QVERIFY(lod.error <= maxError);
+
+        // the surface keeps its orientation: every triangle still faces away from the center
+        for (size_t t = 0; t < indices.size(); t += 3) {
+            QVERIFY(indices[t] >= 0 && indices[t] < mesh.vertices.size());
+            const auto& p0 = mesh.vertices[indices[t]];
+            const auto& p1 = mesh.vertices[indices[t + 1]];
+            const auto& p2 = mesh.vertices[indices[t + 2]];
+            QVERIFY(glm::dot(glm::cross(p1 - p0, p2 - p0), p0 + p1 + p2) > 0.0f);
+        }
+
+        qDebug() << "LOD triangles" << triangles << "error" << lod.error;
+        previousTriangles = triangles;
+        previousError = lod.error;
+    }
+}
+
+void MeshSimplifierTests::lockedFeaturesTest() {
+    const int SIZE = 64;
+    auto mesh = createGrid(SIZE);
+
+    // split the vertices of the middle column so the right half gets its own texture coordinates
+    const int SEAM_COLUMN = SIZE / 2;
+    std::map<int, int> seamVertices;
+    for (int y = 0; y <= SIZE; y++) {
+        int original = y * (SIZE + 1) + SEAM_COLUMN;
+        seamVertices[original] = mesh.vertices.size();
+        mesh.vertices.push_back(mesh.vertices[original]);
+        mesh.normals.push_back(mesh.normals[original]);
+        mesh.texCoords.push_back(glm::vec2(0.0f, mesh.texCoords[original].y));
+    }
+    auto& indices = mesh.parts[0].triangleIndices;
+    for (int t = 0; t < indices.size(); t += 3) {
+        float centroidX = (mesh.vertices[indices[t]].x + mesh.vertices[indices[t + 1]].x + mesh.vertices[indices[t + 2]].x) / 3.0f;
+        if (centroidX > SEAM_COLUMN) {
+            for (int k = 0; k < 3; k++) {
+                auto it = seamVertices.find(indices[t + k]);
+                if (it != seamVertices.end()) {
+                    indices[t + k] = it->second;
+                }
+            }
+        }
+    }
+
+    BuildMeshLODsTask::Settings settings;
+    auto lods = BuildMeshLODsTask::buildMeshLODs(mesh, getNormals(mesh), settings);
+    QVERIFY(lods.size() >= 1);
+
+    for (const auto& lod : lods) {
+        std::set<int> used(lod.triangleIndicesPerPart[0].begin(), lod.triangleIndicesPerPart[0].end());
+        for (int i = 0; i < mesh.vertices.size(); i++) {
+            const auto& position = mesh.vertices[i];
+            bool isBorder = position.x == 0.0f || position.y == 0.0f || position.x == SIZE || position.y == SIZE;
+            bool isSeam = position.x == SEAM_COLUMN;
+            if (isBorder || isSeam) {
+                QVERIFY2(used.count(i) == 1, "border and seam vertices must be kept");
+            }
+        }
+    }
+}
+
+void MeshSimplifierTests::vertexCacheTest() {
+    const int SIZE = 64;
+    auto mesh = createGrid(SIZE);
+    const auto& gridIndices = mesh.parts[0].triangleIndices;
+
+    // shuffle the triangles to start from the worst case
+    std::vector<std::array<int, 3>> triangles;
+    for (int t = 0; t < gridIndices.size(); t += 3) {
+        triangles.push_back({ { gridIndices[t], gridIndices[t + 1], gridIndices[t + 2] } });
+    }
+    std::mt19937 generator(742272);
+    std::shuffle(triangles.begin(), triangles.end(), generator);
+    baker::MeshIndices indices;
+    for (const auto& triangle : triangles) {
+        indices.insert(indices.end(), triangle.begin(), triangle.end());
+    }
+
+    const size_t numVertices = mesh.vertices.size();
+    float shuffledRatio = baker::evalCacheMissRatio(indices, numVertices);
+    baker::optimizeVertexCache(indices, numVertices);
+    float optimizedRatio = baker::evalCacheMissRatio(indices, numVertices);
+    qDebug() << "Cache miss ratio shuffled" << shuffledRatio << "optimized" << optimizedRatio;
+    QVERIFY(optimizedRatio < 1.0f);
+    QVERIFY(optimizedRatio < 0.5f * shuffledRatio);
+
+    std::vector<std::array<int, 3>> optimizedTriangles;
+    for (size_t t = 0; t < indices.size(); t += 3) {
+        optimizedTriangles.push_back({ { indices[t], indices[t + 1], indices[t + 2] } });
+    }
+    std::sort(triangles.begin(), triangles.end());
+    std::sort(optimizedTriangles.begin(), optimizedTriangles.end());
+    QVERIFY(triangles == optimizedTriangles);
+
+    baker::optimizeOverdraw(indices, mesh.vertices);
+    QCOMPARE(indices.size(), (size_t)gridIndices.size());
+}
+
+void MeshSimplifierTests::simplificationTimeTest() {
+    auto mesh = createIcosphere(6);
+    auto normals = getNormals(mesh);
+    BuildMeshLODsTask::Settings settings;
+
+    QBENCHMARK {
+        auto lods = BuildMeshLODsTask::buildMeshLODs(mesh, normals, settings);
+        QVERIFY(!lods.empty());
+    }
+}
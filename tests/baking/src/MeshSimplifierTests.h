@@ -0,0 +1,33 @@
+//
+//  MeshSimplifierTests.h
+//  tests/baking/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_MeshSimplifierTests_h
+#define hifi_MeshSimplifierTests_h
+
+#include <QtTest/QtTest>
+
+class MeshSimplifierTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    // Levels of detail of a closed surface shrink progressively and stay within their error bound
+    void sphereLODTest();
+
+    // Open borders, attribute seams and joint boundaries are preserved
+    void lockedFeaturesTest();
+
+    // Vertex cache reordering keeps every triangle and lowers the cache miss ratio
+    void vertexCacheTest();
+
+    // Time to build the levels of detail of a dense mesh
+    void simplificationTimeTest();
+};
+
+#endif // hifi_MeshSimplifierTests_h
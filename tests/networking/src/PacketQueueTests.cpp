@@ -0,0 +1,101 @@
+//
+//  PacketQueueTests.cpp
+//  tests/networking/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PacketQueueTests.h"
+
+#include <udt/PacketList.h>
+#include <udt/PacketQueue.h>
+
+QTEST_MAIN(PacketQueueTests)
+
+using namespace udt;
+
+static std::unique_ptr<PacketList> createPacketList(char marker, int numPackets, PacketPriority priority) {
+    auto packetList = PacketList::create(PacketType::Unknown, QByteArray(), true, false);
+    packetList->setPriority(priority);
+    for (int i = 0; i < numPackets; ++i) {
+        packetList->write(&marker, sizeof(marker));
+        packetList->closeCurrentPacket();
+    }
+    return packetList;
+}
+
+static std::unique_ptr<Packet> createPacket(char marker) {
+    auto packet = Packet::create(-1, true);
+    packet->write(&marker, sizeof(marker));
+    return packet;
+}
+
+static char takeMarker(PacketQueue& queue) {
+    auto packet = queue.takePacket();
+    return packet ? packet->getPayload()[0] : 0;
+}
+
+void PacketQueueTests::priorityPreemptionTest() {
+    PacketQueue queue;
+
+    queue.queuePacketList(createPacketList('B', 100, PacketPriority::Bulk));
+
+    // start draining the bulk list
+    QCOMPARE(takeMarker(queue), 'B');
+    QCOMPARE(takeMarker(queue), 'B');
+
+    const int NUM_INTERACTIVE_PACKETS = 3;
+    queue.queuePacketList(createPacketList('I', NUM_INTERACTIVE_PACKETS, PacketPriority::Interactive));
+
+    for (int i = 0; i < NUM_INTERACTIVE_PACKETS; ++i) {
+        QCOMPARE(takeMarker(queue), 'I');
+    }
+    QCOMPARE(takeMarker(queue), 'B');
+}
+
+void PacketQueueTests::weightedShareTest() {
+    PacketQueue queue;
+
+    const int INTERACTIVE_WEIGHT = 4;
+    const int BULK_WEIGHT = 1;
+    queue.setPriorityWeight(PacketPriority::Interactive, INTERACTIVE_WEIGHT);
+    queue.setPriorityWeight(PacketPriority::Bulk, BULK_WEIGHT);
+
+    queue.queuePacketList(createPacketList('B', 200, PacketPriority::Bulk));
+    queue.queuePacketList(createPacketList('I', 200, PacketPriority::Interactive));
+
+    const int NUM_ROUNDS = 20;
+    int numInteractive = 0;
+    int numBulk = 0;
+    for (int i = 0; i < NUM_ROUNDS * (INTERACTIVE_WEIGHT + BULK_WEIGHT); ++i) {
+        char marker = takeMarker(queue);
+        numInteractive += marker == 'I';
+        numBulk += marker == 'B';
+    }
+
+    QCOMPARE(numInteractive, NUM_ROUNDS * INTERACTIVE_WEIGHT);
+    QCOMPARE(numBulk, NUM_ROUNDS * BULK_WEIGHT);
+
+    // once the interactive list is drained bulk gets the whole budget
+    while (!queue.isEmpty()) {
+        takeMarker(queue);
+    }
+    QVERIFY(queue.isEmpty());
+    QVERIFY(!queue.takePacket());
+}
+
+void PacketQueueTests::mainChannelTest() {
+    PacketQueue queue;
+
+    queue.queuePacketList(createPacketList('B', 100, PacketPriority::Bulk));
+    QCOMPARE(takeMarker(queue), 'B');
+
+    queue.queuePacket(createPacket('C'));
+    QCOMPARE(takeMarker(queue), 'C');
+
+    QCOMPARE(takeMarker(queue), 'B');
+    QVERIFY(!queue.isEmpty());
+}
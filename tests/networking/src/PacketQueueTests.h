@@ -0,0 +1,31 @@
+//
+//  PacketQueueTests.h
+//  tests/networking/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_PacketQueueTests_h
+#define hifi_PacketQueueTests_h
+
+#pragma once
+
+#include <QtTest/QtTest>
+
+class PacketQueueTests : public QObject {
+    Q_OBJECT
+private slots:
+    // Test that a higher priority list queued behind a bulk list is sent first
+    void priorityPreemptionTest();
+
+    // Test that busy priority classes share the send budget according to their weights
+    void weightedShareTest();
+
+    // Test that single packets on the main channel keep flowing during bulk transfers
+    void mainChannelTest();
+};
+
+#endif // hifi_PacketQueueTests_h
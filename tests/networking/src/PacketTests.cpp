@@ -13,6 +13,7 @@
 #include <test-utils/QTestExtensions.h>
 
 #include <NLPacket.h>
+#include <NLPacketList.h>
 
 QTEST_MAIN(PacketTests)
 
@@ -180,3 +181,33 @@ void PacketTests::primitiveTest() {
     QCOMPARE(recvPacket->peekPrimitive(&noValue), 0);
     QCOMPARE(recvPacket->readPrimitive(&noValue), 0);
 }
+
+void PacketTests::resegmentTest() {
+    QByteArray data(5000, 0);
+    for (int i = 0; i < data.size(); ++i) {
+        data[i] = (char)i;
+    }
+
+    auto packetList = NLPacketList::create(PacketType::Unknown, QByteArray(), true, true);
+    packetList->write(data);
+    packetList->closeCurrentPacket();
+    QCOMPARE(packetList->getNumPackets(), (size_t)4);
+
+    // larger packets, the message is unchanged
+    QVERIFY(packetList->resegment(4000));
+    QCOMPARE(packetList->getNumPackets(), (size_t)2);
+    QCOMPARE(packetList->getPacketSize(), 4000);
+    QCOMPARE(packetList->getMessage(), data);
+    QVERIFY(packetList->getDataSize() <= (size_t)(2 * 4000));
+
+    // smaller packets
+    QVERIFY(packetList->resegment(1000));
+    QCOMPARE(packetList->getNumPackets(), (size_t)6);
+    QCOMPARE(packetList->getMessage(), data);
+
+    // the receiver of unordered lists relies on where their packets are cut
+    auto unorderedList = NLPacketList::create(PacketType::Unknown, QByteArray(), true, false);
+    unorderedList->write(data.left(100));
+    QVERIFY(!unorderedList->resegment(4000));
+    QCOMPARE(unorderedList->getPacketSize(), udt::MAX_PACKET_SIZE);
+}
@@ -36,6 +36,9 @@ private slots:
 
     // Test set/get packet type
     void packetTypeTest();
+
+    // Test re-cutting packet lists to another packet size
+    void resegmentTest();
 };
 
 #endif // hifi_PacketTests_h
@@ -42,6 +42,31 @@ void ResourceTests::initTestCase() {
     networkAccessManager.setCache(cache);
 }
 
+void ResourceTests::memoryBudget() {
+    const qint64 MB = BYTES_PER_MEGABYTES;
+
+    // opt-in
+    auto sharedItems = DependencyManager::get<ResourceCacheSharedItems>();
+    QCOMPARE(sharedItems->getMemoryBudget(), (qint64)0);
+    QCOMPARE(ResourceCacheSharedItems::getBytesToEvict(900 * MB, 500 * MB, 0), (qint64)0);
+
+    // under budget
+    QCOMPARE(ResourceCacheSharedItems::getBytesToEvict(900 * MB, 500 * MB, 1000 * MB), (qint64)0);
+
+    // over budget, and the unused resources are enough to get back under it
+    QCOMPARE(ResourceCacheSharedItems::getBytesToEvict(1200 * MB, 500 * MB, 1000 * MB), 200 * MB);
+    QCOMPARE(ResourceCacheSharedItems::getBytesToEvict(1500 * MB, 500 * MB, 1000 * MB), 500 * MB);
+
+    // the resources in use alone are over budget, evicting the unused ones would only have them loaded again
+    QCOMPARE(ResourceCacheSharedItems::getBytesToEvict(1600 * MB, 500 * MB, 1000 * MB), (qint64)0);
+    QCOMPARE(ResourceCacheSharedItems::getBytesToEvict(1600 * MB, 0, 1000 * MB), (qint64)0);
+
+    // changing the budget with nothing to evict
+    sharedItems->setMemoryBudget(100 * MB);
+    QCOMPARE(sharedItems->getMemoryBudget(), 100 * MB);
+    sharedItems->setMemoryBudget(0);
+}
+
 void ResourceTests::cleanupTestCase() {
     DependencyManager::get<ResourceManager>()->cleanup();
 }
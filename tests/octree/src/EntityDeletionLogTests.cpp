@@ -0,0 +1,122 @@
+//
+//  EntityDeletionLogTests.cpp
+//  tests/octree/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityDeletionLogTests.h"
+
+#include <EntityDeletionLog.h>
+#include <UUID.h>
+
+QTEST_MAIN(EntityDeletionLogTests)
+
+static const int IDS_PER_SEGMENT = 3;
+
+static QVector<QUuid> appendDeletes(EntityDeletionLog& log, int numDeletes) {
+    QVector<QUuid> entityIDs;
+    for (int i = 0; i < numDeletes; ++i) {
+        entityIDs.push_back(QUuid::createUuid());
+        log.append(entityIDs.back());
+    }
+    return entityIDs;
+}
+
+static QVector<QUuid> decodeRuns(const std::vector<EntityDeletionLog::Run>& runs) {
+    QVector<QUuid> entityIDs;
+    for (const auto& run : runs) {
+        for (int i = 0; i < run.numIDs; ++i) {
+            entityIDs.push_back(QUuid::fromRfc4122(QByteArray(run.data() + i * NUM_BYTES_RFC4122_UUID, NUM_BYTES_RFC4122_UUID)));
+        }
+    }
+    return entityIDs;
+}
+
+void EntityDeletionLogTests::testRunsFromCursor() {
+    EntityDeletionLog log(IDS_PER_SEGMENT);
+    auto cursor = log.addCursor();
+    auto entityIDs = appendDeletes(log, 7);
+    QCOMPARE(log.getEnd(), (EntityDeletionLog::Sequence)7);
+
+    // a run per segment, each as full as a packet
+    std::vector<EntityDeletionLog::Run> runs;
+    QCOMPARE(log.getDeletedSince(cursor, runs), (EntityDeletionLog::Sequence)7);
+    QCOMPARE((int)runs.size(), 3);
+    QCOMPARE(runs[0].numIDs, IDS_PER_SEGMENT);
+    QCOMPARE(runs[2].numIDs, 1);
+    QCOMPARE(decodeRuns(runs), entityIDs);
+
+    // from the middle of a segment
+    runs.clear();
+    log.getDeletedSince(4, runs);
+    QCOMPARE((int)runs.size(), 2);
+    QCOMPARE(runs[0].numIDs, 2);
+    QCOMPARE(decodeRuns(runs), entityIDs.mid(4));
+
+    // nothing new
+    runs.clear();
+    QCOMPARE(log.getDeletedSince(7, runs), (EntityDeletionLog::Sequence)7);
+    QVERIFY(runs.empty());
+}
+
+void EntityDeletionLogTests::testRunsOutliveAppends() {
+    EntityDeletionLog log(IDS_PER_SEGMENT);
+    auto entityIDs = appendDeletes(log, 1);
+
+    std::vector<EntityDeletionLog::Run> runs;
+    log.getDeletedSince(0, runs);
+
+    // the segment the run shares keeps growing in the log, while the run still holds the bytes it was given
+    entityIDs += appendDeletes(log, 4);
+    QCOMPARE(decodeRuns(runs), entityIDs.mid(0, 1));
+
+    runs.clear();
+    log.getDeletedSince(0, runs);
+    QCOMPARE(decodeRuns(runs), entityIDs);
+}
+
+void EntityDeletionLogTests::testPruneToLowestCursor() {
+    EntityDeletionLog log(IDS_PER_SEGMENT);
+    auto slowCursor = log.addCursor();
+    auto fastCursor = log.addCursor();
+    auto entityIDs = appendDeletes(log, 7);
+
+    std::vector<EntityDeletionLog::Run> runs;
+    auto end = log.getDeletedSince(fastCursor, runs);
+    log.moveCursor(fastCursor, end);
+    log.moveCursor(slowCursor, 4);
+    QCOMPARE(log.getLowestCursor(), (EntityDeletionLog::Sequence)4);
+
+    // only the first segment is behind every cursor
+    log.prune();
+    runs.clear();
+    log.getDeletedSince(IDS_PER_SEGMENT, runs);
+    QCOMPARE(decodeRuns(runs), entityIDs.mid(IDS_PER_SEGMENT));
+
+    log.moveCursor(4, end);
+    log.prune();
+    QVERIFY(log.isEmpty());
+
+    // the next deletes start a new segment
+    auto moreEntityIDs = appendDeletes(log, 2);
+    runs.clear();
+    log.getDeletedSince(end, runs);
+    QCOMPARE(decodeRuns(runs), moreEntityIDs);
+}
+
+void EntityDeletionLogTests::testPruneWithoutCursors() {
+    EntityDeletionLog log(IDS_PER_SEGMENT);
+    auto cursor = log.addCursor();
+    appendDeletes(log, 5);
+    log.prune();
+    QVERIFY(!log.isEmpty());
+
+    log.removeCursor(cursor);
+    QCOMPARE(log.getLowestCursor(), log.getEnd());
+    log.prune();
+    QVERIFY(log.isEmpty());
+}
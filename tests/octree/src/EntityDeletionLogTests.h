@@ -0,0 +1,25 @@
+//
+//  EntityDeletionLogTests.h
+//  tests/octree/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntityDeletionLogTests_h
+#define hifi_EntityDeletionLogTests_h
+
+#include <QtTest/QtTest>
+
+class EntityDeletionLogTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testRunsFromCursor();
+    void testRunsOutliveAppends();
+    void testPruneToLowestCursor();
+    void testPruneWithoutCursors();
+};
+
+#endif // hifi_EntityDeletionLogTests_h
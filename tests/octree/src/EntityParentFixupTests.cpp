@@ -0,0 +1,161 @@
+//
+//  EntityParentFixupTests.cpp
+//  tests/octree/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityParentFixupTests.h"
+
+#include <DependencyManager.h>
+#include <EntityTree.h>
+#include <EntityTreeElement.h>
+#include <LightEntityItem.h>
+#include <SpatialParentFinder.h>
+
+QTEST_MAIN(EntityParentFixupTests)
+
+namespace {
+
+// Finds parents among the entities of the tree only, the way the entity server does without any avatars
+class EntityParentFinder : public SpatialParentFinder {
+public:
+    SpatiallyNestableWeakPointer find(QUuid parentID, bool& success, SpatialParentTree* entityTree) const override {
+        SpatiallyNestableWeakPointer parent;
+        if (parentID.isNull()) {
+            success = true;
+            return parent;
+        }
+        if (entityTree) {
+            parent = entityTree->findByID(parentID);
+        }
+        success = !parent.expired();
+        return parent;
+    }
+};
+
+EntityTreePointer makeTree() {
+    auto tree = std::make_shared<EntityTree>();
+    tree->createRootElement();
+    tree->setIsClient(true);
+    return tree;
+}
+
+EntityItemPointer addEntity(const EntityTreePointer& tree, const QUuid& parentID, const QUuid& id = QUuid::createUuid()) {
+    auto entity = std::make_shared<LightEntityItem>(EntityItemID(id));
+    entity->setParentID(parentID);
+    tree->withWriteLock([&] {
+        tree->getRoot()->addEntityItem(entity);
+        tree->addEntityMapEntry(entity);
+        tree->postAddEntity(entity);
+    });
+    return entity;
+}
+
+}
+
+void EntityParentFixupTests::initTestCase() {
+    DependencyManager::set<SpatialParentFinder, EntityParentFinder>();
+}
+
+void EntityParentFixupTests::cleanupTestCase() {
+    DependencyManager::destroy<SpatialParentFinder>();
+}
+
+void EntityParentFixupTests::testParentArrivesLate() {
+    auto tree = makeTree();
+    QUuid parentID = QUuid::createUuid();
+
+    auto child = addEntity(tree, parentID);
+    auto grandchild = addEntity(tree, child->getID());
+    QCOMPARE(tree->getWaitingForParentID(child->getID()), parentID);
+    QCOMPARE(tree->getWaitingForParentID(grandchild->getID()), parentID);
+
+    // waiting entities aren't checked again on every update
+    tree->preUpdate();
+    QCOMPARE(tree->getWaitingForParentID(child->getID()), parentID);
+
+    auto parent = addEntity(tree, QUuid(), parentID);
+    tree->preUpdate();
+    QVERIFY(tree->getWaitingForParentID(child->getID()).isNull());
+    QVERIFY(tree->getWaitingForParentID(grandchild->getID()).isNull());
+
+    bool success = false;
+    QVERIFY(grandchild->getParentPointer(success) == child);
+    QVERIFY(success);
+    QVERIFY(child->getParentPointer(success) == parent);
+    QVERIFY(success);
+}
+
+void EntityParentFixupTests::testAvatarArrivesLate() {
+    auto tree = makeTree();
+    QUuid avatarID = QUuid::createUuid();
+
+    auto child = addEntity(tree, avatarID);
+    QCOMPARE(tree->getWaitingForParentID(child->getID()), avatarID);
+
+    // a client never finds the avatars among its entities, so it is known as a child of the avatar from now on
+    tree->knowAvatarID(avatarID);
+    tree->preUpdate();
+    QVERIFY(tree->getWaitingForParentID(child->getID()).isNull());
+
+    // and isn't put back to wait when the avatar is known again
+    tree->knowAvatarID(avatarID);
+    tree->preUpdate();
+    QVERIFY(tree->getWaitingForParentID(child->getID()).isNull());
+}
+
+void EntityParentFixupTests::testAncestorReparented() {
+    auto tree = makeTree();
+    QUuid missingID = QUuid::createUuid();
+
+    auto known = addEntity(tree, QUuid());
+    auto parent = addEntity(tree, missingID);
+    auto child = addEntity(tree, parent->getID());
+    QCOMPARE(tree->getWaitingForParentID(parent->getID()), missingID);
+    QCOMPARE(tree->getWaitingForParentID(child->getID()), missingID);
+
+    // the missing ancestor never arrives, but the parent is moved under an entity which is known
+    parent->setParentID(known->getID());
+    tree->addToNeedsParentFixupList(parent);
+    tree->preUpdate();
+    QVERIFY(tree->getWaitingForParentID(parent->getID()).isNull());
+    tree->preUpdate();
+    QVERIFY(tree->getWaitingForParentID(child->getID()).isNull());
+
+    bool success = false;
+    child->getMaximumAACube(success);
+    QVERIFY(success);
+}
+
+void EntityParentFixupTests::testParentDeletedWhileChildrenWait() {
+    auto tree = makeTree();
+    QUuid missingID = QUuid::createUuid();
+
+    auto parent = addEntity(tree, missingID);
+    auto child = addEntity(tree, parent->getID());
+    QCOMPARE(tree->getWaitingForParentID(child->getID()), missingID);
+
+    EntityItemID parentID = parent->getID();
+    tree->withWriteLock([&] {
+        tree->deleteEntitiesByPointer({ parent });
+    });
+    parent.reset();
+    QVERIFY(tree->getWaitingForParentID(parentID).isNull());
+
+    // the child outlives its parent, and waits for it rather than for the ancestor above it
+    tree->preUpdate();
+    QCOMPARE(tree->getWaitingForParentID(child->getID()), QUuid(parentID));
+
+    addEntity(tree, QUuid(), parentID);
+    tree->preUpdate();
+    QVERIFY(tree->getWaitingForParentID(child->getID()).isNull());
+
+    // nothing is left waiting for the ancestor which never arrived
+    addEntity(tree, QUuid(), missingID);
+    tree->preUpdate();
+    QVERIFY(tree->getWaitingForParentID(child->getID()).isNull());
+}
@@ -0,0 +1,27 @@
+//
+//  EntityParentFixupTests.h
+//  tests/octree/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntityParentFixupTests_h
+#define hifi_EntityParentFixupTests_h
+
+#include <QtTest/QtTest>
+
+class EntityParentFixupTests : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void testParentArrivesLate();
+    void testAvatarArrivesLate();
+    void testAncestorReparented();
+    void testParentDeletedWhileChildrenWait();
+};
+
+#endif // hifi_EntityParentFixupTests_h
@@ -0,0 +1,310 @@
+//
+//  EntitySentStateTests.cpp
+//  tests/octree/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntitySentStateTests.h"
+
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+
+#include <DenseIndexAllocator.h>
+#include <DenseTimestamps.h>
+#include <DiffTraversal.h>
+#include <EntityTree.h>
+#include <EntityTreeElement.h>
+#include <LightEntityItem.h>
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
+#include <test-utils/CountingAllocator.h>
+
+QTEST_MAIN(EntitySentStateTests)
+
+static const int TREE_DEPTH = 3; // 512 leaves
+static const int ENTITIES_PER_LEAF = 40;
+static const float VIEW_RADIUS = 100000.0f; // every element is in view
+static const glm::vec3 VIEW_STEP(10.0f, 0.0f, 0.0f); // far enough for a Differential traversal
+
+namespace {
+
+// The pointer keyed maps the entity server used to keep
+using PointerKeyedState = std::unordered_map<EntityItem*, uint64_t, std::hash<EntityItem*>, std::equal_to<EntityItem*>,
+                                             CountingAllocator<std::pair<EntityItem* const, uint64_t>>>;
+
+// A complete octree with the same number of entities in each of its leaves
+class TestTree {
+public:
+    TestTree() {
+        _tree = std::make_shared<EntityTree>();
+        _tree->createRootElement();
+        std::vector<EntityTreeElementPointer> path;
+        addElements(_tree->getRoot(), TREE_DEPTH, path);
+    }
+    ~TestTree() {
+        for (auto& element : _elements) {
+            element->cleanupEntities();
+        }
+    }
+
+    EntityTreeElementPointer getRoot() { return _tree->getRoot(); }
+    glm::vec3 getCenter() { return getRoot()->getAACube().calcCenter(); }
+    const std::vector<EntityItemPointer>& getEntities() const { return _entities; }
+
+    // changes an entity the way the entity simulation does, dirtying the elements down to it
+    void change(int i) {
+        _entities[i]->markAsChangedOnServer();
+        for (auto& element : _leafPaths[i / ENTITIES_PER_LEAF]) {
+            element->markWithChangedTime();
+        }
+        _entities[i]->getElement()->bumpChangedContent();
+    }
+
+private:
+    void addElements(const EntityTreeElementPointer& element, int depth, std::vector<EntityTreeElementPointer>& path) {
+        _elements.push_back(element);
+        path.push_back(element);
+        if (depth == 0) {
+            for (int i = 0; i < ENTITIES_PER_LEAF; i++) {
+                auto entity = std::make_shared<LightEntityItem>(EntityItemID(QUuid::createUuid()));
+                element->addEntityItem(entity);
+                _entities.push_back(entity);
+            }
+            _leafPaths.push_back(path);
+        } else {
+            for (int i = 0; i < NUMBER_OF_CHILDREN; i++) {
+                auto child = std::static_pointer_cast<EntityTreeElement>(element->addChildAtIndex(i));
+                addElements(child, depth - 1, path);
+            }
+        }
+        path.pop_back();
+    }
+
+    EntityTreePointer _tree;
+    std::vector<EntityTreeElementPointer> _elements;
+    std::vector<std::vector<EntityTreeElementPointer>> _leafPaths;
+    std::vector<EntityItemPointer> _entities;
+};
+
+// What an entity server send thread does for one client, sending whatever the client doesn't have right away.
+// Only the dense tables come with subtree summaries, the pointer keyed maps are how it was done before.
+template <typename KnownState>
+class SimulatedClient {
+public:
+    int traverse(const EntityTreeElementPointer& root, const glm::vec3& position) {
+        DiffTraversal::View view;
+        ConicalViewFrustum frustum;
+        frustum.setPositionAndSimpleRadius(position, VIEW_RADIUS);
+        view.viewFrustums.push_back(frustum);
+
+        int numProbes = 0;
+        _traversal.prepareNewTraversal(view, root);
+        _traversal.setScanCallback([&](DiffTraversal::VisibleElement& next) {
+            next.allKnown = std::is_same<KnownState, DenseTimestamps>::value;
+            next.element->forEachEntity([&](EntityItemPointer entity) {
+                ++numProbes;
+                uint64_t knownTimestamp = getKnown(entity);
+                if (knownTimestamp == 0 || entity->getLastChangedOnServer() > knownTimestamp) {
+                    setKnown(entity, usecTimestampNow());
+                    next.allKnown = false;
+                }
+            });
+        });
+        while (!_traversal.finished()) {
+            _traversal.traverse(USECS_PER_SECOND);
+        }
+        return numProbes;
+    }
+
+    size_t getMemoryUsage() const;
+
+private:
+    uint64_t getKnown(const EntityItemPointer& entity) const;
+    void setKnown(const EntityItemPointer& entity, uint64_t timestamp);
+
+    DiffTraversal _traversal;
+    KnownState _known;
+};
+
+template <>
+uint64_t SimulatedClient<DenseTimestamps>::getKnown(const EntityItemPointer& entity) const {
+    return _known.get(entity->getDenseIndex());
+}
+
+template <>
+void SimulatedClient<DenseTimestamps>::setKnown(const EntityItemPointer& entity, uint64_t timestamp) {
+    _known.set(entity->getDenseIndex(), timestamp);
+}
+
+template <>
+size_t SimulatedClient<DenseTimestamps>::getMemoryUsage() const {
+    return _known.getMemoryUsage() + _traversal.getMemoryUsage();
+}
+
+template <>
+uint64_t SimulatedClient<PointerKeyedState>::getKnown(const EntityItemPointer& entity) const {
+    auto known = _known.find(entity.get());
+    return known != _known.end() ? known->second : 0;
+}
+
+template <>
+void SimulatedClient<PointerKeyedState>::setKnown(const EntityItemPointer& entity, uint64_t timestamp) {
+    _known[entity.get()] = timestamp;
+}
+
+void waitForClockTick() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+}
+
+}  // namespace
+
+void EntitySentStateTests::testDenseIndices() {
+    DenseIndexAllocator allocator;
+    DenseIndex first = allocator.allocate();
+    DenseIndex second = allocator.allocate();
+    DenseIndex third = allocator.allocate();
+    QCOMPARE(first.index, (uint32_t)0);
+    QCOMPARE(second.index, (uint32_t)1);
+    QCOMPARE(third.index, (uint32_t)2);
+    QCOMPARE(first.generation, (uint32_t)0);
+
+    // released indices are handed out again lowest first, with the next generation
+    allocator.release(third);
+    allocator.release(first);
+    DenseIndex reused = allocator.allocate();
+    QCOMPARE(reused.index, (uint32_t)0);
+    QCOMPARE(reused.generation, (uint32_t)1);
+    QCOMPARE(allocator.allocate().index, (uint32_t)2);
+    QCOMPARE(allocator.allocate().index, (uint32_t)3);
+    QCOMPARE(allocator.getCapacity(), (uint32_t)4);
+}
+
+void EntitySentStateTests::testDenseTimestamps() {
+    DenseTimestamps timestamps;
+    const DenseIndex INDEX { 10 * DenseTimestamps::PAGE_SIZE + 3, 0 };
+    QCOMPARE(timestamps.get(INDEX), (uint64_t)0);
+
+    size_t emptyUsage = timestamps.getMemoryUsage();
+    timestamps.reset(INDEX);
+    QCOMPARE(timestamps.getMemoryUsage(), emptyUsage);
+
+    timestamps.set(INDEX, 42);
+    QCOMPARE(timestamps.get(INDEX), (uint64_t)42);
+    QCOMPARE(timestamps.get({ INDEX.index + 1, 0 }), (uint64_t)0);
+    QCOMPARE(timestamps.get({ INDEX.index - DenseTimestamps::PAGE_SIZE, 0 }), (uint64_t)0);
+
+    timestamps.reset(INDEX);
+    QCOMPARE(timestamps.get(INDEX), (uint64_t)0);
+
+    timestamps.clear();
+    QCOMPARE(timestamps.get(INDEX), (uint64_t)0);
+}
+
+void EntitySentStateTests::testReusedDenseIndices() {
+    DenseIndexAllocator allocator;
+    DenseTimestamps timestamps;
+    DenseIndex deleted = allocator.allocate();
+    timestamps.set(deleted, 42);
+
+    // the index is reused before the table hears that its holder was deleted
+    allocator.release(deleted);
+    DenseIndex created = allocator.allocate();
+    QCOMPARE(created.index, deleted.index);
+    QCOMPARE(timestamps.get(created), (uint64_t)0);
+
+    timestamps.set(created, 43);
+    timestamps.reset(deleted);
+    QCOMPARE(timestamps.get(created), (uint64_t)43);
+    QCOMPARE(timestamps.get(deleted), (uint64_t)0);
+}
+
+void EntitySentStateTests::testKnownSubtreesAreSkipped() {
+    TestTree tree;
+    const int NUM_ENTITIES = (int)tree.getEntities().size();
+    waitForClockTick();
+
+    SimulatedClient<DenseTimestamps> client;
+    glm::vec3 position = tree.getCenter();
+    QCOMPARE(client.traverse(tree.getRoot(), position), NUM_ENTITIES);
+
+    // the next traversal finds that the client has everything, after which moving the view doesn't look at any
+    // entity again
+    waitForClockTick();
+    position += VIEW_STEP;
+    QCOMPARE(client.traverse(tree.getRoot(), position), NUM_ENTITIES);
+    waitForClockTick();
+    position += VIEW_STEP;
+    QCOMPARE(client.traverse(tree.getRoot(), position), 0);
+
+    // only the leaf of an entity that changed is looked at
+    tree.change(NUM_ENTITIES / 2);
+    waitForClockTick();
+    position += VIEW_STEP;
+    QCOMPARE(client.traverse(tree.getRoot(), position), ENTITIES_PER_LEAF);
+
+    // where everything is looked at every time without the summaries
+    SimulatedClient<PointerKeyedState> pointerKeyedClient;
+    position = tree.getCenter();
+    for (int i = 0; i < 3; i++) {
+        waitForClockTick();
+        position += VIEW_STEP;
+        QCOMPARE(pointerKeyedClient.traverse(tree.getRoot(), position), NUM_ENTITIES);
+    }
+}
+
+void EntitySentStateTests::benchmarkManyClients() {
+    TestTree tree;
+    const int NUM_ENTITIES = (int)tree.getEntities().size();
+    waitForClockTick();
+
+    // clients that were sent every entity, and then moved once
+    const int NUM_CLIENTS = 100;
+    size_t allocatedBefore = countedAllocatedBytes();
+    std::vector<std::unique_ptr<SimulatedClient<PointerKeyedState>>> pointerKeyedClients;
+    std::vector<std::unique_ptr<SimulatedClient<DenseTimestamps>>> denseClients;
+    glm::vec3 position = tree.getCenter();
+    for (int i = 0; i < NUM_CLIENTS; i++) {
+        pointerKeyedClients.emplace_back(new SimulatedClient<PointerKeyedState>());
+        pointerKeyedClients.back()->traverse(tree.getRoot(), position);
+        denseClients.emplace_back(new SimulatedClient<DenseTimestamps>());
+        denseClients.back()->traverse(tree.getRoot(), position);
+    }
+    waitForClockTick();
+    position += VIEW_STEP;
+    size_t denseBytes = 0;
+    for (int i = 0; i < NUM_CLIENTS; i++) {
+        pointerKeyedClients[i]->traverse(tree.getRoot(), position);
+        denseClients[i]->traverse(tree.getRoot(), position);
+        denseBytes += denseClients[i]->getMemoryUsage();
+    }
+    size_t pointerKeyedBytes = countedAllocatedBytes() - allocatedBefore;
+    qDebug() << "Entity server sent state for" << NUM_CLIENTS << "clients and" << NUM_ENTITIES << "entities:"
+             << "pointer keyed maps" << pointerKeyedBytes / 1024 << "KiB, dense tables" << denseBytes / 1024 << "KiB";
+    QVERIFY(2 * denseBytes < pointerKeyedBytes);
+
+    // the clients keep moving a little, with one entity changing each time
+    int step = 0;
+    int numPointerKeyedProbes = 0;
+    int numDenseProbes = 0;
+    QBENCHMARK {
+        tree.change((step * 7919) % NUM_ENTITIES);
+        ++step;
+        position += VIEW_STEP;
+        numPointerKeyedProbes = 0;
+        numDenseProbes = 0;
+        for (int i = 0; i < NUM_CLIENTS; i++) {
+            numPointerKeyedProbes += pointerKeyedClients[i]->traverse(tree.getRoot(), position);
+            numDenseProbes += denseClients[i]->traverse(tree.getRoot(), position);
+        }
+    }
+    qDebug() << "Entities looked at when" << NUM_CLIENTS << "clients moved: pointer keyed maps" << numPointerKeyedProbes
+             << "dense tables with subtree summaries" << numDenseProbes;
+    QVERIFY(numDenseProbes < numPointerKeyedProbes);
+}
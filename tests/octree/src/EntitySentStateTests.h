@@ -0,0 +1,26 @@
+//
+//  EntitySentStateTests.h
+//  tests/octree/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntitySentStateTests_h
+#define hifi_EntitySentStateTests_h
+
+#include <QtTest/QtTest>
+
+class EntitySentStateTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testDenseIndices();
+    void testDenseTimestamps();
+    void testReusedDenseIndices();
+    void testKnownSubtreesAreSkipped();
+    void benchmarkManyClients();
+};
+
+#endif // hifi_EntitySentStateTests_h
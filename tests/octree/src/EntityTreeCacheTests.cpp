@@ -0,0 +1,102 @@
+//
+//  EntityTreeCacheTests.cpp
+//  tests/octree/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityTreeCacheTests.h"
+
+#include <QtCore/QTemporaryDir>
+
+#include <EntityTreeCache.h>
+
+QTEST_MAIN(EntityTreeCacheTests)
+
+static EntityTreeCache::Manifest makeManifest(int numEntries) {
+    EntityTreeCache::Manifest manifest;
+    for (int i = 0; i < numEntries; ++i) {
+        EntityTreeCache::Version version;
+        // past 2^53, where these would lose precision as doubles
+        version.lastEdited = 1700000000000000ULL + i;
+        version.sentAt = 0x8000000000000000ULL + i;
+        manifest[QUuid::createUuid()] = version;
+    }
+    return manifest;
+}
+
+void EntityTreeCacheTests::testManifestRoundTrip() {
+    const int NUM_ENTRIES = 1000;
+    auto manifest = makeManifest(NUM_ENTRIES);
+
+    QByteArray data = EntityTreeCache::encodeManifest(manifest);
+
+    EntityTreeCache::Manifest decoded;
+    QVERIFY(EntityTreeCache::decodeManifest(data, decoded));
+    QCOMPARE(decoded.size(), NUM_ENTRIES);
+    QVERIFY(decoded == manifest);
+}
+
+void EntityTreeCacheTests::testEmptyManifest() {
+    EntityTreeCache::Manifest decoded = makeManifest(1);
+    QVERIFY(EntityTreeCache::decodeManifest(EntityTreeCache::encodeManifest(EntityTreeCache::Manifest()), decoded));
+    QVERIFY(decoded.isEmpty());
+
+    QVERIFY(!EntityTreeCache::decodeManifest(QByteArray(), decoded));
+}
+
+void EntityTreeCacheTests::testTruncatedManifest() {
+    QByteArray data = EntityTreeCache::encodeManifest(makeManifest(10));
+
+    // a manifest claiming more entries than it holds is rejected up front
+    EntityTreeCache::Manifest decoded;
+    QVERIFY(!EntityTreeCache::decodeManifest(data.left(data.size() - 1), decoded));
+    QVERIFY(decoded.isEmpty());
+}
+
+void EntityTreeCacheTests::testOversizedManifest() {
+    const int MAX_ENTRIES = EntityTreeCache::MAX_MANIFEST_ENTRIES;
+    EntityTreeCache::Manifest decoded;
+    QVERIFY(EntityTreeCache::decodeManifest(EntityTreeCache::encodeManifest(makeManifest(MAX_ENTRIES)), decoded));
+    QCOMPARE(decoded.size(), MAX_ENTRIES);
+
+    // rejected up front, even though the data is all there
+    QVERIFY(!EntityTreeCache::decodeManifest(EntityTreeCache::encodeManifest(makeManifest(MAX_ENTRIES + 1)), decoded));
+    QVERIFY(decoded.isEmpty());
+}
+
+void EntityTreeCacheTests::testPruneCacheFiles() {
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+
+    const int FILE_SIZE = 100;
+    const QStringList FILE_NAMES { "oldest.json.gz", "older.json.gz", "newest.json.gz" };
+    auto now = QDateTime::currentDateTime();
+    for (int i = 0; i < FILE_NAMES.size(); ++i) {
+        QFile file(directory.filePath(FILE_NAMES[i]));
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        QCOMPARE(file.write(QByteArray(FILE_SIZE, 'x')), (qint64)FILE_SIZE);
+        QVERIFY(file.flush());
+        QVERIFY(file.setFileTime(now.addSecs(i - FILE_NAMES.size()), QFileDevice::FileModificationTime));
+    }
+
+    // anything else in there is left alone
+    QFile otherFile(directory.filePath("other.txt"));
+    QVERIFY(otherFile.open(QIODevice::WriteOnly));
+    QCOMPARE(otherFile.write(QByteArray(10 * FILE_SIZE, 'x')), (qint64)10 * FILE_SIZE);
+    otherFile.close();
+
+    EntityTreeCache::pruneCacheFiles(directory.path(), 3 * FILE_SIZE);
+    QCOMPARE(QDir(directory.path()).entryList(QDir::Files).size(), 4);
+
+    EntityTreeCache::pruneCacheFiles(directory.path(), 2 * FILE_SIZE + FILE_SIZE / 2);
+    QVERIFY(!QFile::exists(directory.filePath("oldest.json.gz")));
+    QVERIFY(QFile::exists(directory.filePath("older.json.gz")));
+    QVERIFY(QFile::exists(directory.filePath("newest.json.gz")));
+
+    EntityTreeCache::pruneCacheFiles(directory.path(), 0);
+    QCOMPARE(QDir(directory.path()).entryList(QDir::Files), QStringList { "other.txt" });
+}
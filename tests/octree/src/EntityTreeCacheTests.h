@@ -0,0 +1,26 @@
+//
+//  EntityTreeCacheTests.h
+//  tests/octree/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntityTreeCacheTests_h
+#define hifi_EntityTreeCacheTests_h
+
+#include <QtTest/QtTest>
+
+class EntityTreeCacheTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testManifestRoundTrip();
+    void testEmptyManifest();
+    void testTruncatedManifest();
+    void testOversizedManifest();
+    void testPruneCacheFiles();
+};
+
+#endif // hifi_EntityTreeCacheTests_h
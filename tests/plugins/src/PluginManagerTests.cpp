@@ -0,0 +1,76 @@
+//
+//  PluginManagerTests.cpp
+//  tests/plugins/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PluginManagerTests.h"
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QPluginLoader>
+
+#include <DependencyManager.h>
+#include <NumericalConstants.h>
+#include <plugins/PluginManager.h>
+
+// a QCoreApplication, so the plugin manager runs as it does in the assignment clients
+QTEST_GUILESS_MAIN(PluginManagerTests)
+
+static const QStringList STUB_PLUGINS {
+    "StubScriptingPlugin", "StubCodecPlugin", "StubLegacyCodecPlugin", "StubGuiCodecPlugin", "StubInputPlugin"
+};
+
+// The stub libraries are built where the plugin manager looks for the plugins of this executable
+static QString getStubPath(const QString& name) {
+#if defined(Q_OS_MAC)
+    QDir pluginDir { QCoreApplication::applicationDirPath() + "/../PlugIns/" };
+#else
+    QDir pluginDir { QCoreApplication::applicationDirPath() + "/plugins/" };
+#endif
+    return pluginDir.absoluteFilePath(name);
+}
+
+// A library loaded by the plugin manager is shared with every loader of the same file
+static bool isStubLoaded(const QString& name) {
+    return QPluginLoader(getStubPath(name)).isLoaded();
+}
+
+void PluginManagerTests::initTestCase() {
+    DependencyManager::set<PluginManager>();
+    for (const auto& stub : STUB_PLUGINS) {
+        QVERIFY2(QPluginLoader(getStubPath(stub)).metaData().contains("IID"), qPrintable(stub + " was not built"));
+        QVERIFY(!isStubLoaded(stub));
+    }
+}
+
+void PluginManagerTests::testInstantiate() {
+    QElapsedTimer timer;
+    timer.start();
+    QCOMPARE(PluginManager::getInstance()->instantiate(), 1);
+    qDebug() << "Instantiated the plugins that provide nothing in" << timer.nsecsElapsed() / NSECS_PER_USEC << "us";
+
+    QVERIFY(isStubLoaded("StubScriptingPlugin"));
+    QVERIFY(!isStubLoaded("StubCodecPlugin"));
+    QVERIFY(!isStubLoaded("StubLegacyCodecPlugin"));
+    QVERIFY(!isStubLoaded("StubGuiCodecPlugin"));
+    QVERIFY(!isStubLoaded("StubInputPlugin"));
+}
+
+void PluginManagerTests::testCodecPlugins() {
+    QElapsedTimer timer;
+    timer.start();
+    // the stubs implement no provider interface, so they add no codecs
+    QVERIFY(PluginManager::getInstance()->getCodecPlugins().empty());
+    qDebug() << "Loaded the codec plugins in" << timer.nsecsElapsed() / NSECS_PER_USEC << "us";
+
+    QVERIFY(isStubLoaded("StubCodecPlugin"));
+    // from before capabilities were declared, so it loads as it always did
+    QVERIFY(isStubLoaded("StubLegacyCodecPlugin"));
+    // it needs a GUI, which this process doesn't have
+    QVERIFY(!isStubLoaded("StubGuiCodecPlugin"));
+    QVERIFY(!isStubLoaded("StubInputPlugin"));
+}
@@ -0,0 +1,28 @@
+//
+//  PluginManagerTests.h
+//  tests/plugins/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_PluginManagerTests_h
+#define hifi_PluginManagerTests_h
+
+#include <QtTest/QtTest>
+
+class PluginManagerTests : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase();
+
+    // Test that startup only instantiates the libraries that provide nothing
+    void testInstantiate();
+
+    // Test that asking for codecs only loads the codec libraries that work headless
+    void testCodecPlugins();
+};
+
+#endif // hifi_PluginManagerTests_h
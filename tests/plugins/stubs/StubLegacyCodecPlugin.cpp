@@ -0,0 +1,21 @@
+//
+//  StubLegacyCodecPlugin.cpp
+//  tests/plugins/stubs
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include <QtCore/QObject>
+#include <QtCore/QtPlugin>
+
+// Stub plugin library for PluginManagerTests: a codec from before plugins declared capabilities.
+// It only has to load, it implements no provider interface.
+class StubLegacyCodecPlugin : public QObject {
+    Q_OBJECT
+    Q_PLUGIN_METADATA(IID "com.highfidelity.plugins.codec" FILE "StubLegacyCodecPlugin.json")
+};
+
+#include "StubLegacyCodecPlugin.moc"
@@ -0,0 +1,170 @@
+//
+//  MultiViewCullTests.cpp
+//  tests/render/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "MultiViewCullTests.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <GLMHelpers.h>
+
+#include <render/MultiViewCull.h>
+
+QTEST_MAIN(MultiViewCullTests)
+
+using namespace render;
+
+// An orthographic view of the 20m wide, 100m deep box in front of position
+static ViewFrustumPointer makeFrustum(const glm::vec3& position) {
+    auto frustum = std::make_shared<ViewFrustum>();
+    frustum->setProjection(glm::ortho(-10.0f, 10.0f, -10.0f, 10.0f, 0.0f, 100.0f));
+    frustum->setPosition(position);
+    frustum->setOrientation(Quaternions::IDENTITY);
+    frustum->calculate();
+    return frustum;
+}
+
+static ItemBound makeItem(ItemID id, const glm::vec3& center, float size) {
+    return ItemBound(id, AABox(center - glm::vec3(0.5f * size), size));
+}
+
+// Items spread on a grid covering the views of a row of cascades
+static ItemBounds makeGrid(int numItems) {
+    ItemBounds items;
+    items.reserve(numItems);
+    for (int i = 0; i < numItems; i++) {
+        glm::vec3 center((float)(i % 64) * 2.0f - 64.0f, (float)((i / 64) % 16) - 8.0f, -(float)(i / 1024) - 1.0f);
+        items.push_back(makeItem(i, center, 0.5f + (float)(i % 7) * 0.25f));
+    }
+    return items;
+}
+
+static MultiViewCull::Views makeCascades(const glm::vec3& offset) {
+    MultiViewCull::Views views;
+    for (int i = 0; i < 4; i++) {
+        views[i].frustum = makeFrustum(offset + glm::vec3((float)i * 15.0f - 30.0f, 0.0f, 0.0f));
+        views[i].minSquareSize = 0.1f;
+        if (i > 1) {
+            views[i].antiFrustum = views[i - 2].frustum;
+        }
+    }
+    return views;
+}
+
+void MultiViewCullTests::testVisibility() {
+    MultiViewCull::Views views;
+    views[0].frustum = makeFrustum(glm::vec3(0.0f));
+    views[1].frustum = makeFrustum(glm::vec3(100.0f, 0.0f, 0.0f));
+    views[0].minSquareSize = views[1].minSquareSize = 0.01f;
+
+    ItemBounds items {
+        makeItem(1, glm::vec3(0.0f, 0.0f, -50.0f), 1.0f),
+        makeItem(2, glm::vec3(100.0f, 0.0f, -50.0f), 1.0f),
+        makeItem(3, glm::vec3(0.0f, 0.0f, -50.0f), 0.01f),
+        makeItem(4, glm::vec3(1000.0f, 0.0f, -50.0f), 1.0f),
+        makeItem(5, glm::vec3(50.0f, 0.0f, -50.0f), 100.0f)
+    };
+
+    MultiViewCull cull;
+    const auto& masks = cull.run(views, items);
+    QCOMPARE((int)masks.size(), 5);
+    QCOMPARE((int)masks[0], 0x1);
+    QCOMPARE((int)masks[1], 0x2);
+    QCOMPARE((int)masks[2], 0x0); // too small
+    QCOMPARE((int)masks[3], 0x0); // out of both views
+    QCOMPARE((int)masks[4], 0x3);
+    QCOMPARE(cull.getNumTests(), 10);
+}
+
+void MultiViewCullTests::testAntiFrustum() {
+    MultiViewCull::Views views;
+    views[0].frustum = makeFrustum(glm::vec3(0.0f));
+    views[1].frustum = makeFrustum(glm::vec3(5.0f, 0.0f, 0.0f));
+    views[1].antiFrustum = views[0].frustum;
+
+    ItemBounds items {
+        makeItem(1, glm::vec3(0.0f, 0.0f, -50.0f), 1.0f),
+        makeItem(2, glm::vec3(10.0f, 0.0f, -50.0f), 1.0f)
+    };
+
+    MultiViewCull cull;
+    const auto& masks = cull.run(views, items);
+    QCOMPARE((int)masks[0], 0x1); // entirely inside the anti frustum
+    QCOMPARE((int)masks[1], 0x3); // straddles it
+}
+
+void MultiViewCullTests::testReuse() {
+    MultiViewCull::Views views;
+    views[0].frustum = makeFrustum(glm::vec3(0.0f));
+    views[1].frustum = makeFrustum(glm::vec3(100.0f, 0.0f, 0.0f));
+
+    ItemBounds items {
+        makeItem(1, glm::vec3(0.0f, 0.0f, -50.0f), 1.0f),
+        makeItem(2, glm::vec3(100.0f, 0.0f, -50.0f), 1.0f),
+        makeItem(3, glm::vec3(200.0f, 0.0f, -50.0f), 1.0f)
+    };
+
+    MultiViewCull cull;
+    cull.run(views, items);
+    QCOMPARE(cull.getNumTests(), 6);
+
+    // nothing changed
+    auto masks = cull.run(views, items);
+    QCOMPARE(cull.getNumTests(), 0);
+    QCOMPARE((int)masks[0], 0x1);
+    QCOMPARE((int)masks[1], 0x2);
+
+    // one item moved into the first view, only it is tested again
+    items[2] = makeItem(3, glm::vec3(5.0f, 0.0f, -50.0f), 1.0f);
+    masks = cull.run(views, items);
+    QCOMPARE(cull.getNumTests(), 2);
+    QCOMPARE((int)masks[2], 0x1);
+
+    // the second view moved away, all the items are tested against it and only it
+    views[1].frustum = makeFrustum(glm::vec3(500.0f, 0.0f, 0.0f));
+    masks = cull.run(views, items);
+    QCOMPARE(cull.getNumTests(), 3);
+    QCOMPARE((int)masks[0], 0x1);
+    QCOMPARE((int)masks[1], 0x0);
+    QCOMPARE((int)masks[2], 0x1);
+
+    // a different item in the same place in the list isn't mistaken for the previous one
+    items[0] = makeItem(4, glm::vec3(100.0f, 0.0f, -50.0f), 1.0f);
+    masks = cull.run(views, items);
+    QCOMPARE(cull.getNumTests(), 2);
+    QCOMPARE((int)masks[0], 0x0);
+
+    // a disabled view is neither tested nor visible
+    views[1].frustum = nullptr;
+    masks = cull.run(views, items);
+    QCOMPARE(cull.getNumTests(), 0);
+    QCOMPARE((int)masks[2], 0x1);
+}
+
+void MultiViewCullTests::benchmarkMovingViews() {
+    const auto items = makeGrid(16 * 1024);
+    MultiViewCull cull;
+    float offset = 0.0f;
+    QBENCHMARK {
+        // every cascade follows the camera, so every item is tested against every cascade
+        offset += 0.01f;
+        cull.run(makeCascades(glm::vec3(offset, 0.0f, 0.0f)), items);
+    }
+}
+
+void MultiViewCullTests::benchmarkStillViews() {
+    const auto items = makeGrid(16 * 1024);
+    const auto views = makeCascades(glm::vec3(0.0f));
+    MultiViewCull cull;
+    cull.run(views, items);
+    QBENCHMARK {
+        cull.run(views, items);
+    }
+    QCOMPARE(cull.getNumTests(), 0);
+}
@@ -0,0 +1,27 @@
+//
+//  MultiViewCullTests.h
+//  tests/render/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_render_MultiViewCullTests_h
+#define hifi_render_MultiViewCullTests_h
+
+#include <QtTest/QtTest>
+
+class MultiViewCullTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testVisibility();
+    void testAntiFrustum();
+    void testReuse();
+    void benchmarkMovingViews();
+    void benchmarkStillViews();
+};
+
+#endif // hifi_render_MultiViewCullTests_h
@@ -0,0 +1,166 @@
+//
+//  FrameBudgetGovernorTests.cpp
+//  tests/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "FrameBudgetGovernorTests.h"
+
+#include <vector>
+
+#include <QtTest/QtTest>
+
+#include <FrameBudgetGovernor.h>
+
+QTEST_MAIN(FrameBudgetGovernorTests)
+
+static const float BUDGET = 16.0f; // msecs
+static const int NUM_LEVELS = 3;
+
+namespace {
+
+// Subsystems whose costs halve with each level they are lowered, in frames that also spend a fixed time elsewhere
+class SyntheticFrames {
+public:
+    SyntheticFrames() {
+        // avatars and entities cost the most, and picks are the most noticeable when lowered
+        _avatars = addSubsystem("avatars", 6.0f, 1.0f);
+        _entities = addSubsystem("entities", 4.0f, 1.0f);
+        _picks = addSubsystem("picks", 3.0f, 4.0f);
+    }
+
+    // runs frames until the given number of levels changed, or until numFrames were run
+    int run(int numFrames, int numChanges = -1) {
+        int changesBefore = _numChanges;
+        for (int frame = 0; frame < numFrames && _numChanges - changesBefore != numChanges; frame++) {
+            float frameTime = _fixedCost;
+            for (int i = 0; i < (int)_fullCosts.size(); i++) {
+                float cost = getCost(i);
+                governor.addCost(i, cost);
+                frameTime += cost;
+            }
+            governor.endFrame(frameTime, BUDGET);
+        }
+        return _numChanges - changesBefore;
+    }
+
+    float getFrameTime() const {
+        float frameTime = _fixedCost;
+        for (int i = 0; i < (int)_fullCosts.size(); i++) {
+            frameTime += getCost(i);
+        }
+        return frameTime;
+    }
+
+    void setFixedCost(float fixedCost) { _fixedCost = fixedCost; }
+    int getNumChanges() const { return _numChanges; }
+
+    FrameBudgetGovernor governor;
+    int _avatars;
+    int _entities;
+    int _picks;
+
+private:
+    int addSubsystem(const QString& name, float fullCost, float impact) {
+        int subsystem = governor.addSubsystem(name, NUM_LEVELS, impact, [this](int level) {
+            ++_numChanges;
+        });
+        _fullCosts.push_back(fullCost);
+        return subsystem;
+    }
+
+    float getCost(int subsystem) const { return _fullCosts[subsystem] / (float)(1 << governor.getLevel(subsystem)); }
+
+    std::vector<float> _fullCosts;
+    float _fixedCost { 10.0f };
+    int _numChanges { 0 };
+};
+
+const int MAX_FRAMES = 10000;
+
+}  // namespace
+
+void FrameBudgetGovernorTests::testDegradesMostCostEffectiveFirst() {
+    SyntheticFrames frames;
+    QCOMPARE(frames.getFrameTime(), 23.0f);
+
+    // nothing changes before the frame stays over budget for a while
+    QCOMPARE(frames.run(FrameBudgetGovernor::DEGRADE_FRAMES / 2), 0);
+
+    QCOMPARE(frames.run(MAX_FRAMES, 1), 1);
+    QCOMPARE(frames.governor.getLevel(frames._avatars), 1);
+    QCOMPARE(frames.governor.getLevel(frames._entities), 0);
+
+    // then whichever costs the most now
+    QCOMPARE(frames.run(MAX_FRAMES, 1), 1);
+    QCOMPARE(frames.governor.getLevel(frames._avatars), 1);
+    QCOMPARE(frames.governor.getLevel(frames._entities), 1);
+
+    QCOMPARE(frames.run(MAX_FRAMES, 1), 1);
+    QCOMPARE(frames.governor.getLevel(frames._avatars), 2);
+
+    QCOMPARE(frames.run(MAX_FRAMES, 1), 1);
+    QCOMPARE(frames.governor.getLevel(frames._entities), 2);
+
+    // the picks are never lowered, as lowering the others was enough
+    QVERIFY(frames.getFrameTime() < BUDGET);
+    QCOMPARE(frames.governor.getLevel(frames._picks), 0);
+}
+
+void FrameBudgetGovernorTests::testSettlesUnderBudget() {
+    SyntheticFrames frames;
+    frames.run(MAX_FRAMES);
+    QVERIFY(frames.getFrameTime() < BUDGET);
+    QCOMPARE(frames.getNumChanges(), 4);
+
+    // right under budget, which isn't enough room to raise anything back
+    QCOMPARE(frames.run(MAX_FRAMES), 0);
+    QVERIFY(frames.governor.getSmoothFrameTime() < BUDGET);
+    QVERIFY(frames.governor.getSmoothFrameTime() > FrameBudgetGovernor::RESTORE_RATIO * BUDGET);
+}
+
+void FrameBudgetGovernorTests::testRestoresWhenThereIsRoom() {
+    SyntheticFrames frames;
+    frames.run(MAX_FRAMES);
+
+    // with some room, the last lowered is raised first
+    frames.setFixedCost(4.0f);
+    QCOMPARE(frames.run(MAX_FRAMES, 1), 1);
+    QCOMPARE(frames.governor.getLevel(frames._entities), 1);
+    QCOMPARE(frames.governor.getLevel(frames._avatars), 2);
+
+    // and only what leaves the frame far enough under budget not to be lowered again
+    QCOMPARE(frames.run(MAX_FRAMES), 2);
+    QCOMPARE(frames.governor.getLevel(frames._avatars), 1);
+    QCOMPARE(frames.governor.getLevel(frames._entities), 0);
+    QVERIFY(frames.getFrameTime() < BUDGET);
+
+    // everything once there is room for it
+    frames.setFixedCost(0.0f);
+    QCOMPARE(frames.run(MAX_FRAMES), 1);
+    QCOMPARE(frames.governor.getLevel(frames._avatars), 0);
+    QCOMPARE(frames.governor.getLevel(frames._entities), 0);
+    QCOMPARE(frames.governor.getLevel(frames._picks), 0);
+}
+
+void FrameBudgetGovernorTests::testDisabled() {
+    SyntheticFrames frames;
+    frames.run(MAX_FRAMES);
+    QVERIFY(frames.governor.getLevel(frames._avatars) > 0);
+
+    frames.governor.setEnabled(false);
+    QCOMPARE(frames.governor.getLevel(frames._avatars), 0);
+    QCOMPARE(frames.governor.getLevel(frames._entities), 0);
+
+    // costs are still measured, but nothing is lowered
+    QCOMPARE(frames.run(MAX_FRAMES), 0);
+    QVERIFY(frames.governor.getCost(frames._avatars) > 5.0f);
+    QVERIFY(frames.governor.getSmoothFrameTime() > BUDGET);
+
+    frames.governor.setEnabled(true);
+    QVERIFY(frames.run(MAX_FRAMES) > 0);
+}
@@ -0,0 +1,25 @@
+//
+//  FrameBudgetGovernorTests.h
+//  tests/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_FrameBudgetGovernorTests_h
+#define hifi_FrameBudgetGovernorTests_h
+
+#include <QtCore/QObject>
+
+class FrameBudgetGovernorTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testDegradesMostCostEffectiveFirst();
+    void testSettlesUnderBudget();
+    void testRestoresWhenThereIsRoom();
+    void testDisabled();
+};
+
+#endif // hifi_FrameBudgetGovernorTests_h
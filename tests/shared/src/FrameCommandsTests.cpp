@@ -0,0 +1,116 @@
+//
+//  FrameCommandsTests.cpp
+//  tests/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "FrameCommandsTests.h"
+
+#include <thread>
+#include <vector>
+
+#include <QtTest/QtTest>
+
+#include <shared/FrameCommands.h>
+
+QTEST_MAIN(FrameCommandsTests)
+
+static const char LOOK_AT_COMMAND[] = "lookAt";
+static const char VOLUME_COMMAND[] = "volume";
+
+void FrameCommandsTests::testCoalescedCommands() {
+    hifi::FrameCommandQueue commands;
+    QStringList applied;
+
+    QVERIFY(commands.post(LOOK_AT_COMMAND, [&] { applied << "lookAt 1"; }));
+    QVERIFY(!commands.post(VOLUME_COMMAND, [&] { applied << "volume"; }));
+    commands.post([&] { applied << "release"; });
+    commands.post(LOOK_AT_COMMAND, [&] { applied << "lookAt 2"; });
+    commands.post(LOOK_AT_COMMAND, [&] { applied << "lookAt 3"; });
+    QVERIFY(applied.empty());
+
+    // the last look at replaces the others, and stays after the release that was posted before it
+    commands.apply();
+    QCOMPARE(applied, QStringList({ "volume", "release", "lookAt 3" }));
+
+    applied.clear();
+    commands.apply();
+    QVERIFY(applied.empty());
+
+    // commands posted while applying are applied the next time
+    QVERIFY(commands.post([&] {
+        applied << "first";
+        commands.post([&] { applied << "second"; });
+    }));
+    commands.apply();
+    QCOMPARE(applied, QStringList({ "first" }));
+    commands.apply();
+    QCOMPARE(applied, QStringList({ "first", "second" }));
+}
+
+void FrameCommandsTests::testCommandsFromThreads() {
+    hifi::FrameCommandQueue commands;
+    const int NUM_THREADS = 4;
+    const int NUM_COMMANDS = 1000;
+    int numApplied = 0;
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < NUM_THREADS; ++i) {
+        threads.emplace_back([&] {
+            for (int j = 0; j < NUM_COMMANDS; ++j) {
+                commands.post([&] { ++numApplied; });
+            }
+        });
+    }
+    while (numApplied < NUM_THREADS * NUM_COMMANDS) {
+        commands.apply();
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    commands.apply();
+    QCOMPARE(numApplied, NUM_THREADS * NUM_COMMANDS);
+}
+
+void FrameCommandsTests::testFrameSnapshot() {
+    hifi::FrameSnapshot<int> snapshot;
+    int numComputed = 0;
+    int source = 42;
+    auto compute = [&] {
+        ++numComputed;
+        return source;
+    };
+
+    // nobody asked yet
+    snapshot.update(compute);
+    QCOMPARE(numComputed, 0);
+
+    int value = 0;
+    QVERIFY(!snapshot.get(value));
+    snapshot.update(compute);
+    QCOMPARE(numComputed, 1);
+    QVERIFY(snapshot.get(value));
+    QCOMPARE(value, 42);
+
+    // asked for again, so published again by the next frame
+    source = 43;
+    snapshot.update(compute);
+    QCOMPARE(numComputed, 2);
+    QVERIFY(snapshot.get(value));
+    QCOMPARE(value, 43);
+
+    // a getter called rarely doesn't get the value of an older frame
+    snapshot.update(compute);
+    snapshot.update(compute);
+    source = 44;
+    snapshot.update(compute);
+    QCOMPARE(numComputed, 3);
+    QVERIFY(!snapshot.get(value));
+    snapshot.update(compute);
+    QVERIFY(snapshot.get(value));
+    QCOMPARE(value, 44);
+}
@@ -0,0 +1,24 @@
+//
+//  FrameCommandsTests.h
+//  tests/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_FrameCommandsTests_h
+#define hifi_FrameCommandsTests_h
+
+#include <QtCore/QObject>
+
+class FrameCommandsTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testCoalescedCommands();
+    void testCommandsFromThreads();
+    void testFrameSnapshot();
+};
+
+#endif // hifi_FrameCommandsTests_h
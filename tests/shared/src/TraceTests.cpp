@@ -11,6 +11,10 @@
 #include <QtTest/QtTest>
 #include <QtGui/QDesktopServices>
 
+#include <algorithm>
+#include <thread>
+
+#include <PerfStat.h>
 #include <Profile.h>
 
 #include <NumericalConstants.h>
@@ -45,3 +49,102 @@ void TraceTests::testTraceSerialization() {
     qDebug() << "Done";
 }
 
+
+void TraceTests::testTraceRecorder() {
+    using namespace tracing;
+    TraceRecorder::setSampleInterval(1);
+    TraceRecorder::clear();
+    for (size_t i = 0; i < 10; ++i) {
+        TRACE_SCOPE(test, "TestScope")
+    }
+    auto events = TraceRecorder::collect();
+    QCOMPARE((int)events.size(), 10);
+    QCOMPARE(events.front().name, QString("TestScope"));
+    QCOMPARE(events.front().type, Complete);
+    QVERIFY(events.front().extra.contains("dur"));
+
+    // only the newest events are kept, on each thread
+    TraceRecorder::clear();
+    for (uint32_t i = 0; i < 2 * TraceRecorder::RING_CAPACITY; ++i) {
+        TRACE_COUNTER(test, "TestCounter", i)
+    }
+    std::thread([] {
+        TRACE_SCOPE(test, "OtherThreadScope")
+    }).join();
+    // the newest counters, and the scope of the other thread
+    events = TraceRecorder::collect();
+    QCOMPARE((uint32_t)events.size(), TraceRecorder::RING_CAPACITY + 1);
+    auto counter = std::find_if(events.begin(), events.end(), [](const TraceEvent& event) {
+        return event.type == Counter;
+    });
+    QCOMPARE(counter->args["TestCounter"].toUInt(), TraceRecorder::RING_CAPACITY);
+
+    // several scopes in a block, and names built at runtime
+    TraceRecorder::clear();
+    {
+        TRACE_SCOPE(test, "FirstScope")
+        TRACE_SCOPE(test, "SecondScope")
+        std::string name = "Runtime";
+        ScopedTrace runtimeScope(trace_test(), name + "Scope");
+    }
+    events = TraceRecorder::collect();
+    QCOMPARE((int)events.size(), 3);
+    QCOMPARE(events.front().name, QString("RuntimeScope"));
+    QCOMPARE(events.back().name, QString("FirstScope"));
+
+    // one in four scopes
+    TraceRecorder::setSampleInterval(4);
+    TraceRecorder::clear();
+    for (size_t i = 0; i < 100; ++i) {
+        TRACE_SCOPE(test, "SampledScope")
+    }
+    QCOMPARE((int)TraceRecorder::collect().size(), 25);
+
+    TraceRecorder::setSampleInterval(0);
+    TraceRecorder::clear();
+    {
+        TRACE_SCOPE(test, "NotRecordedScope")
+    }
+    QVERIFY(TraceRecorder::collect().empty());
+}
+
+void TraceTests::testPerformanceTimer() {
+    PerformanceTimer::setActive(true);
+    auto timeNested = [] {
+        PerformanceTimer outerTimer("outer");
+        PerformanceTimer innerTimer(std::string("in") + "ner");
+        QCOMPARE(PerformanceTimer::getContextName(), QString("/outer/inner"));
+    };
+    timeNested();
+    std::thread(timeNested).join();
+    QCOMPARE(PerformanceTimer::getContextName(), QString(""));
+
+    PerformanceTimer::tallyAllTimerRecords();
+    auto records = PerformanceTimer::getAllTimerRecords();
+    QVERIFY(records.contains("/outer"));
+    QVERIFY(records.contains("/outer/inner"));
+    QCOMPARE(records["/outer/inner"].getCount(), (quint64)1);
+    PerformanceTimer::setActive(false);
+    QVERIFY(PerformanceTimer::getAllTimerRecords().empty());
+}
+
+void TraceTests::benchmarkTraceScope() {
+    using namespace tracing;
+    const int NUM_SCOPES = 100000;
+    for (uint32_t sampleInterval : { 0, 64, 1 }) {
+        TraceRecorder::setSampleInterval(sampleInterval);
+        auto start = usecTimestampNow();
+        for (int i = 0; i < NUM_SCOPES; ++i) {
+            TRACE_SCOPE(test, "BenchmarkScope")
+        }
+        auto duration = usecTimestampNow() - start;
+        qDebug() << "Sample interval" << sampleInterval << ":" << (float)(duration * 1000) / NUM_SCOPES << "ns per scope";
+    }
+    TraceRecorder::setSampleInterval(0);
+
+    QBENCHMARK {
+        for (int i = 0; i < NUM_SCOPES; ++i) {
+            TRACE_SCOPE(test, "BenchmarkScope")
+        }
+    }
+}
@@ -15,6 +15,9 @@ class TraceTests : public QObject {
     Q_OBJECT
 private slots:
     void testTraceSerialization();
+    void testTraceRecorder();
+    void testPerformanceTimer();
+    void benchmarkTraceScope();
 };
 
 #endif // hifi_TraceTests_h
@@ -48,6 +48,10 @@ ACClientApp::ACClientApp(int argc, char* argv[]) :
     const QCommandLineOption listenPortOption("listenPort", "listen port", QString::number(INVALID_PORT));
     parser.addOption(listenPortOption);
 
+    const QCommandLineOption reconnectsOption("reconnects", "once connected, reconnect this many times and report the latency",
+                                              "0");
+    parser.addOption(reconnectsOption);
+
     if (!parser.parse(QCoreApplication::arguments())) {
         qCritical() << parser.errorText() << endl;
         parser.showHelp();
@@ -87,6 +91,10 @@ ACClientApp::ACClientApp(int argc, char* argv[]) :
         listenPort = parser.value(listenPortOption).toInt();
     }
 
+    if (parser.isSet(reconnectsOption)) {
+        _reconnectsLeft = parser.value(reconnectsOption).toInt();
+    }
+
     if (parser.isSet(authOption)) {
         QStringList pieces = parser.value(authOption).split(":");
         if (pieces.size() != 2) {
@@ -155,12 +163,13 @@ ACClientApp::ACClientApp(int argc, char* argv[]) :
         accountManager->requestAccessToken(_username, _password);
     }
 
+    _connectTimer.start();
     DependencyManager::get<AddressManager>()->handleLookupString(domainServerAddress, false);
 
-    QTimer* doTimer = new QTimer(this);
-    doTimer->setSingleShot(true);
-    connect(doTimer, &QTimer::timeout, this, &ACClientApp::timedOut);
-    doTimer->start(4000);
+    _timeoutTimer = new QTimer(this);
+    _timeoutTimer->setSingleShot(true);
+    connect(_timeoutTimer, &QTimer::timeout, this, &ACClientApp::timedOut);
+    _timeoutTimer->start(4000);
 }
 
 ACClientApp::~ACClientApp() {
@@ -216,6 +225,19 @@ void ACClientApp::nodeActivated(SharedNodePointer node) {
     }
 
     if (_sawEntityServer && _sawAudioMixer && _sawAvatarMixer && _sawAssetServer && _sawMessagesMixer) {
+        auto nodeList = DependencyManager::get<NodeList>();
+        if (_previousSessionID.isNull()) {
+            qDebug() << "connected in" << _connectTimer.elapsed() << "msec";
+        } else {
+            qDebug() << "reconnected in" << _connectTimer.elapsed() << "msec"
+                << (nodeList->getSessionUUID() == _previousSessionID ? "(session resumed)" : "(new session)");
+        }
+
+        if (_reconnectsLeft > 0) {
+            reconnect();
+            return;
+        }
+
         if (_verbose) {
             qDebug() << "success";
         }
@@ -223,6 +245,26 @@ void ACClientApp::nodeActivated(SharedNodePointer node) {
     }
 }
 
+void ACClientApp::reconnect() {
+    --_reconnectsLeft;
+
+    _sawEntityServer = false;
+    _sawAudioMixer = false;
+    _sawAvatarMixer = false;
+    _sawAssetServer = false;
+    _sawMessagesMixer = false;
+
+    auto nodeList = DependencyManager::get<NodeList>();
+    _previousSessionID = nodeList->getSessionUUID();
+
+    _connectTimer.restart();
+    _timeoutTimer->start(4000);
+
+    // drop everything we know about the domain, then check in right away instead of waiting for the timer
+    nodeList->reset("Reconnect requested");
+    QMetaObject::invokeMethod(nodeList.data(), "sendDomainServerCheckIn");
+}
+
 void ACClientApp::nodeKilled(SharedNodePointer node) {
     qDebug() << "nodeKilled";
 }
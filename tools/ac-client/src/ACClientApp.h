@@ -14,6 +14,8 @@
 #define hifi_ACClientApp_h
 
 #include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QTimer>
 #include <udt/Constants.h>
 #include <udt/Socket.h>
 #include <ReceivedMessage.h>
@@ -40,8 +42,16 @@ private:
     void timedOut();
     void printFailedServers();
     void finish(int exitCode);
+    void reconnect();
     bool _verbose;
 
+    QTimer* _timeoutTimer { nullptr };
+
+    // measures how long it takes to reach every assignment again after dropping the domain connection
+    int _reconnectsLeft { 0 };
+    QElapsedTimer _connectTimer;
+    QUuid _previousSessionID;
+
     bool _sawEntityServer { false };
     bool _sawAudioMixer { false };
     bool _sawAvatarMixer { false };
@@ -18,6 +18,7 @@
 #include <udt/PacketList.h>
 
 #include <LogHandler.h>
+#include <SharedUtil.h>
 
 const QCommandLineOption PORT_OPTION { "p", "listening port for socket (defaults to random)", "port", 0 };
 const QCommandLineOption TARGET_OPTION {
@@ -56,14 +57,37 @@ const QCommandLineOption STATS_INTERVAL {
     "stats-interval", "stats output interval (default is 100ms)", "milliseconds"
 };
 
+const QCommandLineOption ACK_EVERY_PACKET {
+    "ack-every-packet", "acknowledge every received reliable packet (default is to coalesce ACKs)"
+};
+const QCommandLineOption LOSS_PERCENT {
+    "loss", "percentage of received data packets to drop, to emulate a lossy link (default is 0)", "percent"
+};
+const QCommandLineOption EMULATED_MTU {
+    "mtu", "emulate a path to the target whose MTU allows UDP payloads of this size: larger MTU probes are lost and "
+    "larger packets are counted as fragmented (default is the real path)", "bytes"
+};
+
+const QCommandLineOption PROBE_INTERVAL {
+    "probe-interval", "interval between small latency probe messages sent alongside ordered data (default is off)",
+    "milliseconds"
+};
+const QCommandLineOption PROBE_PRIORITY {
+    "probe-priority", "send priority for latency probes: control, interactive or bulk (default is interactive)", "priority"
+};
+
+// leading marker of probe messages, followed by the send timestamp - the receiver measures latency from it,
+// so sender and receiver should share a clock (i.e. run on the same machine)
+static const quint64 PROBE_MARKER = 0x50524f4245505242;
+
 const QStringList CLIENT_STATS_TABLE_HEADERS {
     "Send (Mb/s)", "Est. Max (Mb/s)", "RTT (ms)", "CW (P)", "Period (us)",
-    "Recv ACK", "Procd ACK", "Sent Packets", "Re-sent Packets"
+    "Recv ACK", "Procd ACK", "Sent Packets", "Re-sent Packets", "Pkt Size", "Fragmented (P)"
 };
 
 const QStringList SERVER_STATS_TABLE_HEADERS {
     "  Mb/s  ", "Recv Mb/s", "Est. Max (Mb/s)", "RTT (ms)", "CW (P)",
-    "Sent ACK", "Duplicates (P)"
+    "Sent ACK", "ACK/P", "Goodput (Mb/s)", "Duplicates (P)", "Probe Avg (ms)", "Probe Max (ms)"
 };
 
 UDTTest::UDTTest(int& argc, char** argv) :
@@ -155,6 +179,42 @@ UDTTest::UDTTest(int& argc, char** argv) :
     }
     
     
+    if (_argumentParser.isSet(PROBE_INTERVAL)) {
+        if (_argumentParser.isSet(ORDERED_PACKETS)) {
+            _probeInterval = _argumentParser.value(PROBE_INTERVAL).toInt();
+        } else {
+            qWarning() << "probe-interval has no effect if not sending ordered - it will be ignored";
+        }
+    }
+
+    if (_argumentParser.isSet(PROBE_PRIORITY)) {
+        QString priority = _argumentParser.value(PROBE_PRIORITY).toLower();
+        if (priority == "control") {
+            _probePriority = PacketPriority::Control;
+        } else if (priority == "bulk") {
+            _probePriority = PacketPriority::Bulk;
+        } else if (priority != "interactive") {
+            qWarning() << "Unknown probe-priority" << priority << "- using interactive";
+        }
+    }
+
+    if (_argumentParser.isSet(ACK_EVERY_PACKET)) {
+        _socket.setCoalesceACKs(false);
+    }
+
+    if (_argumentParser.isSet(EMULATED_MTU)) {
+        _socket.setEmulatedMTU(_argumentParser.value(EMULATED_MTU).toInt());
+    }
+
+    if (_argumentParser.isSet(LOSS_PERCENT)) {
+        int lossPercent = _argumentParser.value(LOSS_PERCENT).toInt();
+        qDebug() << "Dropping" << QString("%1%").arg(lossPercent) << "of received data packets";
+
+        _socket.setPacketFilterOperator([lossPercent](const udt::Packet& packet) {
+            return rand() % 100 >= lossPercent;
+        });
+    }
+
     // in case we're an ordered sender or receiver setup our random number generator now
     static const int FIRST_MESSAGE_SEED = 742272;
     
@@ -169,6 +229,12 @@ UDTTest::UDTTest(int& argc, char** argv) :
     
     if (!_target.isNull()) {
         sendInitialPackets();
+
+        if (_probeInterval > 0) {
+            QTimer* probeTimer = new QTimer(this);
+            connect(probeTimer, &QTimer::timeout, this, &UDTTest::sendProbe);
+            probeTimer->start(_probeInterval);
+        }
     } else {
         // this is a receiver - in case there are ordered packets (messages) being sent to us make sure that we handle them
         // so that they can be verified
@@ -224,7 +290,8 @@ void UDTTest::parseArguments() {
     _argumentParser.addOptions({
         PORT_OPTION, TARGET_OPTION, PACKET_SIZE, MIN_PACKET_SIZE, MAX_PACKET_SIZE,
         MAX_SEND_BYTES, MAX_SEND_PACKETS, UNRELIABLE_PACKETS, ORDERED_PACKETS,
-        MESSAGE_SIZE, MESSAGE_SEED, STATS_INTERVAL
+        MESSAGE_SIZE, MESSAGE_SEED, STATS_INTERVAL, PROBE_INTERVAL, PROBE_PRIORITY,
+        ACK_EVERY_PACKET, LOSS_PERCENT, EMULATED_MTU
     });
     
     if (!_argumentParser.parse(arguments())) {
@@ -291,6 +358,7 @@ void UDTTest::sendPacket() {
         if (call++ % refillCount == 0) {
             // construct a reliable and ordered packet list
             auto packetList = udt::PacketList::create(PacketType::BulkAvatarData, QByteArray(), true, true);
+            packetList->setPriority(PacketPriority::Bulk);
             
             // fill the packet list with random data according to the constant seed (so receiver can verify)
             for (int i = 0; i < messageSizePackets; ++i) {
@@ -306,6 +374,9 @@ void UDTTest::sendPacket() {
             }
             
             packetList->closeCurrentPacket();
+
+            // use the largest packets path MTU discovery found so far
+            packetList->resegment(_socket.getMaxPacketSize(_target));
             
             _totalQueuedBytes += (int)packetList->getDataSize();
             _totalQueuedPackets += (int)packetList->getNumPackets();
@@ -331,7 +402,43 @@ void UDTTest::sendPacket() {
     
 }
 
+void UDTTest::sendProbe() {
+    auto packetList = udt::PacketList::create(PacketType::Unknown, QByteArray(), true, true);
+    packetList->setPriority(_probePriority);
+
+    quint64 now = usecTimestampNow();
+    packetList->write(reinterpret_cast<const char*>(&PROBE_MARKER), sizeof(PROBE_MARKER));
+    packetList->write(reinterpret_cast<const char*>(&now), sizeof(now));
+    packetList->closeCurrentPacket();
+
+    _socket.writePacketList(std::move(packetList), _target);
+}
+
+bool UDTTest::handleProbe(const QByteArray& data) {
+    if (data.size() != (int)(sizeof(PROBE_MARKER) + sizeof(quint64))
+        || memcmp(data.constData(), &PROBE_MARKER, sizeof(PROBE_MARKER)) != 0) {
+        return false;
+    }
+
+    quint64 sentTime;
+    memcpy(&sentTime, data.constData() + sizeof(PROBE_MARKER), sizeof(sentTime));
+
+    quint64 now = usecTimestampNow();
+    quint64 latency = now > sentTime ? now - sentTime : 0;
+
+    _probeLatencySum += latency;
+    _probeLatencyMax = std::max(_probeLatencyMax, latency);
+    ++_probeCount;
+
+    return true;
+}
+
 void UDTTest::handleMessage(std::unique_ptr<Message> message) {
+    if (handleProbe(message->data)) {
+        // probes are interleaved with the seeded messages and don't consume random values
+        return;
+    }
+
     // generate the byte array that should match this message - using the same seed the sender did
     
     int packetSize = udt::Packet::maxPayloadSize(true);
@@ -386,7 +493,9 @@ void UDTTest::sampleStats() {
             QString::number(stats.events[udt::ConnectionStats::Stats::ReceivedACK]).rightJustified(CLIENT_STATS_TABLE_HEADERS[++headerIndex].size()),
             QString::number(stats.events[udt::ConnectionStats::Stats::ProcessedACK]).rightJustified(CLIENT_STATS_TABLE_HEADERS[++headerIndex].size()),
             QString::number(stats.sentPackets).rightJustified(CLIENT_STATS_TABLE_HEADERS[++headerIndex].size()),
-            QString::number(stats.retransmittedPackets).rightJustified(CLIENT_STATS_TABLE_HEADERS[++headerIndex].size())
+            QString::number(stats.retransmittedPackets).rightJustified(CLIENT_STATS_TABLE_HEADERS[++headerIndex].size()),
+            QString::number(_socket.getMaxPacketSize(_target)).rightJustified(CLIENT_STATS_TABLE_HEADERS[++headerIndex].size()),
+            QString::number(_socket.getNumEmulatedFragmentedDatagrams()).rightJustified(CLIENT_STATS_TABLE_HEADERS[++headerIndex].size())
         };
         
         // output this line of values
@@ -405,6 +514,9 @@ void UDTTest::sampleStats() {
             int headerIndex = -1;
             
             double megabitsPerSecond = (stats.receivedBytes * MEGABITS_PER_BYTE * MS_PER_SECOND) / _statsInterval;
+            double goodputMegabitsPerSecond = (stats.receivedUtilBytes * MEGABITS_PER_BYTE * MS_PER_SECOND) / _statsInterval;
+            double acksPerPacket = stats.receivedPackets > 0 ?
+                (double)stats.events[udt::ConnectionStats::Stats::SentACK] / stats.receivedPackets : 0.0;
             
             // setup a list of left justified values
             QStringList values {
@@ -414,8 +526,16 @@ void UDTTest::sampleStats() {
                 QString::number(stats.rtt / USECS_PER_MSEC, 'f', 2).rightJustified(SERVER_STATS_TABLE_HEADERS[++headerIndex].size()),
                 QString::number(stats.congestionWindowSize).rightJustified(SERVER_STATS_TABLE_HEADERS[++headerIndex].size()),
                 QString::number(stats.events[udt::ConnectionStats::Stats::SentACK]).rightJustified(SERVER_STATS_TABLE_HEADERS[++headerIndex].size()),
-                QString::number(stats.events[udt::ConnectionStats::Stats::Duplicate]).rightJustified(SERVER_STATS_TABLE_HEADERS[++headerIndex].size())
+                QString::number(acksPerPacket, 'f', 2).rightJustified(SERVER_STATS_TABLE_HEADERS[++headerIndex].size()),
+                QString::number(goodputMegabitsPerSecond, 'f', 2).rightJustified(SERVER_STATS_TABLE_HEADERS[++headerIndex].size()),
+                QString::number(stats.events[udt::ConnectionStats::Stats::Duplicate]).rightJustified(SERVER_STATS_TABLE_HEADERS[++headerIndex].size()),
+                QString::number(_probeCount > 0 ? (double)_probeLatencySum / _probeCount / USECS_PER_MSEC : 0.0, 'f', 2).rightJustified(SERVER_STATS_TABLE_HEADERS[++headerIndex].size()),
+                QString::number((double)_probeLatencyMax / USECS_PER_MSEC, 'f', 2).rightJustified(SERVER_STATS_TABLE_HEADERS[++headerIndex].size())
             };
+
+            _probeLatencySum = 0;
+            _probeLatencyMax = 0;
+            _probeCount = 0;
             
             // output this line of values
             qDebug() << qPrintable(values.join(" | "));
@@ -38,10 +38,12 @@ public:
 public slots:
     void refillPacket() { sendPacket(); } // adds a new packet to the queue when we are told one is sent
     void sampleStats();
+    void sendProbe(); // sends a small interactive message used to measure latency under load
     
 private:
     void parseArguments();
     void handleMessage(std::unique_ptr<Message> message);
+    bool handleProbe(const QByteArray& data);
     
     void sendInitialPackets(); // fills the queue with packets to start
     void sendPacket(); // constructs and sends a packet according to the test parameters
@@ -71,6 +73,12 @@ private:
     int _totalQueuedBytes { 0 }; // keeps track of the number of bytes we have already queued
     
     int _statsInterval { 100 }; // recording interval for stats in milliseconds
+
+    int _probeInterval { 0 }; // interval between latency probes in milliseconds, 0 if disabled
+    PacketPriority _probePriority { PacketPriority::Interactive };
+    quint64 _probeLatencySum { 0 }; // sum of probe latencies received since last stats sample in microseconds
+    quint64 _probeLatencyMax { 0 }; // max probe latency received since last stats sample in microseconds
+    int _probeCount { 0 }; // number of probes received since last stats sample
 };
 
 #endif // hifi_UDTTest_h